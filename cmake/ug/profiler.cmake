@@ -36,6 +36,10 @@ if( NOT "${PROFILER}" STREQUAL "Shiny" AND SHINY_CALL_LOGGING)
     message(FATAL_ERROR " Shiny Call Logging activated but not Shiny. Use cmake -DPROFILER=Shiny ..")
 endif( NOT "${PROFILER}" STREQUAL "Shiny" AND SHINY_CALL_LOGGING)
 
+if( NOT "${PROFILER}" STREQUAL "Shiny" AND SHINY_HW_COUNTERS)
+    message(FATAL_ERROR " Shiny hardware counters activated but not Shiny. Use cmake -DPROFILER=Shiny ..")
+endif( NOT "${PROFILER}" STREQUAL "Shiny" AND SHINY_HW_COUNTERS)
+
 
 if(NOT "${PROFILER}" STREQUAL "None")
     if("${PROFILER}" STREQUAL "Shiny")
@@ -47,6 +51,15 @@ if(NOT "${PROFILER}" STREQUAL "None")
         	add_definitions(-DSHINY_CALL_LOGGING)
         	message(" -- Info: Shiny Call Logging activated.")
         endif(SHINY_CALL_LOGGING)
+
+        if(SHINY_HW_COUNTERS)
+            if(CMAKE_SYSTEM_NAME STREQUAL "Linux")
+                add_definitions(-DUG_HW_COUNTERS)
+                message(" -- Info: Shiny hardware performance counters activated.")
+            else()
+                message(WARNING "SHINY_HW_COUNTERS is only supported on Linux. Ignoring it.")
+            endif()
+        endif(SHINY_HW_COUNTERS)
              	
         
     # Scalasca
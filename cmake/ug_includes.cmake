@@ -168,6 +168,7 @@ option(DEBUG_LOGS "Enables debug output. Valid options are: ON, OFF" OFF)
 option(PARALLEL "Enables parallel compilation. Valid options are: ON, OFF" ${MPI_FOUND})
 option(PROFILE_PCL "Enables profiling of the pcl-library. Valid options are ON, OFF" OFF)
 option(SHINY_CALL_LOGGING "Enables Call Logging for Shiny. Valid options are ON, OFF" OFF)
+option(SHINY_HW_COUNTERS "Enables hardware performance counters (Linux perf_event) for Shiny profile nodes. Valid options are ON, OFF" OFF)
 option(PROFILE_BRIDGE "Enables profiling of bridge objects. Valid options are ON, OFF" OFF)
 option(PCL_DEBUG_BARRIER "Enables debug barriers in the pcl-library. Valid options are ON, OFF" OFF)
 option(LAPACK "Lapack won't be used, even if available. Valid options are ON, OFF" ${lapackDefault})
@@ -184,6 +185,7 @@ option(POSIX "If enabled and available, some additional functionality may be ava
 option(CRS_ALGEBRA "Use the CRS Sparse Matrix" OFF)
 option(CPU_ALGEBRA "Use the old CPU Sparse Matrix" ON)
 option(INTERNAL_MEMTRACKER "Internal Memory Tracker" OFF)
+option(BENCHMARKS "Builds the ugbench executable (requires algebra and disc, e.g. TARGET=ugshell). Valid options are ON, OFF" OFF)
 
 if(APPLE)
 	option(USE_LUA2C "Use LUA2C" ON)
@@ -271,6 +273,7 @@ message(STATUS "Info: EMBEDDED_PLUGINS   ${EMBEDDED_PLUGINS} (options are: ON, O
 message(STATUS "Info: COMPILE_INFO       ${COMPILE_INFO} (options are: ON, OFF)")
 message(STATUS "Info: USE_LUA2C          ${USE_LUA2C} (options are: ON, OFF)")
 message(STATUS "Info: USE_LUAJIT         ${USE_LUAJIT} (options are: ON, OFF)")
+message(STATUS "Info: BENCHMARKS         ${BENCHMARKS} (options are: ON, OFF)")
 message(STATUS "")
 message(STATUS "Info: External libraries (path which contains the library or ON if you used uginstall):")
 message(STATUS "Info: TETGEN:   ${TETGEN}")
@@ -0,0 +1,110 @@
+-- Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+-- Author: agent
+-- 
+-- This file is part of UG4.
+-- 
+-- UG4 is free software: you can redistribute it and/or modify it under the
+-- terms of the GNU Lesser General Public License version 3 (as published by the
+-- Free Software Foundation) with the following additional attribution
+-- requirements (according to LGPL/GPL v3 §7):
+-- 
+-- (1) The following notice must be displayed in the Appropriate Legal Notices
+-- of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+-- 
+-- (2) The following notice must be displayed at a prominent place in the
+-- terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+-- 
+-- (3) The following bibliography is recommended for citation and must be
+-- preserved in all covered files:
+-- "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+--   parallel geometric multigrid solver on hierarchically distributed grids.
+--   Computing and visualization in science 16, 4 (2013), 151-164"
+-- "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+--   flexible software system for simulating pde based models on high performance
+--   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+-- 
+-- This program is distributed in the hope that it will be useful,
+-- but WITHOUT ANY WARRANTY; without even the implied warranty of
+-- MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+-- GNU Lesser General Public License for more details.
+
+--[[!
+\addtogroup scripts_util
+\{
+\file file_io_benchmark.lua
+\author Sebastian Reiter
+\brief compares the legacy and the current ASCII number parser of the ugx reader
+
+Parses the vertex and element blocks of the ugx file given through -grid
+several times, once through std::istringstream as done by the ugx reader before
+ParseNumberBlock was introduced and once through ParseNumberBlock. The average
+parse times, the achieved throughputs and the speedup are printed.
+
+ParseNumberBlock parses large blocks on multiple threads if ug was built
+with OpenMP. Run the script with different values of OMP_NUM_THREADS to
+measure the scalability of the parser, e.g.
+
+	OMP_NUM_THREADS=8 ugshell -ex file_io_benchmark.lua -grid big.ugx
+]]--
+
+ug_load_script("ug_util.lua")
+
+local gridName	= util.GetParam("-grid", "grid.ugx",
+								"the ugx file whose number blocks shall be parsed")
+local numReps	= util.GetParamNumber("-reps", 3, "number of times the file is parsed")
+
+util.CheckAndPrintHelp("File IO Benchmark")
+
+--	returns the size of the given file in MB
+local function FileSizeMB(fileName)
+	local f = io.open(fileName, "rb")
+	if f == nil then return 0 end
+	local size = f:seek("end")
+	f:close()
+	return size / (1024 * 1024)
+end
+
+--	parses the number blocks of the given file numReps times and returns the
+--	average time in seconds and the number of parsed values
+local function BenchmarkParse(fileName, legacyParser)
+	local totalTime = 0
+	local numVals = 0
+	for i = 1, numReps do
+		local tStart = GetClockS()
+		numVals = ParseUGXNumberBlocks(fileName, legacyParser)
+		totalTime = totalTime + GetClockS() - tStart
+	end
+	return totalTime / numReps, numVals
+end
+
+local function PrintResult(name, time, sizeMB)
+	print(string.format("  %-20s %10.3f s %10.1f MB/s", name, time, sizeMB / time))
+end
+
+if string.sub(gridName, -4) ~= ".ugx" then
+	print("ERROR: Only .ugx files are supported.")
+	exit()
+end
+
+local sizeMB = FileSizeMB(gridName)
+print("")
+print(string.format("Parsing %s (%.2f MB, %d repetitions)", gridName, sizeMB, numReps))
+local tLegacy, numValsLegacy = BenchmarkParse(gridName, true)
+local tCurrent, numValsCurrent = BenchmarkParse(gridName, false)
+
+if numValsLegacy ~= numValsCurrent then
+	print("ERROR: The parsers read different numbers of values: "
+		  .. numValsLegacy .. " (legacy) vs. " .. numValsCurrent .. " (current)")
+	exit()
+end
+
+print("  " .. numValsCurrent .. " values parsed")
+print("")
+print("Average parse times:")
+PrintResult("istringstream", tLegacy, sizeMB)
+PrintResult("ParseNumberBlock", tCurrent, sizeMB)
+print(string.format("  speedup: %.2f", tLegacy / tCurrent))
+
+--[[!
+\}
+]]--
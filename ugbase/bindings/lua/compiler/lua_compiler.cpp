@@ -36,9 +36,11 @@
 #include "bindings/lua/lua_stack_check.h"
 #include "bindings/lua/info_commands.h"
 #include "common/util/file_util.h"
+#include "common/util/string_util.h"
 #include <fstream>
 #include <stdio.h>
 #include <stdlib.h>
+#include <ctype.h>
 #include <unistd.h>
 #include "lua_compiler.h"
 #include "lua_compiler_debug.h"
@@ -50,6 +52,7 @@ namespace ug{
 
 extern bool useLua2VM;
 extern bool useLuaCompiler;
+extern std::string lua2cCacheDirectory;
 
 DebugID DID_LUACOMPILER("LUACompiler");
 
@@ -67,16 +70,17 @@ bool LUACompiler::create(const char *functionName, LuaFunctionHandle* pHandle)
 bool LUACompiler::createC(const char *functionName, LuaFunctionHandle* pHandle)
 {
 #ifdef USE_LUA2C
-	PROFILE_BEGIN_GROUP(LUACompiler_createVM, "LUA2C");
+	PROFILE_BEGIN_GROUP(LUACompiler_createC, "LUA2C");
 	UG_DLOG(DID_LUACOMPILER, 1, "LUA2C: parsing " << functionName << "... ");
 	try{
 		m_f=NULL;
+		m_fBatch=NULL;
 		LUAParserClass parser;
 		int ret = 0;
 		if(pHandle == NULL){
-			parser.parse_luaFunction(functionName);
+			ret = parser.parse_luaFunction(functionName);
 		} else {
-			parser.parse_luaFunction(*pHandle);
+			ret = parser.parse_luaFunction(*pHandle);
 		}
 		if(ret == LUAParserClass::LUAParserError)
 		{
@@ -89,19 +93,23 @@ bool LUACompiler::createC(const char *functionName, LuaFunctionHandle* pHandle)
 			return false;
 		}
 		//parser.reduce();
-	
-		string p = PathProvider::get_path(ROOT_PATH) + "/bin/LUACompiler_tmp/";
 
-		if(!DirectoryExists(p))
-			CreateDirectory(p);
-
-		fstream out((p + "LUACompiler_output.c").c_str(), fstream::out);
-	
-		out << "#include <math.h>\n";
-		out << "#define true 1\n";
-		out << "#define false 0\n";
-
-		ret = parser.createC(out);
+	//	the C symbol has to be a valid identifier, also for namespaced
+	//	functions ("a.b") and functions given by handle
+		string symbol = string("LUA2C_") + functionName;
+		for(size_t i = 6; i < symbol.size(); ++i)
+			if(!isalnum((unsigned char)symbol[i])) symbol[i] = '_';
+		parser.set_name(symbol.c_str());
+
+	//	generate the C source. Globals are inserted as constants, so they
+	//	have to be written with full precision.
+		stringstream src;
+		src.precision(17);
+		src << "#include <math.h>\n";
+		src << "#define true 1\n";
+		src << "#define false 0\n";
+
+		ret = parser.createC(src);
 		if(ret != LUAParserClass::LUAParserOK)
 		{
 			UG_DLOG(DID_LUACOMPILER, 1, "some problem when generating C code.\n");
@@ -110,68 +118,92 @@ bool LUACompiler::createC(const char *functionName, LuaFunctionHandle* pHandle)
 
 		m_iIn = parser.num_in();
 		m_iOut = parser.num_out();
-		out.close();
 
-		UG_DLOG(DID_LUACOMPILER, 5, GetFileLines((p+"LUACompiler_output.c").c_str(), 1, -1, true) << "\n");
+	//	batched entry point: evaluates n points stored consecutively in 'in'
+		src << "\nint " << symbol << "_batch(int LUA2C_n, "
+				"double *LUA2C_ret, const double *LUA2C_in)\n"
+			<< "{\n"
+			<< "\tint i;\n"
+			<< "\tfor(i = 0; i < LUA2C_n; ++i)\n"
+			<< "\t\t" << symbol << "(LUA2C_ret + i*" << m_iOut
+					<< ", LUA2C_in + i*" << m_iIn << ");\n"
+			<< "\treturn 1;\n"
+			<< "}\n";
+
+	//	the compiled library is cached. Its name contains a hash of the source
+	//	and the compile line, so that changed functions (or changed globals)
+	//	are recompiled automatically.
+	#ifdef __APPLE__
+		const char* linkFlag = "-dynamiclib";
+		const char* libExt = ".dylib";
+	#else
+		const char* linkFlag = "-shared";
+		const char* libExt = ".so";
+	#endif
+		const string compileFlags = string("gcc -fpic -O3 ") + linkFlag;
+		const string code = src.str();
+		const size_t hash = hash_key<string>(compileFlags + code);
+
+		string p = lua2cCacheDirectory;
+		if(p.empty())
+			p = PathProvider::get_path(ROOT_PATH) + "/bin/LUACompiler_cache";
+		p += "/";
+		if(!DirectoryExists(p))
+			CreateDirectory(p);
 
+		m_name = functionName;
+		m_pDyn = mkstr(p << symbol << "_" << hex << hash << libExt);
 
-		string c1s=string("gcc -fpic -O3 -c ") + p + "LUACompiler_output.c -o " + p + "LUACompiler_output.o";
-		UG_DLOG(DID_LUACOMPILER, 2, "compiling line: " << c1s << "\n");
-		if(system(c1s.c_str()) != 0)
-		{
-//			IF_DEBUG(DID_LUACOMPILER, 1)
-			if(GetLogAssistant().is_output_process())
-			{
-				UG_LOG("\nLUA2C: Error when compiling " << functionName << "\n");
-				UG_LOG("compiling line: " << c1s << "\n");
-				UG_LOG("--[LUACompiler]-----------------------------------------------\n");
-				UG_LOG("created C function from LUA function " << functionName << ":\n");
-				UG_LOG(GetFileLines((p+"LUACompiler_output.c").c_str(), 1, -1, true) << "\n");
-				UG_LOG("--[LUACompiler]-----------------------------------------------\n");
+		if(FileExists(m_pDyn)){
+			if(load_library(symbol.c_str())){
+				UG_DLOG(DID_LUACOMPILER, 1, "OK (cached)\n");
+				return true;
 			}
-			return false;
+		//	the cached file is broken, compile it again
+			UG_DLOG(DID_LUACOMPILER, 1, "cached library " << m_pDyn << " unusable, recompiling... ");
 		}
-	
-		bool bTmpFileSuccess=false;
-		m_name = functionName;
-
-		m_pDyn = MakeTmpFile(p+string(functionName), ".dylib", bTmpFileSuccess);
 
-		string c2s=string("gcc -dynamiclib ") + p+"LUACompiler_output.o -o " + m_pDyn.c_str();
+	//	compile into process-unique files and move the result in place, so that
+	//	several processes compiling the same function don't interfere.
+		const string pTmp = mkstr(m_pDyn << "." << getpid());
+		const string pSrc = pTmp + ".c";
+		{
+			fstream out(pSrc.c_str(), fstream::out);
+			out << code;
+		}
 
-		if(GetLogAssistant().is_output_process())
-		{	UG_DLOG(DID_LUACOMPILER, 2, "linking line: " << c2s << "\n"); }
+		UG_DLOG(DID_LUACOMPILER, 5, code << "\n");
 
-		if(system(c2s.c_str()) != 0)
+		string cs = compileFlags + " " + pSrc + " -o " + pTmp;
+		UG_DLOG(DID_LUACOMPILER, 2, "compiling line: " << cs << "\n");
+		if(system(cs.c_str()) != 0)
 		{
-//			IF_DEBUG(DID_LUACOMPILER, 1)
 			if(GetLogAssistant().is_output_process())
 			{
-				UG_LOG("\nLUA2C: Error when linking " << functionName << "\n");
-				UG_LOG("linking line: " << c2s << "\n");
+				UG_LOG("\nLUA2C: Error when compiling " << functionName << "\n");
+				UG_LOG("compiling line: " << cs << "\n");
 				UG_LOG("--[LUACompiler]-----------------------------------------------\n");
 				UG_LOG("created C function from LUA function " << functionName << ":\n");
-				UG_LOG(GetFileLines((p+"LUACompiler_output.c").c_str(), 1, -1, true) << "\n");
+				UG_LOG(GetFileLines(pSrc.c_str(), 1, -1, true) << "\n");
 				UG_LOG("--[LUACompiler]-----------------------------------------------\n");
 			}
+			remove(pSrc.c_str());
+			remove(pTmp.c_str());
 			return false;
 		}
-		try{
-		m_libHandle = OpenLibrary(m_pDyn.c_str());
-		}
-		catch(std::string error)
+		remove(pSrc.c_str());
+
+		if(rename(pTmp.c_str(), m_pDyn.c_str()) != 0)
 		{
-			UG_LOG("\nLUA2C: Error when opening library for function " << functionName << "\n");
-			UG_LOG("Error is " << error << "\n");
+			UG_LOG("\nLUA2C: Error when moving " << pTmp << " to " << m_pDyn << "\n");
+			remove(pTmp.c_str());
 			return false;
 		}
-		m_f = (LUA2C_Function) GetLibraryProcedure(m_libHandle, functionName);
 
-		if(m_f !=NULL) { UG_DLOG(DID_LUACOMPILER, 1, "OK\n"); }
+		bool bOK = load_library(symbol.c_str());
+		if(bOK) { UG_DLOG(DID_LUACOMPILER, 1, "OK\n"); }
 		else { UG_DLOG(DID_LUACOMPILER, 1, "FAILED\n"); }
-		if(m_f !=NULL)
-			bInitialized = true;
-		return m_f != NULL;
+		return bOK;
 	}
 	catch(...)
 	{
@@ -184,6 +216,39 @@ bool LUACompiler::createC(const char *functionName, LuaFunctionHandle* pHandle)
 
 }
 
+bool LUACompiler::load_library(const char *symbol)
+{
+	if(m_libHandle){
+		CloseLibrary(m_libHandle);
+		m_libHandle = NULL;
+	}
+	m_f = NULL;
+	m_fBatch = NULL;
+	bInitialized = false;
+
+	try{
+		m_libHandle = OpenLibrary(m_pDyn.c_str());
+	}
+	catch(std::string error)
+	{
+		UG_LOG("\nLUA2C: Error when opening library for function " << m_name << "\n");
+		UG_LOG("Error is " << error << "\n");
+		m_libHandle = NULL;
+		return false;
+	}
+
+	m_f = (LUA2C_Function) GetLibraryProcedure(m_libHandle, symbol);
+	m_fBatch = (LUA2C_BatchFunction) GetLibraryProcedure(m_libHandle,
+									(string(symbol) + "_batch").c_str());
+	if(m_f == NULL){
+		CloseLibrary(m_libHandle);
+		m_libHandle = NULL;
+		return false;
+	}
+	bInitialized = true;
+	return true;
+}
+
 bool LUACompiler::createVM(const char *functionName, LuaFunctionHandle* pHandle)
 {
 	PROFILE_BEGIN_GROUP(LUACompiler_createVM, "LUA2VM");
@@ -248,16 +313,9 @@ LUACompiler::~LUACompiler()
 {
 	if(vm != NULL) delete vm;
 
-    UG_DLOG(DID_LUACOMPILER, 2, "removing " << m_name << "\n");
 	if(m_libHandle)
 	   	CloseLibrary(m_libHandle);
-        
-    if(m_pDyn.size() > 0)
-    {
-		string s = string("rm ") + m_pDyn;
-		UG_DLOG(DID_LUACOMPILER, 2, s << "\n");
-		system(s.c_str());
-	}
+//	the library itself stays in the cache directory for later runs
 }
 
 bool LUACompiler::call(double *ret, const double *in) const
@@ -275,6 +333,18 @@ bool LUACompiler::call(double *ret, const double *in) const
 	}
 }
 
+bool LUACompiler::call_batch(size_t n, double *ret, const double *in) const
+{
+	if(!bVM && m_fBatch != NULL)
+	{
+		m_fBatch((int)n, ret, in);
+		return true;
+	}
+	for(size_t i = 0; i < n; ++i)
+		call(ret + i*m_iOut, in + i*m_iIn);
+	return true;
+}
+
 
 }
 }
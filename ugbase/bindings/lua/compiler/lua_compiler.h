@@ -51,6 +51,7 @@ class LUACompiler
 	
 private:
 	typedef int (*LUA2C_Function)(double *, const double *) ;
+	typedef int (*LUA2C_BatchFunction)(int, double *, const double *) ;
 	
 	DynLibHandle m_libHandle;
 	std::string m_pDyn;
@@ -59,12 +60,14 @@ private:
 public:
 	std::string m_name;
 	LUA2C_Function m_f;
+	LUA2C_BatchFunction m_fBatch;
 	int m_iIn, m_iOut;
 	bool bInitialized;
 	bool bVM;
 	LUACompiler()
 	{ 
 		m_f= NULL; 
+		m_fBatch = NULL;
 		m_name = "uninitialized"; 
 		m_pDyn = ""; 
 		m_libHandle = NULL;
@@ -96,8 +99,19 @@ public:
 	bool create(const char *functionName, LuaFunctionHandle* pHandle = NULL);
 	bool createVM(const char *functionName, LuaFunctionHandle* pHandle = NULL);
 	bool createC(const char *functionName, LuaFunctionHandle* pHandle = NULL);
+
+private:
+	bool load_library(const char *symbol);
+
+public:
 	
 	bool call(double *ret, const double *in) const;
+
+///	evaluates the function for n input tuples
+/**	'in' holds n consecutive blocks of num_in() values, 'ret' receives n
+ * consecutive blocks of num_out() values. Compiled functions use the
+ * generated batch entry point, otherwise call() is used for each tuple.*/
+	bool call_batch(size_t n, double *ret, const double *in) const;
 	virtual ~LUACompiler();
 };
 
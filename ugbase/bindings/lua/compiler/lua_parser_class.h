@@ -204,7 +204,8 @@ public:
 			i++;
 			a = a->opr.op[1];
 		}
-		return i;
+	//	the last argument is a leaf
+		return i+1;
 	}
 	
 	int num_out()
@@ -91,6 +91,7 @@ namespace ug
 {
 bool useLua2VM=false;
 bool useLuaCompiler=false;
+std::string lua2cCacheDirectory;
 
 namespace bridge
 {
@@ -1236,6 +1237,15 @@ void EnableLUA2VM(bool b)
 	useLua2VM=b;
 }
 
+///	sets the directory in which compiled LUA2C functions are cached
+/**	Defaults to bin/LUACompiler_cache. Compiled functions are reused in later
+ * runs as long as the generated code (including the values of used globals)
+ * is unchanged.*/
+void SetLUA2CCacheDirectory(const char* dir)
+{
+	lua2cCacheDirectory = dir;
+}
+
 bool RegisterSerializationCommands(Registry &reg, const char* parentGroup);
 
 bool RegisterInfoCommands(Registry &reg, const char* parentGroup)
@@ -1285,6 +1295,8 @@ bool RegisterInfoCommands(Registry &reg, const char* parentGroup)
 		                 "", "bEnable", "");
 		reg.add_function("EnableLUA2VM", &EnableLUA2VM, grp.c_str(),
 				"", "bEnable", "");
+		reg.add_function("SetLUA2CCacheDirectory", &SetLUA2CCacheDirectory, grp.c_str(),
+				"", "directory", "sets the directory in which compiled LUA2C functions are cached");
 		reg.add_function("InitSignals", &InitSignals, grp.c_str());
 	}
 	UG_REGISTRY_CATCH_THROW(grp);
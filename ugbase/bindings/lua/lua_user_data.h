@@ -135,7 +135,37 @@ class LuaUserData
 	///	evaluates the data at a given point and time
 		inline TRet evaluate(TData& D, const MathVector<dim>& x, number time, int si) const;
 
+	///	evaluates the data at nip points. Uses the batch callback if one was set.
+		void evaluate_batch(TData vValue[], const MathVector<dim> vGlobIP[],
+		                    number time, int si, const size_t nip) const;
+
+	///	sets a lua callback which evaluates the data at many points in one call
+	/**
+	 * If a batch callback is set, evaluations at several points (e.g. at all
+	 * integration points of an element) are performed by one call to the batch
+	 * callback instead of one call of the standard callback per point. The
+	 * batch callback receives the number of points n, a table with the
+	 * coordinates of the points for each dimension, the time, the subset index
+	 * and a table which has to be filled with the values of all points
+	 * (see batch_signature). All tables are indexed starting with 1 and are
+	 * reused between calls, i.e. only the first n entries are valid.
+	 *
+	 * The standard callback is still used for evaluations at single points.
+	 * \{ */
+		void set_batch_callback(const char* luaCallback);
+		void set_batch_callback(LuaFunctionHandle handle);
+	/** \} */
+
+	///	returns true if a batch callback has been set
+		bool has_batch_callback() const	{return m_batchCallbackRef != LUA_NOREF;}
+
+	///	returns string of required batch callback signature
+		static std::string batch_signature();
+
 	protected:
+	///	creates the tables for batch evaluation and performs a test run of the batch callback
+		void init_batch_callback();
+
 	///	sets that LuaUserData is created by LuaUserDataFactory
 		void set_created_from_factory(bool bFromFactory) {m_bFromFactory = bFromFactory;}
 
@@ -145,10 +175,20 @@ class LuaUserData
 
 	///	reference to lua function
 		int m_callbackRef;
+
+	///	reference to lua batch function (LUA_NOREF if not set)
+		int m_batchCallbackRef;
+
+	///	references to the tables holding coordinates and values in batch evaluations
+		int m_batchCoordRef[dim];
+		int m_batchValueRef;
 		
 		#ifdef USE_LUA2C
     	/// LUACompiler type for compiled LUA code
 			bridge::LUACompiler m_luaComp;
+
+		///	in- and output buffers for batched calls of compiled code
+			mutable std::vector<double> m_vCompIn, m_vCompOut;
 		#endif
 	///	flag, indicating if created from factory
 		bool m_bFromFactory;
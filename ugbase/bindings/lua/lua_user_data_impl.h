@@ -33,6 +33,7 @@
 #ifndef __H__UG_BRIDGE__BRIDGES__USER_DATA__USER_DATA_IMPL_
 #define __H__UG_BRIDGE__BRIDGES__USER_DATA__USER_DATA_IMPL_
 
+#include <algorithm>
 #include "lua_user_data.h"
 #include "lib_disc/spatial_disc/user_data/linker/linker_traits.h"
 #include "lib_disc/spatial_disc/user_data/const_user_data.h"
@@ -88,10 +89,42 @@ std::string LuaUserData<TData,dim,TRet>::name()
 	return ss.str();
 }
 
+template <typename TData, int dim, typename TRet>
+std::string LuaUserData<TData,dim,TRet>::batch_signature()
+{
+	static const char cmp[] = {'x', 'y', 'z'};
+	const int size = lua_traits<TData>::size;
+
+	std::stringstream ss;
+	ss << "function name(n, ";
+	for(int d = 0; d < dim; ++d)
+		ss << cmp[d] << ", ";
+	ss << "t, si, values)\n   for i = 1, n do\n      -- point i: ";
+	for(int d = 0; d < dim; ++d){
+		if(d != 0) ss << ", ";
+		ss << cmp[d] << "[i]";
+	}
+	ss << "\n      ";
+	if(size == 1)
+		ss << "values[i]";
+	else{
+		for(int k = 1; k <= size; ++k){
+			if(k != 1) ss << ", ";
+			ss << "values[(i-1)*" << size << "+" << k << "]";
+		}
+	}
+	ss << " = " << lua_traits<TData>::signature() << "\n   end\nend";
+	return ss.str();
+}
+
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::LuaUserData(const char* luaCallback)
-	: m_callbackName(luaCallback), m_bFromFactory(false)
+	: m_callbackName(luaCallback), m_batchCallbackRef(LUA_NOREF),
+	  m_batchValueRef(LUA_NOREF), m_bFromFactory(false)
 {
+	for(int d = 0; d < dim; ++d)
+		m_batchCoordRef[d] = LUA_NOREF;
+
 //	get lua state
 	m_L = ug::script::GetDefaultLuaState();
 
@@ -117,8 +150,12 @@ LuaUserData<TData,dim,TRet>::LuaUserData(const char* luaCallback)
 
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::LuaUserData(LuaFunctionHandle handle)
-	: m_callbackName("__anonymous__lua__function__"), m_bFromFactory(false)
+	: m_callbackName("__anonymous__lua__function__"), m_batchCallbackRef(LUA_NOREF),
+	  m_batchValueRef(LUA_NOREF), m_bFromFactory(false)
 {
+	for(int d = 0; d < dim; ++d)
+		m_batchCoordRef[d] = LUA_NOREF;
+
 //	get lua state
 	m_L = ug::script::GetDefaultLuaState();
 
@@ -349,12 +386,187 @@ evaluate(TData& D, const MathVector<dim>& x, number time, int si) const
 	}
 }
 
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::
+set_batch_callback(const char* luaCallback)
+{
+//	obtain a reference
+	lua_getglobal(m_L, luaCallback);
+
+//	make sure that the reference is valid
+	if(lua_isnil(m_L, -1)){
+		lua_pop(m_L, 1);
+		UG_THROW(name() << ": Specified lua batch callback "
+						"does not exist: " << luaCallback);
+	}
+
+	luaL_unref(m_L, LUA_REGISTRYINDEX, m_batchCallbackRef);
+	m_batchCallbackRef = luaL_ref(m_L, LUA_REGISTRYINDEX);
+
+	try{
+		init_batch_callback();
+	}
+	UG_CATCH_THROW(name() << ": Error while testing batch callback '"
+					<< luaCallback << "'.\nUse signature as follows:\n"
+					<< batch_signature());
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::
+set_batch_callback(LuaFunctionHandle handle)
+{
+	luaL_unref(m_L, LUA_REGISTRYINDEX, m_batchCallbackRef);
+	m_batchCallbackRef = handle.ref;
+
+	try{
+		init_batch_callback();
+	}
+	UG_CATCH_THROW(name() << ": Error while testing batch callback."
+					"\nUse signature as follows:\n" << batch_signature());
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::
+init_batch_callback()
+{
+//	the tables are reused for all evaluations
+	for(int d = 0; d < dim; ++d){
+		if(m_batchCoordRef[d] == LUA_NOREF){
+			lua_newtable(m_L);
+			m_batchCoordRef[d] = luaL_ref(m_L, LUA_REGISTRYINDEX);
+		}
+	}
+
+	if(m_batchValueRef == LUA_NOREF){
+		lua_newtable(m_L);
+		m_batchValueRef = luaL_ref(m_L, LUA_REGISTRYINDEX);
+	}
+
+//	make a test run
+	MathVector<dim> x; x = 0.0;
+	TData D;
+	evaluate_batch(&D, &x, 0.0, 0, 1);
+}
+
+template <typename TData, int dim, typename TRet>
+void LuaUserData<TData,dim,TRet>::
+evaluate_batch(TData vValue[], const MathVector<dim> vGlobIP[],
+               number time, int si, const size_t nip) const
+{
+	#ifdef USE_LUA2C
+	if(useLuaCompiler && m_luaComp.is_valid())
+	{
+		PROFILE_CALLBACK()
+	//	the compiled function steps through the input by its own number of
+	//	arguments, which may be less than dim + 2 (e.g. if t and si are omitted)
+		const size_t numIn = m_luaComp.num_in();
+		const size_t numOut = m_luaComp.num_out();
+		UG_COND_THROW(numIn > (size_t)dim + 2, name() << "::evaluate_batch(...): "
+					  "compiled callback expects " << numIn << " arguments, at most "
+					  << dim + 2 << " are supported.");
+		m_vCompIn.resize(nip * numIn);
+		m_vCompOut.resize(nip * numOut);
+		for(size_t ip = 0; ip < nip; ++ip){
+			double d[dim+2];
+			for(int i = 0; i < dim; ++i)
+				d[i] = vGlobIP[ip][i];
+			d[dim] = time;
+			d[dim+1] = si;
+			std::copy(d, d + numIn, m_vCompIn.begin() + ip * numIn);
+		}
+		if(nip > 0)
+			m_luaComp.call_batch(nip, &m_vCompOut[0], &m_vCompIn[0]);
+
+		#ifndef NDEBUG
+	//	the batched results have to match the ones of the per-point path
+		std::vector<double> ret(numOut);
+		for(size_t ip = 0; ip < nip; ++ip){
+			m_luaComp.call(&ret[0], &m_vCompIn[ip * numIn]);
+			for(size_t k = 0; k < numOut; ++k){
+				const double b = m_vCompOut[ip * numOut + k];
+				UG_ASSERT(ret[k] == b || (ret[k] != ret[k] && b != b),
+						  name() << "::evaluate_batch(...): batched result "
+						  << b << " differs from "
+						  << ret[k] << " of the per-point call at point " << ip);
+			}
+		}
+		#endif
+		TRet *t=NULL;
+		for(size_t ip = 0; ip < nip; ++ip)
+			lua_traits<TData>::read(vValue[ip], &m_vCompOut[ip * numOut], t);
+		return;
+	}
+	#endif
+
+	const bool useBatch = (m_batchCallbackRef != LUA_NOREF) && (nip > 0);
+
+	if(!useBatch){
+		for(size_t ip = 0; ip < nip; ++ip)
+			evaluate(vValue[ip], vGlobIP[ip], time, si);
+		return;
+	}
+
+	PROFILE_CALLBACK()
+//	push the callback function and the number of points on the stack
+	lua_rawgeti(m_L, LUA_REGISTRYINDEX, m_batchCallbackRef);
+	lua_pushinteger(m_L, (lua_Integer)nip);
+
+//	fill the coordinate tables and push them on the stack
+	for(int d = 0; d < dim; ++d){
+		lua_rawgeti(m_L, LUA_REGISTRYINDEX, m_batchCoordRef[d]);
+		for(size_t ip = 0; ip < nip; ++ip){
+			lua_pushnumber(m_L, vGlobIP[ip][d]);
+			lua_rawseti(m_L, -2, (int)ip + 1);
+		}
+	}
+
+//	push time, subset index and the value table on stack
+	lua_traits<number>::push(m_L, time);
+	lua_traits<int>::push(m_L, si);
+	lua_rawgeti(m_L, LUA_REGISTRYINDEX, m_batchValueRef);
+
+//	call lua function
+	if(lua_pcall(m_L, dim + 4, 0, 0) != 0)
+		UG_THROW(name() << "::evaluate_batch(...): Error while "
+						"running batch callback of '" << m_callbackName << "',"
+						" lua message: "<< lua_tostring(m_L, -1)<<".\n"
+						"Use signature as follows:\n"
+						<< batch_signature());
+
+//	read the values of all points from the value table
+	const int size = lua_traits<TData>::size;
+	number ret[size];
+	lua_rawgeti(m_L, LUA_REGISTRYINDEX, m_batchValueRef);
+	try{
+		for(size_t ip = 0; ip < nip; ++ip){
+			for(int k = 0; k < size; ++k){
+				lua_rawgeti(m_L, -1, (int)ip * size + k + 1);
+				ret[k] = ReturnValueToNumber(m_L, -1);
+				lua_pop(m_L, 1);
+			}
+			lua_traits<TData>::read(vValue[ip], ret, (void*)NULL);
+		}
+	}
+	catch(...){
+	//	pop the invalid value and the value table
+		lua_pop(m_L, 2);
+		throw;
+	}
+	lua_pop(m_L, 1);
+}
+
 template <typename TData, int dim, typename TRet>
 LuaUserData<TData,dim,TRet>::~LuaUserData()
 {
 //	free reference to callback
 	luaL_unref(m_L, LUA_REGISTRYINDEX, m_callbackRef);
 
+//	free references used for batch evaluation
+	luaL_unref(m_L, LUA_REGISTRYINDEX, m_batchCallbackRef);
+	luaL_unref(m_L, LUA_REGISTRYINDEX, m_batchValueRef);
+	for(int d = 0; d < dim; ++d)
+		luaL_unref(m_L, LUA_REGISTRYINDEX, m_batchCoordRef[d]);
+
 	if(m_bFromFactory)
 		LuaUserDataFactory<TData,dim,TRet>::remove(m_callbackName);
 }
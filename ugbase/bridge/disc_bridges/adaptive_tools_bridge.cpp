@@ -293,6 +293,20 @@ static void Domain(Registry& reg, string grp)
 			reg.add_class_to_group(name, "MaximumMarking", tag);
 	}
 
+	//  DoerflerMarking
+	{
+			typedef DoerflerMarking<TDomain> T;
+			typedef IElementMarkingStrategy<TDomain> TBase;
+			string name = string("DoerflerMarking").append(suffix);
+			reg.add_class_<T, TBase>(name, grp)
+								   .template add_constructor<void (*)(number)>("theta")
+								   .template add_constructor<void (*)(number, int)>("theta#max_level")
+								   .add_method("set_theta", &T::set_theta)
+								   .add_method("set_max_level", &T::set_max_level)
+								   .set_construct_as_smart_pointer(true);
+			reg.add_class_to_group(name, "DoerflerMarking", tag);
+	}
+
 	//  MeanValueMarking
 	{
 			typedef MeanValueMarking<TDomain> T;
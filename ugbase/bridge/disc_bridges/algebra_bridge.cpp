@@ -51,6 +51,7 @@
 #include "lib_disc/spatial_disc/constraints/constraint_interface.h"
 #include "lib_disc/time_disc/time_disc_interface.h"
 #include "lib_disc/time_disc/theta_time_step.h"
+#include "lib_disc/time_disc/time_integrator.h"
 #include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
 #include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
 #include "lib_disc/operator/non_linear_operator/line_search.h"
@@ -280,6 +281,8 @@ static void Algebra(Registry& reg, string parentGroup)
 			.add_method("clear_inner_step_update", &T::clear_inner_step_update, "clear inner step update", "")
 			.add_method("add_step_update", &T::add_step_update, "data update called before every Newton step", "")
 			.add_method("clear_step_update", &T::clear_step_update, "clear step update", "")
+			.add_method("set_reuse_jacobian", &T::set_reuse_jacobian, "", "bReuse", "keeps Jacobian and linear solver of the last call (simplified Newton)")
+			.add_method("reuse_jacobian", &T::reuse_jacobian, "bReuse")
 			.add_method("config_string", &T::config_string)
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "NewtonSolver", tag);
@@ -476,6 +479,35 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "CompositeConvCheck", tag);
 	}
 
+	//	AdaptiveTimeIntegrator
+	{
+		std::string grp2 = grp; grp2.append("/Discretization/TimeDisc");
+		typedef AdaptiveTimeIntegrator<TDomain, TAlgebra> T;
+		string name = string("AdaptiveTimeIntegrator").append(suffix);
+		reg.add_class_<T>(name, grp2)
+			.template add_constructor<void (*)(SmartPtr<ITimeDiscretization<TAlgebra> >, SmartPtr<NewtonSolver<TAlgebra> >)>("TimeDisc#NewtonSolver")
+			.add_method("set_tolerance", &T::set_tolerance, "", "rtol#atol", "tolerances for the estimated local error")
+			.add_method("set_error_order", &T::set_error_order, "", "order", "order of the error estimator")
+			.add_method("set_step_size", &T::set_step_size, "", "dt", "initial step size")
+			.add_method("set_min_step_size", &T::set_min_step_size, "", "dtMin", "minimal step size (default: 1e-6 times the initial step size)")
+			.add_method("set_max_step_size", &T::set_max_step_size, "", "dtMax")
+			.add_method("set_safety_factor", &T::set_safety_factor, "", "safety")
+			.add_method("set_step_factor_bounds", &T::set_step_factor_bounds, "", "minFac#maxFac")
+			.add_method("set_pi_gains", &T::set_pi_gains, "", "kI#kP", "gains of the PI step size controller")
+			.add_method("set_reduction_factor", &T::set_reduction_factor, "", "red", "step size reduction if Newton fails")
+			.add_method("set_reuse_threshold", &T::set_reuse_threshold, "", "relChange", "relative change of step size up to which the Jacobian of a rejected step is reused")
+			.add_method("set_finish_step", &T::set_finish_step, "", "bFinish")
+			.add_method("set_checkpoint", &T::set_checkpoint, "", "checkpoint#filename", "checkpoint written if the step size becomes too small")
+			.add_method("apply", &T::apply, "success", "u#t0#tEnd")
+			.add_method("time", &T::time, "time of last accepted solution")
+			.add_method("step_size", &T::step_size, "proposed step size")
+			.add_method("num_accepted_steps", &T::num_accepted_steps)
+			.add_method("num_rejected_steps", &T::num_rejected_steps)
+			.add_method("num_jacobian_reuses", &T::num_jacobian_reuses)
+			.set_construct_as_smart_pointer(true);
+		reg.add_class_to_group(name, "AdaptiveTimeIntegrator", tag);
+	}
+
 	//	NonlinearGaussSeidelSolver
 	{
 		grp.append("/Discretization/Nonlinear");
@@ -117,7 +117,9 @@ static void Domain(Registry& reg, string grp)
 		string name = string("IElemDisc").append(suffix);
 		reg.add_class_<T, TBase>(name, elemGrp)
  		//	.add_method("set_stationary", static_cast<void (T::*)()>(&T::set_stationary))
- 			.add_method("add_elem_modifier", &T::add_elem_modifier, "", "");
+ 			.add_method("add_elem_modifier", &T::add_elem_modifier, "", "")
+			.add_method("set_constant_matrices", &T::set_constant_matrices, "", "bConstMatrices")
+			.add_method("constant_matrices", &T::constant_matrices);
  		//	.add_method("set_error_estimator", static_cast<void (T::*)(SmartPtr<IErrEstData<TDomain> >)>(&T::set_error_estimator));
  		reg.add_class_to_group(name, "IElemDisc", tag);
 	}
@@ -44,6 +44,7 @@
 // lib_disc includes
 #include "lib_disc/dof_manager/dof_distribution.h"
 #include "lib_disc/function_spaces/grid_function.h"
+#include "lib_disc/function_spaces/grid_function_global_user_data.h"
 
 #ifdef UG_PARALLEL
 	#include "lib_grid/parallelization/distributed_grid.h"
@@ -236,6 +237,19 @@ number EvaluateAtClosestVertex(const MathVector<TGridFunction::dim>& pos,
 }
 
 
+/// evaluates a component of a grid function at arbitrary points (collective)
+/**	vCoords holds the coordinates of all points of this process consecutively.
+ * Points are routed to the processes whose part of the grid contains them.*/
+template <typename TGridFunction>
+std::vector<number> EvaluateAtPoints(SmartPtr<TGridFunction> spGridFct,
+                                     const char* cmp,
+                                     std::vector<number> vCoords)
+{
+	GlobalGridFunctionNumberData<TGridFunction> data(spGridFct, cmp);
+	return data.evaluate_at_points(vCoords);
+}
+
+
 /**
  * Class exporting the functionality. All functionality that is to
  * be used in scripts or visualization must be registered here.
@@ -267,6 +281,7 @@ static void DomainAlgebra(Registry& reg, string grp)
 
 		//reg.add_function("EvaluateAtClosestVertex", static_cast<number (*)(const std::vector<number>&, SmartPtr<TFct>, const char*, const char*)>(&EvaluateAtClosestVertex<TFct>),grp, "Evaluate_at_closest_vertex", "Position#GridFunction#Component#Subsets");
 		reg.add_function("EvaluateAtClosestVertex", &EvaluateAtClosestVertex<TFct>, grp, "Evaluate_at_closest_vertex", "Position#GridFunction#Component#Subsets");
+		reg.add_function("EvaluateAtPoints", &EvaluateAtPoints<TFct>, grp, "Values", "GridFunction#Component#Coordinates");
 	}
 }
 
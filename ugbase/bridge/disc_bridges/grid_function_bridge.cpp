@@ -185,6 +185,7 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_class_<T, TBase>(name, grp)
 			.template add_constructor<void (*)(SmartPtr<TFct>, const char*)>("GridFunction#Component")
 			.add_method("evaluate", static_cast<number (T::*)(std::vector<number>)>(&T::evaluate))
+			.add_method("evaluate_at_points", &T::evaluate_at_points, "values", "coordinates")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "GlobalGridFunctionNumberData", tag);
 	}
@@ -198,6 +199,7 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_class_<T, TBase>(name, grp)
 			.template add_constructor<void (*)(SmartPtr<TFct>, const char*)>("GridFunction#Component")
 			.add_method("evaluate", static_cast<number (T::*)(std::vector<number>)>(&T::evaluate))
+			.add_method("evaluate_at_points", &T::evaluate_at_points, "values", "coordinates")
 			.set_construct_as_smart_pointer(true);
 		reg.add_class_to_group(name, "GlobalEdgeGridFunctionNumberData", tag);
 	}
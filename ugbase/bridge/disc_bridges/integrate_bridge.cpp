@@ -46,6 +46,7 @@
 #include "lib_disc/function_spaces/integrate_flux.h"
 
 #include "lib_disc/quadrature/quad_test.h"
+#include "lib_disc/local_finite_element/lagrange/lagrange_sum_fact_test.h"
 
 using namespace std;
 
@@ -184,6 +185,8 @@ void RegisterBridge_Integrate(Registry& reg, string grp)
 
 	{
 		reg.add_function("TestQuadRule", &ug::TestQuadRule);
+		reg.add_function("TestLagrangeSumFactorization", &ug::TestLagrangeSumFactorization,
+		                 grp, "success", "maxOrder");
 	}
 
 	try{
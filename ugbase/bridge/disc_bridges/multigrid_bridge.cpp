@@ -181,11 +181,14 @@ static void DomainAlgebra(Registry& reg, string grp)
 					.template add_constructor<void (*)(SmartPtr<ApproximationSpace<TDomain> >)>("Approximation Space")
 					.template add_constructor<void (*)()>()
 			.add_method("set_mg_stats", &T::set_mg_stats, "", "MGStats")
+			.add_method("set_cycle_profile", &T::set_cycle_profile, "", "MGCycleProfile")
 			.add_method("set_approximation_space", &T::set_approximation_space, "", "Approximation space")
 			.add_method("set_discretization", &T::set_discretization, "", "Discretization")
 			.add_method("set_base_level", &T::set_base_level, "", "Base Level")
 			.add_method("set_surface_level", &T::set_surface_level, "", "Surface Level")
 			.add_method("set_gathered_base_solver_if_ambiguous", &T::set_gathered_base_solver_if_ambiguous,"", "Specifies if gathered base solver used in case of Ambiguity")
+			.add_method("set_base_agglomeration", &T::set_base_agglomeration,"", "numProcsPerProc", "Agglomerates the base level of groups of numProcsPerProc processes onto one process each")
+			.add_method("set_level_agglomeration", &T::set_level_agglomeration,"", "level#numProcsPerProc", "Agglomerates the smoothing on the given level of groups of numProcsPerProc processes onto one process each")
 			.add_method("set_base_solver", &T::set_base_solver,"","Base Solver")
 			.add_method("set_smoother", &T::set_smoother,"", "Smoother")
 			.add_method("set_presmoother", &T::set_presmoother,"", "Smoother")
@@ -247,6 +250,41 @@ static void DomainAlgebra(Registry& reg, string grp)
 
 }
 
+/**
+ * Function called for the registration of Domain and Algebra independent parts.
+ * All Functions and Classes not depending on Domain and Algebra
+ * are to be placed here when registering.
+ *
+ * @param reg				registry
+ * @param grp				group for sorting of functionality
+ */
+static void Common(Registry& reg, string grp)
+{
+	grp.append("/MultiGrid");
+
+//	MGCycleProfile
+	{
+		typedef MGCycleProfile T;
+		reg.add_class_<T>("MGCycleProfile", grp, "Time, bytes and flops per level of a multigrid cycle")
+			.add_constructor()
+			.add_method("set_enabled", &T::set_enabled, "", "enable")
+			.add_method("enabled", &T::enabled, "enabled", "")
+			.add_method("clear", &T::clear, "", "")
+			.add_method("num_cycles", &T::num_cycles, "number of cycles", "")
+			.add_method("num_levels", &T::num_levels, "number of levels", "")
+			.add_method("time", &T::time, "seconds", "lvl#phase")
+			.add_method("bytes", &T::bytes, "bytes", "lvl#phase")
+			.add_method("flops", &T::flops, "flops", "lvl#phase")
+			.add_method("calls", &T::calls, "calls", "lvl#phase")
+			.add_method("level_time", &T::level_time, "seconds", "lvl")
+			.add_method("total_time", &T::total_time, "seconds", "")
+			.add_method("print", &T::print, "", "")
+			.add_method("save_csv", &T::save_csv, "", "filename")
+			.add_method("save_json", &T::save_json, "", "filename")
+			.set_construct_as_smart_pointer(true);
+	}
+}
+
 };
 
 // end group multigrid_bridge
@@ -261,6 +299,7 @@ void RegisterBridge_MultiGrid(Registry& reg, string grp)
 	typedef MultiGrid::Functionality Functionality;
 
 	try{
+		RegisterCommon<Functionality>(reg,grp);
 		RegisterDomainAlgebraDependent<Functionality>(reg,grp);
 	}
 	UG_REGISTRY_CATCH_THROW(grp);
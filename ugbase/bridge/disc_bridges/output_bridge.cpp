@@ -46,6 +46,7 @@
 #include "lib_disc/function_spaces/approximation_space.h"
 
 #include "lib_disc/io/vtkoutput.h"
+#include "lib_disc/io/checkpoint.h"
 #include "common/profiler/profiler.h"
 
 #include "../util_overloaded.h"
@@ -146,6 +147,25 @@ static void DomainAlgebra(Registry& reg, string grp)
 		reg.add_class_to_group(name, "GridFunctionDebugWriter", tag);
 	}
 
+//	Checkpoint
+	{
+		typedef Checkpoint<TDomain, TAlgebra> T;
+		string name = string("Checkpoint").append(suffix);
+		reg.add_class_<T>(name, grp)
+			.add_constructor()
+			.add_method("add_grid_function", &T::add_grid_function, "", "gridFunction#name")
+			.add_method("clear_grid_functions", &T::clear_grid_functions)
+			.add_method("write", &T::write, "", "domain#filename")
+			.add_method("read_domain", &T::read_domain, "", "domain#filename")
+			.add_method("read_grid_functions", &T::read_grid_functions)
+			.set_construct_as_smart_pointer(true);
+		#ifdef UG_PARALLEL
+		reg.get_class_<T>()
+			.add_method("set_load_balancer", &T::set_load_balancer, "", "loadBalancer");
+		#endif
+		reg.add_class_to_group(name, "Checkpoint", tag);
+	}
+
 //	GridFunctionPositionProvider
 	{
 		typedef GridFunctionPositionProvider<function_type> T;
@@ -139,6 +139,8 @@ static void ScaleDomain(TDomain& dom, number sx, number sy, number sz)
 		for(int i = 0; i < numCoords; ++i)
 			aaPos[*iter][i] *= s[i];
 	}
+
+	dom.message_hub()->post_message(GridMessage_PositionsChanged());
 }
 
 /**
@@ -169,6 +171,8 @@ static void RandomizeDomain(TDomain& dom, number dx, number dy, number dz)
 		for(int i = 0; i < numCoords; ++i)
 			aaPos[*iter][i] += urand(-d[i], d[i]);
 	}
+
+	dom.message_hub()->post_message(GridMessage_PositionsChanged());
 }
 
 
@@ -188,6 +192,8 @@ static void TranslateDomain(TDomain& dom, number tx, number ty, number tz)
 		for(int i = 0; i < numCoords; ++i)
 			aaPos[*iter][i] += t[i];
 	}
+
+	dom.message_hub()->post_message(GridMessage_PositionsChanged());
 }
 
 /**
@@ -233,6 +239,8 @@ static void ProjectVerticesToSphere(TDomain& dom, std::vector<number> center,
 		// set new pos
 		VecScaleAdd(pos, 1.0, Center, s, dir);
 	}
+
+	dom.message_hub()->post_message(GridMessage_PositionsChanged());
 }
 
 /**
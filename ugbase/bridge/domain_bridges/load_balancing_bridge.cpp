@@ -47,6 +47,7 @@
 	#include "lib_grid/parallelization/load_balancer.h"
 	#include "lib_grid/parallelization/load_balancer_util.h"
 	#include "lib_grid/parallelization/partitioner_dynamic_bisection.h"
+	#include "lib_grid/parallelization/partitioner_dual_graph.h"
 	#include "lib_grid/parallelization/balance_weights_ref_marks.h"
 	#include "lib_grid/parallelization/partition_post_processors/smooth_partition_bounds.h"
 	#include "lib_grid/parallelization/partition_post_processors/cluster_element_stacks.h"
@@ -153,6 +154,32 @@ static void RegisterDynamicBisectionPartitioner(
 	reg.add_class_to_group(name, clsGrpName, GetDomainTag<TDomain>());
 }
 
+template <class TDomain, class TPartitioner>
+static void RegisterDualGraphPartitioner(
+	Registry& reg,
+	string name,
+	string grpName,
+	string clsGrpName)
+{
+	reg.add_class_<TPartitioner, IPartitioner>(name, grpName)
+		.template add_constructor<void (*)(TDomain&)>()
+		.add_method("set_subset_handler",
+			&TPartitioner::set_subset_handler)
+		.add_method("enable_repartitioning",
+			&TPartitioner::enable_repartitioning)
+		.add_method("repartitioning_enabled",
+			&TPartitioner::repartitioning_enabled)
+		.add_method("set_migration_cost",
+			&TPartitioner::set_migration_cost)
+		.add_method("set_imbalance_tolerance",
+			&TPartitioner::set_imbalance_tolerance)
+		.add_method("set_num_refinement_passes",
+			&TPartitioner::set_num_refinement_passes)
+		.set_construct_as_smart_pointer(true);
+
+	reg.add_class_to_group(name, clsGrpName, GetDomainTag<TDomain>());
+}
+
 template <class TDomain, class elem_t>
 static void RegisterSmoothPartitionBounds(
 	Registry& reg,
@@ -258,7 +285,9 @@ static void Common(Registry& reg, string grp) {
 				.add_method("print_quality_records", &T::print_quality_records)
 				.add_method("estimate_distribution_quality", static_cast<number (T::*)()>(&T::estimate_distribution_quality))
 				.add_method("set_balance_weights", &T::set_balance_weights)
-				.add_method("problems_occurred", &T::problems_occurred);
+				.add_method("problems_occurred", &T::problems_occurred)
+				.add_method("num_migrated_elements", &T::num_migrated_elements)
+				.add_method("migration_volume", &T::migration_volume);
 	}
 
 	#ifdef UG_DIM_1
@@ -272,6 +301,14 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"Partitioner_DynamicBisection");
 
+		RegisterDualGraphPartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_DualGraph<Edge, 1> > >(
+			reg,
+			"EdgePartitioner_DualGraph1d",
+			grp,
+			"Partitioner_DualGraph");
+
 
 		RegisterSmoothPartitionBounds<TDomain, Edge>(
 			reg,
@@ -298,6 +335,14 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"ManifoldPartitioner_DynamicBisection");
 
+		RegisterDualGraphPartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_DualGraph<Edge, 2> > >(
+			reg,
+			"EdgePartitioner_DualGraph2d",
+			grp,
+			"ManifoldPartitioner_DualGraph");
+
 		RegisterDynamicBisectionPartitioner<
 				TDomain,
 				DomainPartitioner<TDomain, Partitioner_DynamicBisection<Face, 2> > >(
@@ -306,6 +351,14 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"Partitioner_DynamicBisection");
 
+		RegisterDualGraphPartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_DualGraph<Face, 2> > >(
+			reg,
+			"FacePartitioner_DualGraph2d",
+			grp,
+			"Partitioner_DualGraph");
+
 		RegisterSmoothPartitionBounds<TDomain, Face>(
 			reg,
 			"SmoothPartitionBounds2d",
@@ -331,6 +384,14 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"HyperManifoldPartitioner_DynamicBisection");
 
+		RegisterDualGraphPartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_DualGraph<Edge, 3> > >(
+			reg,
+			"EdgePartitioner_DualGraph3d",
+			grp,
+			"HyperManifoldPartitioner_DualGraph");
+
 		RegisterDynamicBisectionPartitioner<
 				TDomain,
 				DomainPartitioner<TDomain, Partitioner_DynamicBisection<Face, 3> > >(
@@ -339,6 +400,14 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"ManifoldPartitioner_DynamicBisection");
 
+		RegisterDualGraphPartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_DualGraph<Face, 3> > >(
+			reg,
+			"FacePartitioner_DualGraph3d",
+			grp,
+			"ManifoldPartitioner_DualGraph");
+
 		RegisterDynamicBisectionPartitioner<
 				TDomain,
 				DomainPartitioner<TDomain, Partitioner_DynamicBisection<Volume, 3> > >(
@@ -347,6 +416,14 @@ static void Common(Registry& reg, string grp) {
 			grp,
 			"Partitioner_DynamicBisection");
 
+		RegisterDualGraphPartitioner<
+				TDomain,
+				DomainPartitioner<TDomain, Partitioner_DualGraph<Volume, 3> > >(
+			reg,
+			"VolumePartitioner_DualGraph3d",
+			grp,
+			"Partitioner_DualGraph");
+
 		RegisterSmoothPartitionBounds<TDomain, Volume>(
 			reg,
 			"SmoothPartitionBounds3d",
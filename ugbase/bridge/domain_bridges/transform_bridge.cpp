@@ -73,6 +73,8 @@ void TranslateDomain(TDomain& dom, ISelector& sel, const vector3& offset)
 		pos_t& v = aaPos[vrts[i]];
 		VecAdd(v, v, o);
 	}
+
+	dom.message_hub()->post_message(GridMessage_PositionsChanged());
 }
 
 
@@ -100,6 +102,8 @@ void ScaleDomain(TDomain& dom, const vector3& center, const vector3& scale)
 		for(size_t j = 0; j < pos_t::Size; ++j)
 			v[j] = c[j] + (v[j] - c[j]) * s[j];
 	}
+
+	dom.message_hub()->post_message(GridMessage_PositionsChanged());
 }
 
 
@@ -130,6 +134,8 @@ void ScaleDomain(TDomain& dom, ISelector& sel, const vector3& center,
 		for(size_t j = 0; j < pos_t::Size; ++j)
 			v[j] = c[j] + (v[j] - c[j]) * s[j];
 	}
+
+	dom.message_hub()->post_message(GridMessage_PositionsChanged());
 }
 
 template <class TDomain>
@@ -168,6 +174,7 @@ void ScaleDomainSquaredWeighting(TDomain& dom, ISelector& sel, const vector3& ce
             v[j] = c[j] + (v[j] - c[j]) * ((s[j]-1.0)*sqrdWeight + 1.0);
     }
 
+	dom.message_hub()->post_message(GridMessage_PositionsChanged());
 }
 
 template <class TDomain>
@@ -205,6 +212,8 @@ void ScaleDomainWeighting(TDomain& dom, ISelector& sel, const vector3& center,
         for(size_t j = 0; j < pos_t::Size; ++j)
             v[j] = c[j] + (v[j] - c[j]) * ((s[j]-1.0)*weight + 1.0);
     }
+
+	dom.message_hub()->post_message(GridMessage_PositionsChanged());
 }
 
 
@@ -244,6 +253,7 @@ void ScaleDomainSqrtWeighting(TDomain& dom, ISelector& sel, const vector3& cente
             v[j] = c[j] + (v[j] - c[j]) * ((s[j]-1.0)*weight + 1.0);
     }
 
+	dom.message_hub()->post_message(GridMessage_PositionsChanged());
 }
 
 // end group transform_bridge
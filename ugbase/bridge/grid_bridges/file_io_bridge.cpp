@@ -30,11 +30,16 @@
  * GNU Lesser General Public License for more details.
  */
 
+#include <cstring>
+#include <sstream>
 #include "grid_bridges.h"
 #include "common/profiler/profiler.h"
+#include "common/util/fast_number_parser.h"
+#include "common/util/file_util.h"
 #include "lib_grid/multi_grid.h"
 #include "lib_grid/file_io/file_io.h"
 #include "lib_grid/file_io/file_io_ugx.h"
+#include "lib_grid/file_io/file_io_ugxb.h"
 
 using namespace std;
 
@@ -71,6 +76,82 @@ bool SaveGrid(Grid& grid, const ISubsetHandler& sh, const char* filename)
 	return SaveGridToFile(grid, *const_cast<ISubsetHandler*>(&sh), filename);
 }
 
+bool LoadGridSubsetRange(Grid& grid, ISubsetHandler& sh, const char* filename,
+						 int siBegin, int siEnd)
+{
+	PROFILE_FUNC_GROUP("grid");
+	return LoadGridFromUGXB(grid, sh, filename, siBegin, siEnd);
+}
+
+///	parses a number block through std::istringstream and returns the number of values
+template <class T>
+static size_t ParseNumberBlockLegacy(const char* str, size_t len)
+{
+	string buf(str, len);
+	istringstream ss(buf);
+	size_t numVals = 0;
+	T val;
+	while(ss >> val)
+		++numVals;
+	return numVals;
+}
+
+///	parses the vertex and element blocks of all grids in a ugx file
+/**	This is the part of loading a ugx file which depends on the number parser.
+ * If legacyParser is true, the blocks are parsed through std::istringstream,
+ * as done by GridReaderUGX before ParseNumberBlock was introduced. Otherwise
+ * ParseNumberBlock is used.
+ * \returns	the total number of parsed values*/
+size_t ParseUGXNumberBlocks(const char* filename, bool legacyParser)
+{
+	PROFILE_FUNC_GROUP("grid");
+	static const char* elemNodeNames[] = {"edges", "triangles", "quadrilaterals",
+										  "tetrahedrons", "hexahedrons", "prisms",
+										  "pyramids", "octahedrons"};
+	const size_t numElemNodeNames = sizeof(elemNodeNames) / sizeof(elemNodeNames[0]);
+
+	vector<char> content;
+	UG_COND_THROW(!ReadFile(filename, content, true),
+				  "ParseUGXNumberBlocks: Can't read file " << filename);
+
+	rapidxml::xml_document<> doc;
+	doc.parse<0>(&content.front());
+
+	size_t numVals = 0;
+	vector<number> vrtVals;
+	vector<int> elemVals;
+	for(rapidxml::xml_node<>* gridNode = doc.first_node("grid"); gridNode;
+		gridNode = gridNode->next_sibling("grid"))
+	{
+		for(rapidxml::xml_node<>* node = gridNode->first_node(); node;
+			node = node->next_sibling())
+		{
+			const bool isVrtNode = (strcmp(node->name(), "vertices") == 0);
+			bool isElemNode = false;
+			for(size_t i = 0; i < numElemNodeNames; ++i)
+				isElemNode |= (strcmp(node->name(), elemNodeNames[i]) == 0);
+
+			if(isVrtNode){
+				if(legacyParser)
+					numVals += ParseNumberBlockLegacy<number>(node->value(), node->value_size());
+				else{
+					ParseNumberBlock(vrtVals, node->value(), node->value_size());
+					numVals += vrtVals.size();
+				}
+			}
+			else if(isElemNode){
+				if(legacyParser)
+					numVals += ParseNumberBlockLegacy<int>(node->value(), node->value_size());
+				else{
+					ParseNumberBlock(elemVals, node->value(), node->value_size());
+					numVals += elemVals.size();
+				}
+			}
+		}
+	}
+	return numVals;
+}
+
 bool SaveGridHierarchy(MultiGrid& mg, const char* filename)
 {
 	PROFILE_FUNC_GROUP("grid");
@@ -116,6 +197,18 @@ void RegisterGridBridge_FileIO(Registry& reg, string parentGroup)
 //					"", "go#filename")
 //			.add_function("SaveGridObject", &SaveGridObject, grp,
 //					"", "go#filename")
+		.add_function("LoadGridSubsetRange", &LoadGridSubsetRange, grp,
+				"", "grid#sh#filename#siBegin#siEnd",
+				"Loads the subsets [siBegin, siEnd) of a ugxb file together with their boundary elements. "
+				"In parallel grids the pieces of all processes are connected through horizontal interfaces.")
+		.add_function("ParseUGXNumberBlocks", &ParseUGXNumberBlocks, grp,
+				"numValues", "filename#legacyParser",
+				"Parses the vertex and element blocks of a ugx file with the legacy "
+				"stream based or the current number parser (for benchmarking).")
+		.add_function("ConvertUGXToUGXB", &ConvertUGXToUGXB, grp,
+				"", "ugxFilename#ugxbFilename")
+		.add_function("ConvertUGXBToUGX", &ConvertUGXBToUGX, grp,
+				"", "ugxbFilename#ugxFilename")
 		.add_function("SaveGridHierarchy", &SaveGridHierarchy, grp,
 				"", "mg#filename")
 		.add_function("SaveGridHierarchyTransformed",
@@ -99,6 +99,11 @@ void RegisterGridBridge_Grid(Registry& reg, string parentGroup)
 		.add_method("reserve_edges", &Grid::reserve<Edge>, "", "num")
 		.add_method("reserve_faces", &Grid::reserve<Face>, "", "num")
 		.add_method("reserve_volumes", &Grid::reserve<Volume>, "", "num")
+		.add_method("freeze_topology", &Grid::freeze_topology)
+		.add_method("thaw_topology", &Grid::thaw_topology)
+		.add_method("topology_frozen", &Grid::topology_frozen)
+		.add_method("set_auto_freeze_topology", &Grid::set_auto_freeze_topology, "", "enable")
+		.add_method("auto_freeze_topology", &Grid::auto_freeze_topology)
 		.set_construct_as_smart_pointer(true);
 
 //	MultiGrid
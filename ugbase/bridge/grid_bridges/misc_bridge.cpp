@@ -36,6 +36,8 @@
 #include "lib_grid/refinement/hanging_node_refiner_grid.h"
 #include "lib_grid/algorithms/space_partitioning/lg_ntree.h"
 #include "lib_grid/file_io/file_io.h"
+#include "lib_grid/refinement/global_multi_grid_refiner.h"
+#include "lib_grid/algorithms/unit_tests/check_associated_elements.h"
 
 using namespace std;
 
@@ -94,6 +96,42 @@ bool TestNTree(const char* filename)
 	return true;
 }
 
+///	checks the frozen topology of a loaded and refined multigrid
+/**	Automatic freezing is enabled before the grid is loaded. After loading and
+ * after each global refinement the grid has to be frozen and the elements
+ * associated with each vertex have to match those of the thawed grid.*/
+bool TestFrozenTopology(const char* filename, int numRefs)
+{
+	PROFILE_FUNC_GROUP("grid");
+	MultiGrid mg;
+	SubsetHandler sh(mg);
+	mg.set_auto_freeze_topology(true);
+
+	if(!LoadGridFromFile(mg, sh, filename)){
+		UG_LOG("  could not load " << filename << endl);
+		return false;
+	}
+
+	try{
+		UG_COND_THROW(!mg.topology_frozen(), "Topology not frozen after loading.");
+		grid_unit_tests::CheckFrozenTopology(mg);
+
+		GlobalMultiGridRefiner refiner(mg);
+		for(int i = 0; i < numRefs; ++i){
+			refiner.refine();
+			UG_COND_THROW(!mg.topology_frozen(), "Topology not frozen after refinement " << i+1 << ".");
+			grid_unit_tests::CheckFrozenTopology(mg);
+		}
+	}
+	catch(UGError& err){
+		UG_LOG("  TestFrozenTopology failed: " << err.get_msg() << endl);
+		return false;
+	}
+
+	UG_LOG("  frozen and thawed topology match on " << numRefs + 1 << " levels.\n");
+	return true;
+}
+
 
 void RegisterGridBridge_Misc(Registry& reg, string parentGroup)
 {
@@ -103,6 +141,7 @@ void RegisterGridBridge_Misc(Registry& reg, string parentGroup)
 		.add_function("PrintAttachmentInfo", &PrintAttachmentInfo, grp);
 
 	reg.add_function("TestNTree", &TestNTree, grp);
+	reg.add_function("TestFrozenTopology", &TestFrozenTopology, grp, "success", "filename#numRefs");
 }
 
 }//	end of namespace
@@ -262,6 +262,8 @@ void RegisterGridBridge_Refinement(Registry& reg, string parentGroup)
 		.add_constructor()
 		.add_method("assign_grid", static_cast<void (GlobalMultiGridRefiner::*)(MultiGrid&)>(&GlobalMultiGridRefiner::assign_grid),
 				"", "mg")
+		.add_method("enable_threaded_refinement", &GlobalMultiGridRefiner::enable_threaded_refinement, "", "enable")
+		.add_method("threaded_refinement_enabled", &GlobalMultiGridRefiner::threaded_refinement_enabled)
 		.set_construct_as_smart_pointer(true);
 
 //	FracturedMediaRefiner
@@ -34,6 +34,8 @@
 #include "bridge/bridge.h"
 #include "common/profiler/profiler.h"
 #include "common/profiler/profile_node.h"
+#include "common/profiler/sampling_profiler.h"
+#include "common/profiler/hw_counters.h"
 #include "ug.h" // Required for UGOutputProfileStatsOnExit.
 #include <string>
 #include <sstream>
@@ -143,6 +145,8 @@ void RegisterBridge_Profiler(Registry &reg, string parentGroup)
 		.add_method("is_valid", &UGProfileNode::valid, "true if node has been found", "")
 
 	  		.add_method("groups", &UGProfileNode::groups, "", "")
+			.add_method("hw_counters", &UGProfileNode::hw_counters,
+				"string with hardware counters", "", "counters are accumulated by zone and summed over all processes")
 
 		;
 		/*.add_method("__tostring", &UGProfileNode::tostring, "tostring")
@@ -178,6 +182,34 @@ void RegisterBridge_Profiler(Registry &reg, string parentGroup)
 					 grp,
 	                 "", "filename|save-dialog|endings=[\"txt\"]", "writes txt file with call log");
 
+	reg.add_function("StartSamplingProfiler",
+					OVERLOADED_FUNCTION_PTR(void, StartSamplingProfiler, ()),
+					grp, "", "", "starts recording 1000 call stack samples per second of cpu time");
+	reg.add_function("StartSamplingProfiler",
+					OVERLOADED_FUNCTION_PTR(void, StartSamplingProfiler, (double)),
+					grp, "", "samplesPerSecond", "starts recording call stack samples");
+	reg.add_function("StartSamplingProfiler",
+					OVERLOADED_FUNCTION_PTR(void, StartSamplingProfiler, (double, size_t)),
+					grp, "", "samplesPerSecond#maxSamples", "starts recording call stack samples");
+	reg.add_function("StopSamplingProfiler", &StopSamplingProfiler, grp);
+	reg.add_function("SamplingProfilerRunning", &SamplingProfilerRunning, grp);
+	reg.add_function("SamplingProfilerAvailable", &SamplingProfilerAvailable, grp);
+	reg.add_function("SamplingProfilerNumSamples", &SamplingProfilerNumSamples, grp);
+	reg.add_function("SamplingProfilerNumDropped", &SamplingProfilerNumDropped, grp);
+	reg.add_function("SamplingProfilerSummary", &SamplingProfilerSummary, grp,
+					"table of the most sampled functions", "maxEntries");
+	reg.add_function("WriteSamplingTraceJSON", &WriteSamplingTraceJSON, grp,
+					"", "filename|save-dialog|endings=[\"json\"]",
+					"writes the call stack samples of all processes in the Chrome trace event format (viewable with chrome://tracing or ui.perfetto.dev)");
+
+	reg.add_function("HasHWCounters", &HasHWCounters, grp,
+					"true if compiled with hardware counter support (cmake -DSHINY_HW_COUNTERS=ON ..)");
+	reg.add_function("EnableHWCounters", &EnableHWCounters, grp,
+					"previous state", "bEnable", "starts or stops counting hardware events for profile nodes");
+	reg.add_function("IsHWCountersEnabled", &IsHWCountersEnabled, grp);
+	reg.add_function("SetHWCounterFlopEvent", &SetHWCounterFlopEvent, grp,
+					"", "rawEventCode", "raw perf event code used to count floating point operations. Call before EnableHWCounters.");
+
 	reg.add_function("UpdateProfiler", &UpdateProfiler_BridgeImpl, grp);
 
 	reg.add_function("SetShinyCallLoggingMaxFrequency", &SetShinyCallLoggingMaxFrequency, grp, "", "maxFreq");
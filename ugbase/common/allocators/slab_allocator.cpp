@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include "slab_allocator.h"
+
+namespace ug{
+
+///	compares an address with the begin of a slab
+static bool AddressBeforeSlab(const char* p, const std::pair<char*, char*>& slab)
+{
+	return p < slab.first;
+}
+
+SlabAllocator::
+SlabAllocator(std::size_t objSize, std::size_t maxObjsPerSlab) :
+	m_maxObjsPerSlab(std::max<std::size_t>(maxObjsPerSlab, 1)),
+	m_nextObjsPerSlab(std::min<std::size_t>(32, m_maxObjsPerSlab)),
+	m_numAllocated(0),
+	m_memory(0),
+	m_pCur(NULL),
+	m_pCurEnd(NULL),
+	m_pFree(NULL)
+{
+//	objects have to hold the free-list link and are aligned like malloc does
+	const std::size_t align = sizeof(double) > sizeof(void*) ? sizeof(double) : sizeof(void*);
+	m_objSize = std::max(objSize, sizeof(void*));
+	m_objSize = (m_objSize + align - 1) / align * align;
+
+	#ifdef UG_OPENMP
+		omp_init_lock(&m_lock);
+	#endif
+}
+
+SlabAllocator::
+~SlabAllocator()
+{
+	release();
+	#ifdef UG_OPENMP
+		omp_destroy_lock(&m_lock);
+	#endif
+}
+
+void SlabAllocator::
+lock() const
+{
+	#ifdef UG_OPENMP
+		omp_set_lock(&m_lock);
+	#endif
+}
+
+void SlabAllocator::
+unlock() const
+{
+	#ifdef UG_OPENMP
+		omp_unset_lock(&m_lock);
+	#endif
+}
+
+void SlabAllocator::
+add_slab()
+{
+	const std::size_t size = m_nextObjsPerSlab * m_objSize;
+	char* slab = static_cast<char*>(std::malloc(size));
+	if(!slab)
+		throw std::bad_alloc();
+
+	Slab s(slab, slab + size);
+	m_vSlab.insert(std::upper_bound(m_vSlab.begin(), m_vSlab.end(), s), s);
+	m_pCur = s.first;
+	m_pCurEnd = s.second;
+	m_memory += size;
+
+//	small containers only need small slabs, large ones get less slabs
+	m_nextObjsPerSlab = std::min(2 * m_nextObjsPerSlab, m_maxObjsPerSlab);
+}
+
+void* SlabAllocator::
+allocate()
+{
+	lock();
+	void* p;
+	if(m_pFree){
+		p = m_pFree;
+		m_pFree = *static_cast<void**>(m_pFree);
+	}
+	else{
+		if(m_pCur == m_pCurEnd){
+			try{
+				add_slab();
+			}
+			catch(...){
+				unlock();
+				throw;
+			}
+		}
+		p = m_pCur;
+		m_pCur += m_objSize;
+	}
+	++m_numAllocated;
+	unlock();
+	return p;
+}
+
+void SlabAllocator::
+deallocate(void* p)
+{
+	lock();
+	*static_cast<void**>(p) = m_pFree;
+	m_pFree = p;
+	--m_numAllocated;
+	unlock();
+}
+
+bool SlabAllocator::
+owns(const void* p) const
+{
+	const char* cp = static_cast<const char*>(p);
+	lock();
+	std::vector<Slab>::const_iterator iter =
+			std::upper_bound(m_vSlab.begin(), m_vSlab.end(), cp, AddressBeforeSlab);
+	bool bOwns = false;
+	if(iter != m_vSlab.begin()){
+		--iter;
+		bOwns = (cp < iter->second);
+	}
+	unlock();
+	return bOwns;
+}
+
+void SlabAllocator::
+release()
+{
+	lock();
+	for(std::size_t i = 0; i < m_vSlab.size(); ++i)
+		std::free(m_vSlab[i].first);
+	m_vSlab.clear();
+	m_nextObjsPerSlab = std::min<std::size_t>(32, m_maxObjsPerSlab);
+	m_memory = 0;
+	m_pCur = m_pCurEnd = NULL;
+	m_pFree = NULL;
+	m_numAllocated = 0;
+	unlock();
+}
+
+}//	end of namespace
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__COMMON__SLAB_ALLOCATOR__
+#define __H__UG__COMMON__SLAB_ALLOCATOR__
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#ifdef UG_OPENMP
+	#include <omp.h>
+#endif
+
+namespace ug{
+
+///	Allocates objects of a fixed size in large slabs of memory
+/**	In contrast to the FixedAllocator of the SmallObjectAllocator, the
+ * SlabAllocator is intended to be owned by a container of many objects (e.g.
+ * one instance per object type of a Grid). Objects are placed consecutively
+ * in creation order into slabs, whose size grows geometrically from a few
+ * objects up to a maximal number of objects per slab. Freed objects
+ * are kept in a free list and reused by subsequent allocations. The whole
+ * memory can be released at once in O(#slabs) through release(), without
+ * deallocating the single objects.
+ *
+ * The allocator only provides raw memory. Objects have to be constructed via
+ * placement new and destroyed by an explicit destructor call.
+ *
+ * If ug is compiled with OpenMP, allocate and deallocate are guarded by a
+ * lock, so that different threads may create objects concurrently.
+ */
+class SlabAllocator
+{
+	public:
+	///	constructor
+	/**	\param objSize			size of the allocated objects in bytes
+	 *	\param maxObjsPerSlab	maximal number of objects stored in one slab*/
+		SlabAllocator(std::size_t objSize, std::size_t maxObjsPerSlab = 4096);
+
+	///	destructor, releases all slabs
+		~SlabAllocator();
+
+	///	returns memory for one object
+		void* allocate();
+
+	///	returns the memory of an object to the allocator
+	/**	p must have been allocated by this instance.*/
+		void deallocate(void* p);
+
+	///	returns if p points into a slab of this allocator
+		bool owns(const void* p) const;
+
+	///	releases all slabs at once. All previously allocated memory gets invalid.
+		void release();
+
+	///	size of the allocated objects (including padding)
+		std::size_t object_size() const		{return m_objSize;}
+
+	///	maximal number of objects per slab
+		std::size_t max_objects_per_slab() const	{return m_maxObjsPerSlab;}
+
+	///	number of currently allocated slabs
+		std::size_t num_slabs() const		{return m_vSlab.size();}
+
+	///	number of objects currently in use
+		std::size_t num_allocated() const	{return m_numAllocated;}
+
+	///	memory currently held by the allocator in bytes
+		std::size_t memory() const	{return m_memory;}
+
+	private:
+	//	the allocator is not copyable
+		SlabAllocator(const SlabAllocator&);
+		SlabAllocator& operator=(const SlabAllocator&);
+
+	///	allocates a new slab and makes it the current one
+		void add_slab();
+
+		void lock() const;
+		void unlock() const;
+
+	private:
+		std::size_t m_objSize;
+		std::size_t m_maxObjsPerSlab;
+		std::size_t m_nextObjsPerSlab;
+		std::size_t m_numAllocated;
+		std::size_t m_memory;
+
+	///	slabs (begin, end) sorted by address (used for owns())
+		typedef std::pair<char*, char*> Slab;
+		std::vector<Slab> m_vSlab;
+
+	///	next unused position in the current slab and its end
+		char* m_pCur;
+		char* m_pCurEnd;
+
+	///	singly linked list of freed objects (the link is stored inside the object)
+		void* m_pFree;
+
+	#ifdef UG_OPENMP
+		mutable omp_lock_t m_lock;
+	#endif
+};
+
+}//	end of namespace
+
+#endif
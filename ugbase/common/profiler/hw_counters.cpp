@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include "hw_counters.h"
+#include <map>
+#include <cstring>
+#include "common/log.h"
+#include "common/error.h"
+
+#if defined(UG_HW_COUNTERS) && defined(UG_PROFILER_SHINY) && defined(__linux__)
+	#include <unistd.h>
+	#include <errno.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <linux/perf_event.h>
+	#define UG_HW_COUNTERS_AVAILABLE
+#endif
+
+using namespace std;
+
+namespace ug{
+
+double HWCounterValues::ipc() const
+{
+	if(v[HWC_CYCLES] == 0) return 0;
+	return (double)v[HWC_INSTRUCTIONS] / (double)v[HWC_CYCLES];
+}
+
+double HWCounterValues::cache_miss_ratio() const
+{
+	if(v[HWC_CACHE_REFERENCES] == 0) return 0;
+	return (double)v[HWC_CACHE_MISSES] / (double)v[HWC_CACHE_REFERENCES];
+}
+
+static size_t CacheLineSize()
+{
+#if defined(UG_HW_COUNTERS_AVAILABLE) && defined(_SC_LEVEL1_DCACHE_LINESIZE)
+	static long lineSize = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+	if(lineSize > 0)
+		return (size_t)lineSize;
+#endif
+	return 64;
+}
+
+double HWCounterValues::memory_bytes() const
+{
+	return (double)v[HWC_CACHE_MISSES] * (double)CacheLineSize();
+}
+
+double HWCounterValues::bytes_per_flop() const
+{
+	if(v[HWC_FLOPS] == 0) return 0;
+	return memory_bytes() / (double)v[HWC_FLOPS];
+}
+
+
+#ifdef UG_HW_COUNTERS_AVAILABLE
+
+bool g_bHWCounting = false;
+
+static size_t g_flopEventCode = 0;
+
+///	file descriptor of the group leader (-1 if counters are not open)
+static int g_groupFd = -1;
+static int g_fds[HWC_NUM_COUNTERS];
+
+///	counter type of each entry in the group, in the order of opening
+static HWCounterType g_slotCounter[HWC_NUM_COUNTERS];
+static size_t g_numSlots = 0;
+static uint64 g_lastValue[HWC_NUM_COUNTERS];
+
+static map<const Shiny::ProfileNode *, HWCounterValues> g_selfCounters;
+static map<const Shiny::ProfileNode *, HWCounterValues> g_totalCounters;
+
+static int OpenPerfEvent(uint32_t type, uint64_t config, int groupFd)
+{
+	perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.size = sizeof(attr);
+	attr.type = type;
+	attr.config = config;
+	attr.disabled = (groupFd == -1) ? 1 : 0;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP;
+	return (int)syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0);
+}
+
+///	reads the current values of all slots. Returns false on failure.
+static inline bool ReadCounters(uint64* valuesOut)
+{
+	uint64 buf[1 + HWC_NUM_COUNTERS];
+	const ssize_t size = (ssize_t)((1 + g_numSlots) * sizeof(uint64));
+	if(read(g_groupFd, buf, size) != size)
+		return false;
+	for(size_t i = 0; i < g_numSlots; ++i)
+		valuesOut[i] = buf[1 + i];
+	return true;
+}
+
+static void CloseCounters()
+{
+	for(int i = 0; i < HWC_NUM_COUNTERS; ++i){
+		if(g_fds[i] != -1)
+			close(g_fds[i]);
+		g_fds[i] = -1;
+	}
+	g_groupFd = -1;
+	g_numSlots = 0;
+}
+
+static bool OpenCounters()
+{
+	for(int i = 0; i < HWC_NUM_COUNTERS; ++i)
+		g_fds[i] = -1;
+	g_numSlots = 0;
+
+	const uint32_t types[HWC_NUM_COUNTERS] =
+		{PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+		 PERF_TYPE_HARDWARE, PERF_TYPE_RAW};
+	const uint64_t configs[HWC_NUM_COUNTERS] =
+		{PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+		 PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES,
+		 g_flopEventCode};
+
+	for(int i = 0; i < HWC_NUM_COUNTERS; ++i){
+		if(i == HWC_FLOPS && g_flopEventCode == 0)
+			continue;
+
+		int fd = OpenPerfEvent(types[i], configs[i], g_groupFd);
+		if(fd == -1){
+			if(i == HWC_CYCLES){
+				UG_LOG("WARNING: Couldn't open hardware performance counters ("
+					   << strerror(errno) << "). Check "
+					   "/proc/sys/kernel/perf_event_paranoid.\n");
+				return false;
+			}
+			UG_LOG("WARNING: Hardware performance counter " << i
+				   << " not available (" << strerror(errno) << ").\n");
+			continue;
+		}
+		if(g_groupFd == -1)
+			g_groupFd = fd;
+		g_fds[i] = fd;
+		g_slotCounter[g_numSlots++] = (HWCounterType)i;
+	}
+
+	ioctl(g_groupFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(g_groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	if(!ReadCounters(g_lastValue)){
+		CloseCounters();
+		return false;
+	}
+	return true;
+}
+
+void HWCountersAppendToNode(const Shiny::ProfileNode* node)
+{
+	uint64 values[HWC_NUM_COUNTERS];
+	if(!ReadCounters(values))
+		return;
+
+	HWCounterValues& self = g_selfCounters[node];
+	for(size_t i = 0; i < g_numSlots; ++i){
+		self.v[g_slotCounter[i]] += values[i] - g_lastValue[i];
+		g_lastValue[i] = values[i];
+	}
+}
+
+bool HasHWCounters()
+{
+	return true;
+}
+
+bool EnableHWCounters(bool b)
+{
+	const bool bPrev = g_bHWCounting;
+	if(b == bPrev)
+		return bPrev;
+
+	if(b){
+		if(g_groupFd == -1 && !OpenCounters())
+			return bPrev;
+	//	attribute everything up to now to the current node and start from here
+		ioctl(g_groupFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+		ReadCounters(g_lastValue);
+		g_bHWCounting = true;
+	}
+	else{
+		HWCountersAppendToNode(Shiny::ProfileManager::instance._curNode);
+		ioctl(g_groupFd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+		g_bHWCounting = false;
+	}
+	return bPrev;
+}
+
+bool IsHWCountersEnabled()
+{
+	return g_bHWCounting;
+}
+
+bool HWCounterAvailable(HWCounterType c)
+{
+	return g_fds[c] != -1 && g_groupFd != -1;
+}
+
+void SetHWCounterFlopEvent(size_t rawEventCode)
+{
+	UG_COND_THROW(g_groupFd != -1, "SetHWCounterFlopEvent has to be called "
+				  "before the hardware counters are enabled.");
+	g_flopEventCode = rawEventCode;
+}
+
+static void CalcTotalHWCounters(const Shiny::ProfileNode *p)
+{
+	HWCounterValues total = g_selfCounters[p];
+	for(const Shiny::ProfileNode *c=p->firstChild; c != NULL; c=c->nextSibling)
+	{
+		if(g_totalCounters.find(c) == g_totalCounters.end())
+			CalcTotalHWCounters(c);
+		total += g_totalCounters[c];
+		if(c==p->lastChild)
+			break;
+	}
+	g_totalCounters[p] = total;
+}
+
+void UpdateTotalHWCounters()
+{
+	if(g_bHWCounting)
+		HWCountersAppendToNode(Shiny::ProfileManager::instance._curNode);
+	g_totalCounters.clear();
+	CalcTotalHWCounters(&Shiny::ProfileManager::instance.rootNode);
+}
+
+HWCounterValues GetSelfHWCounters(const Shiny::ProfileNode *p)
+{
+	map<const Shiny::ProfileNode *, HWCounterValues>::const_iterator it
+		= g_selfCounters.find(p);
+	if(it != g_selfCounters.end())
+		return it->second;
+	return HWCounterValues();
+}
+
+HWCounterValues GetTotalHWCounters(const Shiny::ProfileNode *p)
+{
+	map<const Shiny::ProfileNode *, HWCounterValues>::const_iterator it
+		= g_totalCounters.find(p);
+	if(it != g_totalCounters.end())
+		return it->second;
+	return HWCounterValues();
+}
+
+#else
+
+#if defined(UG_HW_COUNTERS) && defined(UG_PROFILER_SHINY)
+//	referenced by the Shiny hook, counting is never enabled on this system
+bool g_bHWCounting = false;
+void HWCountersAppendToNode(const Shiny::ProfileNode*)	{}
+#endif
+
+bool HasHWCounters()
+{
+	return false;
+}
+
+bool EnableHWCounters(bool b)
+{
+	if(b){
+		UG_LOG("WARNING: Hardware counters not available. Enable with "
+			   "'cmake -DPROFILER=Shiny -DSHINY_HW_COUNTERS=ON ..' (Linux only).\n");
+	}
+	return false;
+}
+
+bool IsHWCountersEnabled()
+{
+	return false;
+}
+
+bool HWCounterAvailable(HWCounterType)
+{
+	return false;
+}
+
+void SetHWCounterFlopEvent(size_t)
+{
+}
+
+void UpdateTotalHWCounters()
+{
+}
+
+#ifdef UG_PROFILER_SHINY
+HWCounterValues GetSelfHWCounters(const Shiny::ProfileNode *)
+{
+	return HWCounterValues();
+}
+
+HWCounterValues GetTotalHWCounters(const Shiny::ProfileNode *)
+{
+	return HWCounterValues();
+}
+#endif
+
+#endif
+
+}//	end of namespace
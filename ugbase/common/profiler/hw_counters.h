@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+/*
+ * Hardware performance counters for Shiny profile nodes.
+ *
+ * Enable support with
+ * cmake -DPROFILER=Shiny -DSHINY_HW_COUNTERS=ON ..
+ * (Linux only, uses perf_event_open).
+ *
+ * With EnableHWCounters(true) the counters are started. On every change of
+ * the active profile node the counters are read and the difference is
+ * attributed to the node which was active, the same way Shiny attributes
+ * ticks. The counters then show up in the call tree output, in the XML file
+ * written by WriteProfileDataXML and in UGProfileNode::hw_counters, which
+ * aggregates them over all processes.
+ *
+ * Note that reading the counters costs a system call, so instrumented
+ * regions become more expensive while counting. Only the calling thread
+ * is counted.
+ *
+ * The number of floating point operations has no generic perf event.
+ * Use SetHWCounterFlopEvent with the raw event code of your cpu (e.g.
+ * FP_ARITH_INST_RETIRED on Intel) to obtain flop counts and bytes per flop.
+ * Memory traffic is estimated from last level cache misses.
+ */
+
+#ifndef __H__UG__COMMON__PROFILER__HW_COUNTERS__
+#define __H__UG__COMMON__PROFILER__HW_COUNTERS__
+
+#include <cstddef>
+#include "common/types.h"
+#include "common/profiler/profiler.h"
+
+namespace ug{
+
+enum HWCounterType
+{
+	HWC_CYCLES = 0,
+	HWC_INSTRUCTIONS,
+	HWC_CACHE_REFERENCES,
+	HWC_CACHE_MISSES,
+	HWC_FLOPS,
+	HWC_NUM_COUNTERS
+};
+
+///	values of all hardware counters of one profile node
+struct HWCounterValues
+{
+	HWCounterValues()	{clear();}
+	void clear()	{for(int i = 0; i < HWC_NUM_COUNTERS; ++i) v[i] = 0;}
+
+	HWCounterValues& operator+=(const HWCounterValues& o)
+	{
+		for(int i = 0; i < HWC_NUM_COUNTERS; ++i) v[i] += o.v[i];
+		return *this;
+	}
+
+	double ipc() const;
+	double cache_miss_ratio() const;
+///	estimated memory traffic in bytes (cache misses times cache line size)
+	double memory_bytes() const;
+	double bytes_per_flop() const;
+
+	uint64 v[HWC_NUM_COUNTERS];
+};
+
+///	true if ug was compiled with hardware counter support
+bool HasHWCounters();
+
+///	starts or stops counting. Returns the previous state.
+/**	If the counters can't be opened (e.g. due to perf_event_paranoid),
+ * a warning is printed and counting stays disabled.*/
+bool EnableHWCounters(bool b);
+
+bool IsHWCountersEnabled();
+
+///	true if the given counter could be opened
+bool HWCounterAvailable(HWCounterType c);
+
+///	sets the raw perf event code used to count floating point operations
+/**	Has to be called before EnableHWCounters(true). 0 disables flop counting.*/
+void SetHWCounterFlopEvent(size_t rawEventCode);
+
+///	computes the total counter values of all profile nodes
+void UpdateTotalHWCounters();
+
+#ifdef UG_PROFILER_SHINY
+HWCounterValues GetSelfHWCounters(const Shiny::ProfileNode *p);
+HWCounterValues GetTotalHWCounters(const Shiny::ProfileNode *p);
+#endif
+
+}//	end of namespace
+
+#endif
@@ -48,6 +48,7 @@
 #include "pcl/pcl_base.h"
 #include "common/error.h"
 #include "memtracker.h"
+#include "hw_counters.h"
 
 #ifdef UG_PARALLEL
 #include "pcl/pcl.h"
@@ -67,6 +68,7 @@ void ProfilerUpdate()
 {
 	Shiny::ProfileManager::instance.update(1.0);
 	UpdateTotalMem();
+	UpdateTotalHWCounters();
 }
 
 
@@ -144,6 +146,38 @@ string UGProfileNode::get_mem_info(double fullMem) const
 		return "";
 }
 
+string UGProfileNode::get_hw_counter_info() const
+{
+	if(!HasHWCounters())
+		return "";
+
+	HWCounterValues c = GetTotalHWCounters(this);
+//	nothing was counted if counting was never enabled
+	if(!IsHWCountersEnabled() && c.v[HWC_CYCLES] == 0)
+		return "HWC not enabled  ";
+
+	stringstream s;
+	s << fixed << setprecision(2)
+	  << "IPC " << setw(5) << c.ipc()
+	  << "  miss " << setw(5) << c.cache_miss_ratio() * 100 << "%  ";
+	if(HWCounterAvailable(HWC_FLOPS))
+		s << "B/F " << setw(7) << c.bytes_per_flop() << "  ";
+	return s.str();
+}
+
+static void PDXML_write_hw_counters(ostream &s, const char *tag,
+									const HWCounterValues &c)
+{
+	s << "<" << tag
+	  << " cycles=\"" << c.v[HWC_CYCLES] << "\""
+	  << " instructions=\"" << c.v[HWC_INSTRUCTIONS] << "\""
+	  << " cacheReferences=\"" << c.v[HWC_CACHE_REFERENCES] << "\""
+	  << " cacheMisses=\"" << c.v[HWC_CACHE_MISSES] << "\"";
+	if(HWCounterAvailable(HWC_FLOPS))
+		s << " flops=\"" << c.v[HWC_FLOPS] << "\"";
+	s << "/>\n";
+}
+
 string UGProfileNode::call_tree(double dSkipMarginal) const
 {
 	if(!valid()) return "Profile Node not valid!";
@@ -244,6 +278,12 @@ void UGProfileNode::PDXML_rec_write(ostream &s) const
 		s << "<totalMemory>" << get_total_mem() << "</totalMemory>\n";
 		s << "<selfMemory>" << get_self_mem() << "</selfMemory>\n";
 	}
+
+	if(HasHWCounters())
+	{
+		PDXML_write_hw_counters(s, "totalHWCounters", GetTotalHWCounters(this));
+		PDXML_write_hw_counters(s, "selfHWCounters", GetSelfHWCounters(this));
+	}
 			
 	for(const UGProfileNode *p=get_first_child(); p != NULL; p=p->get_next_sibling())
 	{
@@ -322,6 +362,7 @@ string UGProfileNode::print_node(double fullMs, double fullMem, size_t offset) c
 			right << setw(PROFILER_BRIDGE_OUTPUT_WIDTH_PERC) << floor(get_avg_total_time_ms() / fullMs * 100) << "%  ";
 	if(fullMem >= 0.0)
 		s << get_mem_info(fullMem);
+	s << get_hw_counter_info();
 	if(zone->groups != NULL)
 		s << zone->groups;
 	return s.str();
@@ -426,6 +467,101 @@ string UGProfileNode::groups() const
 	return s.str();
 }
 
+struct HWCounterZoneCmp
+{
+	bool operator()(const pair<string, HWCounterValues> &a,
+					const pair<string, HWCounterValues> &b) const
+	{
+		return a.second.v[HWC_CYCLES] > b.second.v[HWC_CYCLES];
+	}
+};
+
+string UGProfileNode::hw_counters() const
+{
+	if (!valid()) return "Profile Node not valid!";
+	if(!HasHWCounters())
+		return "Hardware counters not available! Enable with "
+			   "'cmake -DSHINY_HW_COUNTERS=ON ..'";
+
+	ProfilerUpdate();
+
+	vector<const UGProfileNode*> nodes;
+	rec_add_nodes(nodes);
+
+	map<string, HWCounterValues> mapZones;
+	for(size_t i=0; i<nodes.size(); i++)
+		mapZones[nodes[i]->zone->name] += GetSelfHWCounters(nodes[i]);
+
+	vector<string> names;
+#ifdef UG_PARALLEL
+	if(pcl::ProcRank() == 0)
+#endif
+	for(map<string, HWCounterValues>::iterator it = mapZones.begin(); it != mapZones.end(); ++it)
+		names.push_back(it->first);
+
+	const size_t numCounters = HWC_NUM_COUNTERS;
+	vector<double> vals;
+	vector<double> cycles, cyclesMax;
+#ifdef UG_PARALLEL
+	pcl::ProcessCommunicator pc;
+	pc.broadcast(names);
+#endif
+	vals.resize(names.size() * numCounters);
+	cycles.resize(names.size());
+	for(size_t i=0; i<names.size(); i++){
+		const HWCounterValues &c = mapZones[names[i]];
+		for(size_t j=0; j<numCounters; j++)
+			vals[i*numCounters + j] = (double)c.v[j];
+		cycles[i] = (double)c.v[HWC_CYCLES];
+	}
+	cyclesMax = cycles;
+	int numProcs = 1;
+#ifdef UG_PARALLEL
+	vector<double> valsSum;
+	pc.allreduce(vals, valsSum, PCL_RO_SUM);
+	vals.swap(valsSum);
+	pc.allreduce(cycles, cyclesMax, PCL_RO_MAX);
+	numProcs = pc.size();
+#endif
+
+	vector<pair<string, HWCounterValues> > zones(names.size());
+	map<string, double> imbalance;
+	for(size_t i=0; i<names.size(); i++){
+		zones[i].first = names[i];
+		for(size_t j=0; j<numCounters; j++)
+			zones[i].second.v[j] = (uint64)vals[i*numCounters + j];
+		const double avg = vals[i*numCounters + HWC_CYCLES] / numProcs;
+		imbalance[names[i]] = (avg > 0) ? cyclesMax[i] / avg : 1.0;
+	}
+	sort(zones.begin(), zones.end(), HWCounterZoneCmp());
+
+	stringstream s;
+	s << "hardware counters (self, summed over " << numProcs << " processes)\n";
+	s << left << setw(PROFILER_BRIDGE_OUTPUT_WIDTH_NAME) << "zone" << right
+	  << setw(14) << "cycles" << setw(8) << "IPC" << setw(9) << "miss %"
+	  << setw(12) << "memory";
+	if(HWCounterAvailable(HWC_FLOPS))
+		s << setw(14) << "flops" << setw(9) << "B/F";
+	s << setw(10) << "max/avg" << "\n";
+
+	for(size_t i=0; i<zones.size(); i++)
+	{
+		const HWCounterValues &c = zones[i].second;
+		if(c.v[HWC_CYCLES] == 0) continue;
+		s << left << setw(PROFILER_BRIDGE_OUTPUT_WIDTH_NAME)
+		  << cut(zones[i].first.c_str(), PROFILER_BRIDGE_OUTPUT_WIDTH_NAME) << right
+		  << setw(14) << c.v[HWC_CYCLES]
+		  << fixed << setprecision(2)
+		  << setw(8) << c.ipc()
+		  << setw(9) << c.cache_miss_ratio() * 100
+		  << setw(12) << GetBytesSizeString((size_t)c.memory_bytes());
+		if(HWCounterAvailable(HWC_FLOPS))
+			s << setw(14) << c.v[HWC_FLOPS] << setw(9) << c.bytes_per_flop();
+		s << setw(10) << imbalance[zones[i].first] << "\n";
+	}
+	return s.str();
+}
+
 
 void UGProfileNode::rec_add_nodes(vector<const UGProfileNode*> &nodes) const
 {
@@ -1030,6 +1166,11 @@ string UGProfileNode::groups() const
 	return "Profiler not available!";
 }
 
+string UGProfileNode::hw_counters() const
+{
+	return "Profiler not available!";
+}
+
 const UGProfileNode *GetProfileNode(const char *name)
 {
 	return PROFILER_NULL_NODE;
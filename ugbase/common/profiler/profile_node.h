@@ -121,6 +121,12 @@ public:
 	 */
 	std::string groups() const;
 
+	/**
+	 * @return hardware counters of this node and its subnodes, accumulated by
+	 * 		   profile zone and summed over all processes
+	 */
+	std::string hw_counters() const;
+
 	/// \return true if node has been found
 	bool valid() const;
 
@@ -167,6 +173,11 @@ private:
 	 */
 	std::string get_mem_info(double fullMem) const;
 
+	/**
+	 * @brief prints the hardware counter information of a node (IPC, cache miss ratio, bytes per flop)
+	 */
+	std::string get_hw_counter_info() const;
+
 
 	/**
 	 * @brief recursive print this node and its subnodes into stringstream s
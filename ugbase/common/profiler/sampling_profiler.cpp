@@ -0,0 +1,653 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include "sampling_profiler.h"
+#include "profiler.h"
+#include <vector>
+#include <map>
+#include <string>
+#include <sstream>
+#include <fstream>
+#include <iomanip>
+#include <algorithm>
+#include <limits>
+#include <cstring>
+#include "common/log.h"
+#include "common/error.h"
+#include "common/util/demangle.h"
+#include "common/util/string_util.h"
+
+#ifdef UG_POSIX
+	#include <errno.h>
+	#include <signal.h>
+	#include <time.h>
+	#include <sys/time.h>
+	#include <dlfcn.h>
+	#include <pthread.h>
+	#ifdef __APPLE__
+		#include <sys/ucontext.h>
+	#else
+		#include <ucontext.h>
+	#endif
+	#define UG_SAMPLING_PROFILER_AVAILABLE
+#endif
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+#endif
+
+using namespace std;
+
+namespace ug{
+
+static const size_t SAMPLE_DEFAULT_MAX_SAMPLES = 50000;
+static const size_t SAMPLE_MAX_FRAMES = 32;
+
+struct ProfileSample
+{
+	double time;		///< wall clock time in seconds
+	const void* node;	///< active Shiny profile node (or NULL)
+	size_t numFrames;	///< number of valid entries in frames
+	const void* frames[SAMPLE_MAX_FRAMES];	///< interrupted instruction followed by return addresses
+};
+
+static vector<ProfileSample> g_samples;
+static volatile size_t g_numSamples = 0;
+static volatile size_t g_numDropped = 0;
+static double g_samplePeriod = 0.001;
+
+#ifdef UG_SAMPLING_PROFILER_AVAILABLE
+static volatile sig_atomic_t g_bSampling = 0;
+static struct sigaction g_oldSigAction;
+
+///	stack of the thread which started sampling, the only one which is unwound
+static const char* g_stackLow = NULL;
+static const char* g_stackHigh = NULL;
+
+static inline const void* CurrentProfileNode()
+{
+#if SHINY_PROFILER
+	return Shiny::ProfileManager::instance._curNode;
+#else
+	return NULL;
+#endif
+}
+
+///	registers of the interrupted thread which are needed for unwinding
+struct InterruptedRegisters
+{
+	const void* pc;		///< program counter
+	const char* fp;		///< frame pointer
+	const char* sp;		///< stack pointer
+};
+
+///	reads the registers from the signal context. NULL on unsupported platforms.
+static inline void GetInterruptedRegisters(InterruptedRegisters& regs, void* context)
+{
+	const ucontext_t* uc = (const ucontext_t*) context;
+#if defined(__linux__) && defined(__x86_64__)
+	regs.pc = (const void*) uc->uc_mcontext.gregs[REG_RIP];
+	regs.fp = (const char*) uc->uc_mcontext.gregs[REG_RBP];
+	regs.sp = (const char*) uc->uc_mcontext.gregs[REG_RSP];
+#elif defined(__linux__) && defined(__i386__)
+	regs.pc = (const void*) uc->uc_mcontext.gregs[REG_EIP];
+	regs.fp = (const char*) uc->uc_mcontext.gregs[REG_EBP];
+	regs.sp = (const char*) uc->uc_mcontext.gregs[REG_ESP];
+#elif defined(__linux__) && defined(__aarch64__)
+	regs.pc = (const void*) uc->uc_mcontext.pc;
+	regs.fp = (const char*) uc->uc_mcontext.regs[29];
+	regs.sp = (const char*) uc->uc_mcontext.sp;
+#elif defined(__APPLE__) && defined(__x86_64__)
+	regs.pc = (const void*) uc->uc_mcontext->__ss.__rip;
+	regs.fp = (const char*) uc->uc_mcontext->__ss.__rbp;
+	regs.sp = (const char*) uc->uc_mcontext->__ss.__rsp;
+#elif defined(__APPLE__) && defined(__aarch64__)
+	regs.pc = (const void*) uc->uc_mcontext->__ss.__pc;
+	regs.fp = (const char*) uc->uc_mcontext->__ss.__fp;
+	regs.sp = (const char*) uc->uc_mcontext->__ss.__sp;
+#else
+	(void) uc;
+	regs.pc = NULL;
+	regs.fp = NULL;
+	regs.sp = NULL;
+#endif
+}
+
+///	determines the stack of the calling thread
+static void GetCurrentThreadStack(const char*& lowOut, const char*& highOut)
+{
+	lowOut = highOut = NULL;
+#if defined(__linux__)
+	pthread_attr_t attr;
+	if(pthread_getattr_np(pthread_self(), &attr) != 0)
+		return;
+	void* addr;
+	size_t size;
+	if(pthread_attr_getstack(&attr, &addr, &size) == 0){
+		lowOut = (const char*) addr;
+		highOut = lowOut + size;
+	}
+	pthread_attr_destroy(&attr);
+#elif defined(__APPLE__)
+	highOut = (const char*) pthread_get_stackaddr_np(pthread_self());
+	lowOut = highOut - pthread_get_stacksize_np(pthread_self());
+#endif
+}
+
+///	writes the interrupted instruction and the return addresses of its callers
+/**	The chain of frame pointers is followed, where each frame holds the
+ * frame pointer of its caller followed by the return address. This is
+ * async-signal-safe, since only memory of the interrupted stack between
+ * the stack pointer and the top of the stack is read. The chain ends if
+ * a frame pointer leaves this range, is misaligned or doesn't grow towards
+ * the top of the stack.
+ *
+ * Only the thread which started sampling is unwound. If another thread was
+ * interrupted, or if the code was compiled without frame pointers (see
+ * -fno-omit-frame-pointer), only the interrupted function is reported.
+ * \returns	the number of frames written*/
+static size_t UnwindFramePointers(const void** framesOut, size_t maxFrames,
+								  const InterruptedRegisters& regs)
+{
+	if(!regs.pc || maxFrames == 0)
+		return 0;
+	size_t numFrames = 0;
+	framesOut[numFrames++] = regs.pc;
+
+	if(regs.sp < g_stackLow || regs.sp >= g_stackHigh)
+		return numFrames;
+
+	const char* fp = regs.fp;
+	const char* lower = regs.sp;
+	while(numFrames < maxFrames){
+		if(fp < lower || fp > g_stackHigh - 2 * sizeof(void*)
+		   || ((size_t)fp % sizeof(void*)) != 0)
+			break;
+
+		const void* const* frame = (const void* const*) fp;
+		if(!frame[1])
+			break;
+		framesOut[numFrames++] = frame[1];
+
+		lower = fp + 2 * sizeof(void*);
+		fp = (const char*) frame[0];
+	}
+	return numFrames;
+}
+
+///	records a sample. Only async-signal-safe operations are used in here.
+/**	backtrace and similar unwinders are not async-signal-safe. The stack is
+ * thus unwound by UnwindFramePointers into the fixed-size frame array of
+ * the sample. The addresses are resolved to function names when the
+ * samples are evaluated.*/
+static void SamplingSignalHandler(int, siginfo_t*, void* context)
+{
+	if(!g_bSampling) return;
+	const int savedErrno = errno;
+
+	const size_t i = __sync_fetch_and_add(&g_numSamples, 1);
+	if(i < g_samples.size()){
+		ProfileSample& s = g_samples[i];
+		timespec ts;
+		clock_gettime(CLOCK_REALTIME, &ts);
+		s.time = (double)ts.tv_sec + 1e-9 * (double)ts.tv_nsec;
+		s.node = CurrentProfileNode();
+		InterruptedRegisters regs;
+		GetInterruptedRegisters(regs, context);
+		s.numFrames = UnwindFramePointers(s.frames, SAMPLE_MAX_FRAMES, regs);
+	}
+	else
+		__sync_fetch_and_add(&g_numDropped, 1);
+
+	errno = savedErrno;
+}
+#endif
+
+
+void StartSamplingProfiler(double samplesPerSecond, size_t maxSamples)
+{
+#ifdef UG_SAMPLING_PROFILER_AVAILABLE
+	UG_COND_THROW(samplesPerSecond <= 0,
+				  "StartSamplingProfiler: samplesPerSecond has to be positive.");
+
+	if(g_bSampling)
+		StopSamplingProfiler();
+
+	g_samples.clear();
+	g_samples.resize(maxSamples);
+	g_numSamples = 0;
+	g_numDropped = 0;
+	GetCurrentThreadStack(g_stackLow, g_stackHigh);
+
+	struct sigaction sa;
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_sigaction = &SamplingSignalHandler;
+	sa.sa_flags = SA_RESTART | SA_SIGINFO;
+	sigemptyset(&sa.sa_mask);
+	UG_COND_THROW(sigaction(SIGPROF, &sa, &g_oldSigAction) != 0,
+				  "StartSamplingProfiler: Couldn't install signal handler.");
+
+	long usec = (long)(1e6 / samplesPerSecond);
+	if(usec < 1) usec = 1;
+	g_samplePeriod = 1e-6 * (double)usec;
+
+	itimerval timer;
+	timer.it_interval.tv_sec = usec / 1000000;
+	timer.it_interval.tv_usec = usec % 1000000;
+	timer.it_value = timer.it_interval;
+
+	g_bSampling = 1;
+	if(setitimer(ITIMER_PROF, &timer, NULL) != 0){
+		g_bSampling = 0;
+		sigaction(SIGPROF, &g_oldSigAction, NULL);
+		UG_THROW("StartSamplingProfiler: Couldn't start profiling timer.");
+	}
+#else
+	UG_LOG("WARNING: Sampling profiler is not available on this system.\n");
+#endif
+}
+
+void StartSamplingProfiler(double samplesPerSecond)
+{
+	StartSamplingProfiler(samplesPerSecond, SAMPLE_DEFAULT_MAX_SAMPLES);
+}
+
+void StartSamplingProfiler()
+{
+	StartSamplingProfiler(1000, SAMPLE_DEFAULT_MAX_SAMPLES);
+}
+
+void StopSamplingProfiler()
+{
+#ifdef UG_SAMPLING_PROFILER_AVAILABLE
+	if(!g_bSampling) return;
+
+	itimerval timer;
+	memset(&timer, 0, sizeof(timer));
+	setitimer(ITIMER_PROF, &timer, NULL);
+	g_bSampling = 0;
+	sigaction(SIGPROF, &g_oldSigAction, NULL);
+#endif
+}
+
+bool SamplingProfilerRunning()
+{
+#ifdef UG_SAMPLING_PROFILER_AVAILABLE
+	return g_bSampling != 0;
+#else
+	return false;
+#endif
+}
+
+bool SamplingProfilerAvailable()
+{
+#ifdef UG_SAMPLING_PROFILER_AVAILABLE
+	return true;
+#else
+	return false;
+#endif
+}
+
+size_t SamplingProfilerNumSamples()
+{
+	return std::min((size_t)g_numSamples, g_samples.size());
+}
+
+size_t SamplingProfilerNumDropped()
+{
+	return g_numDropped;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	evaluation of samples
+
+///	assigns ids to function names and resolves addresses to those ids
+class SampleSymbolTable
+{
+	public:
+		size_t id(const string& name)
+		{
+			map<string, size_t>::iterator it = m_nameToId.find(name);
+			if(it != m_nameToId.end())
+				return it->second;
+			m_names.push_back(name);
+			m_nameToId[name] = m_names.size() - 1;
+			return m_names.size() - 1;
+		}
+
+		size_t resolve(const void* addr)
+		{
+			map<const void*, size_t>::iterator it = m_addrToId.find(addr);
+			if(it != m_addrToId.end())
+				return it->second;
+
+			string name;
+		#ifdef UG_SAMPLING_PROFILER_AVAILABLE
+			Dl_info info;
+			memset(&info, 0, sizeof(info));
+			if(addr && dladdr(addr, &info) && info.dli_sname)
+				name = demangle(info.dli_sname);
+			else if(info.dli_fname)
+				name = string("[") + FilenameWithoutPath(info.dli_fname) + "]";
+		#endif
+			if(name.empty())
+				name = "[unknown]";
+
+			size_t i = id(name);
+			m_addrToId[addr] = i;
+			return i;
+		}
+
+		const string& name(size_t i) const	{return m_names[i];}
+		size_t num_symbols() const			{return m_names.size();}
+
+	private:
+		vector<string>		m_names;
+		map<string, size_t>	m_nameToId;
+		map<const void*, size_t>	m_addrToId;
+};
+
+///	symbol id of the function which was interrupted by a sample
+static size_t GetSampleFunction(const ProfileSample& s, SampleSymbolTable& symbols)
+{
+	return symbols.resolve(s.numFrames > 0 ? s.frames[0] : NULL);
+}
+
+///	unwound call stack of a sample, outermost function first
+/**	Return addresses point behind the call instruction, which may belong to
+ * the next function. They are thus resolved one byte earlier.*/
+static void GetSampleCallStack(vector<size_t>& stackOut, const ProfileSample& s,
+							   SampleSymbolTable& symbols)
+{
+	stackOut.clear();
+	for(size_t i = s.numFrames; i > 1; --i)
+		stackOut.push_back(symbols.resolve((const char*) s.frames[i - 1] - 1));
+	stackOut.push_back(GetSampleFunction(s, symbols));
+}
+
+///	stack of active Shiny profile nodes of a sample, outermost node first
+#if SHINY_PROFILER
+static void GetSampleZoneStack(vector<size_t>& stackOut, const ProfileSample& s,
+							   SampleSymbolTable& symbols)
+{
+	stackOut.clear();
+	const Shiny::ProfileNode* root = &Shiny::ProfileManager::instance.rootNode;
+	const Shiny::ProfileNode* node = (const Shiny::ProfileNode*) s.node;
+	while(node && node != root && node->parent != node){
+		stackOut.push_back(symbols.id(node->zone->name));
+		node = node->parent;
+	}
+	reverse(stackOut.begin(), stackOut.end());
+}
+#else
+static void GetSampleZoneStack(vector<size_t>& stackOut, const ProfileSample&,
+							   SampleSymbolTable&)
+{
+	stackOut.clear();
+}
+#endif
+
+struct CmpSampleTime{
+	bool operator()(size_t a, size_t b) const
+	{return g_samples[a].time < g_samples[b].time;}
+};
+
+///	indices of the recorded samples sorted by time
+static void GetSortedSampleIndices(vector<size_t>& indsOut)
+{
+	const size_t numSamples = SamplingProfilerNumSamples();
+	indsOut.resize(numSamples);
+	for(size_t i = 0; i < numSamples; ++i)
+		indsOut[i] = i;
+	stable_sort(indsOut.begin(), indsOut.end(), CmpSampleTime());
+}
+
+string SamplingProfilerSummary(size_t maxEntries)
+{
+	StopSamplingProfiler();
+
+	SampleSymbolTable symbols;
+	vector<size_t> count;
+
+	const size_t numSamples = SamplingProfilerNumSamples();
+	for(size_t i = 0; i < numSamples; ++i){
+		const size_t sym = GetSampleFunction(g_samples[i], symbols);
+		count.resize(symbols.num_symbols(), 0);
+		++count[sym];
+	}
+
+	vector<pair<size_t, size_t> > order;
+	for(size_t i = 0; i < count.size(); ++i)
+		if(count[i] > 0)
+			order.push_back(make_pair(count[i], i));
+	sort(order.rbegin(), order.rend());
+
+	stringstream ss;
+	ss << "Sampling profile: " << numSamples << " samples ("
+	   << g_numDropped << " dropped), sample period "
+	   << g_samplePeriod * 1e3 << " ms\n";
+	ss << setw(10) << "samples" << setw(8) << "%" << "  function\n";
+
+	const double perc = numSamples ? 100. / (double)numSamples : 0;
+	for(size_t i = 0; i < order.size() && i < maxEntries; ++i){
+		const size_t sym = order[i].second;
+		ss << setw(10) << count[sym]
+		   << setw(8) << fixed << setprecision(2) << perc * count[sym]
+		   << "  " << symbols.name(sym) << "\n";
+	}
+	return ss.str();
+}
+
+
+static void WriteJSONString(ostream& out, const string& str)
+{
+	out << '"';
+	for(size_t i = 0; i < str.size(); ++i){
+		const char c = str[i];
+		switch(c){
+			case '"':	out << "\\\""; break;
+			case '\\':	out << "\\\\"; break;
+			case '\n':	out << "\\n"; break;
+			case '\t':	out << "\\t"; break;
+			default:
+				if((unsigned char)c < 0x20)
+					out << ' ';
+				else
+					out << c;
+		}
+	}
+	out << '"';
+}
+
+///	writes complete events ("ph":"X") for the stacks of consecutive samples
+/**	Frames which are on the stack in consecutive samples are merged into one
+ * event. Times are given in seconds and are written in microseconds relative
+ * to t0.*/
+static void WriteStackTimeline(ostream& out, bool& first, int pid, int tid,
+							   const vector<vector<size_t> >& stacks,
+							   const vector<double>& times, double period,
+							   const SampleSymbolTable& symbols, double t0)
+{
+	vector<size_t> open;
+	vector<double> openStart;
+	double tPrev = 0;
+
+	for(size_t i = 0; i <= stacks.size(); ++i){
+		const bool last = (i == stacks.size());
+		const double t = last ? tPrev + period : times[i];
+
+	//	close all frames after gaps (e.g. while sampling was stopped)
+		const bool gap = (i > 0) && (t - tPrev > 3 * period);
+		const double tEnd = gap ? tPrev + period : t;
+
+		size_t numCommon = 0;
+		if(!last && !gap){
+			const vector<size_t>& stack = stacks[i];
+			while(numCommon < open.size() && numCommon < stack.size()
+				  && open[numCommon] == stack[numCommon])
+				++numCommon;
+		}
+
+		while(open.size() > numCommon){
+			if(!first) out << ",\n";
+			first = false;
+			out << "{\"name\":";
+			WriteJSONString(out, symbols.name(open.back()));
+			out << ",\"cat\":\"sample\",\"ph\":\"X\",\"pid\":" << pid
+				<< ",\"tid\":" << tid
+				<< ",\"ts\":" << (openStart.back() - t0) * 1e6
+				<< ",\"dur\":" << (tEnd - openStart.back()) * 1e6 << "}";
+			open.pop_back();
+			openStart.pop_back();
+		}
+
+		if(last) break;
+
+		const vector<size_t>& stack = stacks[i];
+		for(size_t j = numCommon; j < stack.size(); ++j){
+			open.push_back(stack[j]);
+			openStart.push_back(t);
+		}
+		tPrev = t;
+	}
+}
+
+///	writes the trace events of the local process
+static void WriteLocalTraceEvents(ostream& out, int pid, double t0)
+{
+	out << setprecision(15);
+
+	vector<size_t> inds;
+	GetSortedSampleIndices(inds);
+
+	SampleSymbolTable symbols;
+	vector<vector<size_t> > stacks(inds.size()), zoneStacks(inds.size());
+	vector<double> times(inds.size());
+	for(size_t i = 0; i < inds.size(); ++i){
+		const ProfileSample& s = g_samples[inds[i]];
+		times[i] = s.time;
+		GetSampleCallStack(stacks[i], s, symbols);
+		GetSampleZoneStack(zoneStacks[i], s, symbols);
+	}
+
+//	cpu timers are often only checked on scheduler ticks, so the actual
+//	distance of samples may be larger than requested
+	double period = g_samplePeriod;
+	if(times.size() > 1){
+		vector<double> dist(times.size() - 1);
+		for(size_t i = 0; i + 1 < times.size(); ++i)
+			dist[i] = times[i+1] - times[i];
+		nth_element(dist.begin(), dist.begin() + dist.size() / 2, dist.end());
+		period = max(period, dist[dist.size() / 2]);
+	}
+
+	bool first = true;
+	out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+		<< ",\"args\":{\"name\":\"rank " << pid << "\"}}";
+	first = false;
+	out << ",\n{\"name\":\"process_sort_index\",\"ph\":\"M\",\"pid\":" << pid
+		<< ",\"args\":{\"sort_index\":" << pid << "}}";
+	out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+		<< ",\"tid\":0,\"args\":{\"name\":\"functions (sampled)\"}}";
+	WriteStackTimeline(out, first, pid, 0, stacks, times, period, symbols, t0);
+
+#if SHINY_PROFILER
+	out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+		<< ",\"tid\":1,\"args\":{\"name\":\"profile nodes (sampled)\"}}";
+	WriteStackTimeline(out, first, pid, 1, zoneStacks, times, period, symbols, t0);
+#endif
+}
+
+void WriteSamplingTraceJSON(const char* filename)
+{
+	StopSamplingProfiler();
+
+//	all processes use the same time origin, so that their timelines match
+	const size_t numSamples = SamplingProfilerNumSamples();
+	double t0 = 0;
+	for(size_t i = 0; i < numSamples; ++i){
+		if(i == 0 || g_samples[i].time < t0)
+			t0 = g_samples[i].time;
+	}
+
+	int rank = 0;
+#ifdef UG_PARALLEL
+	rank = pcl::ProcRank();
+	pcl::ProcessCommunicator pc;
+	if(numSamples == 0)
+		t0 = numeric_limits<double>::max();
+	t0 = pc.allreduce(t0, PCL_RO_MIN);
+	if(t0 == numeric_limits<double>::max())
+		t0 = 0;
+#endif
+
+	stringstream local;
+	WriteLocalTraceEvents(local, rank, t0);
+
+#ifdef UG_PARALLEL
+	typedef pcl::SingleLevelLayout<pcl::OrderedInterface<size_t, vector> >
+		IndexLayout;
+	pcl::InterfaceCommunicator<IndexLayout> ic;
+
+	if(rank != 0){
+		BinaryBuffer buf;
+		Serialize(buf, local.str());
+		ic.send_raw(0, buf.buffer(), buf.write_pos(), false);
+		ic.communicate();
+		return;
+	}
+#endif
+
+	ofstream f(filename);
+	UG_COND_THROW(!f, "WriteSamplingTraceJSON: Couldn't open file " << filename);
+
+	f << "{\"traceEvents\":[\n" << local.str();
+
+#ifdef UG_PARALLEL
+	vector<BinaryBuffer> buffers(pcl::NumProcs() - 1);
+	for(int i = 1; i < pcl::NumProcs(); ++i)
+		ic.receive_raw(i, buffers[i-1]);
+	ic.communicate();
+
+	for(int i = 1; i < pcl::NumProcs(); ++i){
+		string s;
+		Deserialize(buffers[i-1], s);
+		f << ",\n" << s;
+	}
+#endif
+
+	f << "\n],\n\"displayTimeUnit\":\"ms\"}\n";
+}
+
+}//	end of namespace
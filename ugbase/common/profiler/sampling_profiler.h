@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+/*
+ * A sampling profiler which complements the Shiny instrumentation.
+ *
+ * While the PROFILE_BEGIN/PROFILE_FUNC macros create a call-tree node on every
+ * entry, the sampling profiler interrupts the process at a fixed rate
+ * (SIGPROF, driven by the consumed cpu time) and records the call stack of
+ * the interrupted function and - if Shiny is enabled - the currently active
+ * profile node. Hot kernels thus don't need any instrumentation and
+ * instrumented regions are not affected at all.
+ *
+ * The call stack is unwound in the signal handler by following the frame
+ * pointers (at most 32 frames) and resolved afterwards. Complete stacks are
+ * thus only recorded for code compiled with -fno-omit-frame-pointer and only
+ * for the thread which started sampling. Otherwise only the interrupted
+ * function is reported.
+ *
+ * \code
+ * StartSamplingProfiler(1000);	// 1000 samples per second of cpu time
+ * ...
+ * StopSamplingProfiler();
+ * WriteSamplingTraceJSON("trace.json");
+ * \endcode
+ *
+ * The trace is written in the Chrome trace event format, which can be viewed
+ * with chrome://tracing or https://ui.perfetto.dev. In parallel runs the
+ * samples of all processes are merged into one timeline (one process per rank).
+ *
+ * Sampling is only available on POSIX systems.
+ */
+
+#ifndef __H__UG__COMMON__PROFILER__SAMPLING_PROFILER__
+#define __H__UG__COMMON__PROFILER__SAMPLING_PROFILER__
+
+#include <string>
+#include <cstddef>
+
+namespace ug{
+
+/// \addtogroup ugbase_common
+/// \{
+
+///	starts recording samples with the given rate (in samples per cpu second)
+/**	Storage for maxSamples samples is allocated on start. Further samples are
+ * dropped once the storage is full. Samples recorded by a previous run are
+ * discarded.*/
+void StartSamplingProfiler(double samplesPerSecond, size_t maxSamples);
+
+///	starts recording samples with the given rate and room for 100000 samples
+void StartSamplingProfiler(double samplesPerSecond);
+
+///	starts recording 1000 samples per second with room for 50000 samples
+void StartSamplingProfiler();
+
+///	stops recording samples. Recorded samples are kept.
+void StopSamplingProfiler();
+
+///	returns true if samples are currently recorded
+bool SamplingProfilerRunning();
+
+///	returns true if sampling is supported on this system
+bool SamplingProfilerAvailable();
+
+///	number of recorded samples
+size_t SamplingProfilerNumSamples();
+
+///	number of samples which were dropped since the storage was full
+size_t SamplingProfilerNumDropped();
+
+///	returns a table of the functions in which most samples were taken
+/**	The table lists the number of samples which interrupted each function
+ * of the local process.*/
+std::string SamplingProfilerSummary(size_t maxEntries);
+
+///	Writes the samples of all processes as Chrome trace event JSON
+/**	Frames which are on the stack in consecutive samples are merged into one
+ * event, so the trace shows a timeline of the call stack and - if Shiny is
+ * enabled - of the profile node stack of each process.
+ * Process 0 writes the file. Has to be called by all processes.*/
+void WriteSamplingTraceJSON(const char* filename);
+
+/// \}
+
+}//	end of namespace
+
+#endif
@@ -34,6 +34,15 @@ restrictions:
 
 
 #if SHINY_PROFILER == TRUE
+
+//	ug: hook for hardware performance counters (see common/profiler/hw_counters.h)
+#ifdef UG_HW_COUNTERS
+namespace ug {
+	extern bool g_bHWCounting;
+	void HWCountersAppendToNode(const Shiny::ProfileNode* a_node);
+}
+#endif
+
 namespace Shiny {
 
 
@@ -88,6 +97,10 @@ namespace Shiny {
 
 			_curNode->appendTicks(curTick - _lastTick);
 			_lastTick = curTick;
+#ifdef UG_HW_COUNTERS
+			if(ug::g_bHWCounting)
+				ug::HWCountersAppendToNode(_curNode);
+#endif
 		}
 
 		ProfileNode* _lookupNode(ProfileNodeCache* a_cache, ProfileZone* a_zone);
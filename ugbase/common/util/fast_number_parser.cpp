@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <clocale>
+#include <limits>
+#include "fast_number_parser.h"
+#include "common/types.h"
+
+#include "omp_util.h"
+
+using namespace std;
+
+namespace ug
+{
+
+static inline bool IsSpace(char c)
+{
+	return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+static inline bool IsDigit(char c)
+{
+	return c >= '0' && c <= '9';
+}
+
+static inline const char* SkipSpace(const char* str, const char* end)
+{
+	while(str < end && IsSpace(*str))
+		++str;
+	return str;
+}
+
+///	parses a double through strtod, using '.' as decimal separator
+static const char* ParseDoubleSlow(const char* str, const char* end, double& valOut)
+{
+//	strtod requires a null terminated string in the current locale.
+	const char* tokEnd = str;
+	while(tokEnd < end && !IsSpace(*tokEnd))
+		++tokEnd;
+
+	char buf[64];
+	string longTok;
+	char* tok = buf;
+	const size_t tokLen = tokEnd - str;
+	if(tokLen >= sizeof(buf)){
+		longTok.resize(tokLen + 1);
+		tok = &longTok[0];
+	}
+	memcpy(tok, str, tokLen);
+	tok[tokLen] = 0;
+
+	const char decPt = *localeconv()->decimal_point;
+	if(decPt != '.'){
+		char* pt = strchr(tok, '.');
+		if(pt)
+			*pt = decPt;
+	}
+
+	char* parsedEnd;
+	valOut = strtod(tok, &parsedEnd);
+	if(parsedEnd == tok)
+		return NULL;
+	return str + (parsedEnd - tok);
+}
+
+const char* ParseNumber(const char* str, const char* end, double& valOut)
+{
+//	powers of ten which are exactly representable as double
+	static const double pow10[] = {
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+	str = SkipSpace(str, end);
+	const char* p = str;
+
+	bool negative = false;
+	if(p < end && (*p == '-' || *p == '+')){
+		negative = (*p == '-');
+		++p;
+	}
+
+//	collect up to 19 significant digits, which always fit into uint64
+	uint64 mantissa = 0;
+	int numSigDigits = 0;
+	int exp10 = 0;
+	bool gotDigit = false;
+	bool exact = true;
+
+	for(; p < end && IsDigit(*p); ++p){
+		gotDigit = true;
+		if(numSigDigits < 19){
+			mantissa = mantissa * 10 + (*p - '0');
+			if(mantissa)
+				++numSigDigits;
+		}
+		else{
+			exact = false;
+			++exp10;
+		}
+	}
+
+	if(p < end && *p == '.'){
+		for(++p; p < end && IsDigit(*p); ++p){
+			gotDigit = true;
+			if(numSigDigits < 19){
+				mantissa = mantissa * 10 + (*p - '0');
+				if(mantissa)
+					++numSigDigits;
+				--exp10;
+			}
+			else
+				exact = false;
+		}
+	}
+
+	if(!gotDigit){
+	//	inf and nan are left to strtod
+		if(p < end && (*p == 'i' || *p == 'I' || *p == 'n' || *p == 'N'))
+			return ParseDoubleSlow(str, end, valOut);
+		return NULL;
+	}
+
+	if(p < end && (*p == 'e' || *p == 'E')){
+	//	the exponent is only consumed if it contains digits
+		const char* q = p + 1;
+		bool negExp = false;
+		if(q < end && (*q == '-' || *q == '+')){
+			negExp = (*q == '-');
+			++q;
+		}
+		if(q < end && IsDigit(*q)){
+			int e = 0;
+			for(; q < end && IsDigit(*q); ++q){
+				if(e < 100000)
+					e = e * 10 + (*q - '0');
+			}
+			exp10 += negExp ? -e : e;
+			p = q;
+		}
+	}
+
+//	Clinger's fast path: mantissa and power of ten are exact doubles, so a
+//	single multiplication or division gives the correctly rounded result.
+	if(mantissa == 0 && exact){
+		valOut = negative ? -0.0 : 0.0;
+		return p;
+	}
+
+	if(!exact || mantissa > (uint64(1) << 53) || exp10 < -22 || exp10 > 22)
+		return ParseDoubleSlow(str, end, valOut);
+
+	double val = static_cast<double>(mantissa);
+	if(exp10 < 0)	val /= pow10[-exp10];
+	else			val *= pow10[exp10];
+	valOut = negative ? -val : val;
+	return p;
+}
+
+const char* ParseNumber(const char* str, const char* end, float& valOut)
+{
+	double d;
+	const char* p = ParseNumber(str, end, d);
+	if(p)
+		valOut = static_cast<float>(d);
+	return p;
+}
+
+///	parses the digits of an integer. Returns NULL on overflow of maxVal.
+static const char*
+ParseDigits(const char* p, const char* end, unsigned long long maxVal,
+			unsigned long long& valOut)
+{
+	if(p == end || !IsDigit(*p))
+		return NULL;
+
+	unsigned long long val = 0;
+	for(; p < end && IsDigit(*p); ++p){
+		unsigned int d = *p - '0';
+		if(val > (maxVal - d) / 10)
+			return NULL;
+		val = val * 10 + d;
+	}
+	valOut = val;
+	return p;
+}
+
+template <class TInt>
+static const char* ParseSigned(const char* str, const char* end, TInt& valOut)
+{
+	str = SkipSpace(str, end);
+	bool negative = false;
+	if(str < end && (*str == '-' || *str == '+')){
+		negative = (*str == '-');
+		++str;
+	}
+
+	const unsigned long long maxPos = numeric_limits<TInt>::max();
+	unsigned long long val;
+	const char* p = ParseDigits(str, end, negative ? maxPos + 1 : maxPos, val);
+	if(p){
+		if(negative)
+			valOut = (val == maxPos + 1) ? numeric_limits<TInt>::min()
+										 : -static_cast<TInt>(val);
+		else
+			valOut = static_cast<TInt>(val);
+	}
+	return p;
+}
+
+template <class TUInt>
+static const char* ParseUnsigned(const char* str, const char* end, TUInt& valOut)
+{
+	str = SkipSpace(str, end);
+	if(str < end && *str == '+')
+		++str;
+
+	unsigned long long val;
+	const char* p = ParseDigits(str, end, numeric_limits<TUInt>::max(), val);
+	if(p)
+		valOut = static_cast<TUInt>(val);
+	return p;
+}
+
+const char* ParseNumber(const char* str, const char* end, int& valOut)
+{
+	return ParseSigned(str, end, valOut);
+}
+
+const char* ParseNumber(const char* str, const char* end, long& valOut)
+{
+	return ParseSigned(str, end, valOut);
+}
+
+const char* ParseNumber(const char* str, const char* end, long long& valOut)
+{
+	return ParseSigned(str, end, valOut);
+}
+
+const char* ParseNumber(const char* str, const char* end, unsigned int& valOut)
+{
+	return ParseUnsigned(str, end, valOut);
+}
+
+const char* ParseNumber(const char* str, const char* end, unsigned long& valOut)
+{
+	return ParseUnsigned(str, end, valOut);
+}
+
+const char* ParseNumber(const char* str, const char* end, unsigned long long& valOut)
+{
+	return ParseUnsigned(str, end, valOut);
+}
+
+
+double StringToDouble(const char* str)
+{
+	double val;
+	if(ParseNumber(str, str + strlen(str), val))
+		return val;
+	return 0;
+}
+
+int StringToInt(const char* str)
+{
+	int val;
+	if(ParseNumber(str, str + strlen(str), val))
+		return val;
+	return 0;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+template <class T>
+static bool ParseChunk(vector<T>& valsOut, const char* str, const char* end)
+{
+	const char* p = SkipSpace(str, end);
+	while(p < end){
+		T val;
+		const char* next = ParseNumber(p, end, val);
+		if(!next || (next < end && !IsSpace(*next)))
+			return false;
+		valsOut.push_back(val);
+		p = SkipSpace(next, end);
+	}
+	return true;
+}
+
+template <class T>
+bool ParseNumberBlock(vector<T>& valsOut, const char* str, size_t len)
+{
+	const char* end = str + len;
+
+	valsOut.clear();
+
+	int numChunks = 1;
+	#ifdef UG_OPENMP
+		numChunks = NumOMPChunks(len);
+	#endif
+
+	if(numChunks <= 1)
+		return ParseChunk(valsOut, str, end);
+
+//	chunk borders are moved to the next whitespace so that no token is split
+	vector<const char*> chunkBegin(numChunks + 1);
+	chunkBegin[0] = str;
+	chunkBegin[numChunks] = end;
+	for(int i = 1; i < numChunks; ++i){
+		const char* p = max(str + i * (len / numChunks), chunkBegin[i - 1]);
+		while(p < end && !IsSpace(*p))
+			++p;
+		chunkBegin[i] = p;
+	}
+
+	vector<vector<T> > chunkVals(numChunks);
+	vector<char> chunkOk(numChunks, 0);
+
+	#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static, 1)
+	#endif
+	for(int i = 0; i < numChunks; ++i)
+		chunkOk[i] = ParseChunk(chunkVals[i], chunkBegin[i], chunkBegin[i + 1]);
+
+	size_t numVals = 0;
+	for(int i = 0; i < numChunks; ++i)
+		numVals += chunkVals[i].size();
+	valsOut.reserve(numVals);
+
+	for(int i = 0; i < numChunks; ++i){
+		if(!chunkOk[i])
+			return false;
+		valsOut.insert(valsOut.end(), chunkVals[i].begin(), chunkVals[i].end());
+	}
+	return true;
+}
+
+template UG_API bool ParseNumberBlock(vector<double>&, const char*, size_t);
+template UG_API bool ParseNumberBlock(vector<float>&, const char*, size_t);
+template UG_API bool ParseNumberBlock(vector<int>&, const char*, size_t);
+template UG_API bool ParseNumberBlock(vector<long>&, const char*, size_t);
+template UG_API bool ParseNumberBlock(vector<long long>&, const char*, size_t);
+template UG_API bool ParseNumberBlock(vector<unsigned int>&, const char*, size_t);
+template UG_API bool ParseNumberBlock(vector<unsigned long>&, const char*, size_t);
+template UG_API bool ParseNumberBlock(vector<unsigned long long>&, const char*, size_t);
+
+
+////////////////////////////////////////////////////////////////////////
+FastNumberStream& FastNumberStream::
+operator >> (std::string& strOut)
+{
+	if(m_fail)
+		return *this;
+
+	const char* p = SkipSpace(m_pos, m_end);
+	if(p == m_end){
+		m_pos = p;
+		m_eof = m_fail = true;
+		return *this;
+	}
+
+	const char* tokEnd = p;
+	while(tokEnd < m_end && !IsSpace(*tokEnd))
+		++tokEnd;
+	strOut.assign(p, tokEnd);
+	m_pos = tokEnd;
+	m_eof = (m_pos == m_end);
+	return *this;
+}
+
+void FastNumberStream::
+set_failed()
+{
+//	like std::istream, a failed read at the end of the data also sets eof
+	m_pos = SkipSpace(m_pos, m_end);
+	m_fail = true;
+}
+
+}//	end of namespace
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__fast_number_parser__
+#define __H__UG__fast_number_parser__
+
+#include <string>
+#include <vector>
+#include "common/ug_config.h"
+
+namespace ug
+{
+
+/// \addtogroup ugbase_common_io
+/// \{
+
+////////////////////////////////////////////////////////////////////////
+///	Parses a number from the character range [str, end).
+/**	Leading whitespace is skipped. Returns a pointer to the first character
+ * behind the parsed number, or NULL if no number could be parsed.
+ *
+ * Contrary to std::istream and atof, the decimal separator is always '.',
+ * regardless of the current locale. Floating point values with up to 15
+ * significant digits are converted directly, longer values are handed to
+ * strtod, so that results are always correctly rounded.
+ * \{ */
+UG_API const char* ParseNumber(const char* str, const char* end, double& valOut);
+UG_API const char* ParseNumber(const char* str, const char* end, float& valOut);
+UG_API const char* ParseNumber(const char* str, const char* end, int& valOut);
+UG_API const char* ParseNumber(const char* str, const char* end, long& valOut);
+UG_API const char* ParseNumber(const char* str, const char* end, long long& valOut);
+UG_API const char* ParseNumber(const char* str, const char* end, unsigned int& valOut);
+UG_API const char* ParseNumber(const char* str, const char* end, unsigned long& valOut);
+UG_API const char* ParseNumber(const char* str, const char* end, unsigned long long& valOut);
+/** \} */
+
+///	Locale independent replacement for atof. Returns 0 if str doesn't start with a number.
+UG_API double StringToDouble(const char* str);
+
+///	Locale independent replacement for atoi. Returns 0 if str doesn't start with a number.
+UG_API int StringToInt(const char* str);
+
+
+////////////////////////////////////////////////////////////////////////
+///	Parses all whitespace separated numbers in [str, str + len) into valsOut.
+/**	Large blocks are split into chunks at whitespace and the chunks are
+ * parsed concurrently if ug was built with OpenMP. The values in valsOut
+ * are in the same order as in the block.
+ *
+ * valsOut is cleared first. Returns false if the block contains a token
+ * which is not a number of type T. valsOut then contains all values in
+ * front of the first chunk which contains such a token.
+ *
+ * Supported types are double, float and the signed and unsigned integer types
+ * int, long and long long.
+ */
+template <class T>
+bool ParseNumberBlock(std::vector<T>& valsOut, const char* str, size_t len);
+
+
+////////////////////////////////////////////////////////////////////////
+///	A lightweight, locale independent replacement for std::istringstream.
+/**	Reads numbers and whitespace separated words from a character range
+ * through operator >>, using ParseNumber. eof() and fail() behave like
+ * their counterparts in std::istream, so that existing reading loops can
+ * switch from std::stringstream to FastNumberStream without changes.
+ *
+ * The stream does not copy the data. Make sure that it stays valid as
+ * long as the stream is used.
+ */
+class UG_API FastNumberStream
+{
+	public:
+		FastNumberStream(const char* str, size_t len) :
+			m_pos(str), m_end(str + len), m_eof(len == 0), m_fail(false)	{}
+
+		explicit FastNumberStream(const std::string& str) :
+			m_pos(str.c_str()), m_end(str.c_str() + str.size()),
+			m_eof(str.empty()), m_fail(false)								{}
+
+		template <class T>
+		FastNumberStream& operator >> (T& valOut)
+		{
+			if(m_fail)
+				return *this;
+			const char* p = ParseNumber(m_pos, m_end, valOut);
+			if(p)	m_pos = p;
+			else	set_failed();
+			m_eof = (m_pos == m_end);
+			return *this;
+		}
+
+	///	reads the next whitespace separated word
+		FastNumberStream& operator >> (std::string& strOut);
+
+		bool eof() const		{return m_eof;}
+		bool fail() const		{return m_fail;}
+		bool good() const		{return !(m_eof || m_fail);}
+		bool operator!() const	{return m_fail;}
+		operator const void*() const	{return m_fail ? NULL : this;}
+
+	///	returns the current read position
+		const char* pos() const	{return m_pos;}
+
+	private:
+		void set_failed();
+
+		const char*	m_pos;
+		const char*	m_end;
+		bool		m_eof;
+		bool		m_fail;
+};
+
+// end group ugbase_common_io
+/// \}
+
+}//	end of namespace
+
+#endif
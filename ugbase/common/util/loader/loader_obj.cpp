@@ -36,6 +36,7 @@
 #include <string>
 #include "loader_obj.h"
 #include "loader_util.h"
+#include "common/util/fast_number_parser.h"
 
 using namespace std;
 
@@ -245,18 +246,18 @@ bool LoaderObj::load_file(const char* strFilename, bool convertQuadsToTris)
 						if(lstParams.size() != 3)
 							continue;
 						PIter = lstParams.begin();
-						pActMaterial->m_vDiffuse.x() = atof((*PIter).c_str());
+						pActMaterial->m_vDiffuse.x() = StringToDouble((*PIter).c_str());
 						PIter++;
-						pActMaterial->m_vDiffuse.y() = atof((*PIter).c_str());
+						pActMaterial->m_vDiffuse.y() = StringToDouble((*PIter).c_str());
 						PIter++;
-						pActMaterial->m_vDiffuse.z() = atof((*PIter).c_str());
+						pActMaterial->m_vDiffuse.z() = StringToDouble((*PIter).c_str());
 					}
 					else if(strCommand == colorAlpha)
 					{
 						if(lstParams.size() != 1)
 							continue;
 						PIter = lstParams.begin();
-						pActMaterial->m_fAlpha = pActMaterial->m_vDiffuse.w() = atof((*PIter).c_str());
+						pActMaterial->m_fAlpha = pActMaterial->m_vDiffuse.w() = StringToDouble((*PIter).c_str());
 					}
 					else if(strCommand == textureDiffuse)
 					{
@@ -274,11 +275,11 @@ bool LoaderObj::load_file(const char* strFilename, bool convertQuadsToTris)
 				continue;
 			vector3 v;
 			PIter = lstParams.begin();
-			v.x() = atof((*PIter).c_str());
+			v.x() = StringToDouble((*PIter).c_str());
 			PIter++;
-			v.y() = atof((*PIter).c_str());
+			v.y() = StringToDouble((*PIter).c_str());
 			PIter++;
-			v.z() = atof((*PIter).c_str());
+			v.z() = StringToDouble((*PIter).c_str());
 			m_vPoints.push_back(v);
 		}
 		else if(strCommand == strNorm)
@@ -292,9 +293,9 @@ bool LoaderObj::load_file(const char* strFilename, bool convertQuadsToTris)
 				continue;
 			vector2 v;
 			PIter = lstParams.begin();
-			v.x() = atof((*PIter).c_str());
+			v.x() = StringToDouble((*PIter).c_str());
 			PIter++;
-			v.y() = -atof((*PIter).c_str());
+			v.y() = -StringToDouble((*PIter).c_str());
 			m_vTexCoords.push_back(v);
 		}
 		else if(strCommand == strFace){
@@ -316,7 +317,7 @@ bool LoaderObj::load_file(const char* strFilename, bool convertQuadsToTris)
 					uint iCount = 0;
 					if(bGotPosition && (iCount < lstIndexParams.size()))
 					{
-						pActiveObject->m_vEdgeList.push_back(atoi(lstIndexParams[iCount].c_str()) - 1);
+						pActiveObject->m_vEdgeList.push_back(StringToInt(lstIndexParams[iCount].c_str()) - 1);
 						iCount++;
 					}
 				}
@@ -332,17 +333,17 @@ bool LoaderObj::load_file(const char* strFilename, bool convertQuadsToTris)
 					uint iCount = 0;
 					if(bGotPosition)
 					{
-						pActiveObject->m_vTriangleList.push_back(atoi(lstIndexParams[iCount].c_str()) - 1);
+						pActiveObject->m_vTriangleList.push_back(StringToInt(lstIndexParams[iCount].c_str()) - 1);
 						iCount++;
 					}
 					if(bGotTexture && iCount < lstIndexParams.size())
 					{
-						pActiveObject->m_vTriangleListTex.push_back(atoi(lstIndexParams[iCount].c_str()) - 1);
+						pActiveObject->m_vTriangleListTex.push_back(StringToInt(lstIndexParams[iCount].c_str()) - 1);
 						iCount++;
 					}
 					if(bGotNormal && iCount < lstIndexParams.size())
 					{
-						//pActiveObject->m_vTriangleList.push_back(atoi(lstIndexParams[iCount].c_str()) - 1);
+						//pActiveObject->m_vTriangleList.push_back(StringToInt(lstIndexParams[iCount].c_str()) - 1);
 						iCount++;
 					}
 
@@ -360,16 +361,16 @@ bool LoaderObj::load_file(const char* strFilename, bool convertQuadsToTris)
 					string tStr = replace_chars((*PIter), '/', ' ');
 					ParameterList	lstIndexParams;
 					split_parameters(&lstIndexParams, tStr.c_str());
-					tInd[counter] = atoi((*lstIndexParams.begin()).c_str());
+					tInd[counter] = StringToInt((*lstIndexParams.begin()).c_str());
 					uint iCount = 0;
 					if(bGotPosition)
 					{
-						tInd[counter] = atoi(lstIndexParams[iCount].c_str());
+						tInd[counter] = StringToInt(lstIndexParams[iCount].c_str());
 						iCount++;
 					}
 					if(bGotTexture && iCount < lstIndexParams.size())
 					{
-						tIndTex[counter] = atoi(lstIndexParams[iCount].c_str());
+						tIndTex[counter] = StringToInt(lstIndexParams[iCount].c_str());
 						iCount++;
 					}
 					if(bGotNormal && iCount < lstIndexParams.size())
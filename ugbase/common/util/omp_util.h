@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__COMMON__UTIL__OMP_UTIL__
+#define __H__UG__COMMON__UTIL__OMP_UTIL__
+
+#ifdef UG_OPENMP
+
+#include <algorithm>
+#include <cstddef>
+#include <omp.h>
+
+namespace ug{
+
+///	minimal amount of work for which a thread of its own pays off
+/**	The work is measured in units of the cost of parsing a single character
+ * of an ASCII number block, i.e. a few nanoseconds.*/
+const std::size_t OMP_MIN_CHUNK_WORK = 1 << 20;
+
+///	returns the number of chunks into which a loop over numItems items should be split
+/**	Each chunk is processed by a thread of its own. Chunks are only created
+ * if each of them contains at least OMP_MIN_CHUNK_WORK units of work.
+ *
+ * \param numItems		number of items processed by the loop
+ * \param workPerItem	estimated work of a single item (see OMP_MIN_CHUNK_WORK)
+ * \returns				number of chunks in [1, omp_get_max_threads()]*/
+inline int NumOMPChunks(std::size_t numItems, std::size_t workPerItem = 1)
+{
+	const std::size_t numChunks = numItems * workPerItem / OMP_MIN_CHUNK_WORK;
+	return (int)std::max<std::size_t>(1, std::min<std::size_t>(
+						(std::size_t)omp_get_max_threads(), numChunks));
+}
+
+}//	end of namespace
+
+#endif	// UG_OPENMP
+
+#endif
@@ -267,6 +267,146 @@ void CollectMatrixOnOneProc(const matrix_type &A, matrix_type &collectedA, Index
 	}UG_CATCH_THROW(__FUNCTION__ << " failed");
 }
 
+/**
+ * Agglomerates a distributed matrix onto a subset of the processes.
+ *
+ * The processes of the process communicator of A are split into consecutive
+ * groups of groupSize processes. The first process of each group (the group
+ * root) collects the matrices of its group as in CollectMatrixOnOneProc.
+ * In contrast to CollectMatrixOnOneProc, the collected matrices remain
+ * distributed over the group roots: the horizontal layouts between the roots
+ * are rebuilt from the global algebra ids, so that collectedA is a valid
+ * (additive) parallel matrix on the roots, whose process communicator
+ * contains only the group roots. On all other processes collectedA is empty
+ * and its process communicator is empty.
+ *
+ * Vectors can be moved with GatherVectorOnOne and BroadcastVectorFromOne,
+ * using the created agglomeration layouts and bRoot = return value.
+ *
+ * \note	This method is collective on the process communicator of A.
+ *
+ * @param A				(input) the distributed parallel matrix A
+ * @param collectedA	(output) the collected matrix on the group roots
+ * @param masterLayout	the agglomeration master layout (only defined on group roots)
+ * @param slaveLayout	the agglomeration slave layout (only defined on non-roots)
+ * @param groupSize		number of processes agglomerated onto one process
+ * @return				true if the local process is a group root
+ */
+template<typename matrix_type>
+bool CollectMatrixOnProcGroups(const matrix_type &A, matrix_type &collectedA,
+                               IndexLayout &masterLayout, IndexLayout &slaveLayout,
+                               size_t groupSize)
+{
+	try{
+	PROFILE_FUNC_GROUP("algebra parallelization");
+	UG_COND_THROW(groupSize == 0, "Group size must be positive.");
+	masterLayout.clear();
+	slaveLayout.clear();
+
+	const pcl::ProcessCommunicator &pc = A.layouts()->proc_comm();
+	pcl::InterfaceCommunicator<IndexLayout> &communicator = A.layouts()->comm();
+
+//	determine the group root of every process
+	std::map<int, int> groupRoot;
+	for(size_t i = 0; i < pc.size(); ++i)
+		groupRoot[pc.get_proc_id(i)] = pc.get_proc_id(i - i % groupSize);
+
+	const int myRank = pcl::ProcRank();
+	const int myRoot = groupRoot[myRank];
+	const bool bRoot = (myRoot == myRank);
+
+//	communicator containing the roots only (collective on pc)
+	pcl::ProcessCommunicator rootComm = pc.create_sub_communicator(bRoot);
+
+	ParallelNodes PN(A.layouts(), A.num_rows());
+
+//	non-roots send their matrix and are done
+	if(!bRoot)
+	{
+		SendMatrix(A, slaveLayout, myRoot, PN);
+
+		SmartPtr<AlgebraLayouts> spLayouts(new AlgebraLayouts);
+		spLayouts->proc_comm() = rootComm;
+		collectedA.resize_and_clear(0, 0);
+		collectedA.set_layouts(spLayouts);
+		return false;
+	}
+
+//	roots receive the matrices of their group
+	std::vector<int> srcprocs;
+	for(size_t i = 0; i < pc.size(); ++i)
+		if(groupRoot[pc.get_proc_id(i)] == myRank && pc.get_proc_id(i) != myRank)
+			srcprocs.push_back(pc.get_proc_id(i));
+	ReceiveMatrix(A, collectedA, masterLayout, srcprocs, PN);
+
+//	every collected index, whose master process is located in another group,
+//	becomes a slave of the root of that group
+	std::map<int, std::vector<size_t> > slaveIndices;
+	for(size_t i = 0; i < PN.local_size(); ++i)
+	{
+		const int root = groupRoot[PN.local_to_global(i).master_proc()];
+		if(root != myRank) slaveIndices[root].push_back(i);
+	}
+
+	std::vector<int> sendTo, recvFrom;
+	for(std::map<int, std::vector<size_t> >::iterator it = slaveIndices.begin();
+		it != slaveIndices.end(); ++it)
+		sendTo.push_back(it->first);
+	pcl::CommunicateInvolvedProcesses(recvFrom, sendTo, rootComm);
+
+	SmartPtr<AlgebraLayouts> spLayouts(new AlgebraLayouts);
+	spLayouts->proc_comm() = rootComm;
+
+//	send the global ids of the slaves in interface order to the owning roots
+	for(std::map<int, std::vector<size_t> >::iterator it = slaveIndices.begin();
+		it != slaveIndices.end(); ++it)
+	{
+		const std::vector<size_t>& vIndex = it->second;
+		IndexLayout::Interface& interface = spLayouts->slave().interface(it->first);
+		BinaryBuffer stream;
+		Serialize(stream, vIndex.size());
+		for(size_t i = 0; i < vIndex.size(); ++i)
+		{
+			Serialize(stream, PN.local_to_global(vIndex[i]));
+			interface.push_back(vIndex[i]);
+		}
+		communicator.send_raw(it->first, stream.buffer(), stream.write_pos(), false);
+	}
+
+	typedef std::map<int, BinaryBuffer> BufferMap;
+	BufferMap streams;
+	for(size_t i = 0; i < recvFrom.size(); ++i)
+		communicator.receive_raw(recvFrom[i], streams[recvFrom[i]]);
+	communicator.communicate();
+
+//	the owning roots build the matching master interfaces
+	for(size_t i = 0; i < recvFrom.size(); ++i)
+	{
+		BinaryBuffer& stream = streams[recvFrom[i]];
+		stream.set_read_pos(0);
+		IndexLayout::Interface& interface = spLayouts->master().interface(recvFrom[i]);
+
+		size_t numIndex;
+		Deserialize(stream, numIndex);
+		for(size_t j = 0; j < numIndex; ++j)
+		{
+			AlgebraID globalID;
+			Deserialize(stream, globalID);
+			bool bHasIndex;
+			size_t index = PN.get_local_index_if_available(globalID, bHasIndex);
+			UG_COND_THROW(!bHasIndex, "Global id " << globalID << " requested by "
+			              "process " << recvFrom[i] << " not present on group root.");
+			interface.push_back(index);
+		}
+	}
+
+	collectedA.set_layouts(spLayouts);
+	collectedA.set_storage_type(PST_ADDITIVE);
+	return true;
+
+	}UG_CATCH_THROW(__FUNCTION__ << " failed");
+}
+
 /**
  * gathers the vector vec to collectedVec on one processor
  * @param agglomeratedMaster	master agglomeration layout. only nonempty if Root=true
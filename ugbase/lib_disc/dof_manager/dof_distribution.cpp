@@ -31,6 +31,7 @@
  */
 
 #include "dof_distribution.h"
+#include "element_view.h"
 #include "lib_disc/function_spaces/grid_function.h"
 
 #include "common/log.h"
@@ -1419,6 +1420,8 @@ void DoFDistribution::reinit()
 
 void DoFDistribution::reinit()
 {
+	m_mspElemView.clear();
+
 	m_numIndex = 0;
 	m_vNumIndexOnSubset.resize(0);
 	m_vNumIndexOnSubset.resize(num_subsets(), 0);
@@ -1752,6 +1755,11 @@ void DoFDistribution::permute_indices(const std::vector<size_t>& vNewInd)
 	reinit_layouts_and_communicator();
 #endif
 
+//	the dof indices cached in the element views are outdated
+	typedef std::map<std::pair<int, int>, SmartPtr<IElementView> >::iterator view_iterator;
+	for(view_iterator it = m_mspElemView.begin(); it != m_mspElemView.end(); ++it)
+		if(it->second.valid()) it->second->clear_indices();
+
 //	permute indices in associated vectors
 	permute_values(vNewInd);
 }
@@ -33,6 +33,7 @@
 #ifndef __H__UG__LIB_DISC__DOF_MANAGER__DOF_DISTRIBUTION__
 #define __H__UG__LIB_DISC__DOF_MANAGER__DOF_DISTRIBUTION__
 
+#include <map>
 #include "lib_grid/tools/surface_view.h"
 #include "lib_disc/domain_traits.h"
 #include "lib_disc/common/local_algebra.h"
@@ -46,6 +47,8 @@
 namespace ug{
 
 class IGridFunction;
+class IElementView;
+template <typename TElem> class ElementView;
 
 class DoFDistribution : public DoFDistributionInfoProvider
 {
@@ -171,6 +174,15 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		/// returns the default valid surface state
 		SurfaceView::SurfaceConstants defaultValidSurfState() const;
 
+		///	returns a flat view on the elements of type TElem in subset si
+		/**	The view is created on first access and cached until the dof
+		 * distribution is reinitialized. The dof indices stored in the view
+		 * are rebuilt after a permutation of the indices. Pass si < 0 to get
+		 * a view on the elements of all subsets.
+		 * Include "lib_disc/dof_manager/element_view.h" to use this method.*/
+		template <typename TElem>
+		const ElementView<TElem>& element_view(int si) const;
+
 		///	returns the adjacent elements
 		template <typename TElem, typename TBaseElem>
 		void collect_associated(std::vector<TBaseElem*>& vAssElem,
@@ -457,6 +469,9 @@ class DoFDistribution : public DoFDistributionInfoProvider
 		/// DoF-Index Memory Storage
 		SmartPtr<DoFIndexStorage> m_spDoFIndexStorage;
 
+		///	cached element views, indexed by element type and subset
+		mutable std::map<std::pair<int, int>, SmartPtr<IElementView> > m_mspElemView;
+
 	protected:
 		/// number of distributed indices on whole domain
 		size_t m_numIndex;
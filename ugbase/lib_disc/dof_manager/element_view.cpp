@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include "element_view.h"
+
+namespace ug{
+
+////////////////////////////////////////////////////////////////////////////////
+// IElementView
+////////////////////////////////////////////////////////////////////////////////
+
+const IElementView::IndexBlock& IElementView::index_block(bool bHang) const
+{
+	IndexBlock& block = m_vIndexBlock[bHang ? 1 : 0];
+	if(block.bValid) return block;
+
+	const size_t numElem = size();
+	block.numFct = m_pDD->num_fct();
+	block.vOffset.clear();
+	block.vOffset.reserve(numElem * block.numFct + 1);
+	block.vOffset.push_back(0);
+	block.vIndex.clear();
+
+	LocalIndices ind;
+	for(size_t i = 0; i < numElem; ++i)
+	{
+		extract_indices(i, ind, bHang);
+
+		UG_COND_THROW(ind.num_fct() != block.numFct,
+		              "ElementView: Number of functions "<<ind.num_fct()<<
+		              " of element does not match dof distribution ("<<
+		              block.numFct<<").");
+
+		for(size_t fct = 0; fct < block.numFct; ++fct)
+		{
+			for(size_t dof = 0; dof < ind.num_dof(fct); ++dof)
+				block.vIndex.push_back(ind.multi_index(fct, dof));
+			block.vOffset.push_back(block.vIndex.size());
+		}
+	}
+
+	block.bValid = true;
+	return block;
+}
+
+void IElementView::indices(size_t i, LocalIndices& ind, bool bHang) const
+{
+	const IndexBlock& block = index_block(bHang);
+
+	ind.resize_fct(block.numFct);
+	const size_t* pOffset = &block.vOffset[i * block.numFct];
+	for(size_t fct = 0; fct < block.numFct; ++fct)
+	{
+		ind.resize_dof(fct, pOffset[fct+1] - pOffset[fct]);
+		for(size_t k = pOffset[fct], dof = 0; k < pOffset[fct+1]; ++k, ++dof)
+		{
+			ind.index(fct, dof) = block.vIndex[k][0];
+			ind.comp(fct, dof) = block.vIndex[k][1];
+		}
+	}
+}
+
+size_t IElementView::dof_indices(size_t i, size_t fct, std::vector<DoFIndex>& ind,
+                                 bool bClear) const
+{
+	if(bClear) ind.clear();
+
+	const IndexBlock& block = index_block(false);
+	const size_t k = i * block.numFct + fct;
+	ind.insert(ind.end(), block.vIndex.begin() + block.vOffset[k],
+	                      block.vIndex.begin() + block.vOffset[k+1]);
+	return ind.size();
+}
+
+void IElementView::clear_indices()
+{
+	m_vIndexBlock[0] = IndexBlock();
+	m_vIndexBlock[1] = IndexBlock();
+}
+
+} // end namespace ug
@@ -0,0 +1,361 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__DOF_MANAGER__ELEMENT_VIEW__
+#define __H__UG__LIB_DISC__DOF_MANAGER__ELEMENT_VIEW__
+
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include "lib_grid/grid/grid_util.h"
+#include "dof_distribution.h"
+
+namespace ug{
+
+///	base class for element views, used to store views of different types
+/**
+ * The base class holds the part of a view that does not depend on the element
+ * type: the dof indices of the elements. They are stored in blocks in a
+ * compressed row format (offset per element and function, flat multi index
+ * array), one block for the indices with and one for the indices without
+ * hanging dofs. A block is built on first access and dropped by
+ * clear_indices(), which the dof distribution calls whenever its indices are
+ * permuted.
+ */
+class IElementView
+{
+	public:
+	///	constructor
+		IElementView(const DoFDistribution& dd) : m_pDD(&dd) {}
+
+	///	destructor
+		virtual ~IElementView() {}
+
+	///	number of elements
+		virtual size_t size() const = 0;
+
+	///	returns the dof distribution of the view
+		const DoFDistribution& dof_distribution() const {return *m_pDD;}
+
+	///	extracts the local indices of the i'th element
+	/**	The result is the same as for DoFDistribution::indices on the element.*/
+		void indices(size_t i, LocalIndices& ind, bool bHang = false) const;
+
+	///	extracts the multi indices of function fct on the i'th element
+	/**	The result is the same as for DoFDistribution::dof_indices on the
+	 * element (not the hanging dofs).*/
+		size_t dof_indices(size_t i, size_t fct, std::vector<DoFIndex>& ind,
+		                   bool bClear = true) const;
+
+	///	drops the cached dof indices (rebuilt on next access)
+		void clear_indices();
+
+	protected:
+	///	extracts the indices of the i'th element from the dof distribution
+		virtual void extract_indices(size_t i, LocalIndices& ind, bool bHang) const = 0;
+
+	///	dof indices of all elements of the view
+		struct IndexBlock
+		{
+			IndexBlock() : bValid(false), numFct(0) {}
+
+			bool bValid;
+			size_t numFct;
+			std::vector<size_t> vOffset; ///< offset of (elem, fct), size numElem*numFct+1
+			std::vector<DoFIndex> vIndex; ///< multi indices
+		};
+
+	///	returns the index block, builds it if needed
+		const IndexBlock& index_block(bool bHang) const;
+
+	protected:
+	///	underlying dof distribution
+		const DoFDistribution* m_pDD;
+
+	///	index blocks without (0) and with (1) hanging dofs
+		mutable IndexBlock m_vIndexBlock[2];
+};
+
+template <typename TElem> class ElementView;
+
+///	iterator over the elements of an ElementView
+/**
+ * The iterator dereferences to the element like the iterators of the grid,
+ * but in addition knows its position in the view. This allows the helpers
+ * ElementIndices and ElementCornerCoordinates to read the data stored in the
+ * view instead of recomputing it from the grid.
+ */
+template <typename TElem>
+class ElementViewIterator
+{
+	public:
+		typedef std::forward_iterator_tag iterator_category;
+		typedef TElem* value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef TElem* const* pointer;
+		typedef TElem* const& reference;
+
+	public:
+		ElementViewIterator() : m_pView(NULL), m_pos(0) {}
+		ElementViewIterator(const ElementView<TElem>* pView, size_t pos)
+			: m_pView(pView), m_pos(pos) {}
+
+		reference operator*() const {return m_pView->m_vElem[m_pos];}
+
+		ElementViewIterator& operator++() {++m_pos; return *this;}
+		ElementViewIterator operator++(int)
+			{ElementViewIterator tmp(*this); ++m_pos; return tmp;}
+
+		bool operator==(const ElementViewIterator& it) const
+			{return m_pos == it.m_pos && m_pView == it.m_pView;}
+		bool operator!=(const ElementViewIterator& it) const
+			{return !(*this == it);}
+
+	///	the view iterated
+		const ElementView<TElem>& view() const {return *m_pView;}
+
+	///	position in the view
+		size_t position() const {return m_pos;}
+
+	protected:
+		const ElementView<TElem>* m_pView;
+		size_t m_pos;
+};
+
+///	Flat snapshot of the elements of one type on a subset of a DoFDistribution
+/**
+ * The element view stores the elements, over which the dof distribution
+ * iterates for a given element type and subset, in a contiguous array.
+ * Iteration over the view is thus performed over a plain array instead of the
+ * linked lists of the grid and yields the elements in the same order as
+ * DoFDistribution::begin/end.
+ *
+ * In addition, the view stores the vertices of its elements once and the
+ * corners of each element as indices into this vertex array (compressed row
+ * format), as well as the dof indices of the elements (see IElementView).
+ *
+ * Views are created and cached by DoFDistribution::element_view. The cache
+ * is cleared whenever the dof distribution is reinitialized (i.e. on grid
+ * changes).
+ *
+ * \tparam	TElem	element type (concrete or base type)
+ */
+template <typename TElem>
+class ElementView : public IElementView
+{
+	public:
+		typedef ElementViewIterator<TElem> const_iterator;
+		typedef const_iterator iterator;
+
+	public:
+	///	creates the view for subset si (all subsets if si < 0)
+		ElementView(const DoFDistribution& dd, int si);
+
+	///	number of elements
+		virtual size_t size() const {return m_vElem.size();}
+
+	///	iterators over the elements
+	/// \{
+		const_iterator begin() const {return const_iterator(this, 0);}
+		const_iterator end() const {return const_iterator(this, m_vElem.size());}
+	/// \}
+
+	///	returns the i'th element
+		TElem* elem(size_t i) const {return m_vElem[i];}
+
+	///	number of vertices of all elements
+		size_t num_vertices() const {return m_vVertex.size();}
+
+	///	returns the v'th vertex
+		Vertex* vertex(size_t v) const {return m_vVertex[v];}
+
+	///	number of corners of the i'th element
+		size_t num_corners(size_t i) const
+			{return m_vCornerOffset[i+1] - m_vCornerOffset[i];}
+
+	///	index (in the vertex array) of the k'th corner of the i'th element
+		size_t corner_index(size_t i, size_t k) const
+			{return m_vCornerIndex[m_vCornerOffset[i] + k];}
+
+	///	returns the k'th corner of the i'th element
+		Vertex* corner(size_t i, size_t k) const
+			{return m_vVertex[corner_index(i, k)];}
+
+	protected:
+		virtual void extract_indices(size_t i, LocalIndices& ind, bool bHang) const
+			{m_pDD->indices(m_vElem[i], ind, bHang);}
+
+	protected:
+		friend class ElementViewIterator<TElem>;
+
+	///	elements
+		std::vector<TElem*> m_vElem;
+
+	///	vertices of the elements (each vertex once)
+		std::vector<Vertex*> m_vVertex;
+
+	///	corners of the elements, as offsets into m_vCornerIndex
+		std::vector<size_t> m_vCornerOffset;
+
+	///	corners of the elements, as indices into m_vVertex
+		std::vector<size_t> m_vCornerIndex;
+};
+
+template <typename TElem>
+ElementView<TElem>::
+ElementView(const DoFDistribution& dd, int si)
+	: IElementView(dd)
+{
+	typedef typename DoFDistribution::traits<TElem>::const_iterator iterator;
+	iterator iter = (si < 0) ? dd.begin<TElem>() : dd.begin<TElem>(si);
+	iterator iterEnd = (si < 0) ? dd.end<TElem>() : dd.end<TElem>(si);
+
+	for(; iter != iterEnd; ++iter)
+		m_vElem.push_back(*iter);
+
+//	collect the corners and the (unique) vertices
+	m_vCornerOffset.resize(m_vElem.size() + 1);
+	m_vCornerOffset[0] = 0;
+	for(size_t i = 0; i < m_vElem.size(); ++i)
+	{
+		const size_t numCorner = NumVertices(m_vElem[i]);
+		for(size_t k = 0; k < numCorner; ++k)
+			m_vVertex.push_back(GetVertex(m_vElem[i], k));
+		m_vCornerOffset[i+1] = m_vVertex.size();
+	}
+
+	std::vector<Vertex*> vCorner(m_vVertex);
+	std::sort(m_vVertex.begin(), m_vVertex.end());
+	m_vVertex.erase(std::unique(m_vVertex.begin(), m_vVertex.end()), m_vVertex.end());
+
+	m_vCornerIndex.resize(vCorner.size());
+	for(size_t c = 0; c < vCorner.size(); ++c)
+		m_vCornerIndex[c] = std::lower_bound(m_vVertex.begin(), m_vVertex.end(),
+		                                     vCorner[c]) - m_vVertex.begin();
+}
+
+template <typename TElem>
+const ElementView<TElem>& DoFDistribution::element_view(int si) const
+{
+//	views are distinguished by base object type and container section
+	const int type = geometry_traits<TElem>::BASE_OBJECT_ID * 16
+					+ geometry_traits<TElem>::CONTAINER_SECTION + 1;
+	const std::pair<int, int> key(type, si);
+
+	SmartPtr<IElementView>& spView = m_mspElemView[key];
+	if(spView.invalid())
+		spView = SmartPtr<IElementView>(new ElementView<TElem>(*this, si));
+
+	return *static_cast<ElementView<TElem>*>(spView.get());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Element data by iterator
+////////////////////////////////////////////////////////////////////////////////
+
+///	extracts the local indices of the element an iterator points to
+/**
+ * For iterators of an ElementView on the same dof distribution the indices
+ * are read from the view, else they are computed by the dof distribution.
+ */
+/// \{
+template <typename TIterator, typename TElem>
+inline void ElementIndices(LocalIndices& ind, const TIterator& iter, TElem* elem,
+                           const DoFDistribution& dd, bool bHang = false)
+{
+	dd.indices(elem, ind, bHang);
+}
+
+template <typename TElem>
+inline void ElementIndices(LocalIndices& ind, const ElementViewIterator<TElem>& iter,
+                           TElem* elem, const DoFDistribution& dd, bool bHang = false)
+{
+	if(&iter.view().dof_distribution() == &dd)
+		iter.view().indices(iter.position(), ind, bHang);
+	else
+		dd.indices(elem, ind, bHang);
+}
+/// \}
+
+///	extracts the multi indices of a function on the element an iterator points to
+/// \{
+template <typename TIterator, typename TElem>
+inline size_t ElementDoFIndices(std::vector<DoFIndex>& ind, const TIterator& iter,
+                                TElem* elem, const DoFDistribution& dd, size_t fct)
+{
+	return dd.dof_indices(elem, fct, ind);
+}
+
+template <typename TElem>
+inline size_t ElementDoFIndices(std::vector<DoFIndex>& ind,
+                                const ElementViewIterator<TElem>& iter,
+                                TElem* elem, const DoFDistribution& dd, size_t fct)
+{
+	if(&iter.view().dof_distribution() == &dd)
+		return iter.view().dof_indices(iter.position(), fct, ind);
+	return dd.dof_indices(elem, fct, ind);
+}
+/// \}
+
+///	writes the corner coordinates of the element an iterator points to
+/**
+ * For iterators of an ElementView the corners are read from the view, else
+ * from the element. The corners are written in the order of the reference
+ * element.
+ */
+/// \{
+template <typename TIterator, typename TElem, typename TAAPos>
+inline void ElementCornerCoordinates(typename TAAPos::ValueType vCornerCoordsOut[],
+                                     const TIterator& iter, TElem* elem,
+                                     const TAAPos& aaPos)
+{
+	const size_t numCorner = NumVertices(elem);
+	for(size_t k = 0; k < numCorner; ++k)
+		vCornerCoordsOut[k] = aaPos[GetVertex(elem, k)];
+}
+
+template <typename TElem, typename TAAPos>
+inline void ElementCornerCoordinates(typename TAAPos::ValueType vCornerCoordsOut[],
+                                     const ElementViewIterator<TElem>& iter,
+                                     TElem* elem, const TAAPos& aaPos)
+{
+	const ElementView<TElem>& view = iter.view();
+	const size_t i = iter.position();
+	const size_t numCorner = view.num_corners(i);
+	for(size_t k = 0; k < numCorner; ++k)
+		vCornerCoordsOut[k] = aaPos[view.corner(i, k)];
+}
+/// \}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__DOF_MANAGER__ELEMENT_VIEW__ */
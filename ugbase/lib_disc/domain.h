@@ -40,6 +40,7 @@
 
 #ifdef UG_PARALLEL
 #include "lib_grid/parallelization/distributed_grid.h"
+#include "lib_disc/spatial_disc/disc_util/affine_mapping_cache.h"
 #endif
 
 namespace ug{
@@ -325,10 +326,19 @@ class Domain : public IDomain<TGrid, TSubsetHandler>
 
 		virtual SPIGeometry3d geometry3d() const	{return m_geometry3d;}
 
+	///	returns the cache of the Jacobians of affine full-dimensional elements
+	/**	The cache is created on the first call. Its data are recomputed on the
+	 * next call after the grid has been adapted or the vertex positions have
+	 * been changed (see AffineMappingCache).*/
+		ConstSmartPtr<AffineMappingCache<d> > affine_mapping_cache() const;
+
 	protected:
 		position_attachment_type m_aPos;	///<Position Attachment
 		position_accessor_type	m_aaPos;		///<Accessor
 		SPIGeometry3d			m_geometry3d;
+
+	///	cache of the Jacobians of affine elements (created on demand)
+		mutable SmartPtr<AffineMappingCache<d> >	m_spAffineMappingCache;
 };
 
 typedef Domain<1, MultiGrid, MGSubsetHandler> Domain1d;
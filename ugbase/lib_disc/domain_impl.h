@@ -648,6 +648,17 @@ Domain(bool isAdaptive) : IDomain<TGrid, TSubsetHandler>(isAdaptive)
 	this->m_refinementProjector = make_sp(new RefinementProjector(m_geometry3d));
 }
 
+template <int d, typename TGrid, typename TSubsetHandler>
+ConstSmartPtr<AffineMappingCache<d> > Domain<d,TGrid,TSubsetHandler>::
+affine_mapping_cache() const
+{
+	if(m_spAffineMappingCache.invalid())
+		m_spAffineMappingCache = make_sp(new AffineMappingCache<d>(this->m_spGrid));
+
+	m_spAffineMappingCache->update(m_aaPos);
+	return m_spAffineMappingCache;
+}
+
 
 } // end namespace ug
 
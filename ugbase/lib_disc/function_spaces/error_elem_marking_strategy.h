@@ -38,6 +38,7 @@
 #include "lib_grid/refinement/refiner_interface.h"
 #include "lib_disc/dof_manager/dof_distribution.h"
 #include "error_indicator_util.h"
+#include "error_threshold_selection.h"
 
 namespace ug{
 
@@ -221,6 +222,27 @@ number CreateListOfElemWeights(
 	return localErr;
 };
 
+/// fills the valid (non-negative) errors of all elements into a list
+template<class TElem>
+void CollectElemErrors(
+		MultiGrid::AttachmentAccessor<TElem, ug::Attachment<number> > &aaError,
+		ConstSmartPtr<DoFDistribution> dd,
+		std::vector<number> &eta)
+{
+	typedef typename DoFDistribution::traits<TElem>::const_iterator const_iterator;
+
+	eta.clear();
+
+	const const_iterator iterEnd = dd->template end<TElem>();
+	for (const_iterator iter = dd->template begin<TElem>(); iter != iterEnd; ++iter)
+	{
+		const number elemErr = aaError[*iter];
+
+		//	newly added elements are supposed to have a negative error estimator
+		if (elemErr >= 0) eta.push_back(elemErr);
+	}
+}
+
 /// marks elements above a certain fraction of the maximum
 //!
 template <typename TDomain>
@@ -264,58 +286,21 @@ void MaximumMarking<TDomain>::mark(typename base_type::elem_accessor_type& aaErr
 	const_iterator iter;
 	const const_iterator iterEnd = dd->template end<TElem>();
 
-	// determine (local) number of excess elements
-	const size_t ndiscard = (size_t) (numElemLocal*m_eps); // TODO: on every process?
+	// determine (global) number of excess elements
+	const size_t ndiscard = (size_t) (numElem*m_eps);
 	UG_LOG("  +++ Found max "<<  maxElemErr << " ndiscard="<<ndiscard<<".\n");
 
-	// Verfuerths strategy for skipping excess
-/*	while (ndiscard)
-	{
-		// find elements that should be discarded
-		int discard = 0;
-		double newmax = 0.0;
-		for (iter = dd->template begin<TElem>(); iter != iterEnd; ++iter)
-		{
-			const double elemErr = aaError[*iter];
-
-			if ( elemErr >= maxElemErr) { discard++; }
-			else { newmax = std::max(newmax, elemErr); }
-		}
-
-		// quit, if enough elements have been found
-		if ( discard <  ndiscard) maxElemErr = newmax;
-		else break;
-
-	}*/
-
-	if (numElemLocal > 0)
+	// the largest error after skipping the excess is selected over all
+	// processes, without sorting or gathering the element errors
+	if (numElem > ndiscard)
 	{
-		// create sorted array of elem weights
-		std::vector<double> eta;
-		eta.resize(numElemLocal);
-		CreateListOfElemWeights<TElem>(aaError,dd->template begin<TElem>(), iterEnd, eta);
-		UG_ASSERT(numElemLocal==eta.size(), "Huhh: number of elements does not match!");
-		UG_ASSERT(numElemLocal > ndiscard, "Huhh: number of elements does not match!");
-		maxElemErr = eta[ndiscard];
-
+		std::vector<number> eta;
+		eta.reserve(numElemLocal);
+		CollectElemErrors<TElem>(aaError, dd, eta);
+		maxElemErr = SelectGlobalErrorThreshold(eta, ndiscard + 1, false);
 	}
 
-	UG_LOG("  +++ MaximumMarking: Maximum for refinement: " << maxElemErr << " elements.\n");
-
-	// compute parallel threshold
-#ifdef UG_PARALLEL
-	if (pcl::NumProcs() > 1)
-	{
-		pcl::ProcessCommunicator com;
-		number maxElemErrLocal = maxElemErr;
-		maxElemErr = com.allreduce(maxElemErrLocal, PCL_RO_SUM);
-		UG_LOG("  +++ MaximumMarking: Maximum for refinement: " << maxElemErr << ".\n");
-		maxElemErr = maxElemErr / pcl::NumProcs();
-		UG_LOG("  +++ MaximumMarking: Average for refinement: " << maxElemErr << ".\n");
-	}
-#else
 	UG_LOG("  +++ Skipping " << ndiscard << " elements; new max." << maxElemErr << ".\n");
-#endif
 
 	// refine all element above threshold
 	const number minErrToRefine = maxElemErr*m_theta;
@@ -359,6 +344,98 @@ void MaximumMarking<TDomain>::mark(typename base_type::elem_accessor_type& aaErr
 
 }
 
+/// marks a minimal set of elements with the largest errors (Doerfler / bulk criterion)
+/**
+ * Marks all elements with \f$ \eta_i^2 \geq t \f$, where the threshold t is
+ * the largest value such that the marked elements carry at least the fraction
+ * theta of the total error \f$ \sum_i \eta_i^2 \f$. The threshold is selected
+ * over all processes by SelectGlobalErrorThreshold, i.e. the element errors
+ * are neither sorted nor gathered.
+ */
+template <typename TDomain>
+class DoerflerMarking : public IElementMarkingStrategy<TDomain>{
+
+public:
+	typedef IElementMarkingStrategy<TDomain> base_type;
+	DoerflerMarking(number theta) : m_theta(theta), m_max_level(100) {};
+	DoerflerMarking(number theta, int max_level) : m_theta(theta), m_max_level(max_level) {};
+
+	void set_theta(number theta) {m_theta = theta;}
+	void set_max_level(int max_level) {m_max_level = max_level;}
+
+	void mark(typename base_type::elem_accessor_type& aaError,
+					IRefiner& refiner,
+					ConstSmartPtr<DoFDistribution> dd);
+protected:
+
+	number m_theta;			// fraction of the total error to be marked, 0.0 <= m_theta <= 1.0
+	int m_max_level;
+};
+
+template <typename TDomain>
+void DoerflerMarking<TDomain>::mark(typename base_type::elem_accessor_type& aaError,
+				IRefiner& refiner,
+				ConstSmartPtr<DoFDistribution> dd)
+{
+	typedef typename base_type::elem_type TElem;
+	typedef typename DoFDistribution::traits<TElem>::const_iterator const_iterator;
+
+	UG_COND_THROW(m_theta < 0.0 || m_theta > 1.0, "DoerflerMarking: theta must be "
+				  "in [0,1], but is " << m_theta << ".");
+
+	// compute minimal/maximal/total error and number of elements
+	number minElemErr, minElemErrLocal;
+	number maxElemErr, maxElemErrLocal;
+	number errTotal, errLocal;
+	size_t numElem, numElemLocal;
+
+	ComputeMinMax(aaError, dd, minElemErr, maxElemErr, errTotal, numElem,
+					minElemErrLocal, maxElemErrLocal, errLocal, numElemLocal);
+
+	this->m_latest_error = sqrt(errTotal);
+	this->m_latest_error_per_elem_max = maxElemErr;
+	this->m_latest_error_per_elem_min = minElemErr;
+
+	// select the global threshold
+	std::vector<number> eta;
+	eta.reserve(numElemLocal);
+	CollectElemErrors<TElem>(aaError, dd, eta);
+	const number minErrToRefine = SelectGlobalErrorThreshold(eta, m_theta*errTotal, true);
+
+	UG_LOG("  +++ DoerflerMarking: Refining elements if error greater " << minErrToRefine
+			<< " (theta = " << m_theta << ").\n");
+
+	//	mark elements with maximal contribution
+	std::size_t numMarkedRefine = 0;
+	const const_iterator iterEnd = dd->template end<TElem>();
+	for (const_iterator iter = dd->template begin<TElem>(); iter != iterEnd; ++iter)
+	{
+		TElem* elem = *iter;
+		const number elemErr = aaError[elem];
+
+		// skip newly added
+		if (elemErr < 0) continue;
+
+		if ((elemErr >= minErrToRefine) && (dd->multi_grid()->get_level(elem) <= m_max_level))
+		{
+			refiner.mark(elem, RM_REFINE);
+			numMarkedRefine++;
+		}
+	}
+
+#ifdef UG_PARALLEL
+	if (pcl::NumProcs() > 1)
+	{
+		pcl::ProcessCommunicator com;
+		std::size_t numMarkedRefineLocal = numMarkedRefine;
+		numMarkedRefine = com.allreduce(numMarkedRefineLocal, PCL_RO_SUM);
+		UG_LOG("  +++ DoerflerMarking: Marked for refinement: " << numMarkedRefine << " ("<< numMarkedRefineLocal << ") elements.\n");
+	}
+#else
+	UG_LOG("  +++ DoerflerMarking: Marked for refinement: " << numMarkedRefine << " elements.\n");
+#endif
+}
+
 /// marks elements above \f$ \theta * (\mu + width * \sigma) \f$
 //! where \f$ \mu = E[\eta^2], \sigma^2 = Var[\eta^2] \f$
 template <typename TDomain>
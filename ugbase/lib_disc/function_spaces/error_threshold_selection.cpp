@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include <limits>
+#include "error_threshold_selection.h"
+#include "common/error.h"
+#include "common/profiler/profiler.h"
+#include "common/util/omp_util.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+#endif
+
+using namespace std;
+
+namespace ug{
+
+namespace{
+///	accumulates the weights and extrema of all errors in [lo, hi] in buckets
+/**	ext[2*j] holds the negative minimum and ext[2*j+1] the maximum of bucket j,
+ * so that both can be reduced by a single maximum operation.*/
+void BinErrors(vector<number>& w, vector<number>& ext,
+               const number* eta, size_t num,
+               number lo, number hi, number width, bool weighted)
+{
+	const int numBuckets = (int)w.size();
+	for(size_t i = 0; i < num; ++i){
+		const number e = eta[i];
+		if(e < lo || e > hi)
+			continue;
+
+		const int j = (int)min<number>(numBuckets - 1, (e - lo) / width);
+		w[j] += weighted ? e : 1.0;
+		ext[2*j] = max(ext[2*j], -e);
+		ext[2*j+1] = max(ext[2*j+1], e);
+	}
+}
+}//	end of anonymous namespace
+
+
+number SelectGlobalErrorThreshold(const vector<number>& eta,
+                                  number target, bool weighted,
+                                  int numBuckets, int maxRounds)
+{
+	PROFILE_FUNC_GROUP("disc");
+	UG_COND_THROW(numBuckets < 2, "SelectGlobalErrorThreshold: At least two "
+				  "buckets are required, but " << numBuckets << " were given.");
+
+	const number inf = numeric_limits<number>::max();
+	if(target <= 0)
+		return inf;
+
+#ifdef UG_PARALLEL
+	pcl::ProcessCommunicator com;
+	const bool parallel = (pcl::NumProcs() > 1);
+#endif
+
+//	global range of valid errors. The minimum is stored negated, so that
+//	both values can be reduced in one operation.
+	vector<number> range(2, -inf);
+	for(size_t i = 0; i < eta.size(); ++i){
+		if(eta[i] < 0) continue;
+		range[0] = max(range[0], -eta[i]);
+		range[1] = max(range[1], eta[i]);
+	}
+#ifdef UG_PARALLEL
+	if(parallel){
+		vector<number> rangeLocal(range);
+		com.allreduce(rangeLocal, range, PCL_RO_MAX);
+	}
+#endif
+
+	number lo = -range[0];
+	number hi = range[1];
+	if(lo > hi)
+		return inf;
+
+	const size_t numEta = eta.size();
+
+	int numChunks = 1;
+	#ifdef UG_OPENMP
+		numChunks = NumOMPChunks(numEta, 64);
+	#endif
+
+	vector<vector<number> > chunkW(numChunks), chunkExt(numChunks);
+	vector<number> w, ext;
+
+//	accumulated weight of all errors above hi
+	number above = 0;
+
+	for(int round = 0; round < maxRounds && lo < hi; ++round)
+	{
+		const number width = (hi - lo) / numBuckets;
+
+		#ifdef UG_OPENMP
+			#pragma omp parallel for schedule(static, 1) if(numChunks > 1)
+		#endif
+		for(int iChunk = 0; iChunk < numChunks; ++iChunk){
+			const size_t begin = (iChunk * numEta) / numChunks;
+			const size_t end = ((iChunk + 1) * numEta) / numChunks;
+
+			chunkW[iChunk].assign(numBuckets, 0);
+			chunkExt[iChunk].assign(2 * numBuckets, -inf);
+			if(end > begin)
+				BinErrors(chunkW[iChunk], chunkExt[iChunk], &eta[begin],
+						  end - begin, lo, hi, width, weighted);
+		}
+
+		w = chunkW[0];
+		ext = chunkExt[0];
+		for(int iChunk = 1; iChunk < numChunks; ++iChunk){
+			for(int j = 0; j < numBuckets; ++j)
+				w[j] += chunkW[iChunk][j];
+			for(int j = 0; j < 2 * numBuckets; ++j)
+				ext[j] = max(ext[j], chunkExt[iChunk][j]);
+		}
+
+	#ifdef UG_PARALLEL
+		if(parallel){
+			vector<number> wLocal(w), extLocal(ext);
+			com.allreduce(wLocal, w, PCL_RO_SUM);
+			com.allreduce(extLocal, ext, PCL_RO_MAX);
+		}
+	#endif
+
+	//	walk down from the largest errors until the target is reached
+		int j = numBuckets - 1;
+		for(; j >= 0; --j){
+			if(ext[2*j+1] < lo) continue;
+			if(above + w[j] >= target) break;
+			above += w[j];
+		}
+
+	//	the target exceeds the total weight: all elements are selected
+		if(j < 0)
+			return lo;
+
+		lo = -ext[2*j];
+		hi = ext[2*j+1];
+	}
+
+	return lo;
+}
+
+}//	end of namespace
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG_DISC__ERROR_THRESHOLD_SELECTION__
+#define __H__UG_DISC__ERROR_THRESHOLD_SELECTION__
+
+#include <vector>
+#include "common/types.h"
+
+namespace ug{
+
+/// selects a global marking threshold from distributed element errors
+/**
+ * Returns the largest threshold t such that the elements with an error
+ * \f$ \eta_i \geq t \f$ on all processes together reach the given target.
+ * If weighted is true, each element contributes its error (bulk or Doerfler
+ * criterion, target = theta * total error). Otherwise each element counts one
+ * (fixed number of elements, i.e. t is the target-th largest error).
+ *
+ * The errors are never sorted or gathered. In each round, every process bins
+ * its errors into numBuckets equally sized buckets of the current interval.
+ * Bucket weights and extrema are reduced over all processes, and the interval
+ * shrinks to the bucket in which the target is reached. This needs two
+ * allreduce operations per round and O(log(range) / log(numBuckets)) rounds.
+ * The binning is distributed onto several threads if OpenMP is enabled.
+ *
+ * The result is the same on all processes. If target <= 0 the largest
+ * representable number is returned. If the target exceeds the total weight,
+ * the global minimal error is returned.
+ *
+ * \param[in]	eta			local element errors (negative values are ignored)
+ * \param[in]	target		weight that the marked elements have to reach
+ * \param[in]	weighted	weight elements by their error instead of counting them
+ * \param[in]	numBuckets	number of histogram buckets per round
+ * \param[in]	maxRounds	maximal number of rounds; afterwards the lower
+ * 							bound of the remaining interval is returned
+ */
+number SelectGlobalErrorThreshold(const std::vector<number>& eta,
+                                  number target, bool weighted,
+                                  int numBuckets = 64, int maxRounds = 32);
+
+}//	end of namespace
+
+#endif
@@ -44,9 +44,10 @@
 #include "lib_disc/local_finite_element/local_finite_element_provider.h"
 #include "lib_disc/spatial_disc/user_data/std_glob_pos_data.h"
 #include "lib_disc/reference_element/reference_mapping_provider.h"
-#include "lib_grid/algorithms/space_partitioning/lg_ntree.h"
+#include "lib_grid/algorithms/space_partitioning/point_locator.h"
 
 #include <math.h>       /* fabs */
+#include <limits>
 
 namespace ug{
 
@@ -71,14 +72,14 @@ class GlobalGridFunctionNumberData
 	///	local finite element id
 		LFEID m_lfeID;
 
-		typedef lg_ntree<dim, dim, element_t>	tree_t;
-		tree_t	m_tree;
+		typedef PointLocator<element_t, dim>	locator_t;
+		locator_t	m_locator;
 
 	public:
 	/// constructor
 		GlobalGridFunctionNumberData(SmartPtr<TGridFunction> spGridFct, const char* cmp)
 		: m_spGridFct(spGridFct),
-		  m_tree(*spGridFct->domain()->grid(), spGridFct->domain()->position_attachment())
+		  m_locator(*spGridFct->domain()->grid(), spGridFct->domain()->position_attachment())
 		{
 			//this->set_functions(cmp);
 
@@ -123,10 +124,11 @@ class GlobalGridFunctionNumberData
 				}
 			}
 
-//			m_tree.create_tree(spGridFct->template begin<element_t>(si),
-//														spGridFct->template end<element_t>(si));
+			m_locator.create_tree(elemsWithGridFunctions.begin(), elemsWithGridFunctions.end());
 
-			m_tree.create_tree(elemsWithGridFunctions.begin(), elemsWithGridFunctions.end());
+		//	a surface grid function on the top level follows the refinement of the grid
+			const GridLevel& gl = spGridFct->grid_level();
+			m_locator.enable_incremental_update(gl.is_surface() && gl.level() == GridLevel::TOP);
 
 		};
 
@@ -148,50 +150,156 @@ class GlobalGridFunctionNumberData
 		inline bool evaluate(number& value, const MathVector<dim>& x) const
 		{
 			element_t* elem = NULL;
-			//try{
+			if(!m_locator.locate(elem, x)){
+				return false;
+			}
 
-				if(!FindContainingElement(elem, m_tree, x)){
-					return false;
-				}
+			std::vector<MathVector<dim> > vCornerCoords;
+			std::vector<DoFIndex> ind;
+			std::vector<number> vShape;
+			value = evaluate_in_element(elem, x, vCornerCoords, ind, vShape, true);
 
-			//	get corners of element
-				std::vector<MathVector<dim> > vCornerCoords;
-				CollectCornerCoordinates(vCornerCoords, *elem, *m_spGridFct->domain());
+		//	point is found
+			return true;
+		}
 
-			//	reference object id
-				const ReferenceObjectID roid = elem->reference_object_id();
+		///	evaluates the data at a set of points
+		/**	All points are located by one batch query of the point locator.
+		 * Corner coordinates and DoF indices are reused for consecutive points
+		 * in the same element.
+		 *
+		 * \param[out]	vValue	values at the points (0 if not found)
+		 * \param[out]	vFound	false for points not contained in any local element
+		 * \param[in]	vX		points
+		 * \returns the number of points found on this process*/
+		size_t evaluate(std::vector<number>& vValue, std::vector<bool>& vFound,
+						const std::vector<MathVector<dim> >& vX) const
+		{
+			std::vector<element_t*> vElem;
+			const size_t numFound = m_locator.locate(vElem, vX);
+
+			vValue.assign(vX.size(), 0.0);
+			vFound.assign(vX.size(), false);
+
+			std::vector<MathVector<dim> > vCornerCoords;
+			std::vector<DoFIndex> ind;
+			std::vector<number> vShape;
+			element_t* lastElem = NULL;
+			for(size_t i = 0; i < vX.size(); ++i)
+			{
+				if(!vElem[i]) continue;
+
+				vValue[i] = evaluate_in_element(vElem[i], vX[i], vCornerCoords,
+												ind, vShape, vElem[i] != lastElem);
+				vFound[i] = true;
+				lastElem = vElem[i];
+			}
 
-			//	get local position of DoF
-				DimReferenceMapping<elemDim, dim>& map
-					= ReferenceMappingProvider::get<elemDim, dim>(roid, vCornerCoords);
-				MathVector<elemDim> locPos;
-				VecSet(locPos, 0.5);
-				map.global_to_local(locPos, x);
+			return numFound;
+		}
 
-			//	evaluate at shapes at ip
-				const LocalShapeFunctionSet<elemDim>& rTrialSpace =
-						LocalFiniteElementProvider::get<elemDim>(roid, m_lfeID);
-				std::vector<number> vShape;
-				rTrialSpace.shapes(vShape, locPos);
+		///	evaluates the data at a set of points on all procs (collective)
+		/**	Each process may pass its own set of points. The bounding boxes of
+		 * the local parts of the grid are gathered on all processes, and each
+		 * point is sent to the processes whose box contains it. The points are
+		 * evaluated there and the values are sent back, i.e. points and values
+		 * are exchanged in two alltoallv rounds. If a point is found on several
+		 * processes (e.g. on process boundaries), the mean value is taken.
+		 *
+		 * \param[out]	vValue	values at the points (0 if not found)
+		 * \param[out]	vFound	false for points not found on any process
+		 * \param[in]	vX		points of this process
+		 * \returns the number of points of this process which were found*/
+		size_t evaluate_global(std::vector<number>& vValue, std::vector<bool>& vFound,
+							   const std::vector<MathVector<dim> >& vX) const
+		{
+#ifdef UG_PARALLEL
+			if(pcl::NumProcs() > 1)
+			{
+				pcl::ProcessCommunicator com;
+				const int numProcs = pcl::NumProcs();
+
+			//	gather the bounding boxes of all procs: (valid, min, max)
+				const int boxSize = 2 * dim + 1;
+				typename locator_t::box_t box;
+				std::vector<number> vLocalBox(boxSize, 0.0);
+				if(m_locator.bounding_box(box)){
+					vLocalBox[0] = 1.0;
+					for(int d = 0; d < dim; ++d){
+						vLocalBox[1 + d] = box.min[d];
+						vLocalBox[1 + dim + d] = box.max[d];
+					}
+				}
+				std::vector<number> vBoxes(numProcs * boxSize);
+				com.allgather(&vLocalBox.front(), boxSize, PCL_DT_DOUBLE,
+							  &vBoxes.front(), boxSize, PCL_DT_DOUBLE);
+
+			//	sort points by destination procs
+				std::vector<std::vector<size_t> > vPointsForProc(numProcs);
+				for(size_t i = 0; i < vX.size(); ++i){
+					for(int p = 0; p < numProcs; ++p){
+						const number* b = &vBoxes[p * boxSize];
+						if(b[0] == 0.0) continue;
+
+						bool inside = true;
+						for(int d = 0; d < dim; ++d)
+							if(vX[i][d] < b[1 + d] || vX[i][d] > b[1 + dim + d])
+								inside = false;
+						if(inside)
+							vPointsForProc[p].push_back(i);
+					}
+				}
 
-			//	get multiindices of element
-				std::vector<DoFIndex> ind;
-				m_spGridFct->dof_indices(elem, m_fct, ind);
+				std::vector<MathVector<dim> > vSendPts;
+				std::vector<int> vSendSizes(numProcs);
+				for(int p = 0; p < numProcs; ++p){
+					vSendSizes[p] = (int)vPointsForProc[p].size();
+					for(size_t j = 0; j < vPointsForProc[p].size(); ++j)
+						vSendPts.push_back(vX[vPointsForProc[p][j]]);
+				}
 
-			// 	compute solution at integration point
-				value = 0.0;
-				for(size_t sh = 0; sh < vShape.size(); ++sh)
-				{
-					const number valSH = DoFRef(*m_spGridFct, ind[sh]);
-					value += valSH * vShape[sh];
+			//	first round: points to the procs containing them
+				std::vector<MathVector<dim> > vRecvPts;
+				std::vector<int> vRecvSizes;
+				com.alltoallv(vRecvPts, vSendPts, vSendSizes, &vRecvSizes);
+
+			//	evaluate the received points. Values of points not found
+			//	are sent as NaN.
+				std::vector<number> vRecvValue;
+				std::vector<bool> vRecvFound;
+				evaluate(vRecvValue, vRecvFound, vRecvPts);
+				for(size_t i = 0; i < vRecvValue.size(); ++i)
+					if(!vRecvFound[i])
+						vRecvValue[i] = std::numeric_limits<number>::quiet_NaN();
+
+			//	second round: values back to the requesting procs
+				std::vector<number> vAnswer;
+				com.alltoallv(vAnswer, vRecvValue, vRecvSizes);
+
+			//	average values which were found on several procs
+				vValue.assign(vX.size(), 0.0);
+				std::vector<int> vNumFound(vX.size(), 0);
+				size_t ans = 0;
+				for(int p = 0; p < numProcs; ++p){
+					for(size_t j = 0; j < vPointsForProc[p].size(); ++j, ++ans){
+						if(vAnswer[ans] != vAnswer[ans]) continue;
+						vValue[vPointsForProc[p][j]] += vAnswer[ans];
+						++vNumFound[vPointsForProc[p][j]];
+					}
 				}
 
-			//	point is found
-				return true;
-			//}
-			//UG_CATCH_THROW("GlobalGridFunctionNumberData: Evaluation failed."
-			//			   << "Point: " << x << ", Element: "
-			//			   << ElementDebugInfo(*m_spGridFct->domain()->grid(), elem));
+				size_t numFound = 0;
+				vFound.assign(vX.size(), false);
+				for(size_t i = 0; i < vX.size(); ++i){
+					if(vNumFound[i] == 0) continue;
+					vValue[i] /= vNumFound[i];
+					vFound[i] = true;
+					++numFound;
+				}
+				return numFound;
+			}
+#endif
+			return evaluate(vValue, vFound, vX);
 		}
 
 		/// evaluate value on all procs
@@ -246,6 +354,72 @@ class GlobalGridFunctionNumberData
 
 			return value;
 		}
+
+		///	evaluates at given positions on all procs (collective)
+		/**	vCoords holds the coordinates of all points consecutively. Throws,
+		 * if a point is not found on any process.*/
+		std::vector<number> evaluate_at_points(std::vector<number> vCoords)
+		{
+			if(vCoords.size() % dim != 0)
+				UG_THROW("Expected a multiple of "<<dim<<" components, but given "<<vCoords.size());
+
+			std::vector<MathVector<dim> > vX(vCoords.size() / dim);
+			for(size_t i = 0; i < vX.size(); ++i)
+				for(int d = 0; d < dim; ++d) vX[i][d] = vCoords[i * dim + d];
+
+			std::vector<number> vValue;
+			std::vector<bool> vFound;
+			evaluate_global(vValue, vFound, vX);
+
+			for(size_t i = 0; i < vX.size(); ++i)
+				if(!vFound[i])
+					UG_THROW("Couldn't find an element containing the specified point: " << vX[i]);
+
+			return vValue;
+		}
+
+	protected:
+		///	evaluates the function at a point in the given element
+		/**	If newElem is false, corner coordinates and DoF indices of the
+		 * previous call are reused.*/
+		number evaluate_in_element(element_t* elem, const MathVector<dim>& x,
+								   std::vector<MathVector<dim> >& vCornerCoords,
+								   std::vector<DoFIndex>& ind,
+								   std::vector<number>& vShape,
+								   bool newElem) const
+		{
+			if(newElem){
+			//	get corners of element
+				CollectCornerCoordinates(vCornerCoords, *elem, *m_spGridFct->domain());
+
+			//	get multiindices of element
+				m_spGridFct->dof_indices(elem, m_fct, ind);
+			}
+
+		//	reference object id
+			const ReferenceObjectID roid = elem->reference_object_id();
+
+		//	get local position of DoF
+			DimReferenceMapping<elemDim, dim>& map
+				= ReferenceMappingProvider::get<elemDim, dim>(roid, vCornerCoords);
+			MathVector<elemDim> locPos;
+			VecSet(locPos, 0.5);
+			map.global_to_local(locPos, x);
+
+		//	evaluate at shapes at ip
+			const LocalShapeFunctionSet<elemDim>& rTrialSpace =
+					LocalFiniteElementProvider::get<elemDim>(roid, m_lfeID);
+			rTrialSpace.shapes(vShape, locPos);
+
+		// 	compute solution at integration point
+			number value = 0.0;
+			for(size_t sh = 0; sh < vShape.size(); ++sh)
+			{
+				const number valSH = DoFRef(*m_spGridFct, ind[sh]);
+				value += valSH * vShape[sh];
+			}
+			return value;
+		}
 };
 
 
@@ -269,14 +443,14 @@ class GlobalGridFunctionGradientData
 	///	local finite element id
 		LFEID m_lfeID;
 
-		typedef lg_ntree<dim, dim, element_t>	tree_t;
-		tree_t	m_tree;
+		typedef PointLocator<element_t, dim>	locator_t;
+		locator_t	m_locator;
 
 	public:
 	/// constructor
 		GlobalGridFunctionGradientData(SmartPtr<TGridFunction> spGridFct, const char* cmp)
 		: m_spGridFct(spGridFct),
-		  m_tree(*spGridFct->domain()->grid(), spGridFct->domain()->position_attachment())
+		  m_locator(*spGridFct->domain()->grid(), spGridFct->domain()->position_attachment())
 		{
 			//this->set_functions(cmp);
 
@@ -321,10 +495,11 @@ class GlobalGridFunctionGradientData
 				}
 			}
 
-//			m_tree.create_tree(spGridFct->template begin<element_t>(si),
-//														spGridFct->template end<element_t>(si));
+			m_locator.create_tree(elemsWithGridFunctions.begin(), elemsWithGridFunctions.end());
 
-			m_tree.create_tree(elemsWithGridFunctions.begin(), elemsWithGridFunctions.end());
+		//	a surface grid function on the top level follows the refinement of the grid
+			const GridLevel& gl = spGridFct->grid_level();
+			m_locator.enable_incremental_update(gl.is_surface() && gl.level() == GridLevel::TOP);
 
 		};
 
@@ -350,7 +525,7 @@ class GlobalGridFunctionGradientData
 			element_t* elem = NULL;
 			try{
 
-				if(!FindContainingElement(elem, m_tree, x)){
+				if(!m_locator.locate(elem, x)){
 					return false;
 				}
 
@@ -43,8 +43,10 @@
 
 #include "lib_disc/common/function_group.h"
 #include "lib_disc/common/groups_util.h"
+#include "lib_disc/dof_manager/element_view.h"
 #include "lib_disc/quadrature/quadrature_provider.h"
 #include "lib_disc/local_finite_element/local_finite_element_provider.h"
+#include "lib_disc/local_finite_element/lagrange/lagrange_sum_fact.h"
 #include "lib_disc/spatial_disc/disc_util/fv1_geom.h"
 #include "lib_disc/spatial_disc/user_data/user_data.h"
 #include "lib_disc/spatial_disc/user_data/const_user_data.h"
@@ -106,6 +108,8 @@ class IIntegrand
 		                    const size_t numIP) = 0;
 	/// \}
 
+		IIntegrand() : m_pElemView(NULL), m_elemViewPos(0) {}
+
 		virtual ~IIntegrand() {}
 
 
@@ -115,11 +119,58 @@ class IIntegrand
 	///	returns the subset
 		inline int subset() const {return m_si;}
 
+	///	sets the element view and position of the element to integrate
+	/**	Set by the integration routines if iterating an ElementView (NULL
+	 * else). Integrands may then read the dof indices from the view.*/
+		void set_element_view(const IElementView* pView, size_t pos)
+			{m_pElemView = pView; m_elemViewPos = pos;}
+
+	protected:
+	///	extracts the local indices of the element to integrate
+		void element_indices(GridObject* pElem, const DoFDistribution& dd,
+		                     LocalIndices& ind) const
+		{
+			if(m_pElemView && &m_pElemView->dof_distribution() == &dd)
+				m_pElemView->indices(m_elemViewPos, ind);
+			else
+				dd.indices(pElem, ind);
+		}
+
+	///	extracts the multi indices of a function on the element to integrate
+		size_t element_dof_indices(GridObject* pElem, const DoFDistribution& dd,
+		                           size_t fct, std::vector<DoFIndex>& ind) const
+		{
+			if(m_pElemView && &m_pElemView->dof_distribution() == &dd)
+				return m_pElemView->dof_indices(m_elemViewPos, fct, ind);
+			return dd.dof_indices(pElem, fct, ind);
+		}
+
 	protected:
 	///	subset
 		int m_si;
+
+	///	element view and position of the element to integrate
+		const IElementView* m_pElemView;
+		size_t m_elemViewPos;
 };
 
+///	tells the integrand where the element to integrate is found in an element view
+/// \{
+template <typename TIterator, int TWorldDim>
+inline void SetIntegrandElementView(IIntegrand<number, TWorldDim>& integrand,
+                                    const TIterator& iter)
+{
+	integrand.set_element_view(NULL, 0);
+}
+
+template <typename TElem, int TWorldDim>
+inline void SetIntegrandElementView(IIntegrand<number, TWorldDim>& integrand,
+                                    const ElementViewIterator<TElem>& iter)
+{
+	integrand.set_element_view(&iter.view(), iter.position());
+}
+/// \}
+
 /// Abstract integrand interface
 template <typename TData, int TWorldDim, typename TImpl>
 class StdIntegrand : public IIntegrand<TData, TWorldDim>
@@ -262,7 +313,8 @@ number Integrate(TConstIterator iterBegin,
 		const size_t numIP = rQuadRule.size();
 
 	//	get all corner coordinates
-		CollectCornerCoordinates(vCorner, *pElem, aaPos, true);
+		vCorner.resize(NumVertices(pElem));
+		ElementCornerCoordinates(&vCorner[0], iter, pElem, aaPos);
 
 	//	update the reference mapping for the corners
 		mapping.update(&vCorner[0]);
@@ -279,6 +331,7 @@ number Integrate(TConstIterator iterBegin,
 		vValue.resize(numIP);
 		try
 		{
+			SetIntegrandElementView(integrand, iter);
 			integrand.values(&(vValue[0]), &(vGlobIP[0]),
 			                 pElem, &vCorner[0], rQuadRule.points(),
 							 &(vJT[0]),
@@ -310,6 +363,9 @@ number Integrate(TConstIterator iterBegin,
 		}UG_CATCH_THROW("SumValuesOnElems failed.");
 	} // end elem
 
+//	the view may be dropped after the integration
+	integrand.set_element_view(NULL, 0);
+
 //	return the summed integral contributions of all elements
 	return integral;
 }
@@ -321,13 +377,15 @@ number IntegrateSubset(SmartPtr<IIntegrand<number, TGridFunction::dim> > spInteg
 {
 //	integrate elements of subset
 	typedef typename TGridFunction::template dim_traits<dim>::grid_base_object grid_base_object;
-	typedef typename TGridFunction::template dim_traits<dim>::const_iterator const_iterator;
+	typedef typename ElementView<grid_base_object>::const_iterator const_iterator;
 
 	spIntegrand->set_subset(si);
 
+	const ElementView<grid_base_object>& view
+		= spGridFct->dd()->template element_view<grid_base_object>(si);
+
 	return Integrate<TGridFunction::dim,dim,const_iterator>
-					(spGridFct->template begin<grid_base_object>(si),
-	                 spGridFct->template end<grid_base_object>(si),
+					(view.begin(), view.end(),
 	                 spGridFct->domain()->position_accessor(),
 	                 *spIntegrand,
 	                 quadOrder, quadType);
@@ -466,7 +524,7 @@ class UserDataIntegrand
 				LocalVector u;
 
 			// 	get global indices
-				m_spGridFct->indices(pElem, ind);
+				this->element_indices(pElem, *m_spGridFct->dd(), ind);
 
 			// 	adapt local algebra
 				u.resize(ind);
@@ -676,7 +734,7 @@ class L2ErrorIntegrand
 
 		//	get multiindices of element
 			std::vector<DoFIndex> ind;  // 	aux. index array
-			m_spGridFct->dof_indices(pElem, m_fct, ind);
+			this->element_dof_indices(pElem, *m_spGridFct->dd(), m_fct, ind);
 
 		//	check multi indices
 			if(ind.size() != num_sh)
@@ -849,7 +907,7 @@ class H1ErrorIntegrand
 
 		//	get multiindices of element
 			std::vector<DoFIndex> ind;  // 	aux. index array
-			m_spGridFct->dof_indices(pElem, m_fct, ind);
+			this->element_dof_indices(pElem, *m_spGridFct->dd(), m_fct, ind);
 
 		//	check multi indices
 			if(ind.size() != num_sh)
@@ -1072,7 +1130,7 @@ class L2DiffIntegrand
 
 		//	get multiindices of element
 			std::vector<DoFIndex> vFineMI, vCoarseMI;
-			m_spFineGridFct->dof_indices(pFineElem, m_fineFct, vFineMI);
+			this->element_dof_indices(pFineElem, *m_spFineGridFct->dd(), m_fineFct, vFineMI);
 			m_spCoarseGridFct->dof_indices(pCoarseElem, m_coarseFct, vCoarseMI);
 
 		//	loop all integration points
@@ -1279,7 +1337,7 @@ class H1SemiDiffIntegrand
 
 		//	get multiindices of element
 			std::vector<DoFIndex> vFineMI, vCoarseMI;
-			m_spFineGridFct->dof_indices(pFineElem, m_fineFct, vFineMI);
+			this->element_dof_indices(pFineElem, *m_spFineGridFct->dd(), m_fineFct, vFineMI);
 			m_spCoarseGridFct->dof_indices(pCoarseElem, m_coarseFct, vCoarseMI);
 
 			std::vector<MathVector<elemDim> > vFineLocGradient(vFineMI.size());
@@ -1455,7 +1513,7 @@ class H1DiffIntegrand
 
 		//	get multiindices of element
 			std::vector<DoFIndex> vFineMI, vCoarseMI;
-			m_spFineGridFct->dof_indices(pFineElem, m_fineFct, vFineMI);
+			this->element_dof_indices(pFineElem, *m_spFineGridFct->dd(), m_fineFct, vFineMI);
 			m_spCoarseGridFct->dof_indices(pCoarseElem, m_coarseFct, vCoarseMI);
 
 			std::vector<MathVector<elemDim> > vFineLocGradient(vFineMI.size());
@@ -1548,6 +1606,9 @@ class L2FuncIntegrand
 	//	component of function
 		const size_t m_fct;
 
+	//	scratch memory of the sum-factorization kernels
+		LagrangeSumFactorizationWorkspace m_sumFactWS;
+
 	public:
 	/// constructor
 		L2FuncIntegrand(SmartPtr<TGridFunction> spGridFct, size_t cmp)
@@ -1589,13 +1650,28 @@ class L2FuncIntegrand
 		//	get multiindices of element
 
 			std::vector<DoFIndex> ind;  // 	aux. index array
-			m_spGridFct->dof_indices(pElem, m_fct, ind);
+			this->element_dof_indices(pElem, *m_spGridFct->dd(), m_fct, ind);
 
 		//	check multi indices
 			if(ind.size() != num_sh)
 				UG_THROW("L2FuncIntegrand::values: Wrong number of"
 						" multi indices.");
 
+		//	use sum-factorization for tensor product elements and rules
+			const LagrangeSumFactorization<elemDim>* pSumFact =
+				LagrangeSumFactorizationProvider<elemDim>::get(roid, m_id, vLocIP, numIP);
+			if(pSumFact != NULL)
+			{
+				std::vector<number> vCoeff(num_sh);
+				for(size_t sh = 0; sh < num_sh; ++sh)
+					vCoeff[sh] = DoFRef((*m_spGridFct), ind[sh]);
+
+				pSumFact->values(vValue, &vCoeff[0], m_sumFactWS);
+				for(size_t ip = 0; ip < numIP; ++ip)
+					vValue[ip] *= vValue[ip];
+				return;
+			}
+
 		//	loop all integration points
 			for(size_t ip = 0; ip < numIP; ++ip)
 			{
@@ -1686,6 +1762,9 @@ class H1SemiNormFuncIntegrand
 	///	local finite element id
 		LFEID m_id;
 
+	///	scratch memory of the sum-factorization kernels
+		LagrangeSumFactorizationWorkspace m_sumFactWS;
+
 	public:
 	/// constructor
 		H1SemiNormFuncIntegrand(SmartPtr<TGridFunction> gridFct, size_t cmp)
@@ -1725,13 +1804,36 @@ class H1SemiNormFuncIntegrand
 
 		//	get multiindices of element
 			std::vector<DoFIndex> ind;  // 	aux. index array
-			m_spGridFct->dof_indices(pElem, m_fct, ind);
+			this->element_dof_indices(pElem, *m_spGridFct->dd(), m_fct, ind);
 
 		//	check multi indices
 			if(ind.size() != num_sh)
 				UG_THROW("H1SemiNormFuncIntegrand::evaluate: Wrong number of"
 						" multi indices.");
 
+		//	use sum-factorization for tensor product elements and rules
+			const LagrangeSumFactorization<elemDim>* pSumFact =
+				LagrangeSumFactorizationProvider<elemDim>::get(roid, m_id, vLocIP, numIP);
+			if(pSumFact != NULL)
+			{
+				std::vector<number> vCoeff(num_sh), vSol(numIP);
+				std::vector<MathVector<elemDim> > vLocGrad(numIP);
+				for(size_t sh = 0; sh < num_sh; ++sh)
+					vCoeff[sh] = DoFRef(*m_spGridFct, ind[sh]);
+
+				pSumFact->values_and_local_grads(&vSol[0], &vLocGrad[0], &vCoeff[0], m_sumFactWS);
+				for(size_t ip = 0; ip < numIP; ++ip)
+				{
+					MathVector<worldDim> approxGradIP;
+					MathMatrix<worldDim, elemDim> JTInv;
+					Inverse(JTInv, vJT[ip]);
+					MatVecMult(approxGradIP, JTInv, vLocGrad[ip]);
+
+					vValue[ip] = VecDot(approxGradIP, approxGradIP);
+				}
+				return;
+			}
+
 		//	loop all integration points
 			std::vector<MathVector<elemDim> > vLocGradient(num_sh);
 			for(size_t ip = 0; ip < numIP; ++ip)
@@ -1827,6 +1929,8 @@ class H1NormFuncIntegrand
 	///	local finite element id
 		LFEID m_id;
 
+	///	scratch memory of the sum-factorization kernels
+		LagrangeSumFactorizationWorkspace m_sumFactWS;
 
 	public:
 	/// constructor
@@ -1867,13 +1971,37 @@ class H1NormFuncIntegrand
 
 		//	get multiindices of element
 			std::vector<DoFIndex> ind;  // 	aux. index array
-			m_spGridFct->dof_indices(pElem, m_fct, ind);
+			this->element_dof_indices(pElem, *m_spGridFct->dd(), m_fct, ind);
 
 		//	check multi indices
 			if(ind.size() != num_sh)
 				UG_THROW("H1ErrorIntegrand::evaluate: Wrong number of"
 						" multi indices.");
 
+		//	use sum-factorization for tensor product elements and rules
+			const LagrangeSumFactorization<elemDim>* pSumFact =
+				LagrangeSumFactorizationProvider<elemDim>::get(roid, m_id, vLocIP, numIP);
+			if(pSumFact != NULL)
+			{
+				std::vector<number> vCoeff(num_sh), vSol(numIP);
+				std::vector<MathVector<elemDim> > vLocGrad(numIP);
+				for(size_t sh = 0; sh < num_sh; ++sh)
+					vCoeff[sh] = DoFRef(*m_spGridFct, ind[sh]);
+
+				pSumFact->values_and_local_grads(&vSol[0], &vLocGrad[0], &vCoeff[0], m_sumFactWS);
+				for(size_t ip = 0; ip < numIP; ++ip)
+				{
+					MathVector<worldDim> approxGradIP;
+					MathMatrix<worldDim, elemDim> JTInv;
+					Inverse(JTInv, vJT[ip]);
+					MatVecMult(approxGradIP, JTInv, vLocGrad[ip]);
+
+					vValue[ip] = vSol[ip] * vSol[ip];
+					vValue[ip] += VecDot(approxGradIP, approxGradIP);
+				}
+				return;
+			}
+
 		//	loop all integration points
 			std::vector<MathVector<elemDim> > vLocGradient(num_sh);
 			for(size_t ip = 0; ip < numIP; ++ip)
@@ -1997,7 +2125,7 @@ class StdFuncIntegrand
 		//	get multiindices of element
 
 			std::vector<DoFIndex> ind;  // 	aux. index array
-			m_spGridFct->dof_indices(pElem, m_fct, ind);
+			this->element_dof_indices(pElem, *m_spGridFct->dd(), m_fct, ind);
 
 		//	check multi indices
 			if(ind.size() != num_sh)
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__IO__CHECKPOINT__
+#define __H__UG__LIB_DISC__IO__CHECKPOINT__
+
+// extern libraries
+#include <string>
+#include <vector>
+
+// other ug modules
+#include "common/util/binary_buffer.h"
+#include "common/util/smart_pointer.h"
+#include "lib_disc/function_spaces/grid_function.h"
+#include "lib_grid/file_io/file_io_checkpoint.h"
+#ifdef UG_PARALLEL
+	#include "lib_grid/parallelization/load_balancer.h"
+#endif
+
+namespace ug{
+
+/// \ingroup lib_disc_io
+/// @{
+
+///	Writes and restores checkpoints of a domain together with grid functions
+/**	A checkpoint contains the distributed multi-grid of a domain (all levels,
+ * subset indices and grid layouts, see GridCheckpointWriter) and the values
+ * of all added grid functions. All processes write into a single file in one
+ * collective operation.
+ *
+ * The values of grid functions are stored element-wise in the order in which
+ * the elements are stored in the checkpoint. The DoF numbering is thus not
+ * stored, but recreated by the dof distribution of the restored domain. Values
+ * are stored in consistent storage type.
+ *
+ * Restoring a checkpoint is done in two steps:
+ * \code
+ * 	checkpoint:read_domain(dom, "run.ckp")
+ * 	-- create approximation space and grid functions on dom
+ * 	checkpoint:add_grid_function(u, "u")
+ * 	checkpoint:read_grid_functions()
+ * \endcode
+ * The grid of the domain must not be changed between both calls.
+ *
+ * If the checkpoint is read on the same number of processes by which it was
+ * written, the distributed grid is restored exactly. On fewer processes the
+ * parts are merged as described in GridCheckpointReader and a redistribution
+ * is recommended after read_grid_functions. On more processes, the parts are
+ * read by the first processes only and read_grid_functions redistributes the
+ * domain together with all grid functions defined on it (see
+ * GridFunction::enable_redistribution) onto all processes. The load balancer
+ * used for this can be set through set_load_balancer. By default a
+ * DomainLoadBalancer with a dynamic bisection partitioner for the elements
+ * of the domain's dimension is used.
+ */
+template <typename TDomain, typename TAlgebra>
+class Checkpoint
+{
+	public:
+	///	type of grid function
+		typedef GridFunction<TDomain, TAlgebra> TGridFunction;
+
+	public:
+		Checkpoint() : m_numParts(0)	{}
+
+	///	adds a grid function which is written or read under the given name
+		void add_grid_function(SmartPtr<TGridFunction> spGridFct, const char* name);
+
+	///	removes all grid functions
+		void clear_grid_functions()	{m_vGridFct.clear();}
+
+	///	writes the domain and all added grid functions to a checkpoint file
+		void write(TDomain& dom, const char* filename);
+
+	///	restores the domain from a checkpoint file
+	/**	The domain should be empty. The parts of the file are kept in memory
+	 * until read_grid_functions is called.*/
+		void read_domain(SmartPtr<TDomain> spDom, const char* filename);
+
+	///	restores all added grid functions from the checkpoint read by read_domain
+	/**	If the checkpoint has fewer parts than there are processes, the domain
+	 * is redistributed afterwards.*/
+		void read_grid_functions();
+
+	#ifdef UG_PARALLEL
+	///	sets the load balancer which redistributes the domain in read_grid_functions
+	/**	The load balancer has to operate on the domain passed to read_domain.*/
+		void set_load_balancer(SmartPtr<LoadBalancer> spBalancer)	{m_spBalancer = spBalancer;}
+	#endif
+
+	protected:
+	///	elements of a part of the checkpoint and the begin of its grid function data
+		struct Part{
+			size_t					dataPos;
+			std::vector<Vertex*>	vrts;
+			std::vector<Edge*>		edges;
+			std::vector<Face*>		faces;
+			std::vector<Volume*>	vols;
+		};
+
+		template <class TElem>
+		static void write_values(BinaryBuffer& out, const TGridFunction& u,
+								 const std::vector<TElem*>& elems);
+
+		template <class TElem>
+		static void read_values(BinaryBuffer& in, TGridFunction& u,
+								const std::vector<TElem*>& elems);
+
+		static void write_grid_function(BinaryBuffer& out, const TGridFunction& u,
+										const GridCheckpointWriter& writer);
+
+		static void read_grid_function(BinaryBuffer& in, TGridFunction& u,
+									   const Part& part);
+
+	#ifdef UG_PARALLEL
+	///	distributes the domain read by read_domain onto all processes
+		void redistribute();
+	#endif
+
+	protected:
+		std::vector<std::pair<std::string, SmartPtr<TGridFunction> > >	m_vGridFct;
+		std::vector<BinaryBuffer>	m_vBufs;
+		std::vector<Part>			m_vParts;
+		SmartPtr<TDomain>			m_spDom;
+		int							m_numParts;
+
+	#ifdef UG_PARALLEL
+		SmartPtr<LoadBalancer>		m_spBalancer;
+	#endif
+};
+
+/// @}
+
+} // end namespace ug
+
+#include "checkpoint_impl.h"
+
+#endif /* __H__UG__LIB_DISC__IO__CHECKPOINT__ */
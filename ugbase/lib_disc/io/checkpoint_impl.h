@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__IO__CHECKPOINT_IMPL__
+#define __H__UG__LIB_DISC__IO__CHECKPOINT_IMPL__
+
+#include <cstring>
+#include "common/serialization.h"
+#include "common/profiler/profiler.h"
+#include "lib_disc/common/multi_index.h"
+#include "lib_grid/algorithms/attachment_util.h"
+#ifdef UG_PARALLEL
+	#include "pcl/pcl_base.h"
+	#include "lib_grid/parallelization/partitioner_dynamic_bisection.h"
+	#include "lib_disc/parallelization/domain_load_balancer.h"
+#endif
+
+namespace ug{
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+add_grid_function(SmartPtr<TGridFunction> spGridFct, const char* name)
+{
+	UG_COND_THROW(spGridFct.invalid(), "Checkpoint: invalid grid function.");
+	for(size_t i = 0; i < m_vGridFct.size(); ++i){
+		UG_COND_THROW(m_vGridFct[i].first == name,
+					  "Checkpoint: grid function '" << name << "' was already added.");
+	}
+	m_vGridFct.push_back(std::make_pair(std::string(name), spGridFct));
+}
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+write(TDomain& dom, const char* filename)
+{
+	PROFILE_FUNC_GROUP("io");
+	BinaryBuffer buf;
+	GridCheckpointWriter writer(*dom.grid());
+	writer.write(buf, *dom.subset_handler(), dom.position_attachment());
+
+	int numGridFcts = (int)m_vGridFct.size();
+	Serialize(buf, numGridFcts);
+	for(size_t i = 0; i < m_vGridFct.size(); ++i){
+		Serialize(buf, m_vGridFct[i].first);
+
+	//	values are stored consistently, so that parts may be merged on read
+		SmartPtr<TGridFunction> spU = m_vGridFct[i].second;
+		#ifdef UG_PARALLEL
+		if(!spU->has_storage_type(PST_CONSISTENT)){
+			spU = spU->clone();
+			if(!spU->change_storage_type(PST_CONSISTENT))
+				UG_THROW("Checkpoint: can't convert grid function '"
+						 << m_vGridFct[i].first << "' to consistent storage type.");
+		}
+		#endif
+
+		write_grid_function(buf, *spU, writer);
+	}
+
+	WriteCheckpointFile(buf, filename);
+}
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+read_domain(SmartPtr<TDomain> spDom, const char* filename)
+{
+	PROFILE_FUNC_GROUP("io");
+	UG_COND_THROW(spDom.invalid(), "Checkpoint: invalid domain.");
+	m_spDom = spDom;
+	TDomain& dom = *spDom;
+	m_numParts = ReadCheckpointFile(m_vBufs, filename);
+
+//	the first part is always read by process 0, which thus holds valid subset infos
+	MultiGrid& mg = *dom.grid();
+	mg.message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STARTS, 0));
+
+	m_vParts.clear();
+	m_vParts.resize(m_vBufs.size());
+
+	GridCheckpointReader reader(mg, *dom.subset_handler());
+	for(size_t i = 0; i < m_vBufs.size(); ++i){
+		Part& part = m_vParts[i];
+		reader.read_part(m_vBufs[i], dom.position_attachment());
+		part.dataPos = m_vBufs[i].read_pos();
+		part.vrts = reader.elements<Vertex>();
+		part.edges = reader.elements<Edge>();
+		part.faces = reader.elements<Face>();
+		part.vols = reader.elements<Volume>();
+	}
+	reader.finish();
+
+	mg.message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STOPS, 0));
+}
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+read_grid_functions()
+{
+	PROFILE_FUNC_GROUP("io");
+	for(size_t iFct = 0; iFct < m_vGridFct.size(); ++iFct){
+		const std::string& name = m_vGridFct[iFct].first;
+		TGridFunction& u = *m_vGridFct[iFct].second;
+
+		for(size_t iPart = 0; iPart < m_vParts.size(); ++iPart){
+			Part& part = m_vParts[iPart];
+			BinaryBuffer& in = m_vBufs[iPart];
+			in.set_read_pos(part.dataPos);
+
+		//	find the section of the grid function
+			int numGridFcts = Deserialize<int>(in);
+			bool found = false;
+			for(int i = 0; i < numGridFcts; ++i){
+				std::string curName = Deserialize<std::string>(in);
+				uint64 size = Deserialize<uint64>(in);
+				if(curName == name){
+					read_grid_function(in, u, part);
+					found = true;
+					break;
+				}
+				in.set_read_pos(in.read_pos() + size);
+			}
+			UG_COND_THROW(!found, "Checkpoint: grid function '" << name
+						  << "' is not contained in the checkpoint.");
+		}
+
+		#ifdef UG_PARALLEL
+		u.set_storage_type(PST_CONSISTENT);
+		#endif
+	}
+
+	#ifdef UG_PARALLEL
+	if(m_numParts < pcl::NumProcs()){
+	//	the elements of the parts are invalidated by the redistribution
+		m_vBufs.clear();
+		m_vParts.clear();
+		redistribute();
+	}
+	#endif
+}
+
+#ifdef UG_PARALLEL
+/**	The values of the grid functions are carried along by the distribution
+ * callbacks of the grid functions, which is why redistribution has to be
+ * enabled for all of them.*/
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+redistribute()
+{
+	PROFILE_FUNC_GROUP("io");
+	UG_COND_THROW(m_spDom.invalid(), "Checkpoint: read_domain has to be called first.");
+	for(size_t i = 0; i < m_vGridFct.size(); ++i){
+		UG_COND_THROW(!m_vGridFct[i].second->redistribution_enabled(),
+					  "Checkpoint: redistribution of grid function '"
+					  << m_vGridFct[i].first << "' is disabled, but the checkpoint"
+					  " was written by " << m_numParts << " processes and has to be"
+					  " distributed onto " << pcl::NumProcs() << " processes.");
+	}
+
+	SmartPtr<LoadBalancer> spBalancer = m_spBalancer;
+	if(spBalancer.invalid()){
+		typedef typename grid_dim_traits<TDomain::dim>::grid_base_object	TElem;
+		typedef DomainPartitioner<TDomain, Partitioner_DynamicBisection<TElem, TDomain::dim> >
+				TPartitioner;
+
+		SPProcessHierarchy procH = ProcessHierarchy::create();
+		procH->add_hierarchy_level(0, pcl::NumProcs());
+
+		spBalancer = make_sp(new DomainLoadBalancer<TDomain>(m_spDom));
+		spBalancer->set_partitioner(make_sp(new TPartitioner(*m_spDom)));
+		spBalancer->set_next_process_hierarchy(procH);
+	}
+
+	UG_COND_THROW(!spBalancer->rebalance(),
+				  "Checkpoint: redistribution of the restored domain failed.");
+}
+#endif
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+write_grid_function(BinaryBuffer& out, const TGridFunction& u,
+					const GridCheckpointWriter& writer)
+{
+//	the size of the section is written once it is known
+	const size_t sizePos = out.write_pos();
+	Serialize(out, (uint64)0);
+	const size_t begin = out.write_pos();
+
+	Serialize(out, (int)u.num_fct());
+	write_values(out, u, writer.elements<Vertex>());
+	write_values(out, u, writer.elements<Edge>());
+	write_values(out, u, writer.elements<Face>());
+	write_values(out, u, writer.elements<Volume>());
+
+	uint64 size = out.write_pos() - begin;
+	memcpy(out.buffer() + sizePos, &size, sizeof(uint64));
+}
+
+template <typename TDomain, typename TAlgebra>
+void Checkpoint<TDomain, TAlgebra>::
+read_grid_function(BinaryBuffer& in, TGridFunction& u, const Part& part)
+{
+	int numFct = Deserialize<int>(in);
+	UG_COND_THROW(numFct != (int)u.num_fct(),
+				  "Checkpoint: grid function was written with " << numFct
+				  << " functions, but the given grid function has " << u.num_fct());
+
+	read_values(in, u, part.vrts);
+	read_values(in, u, part.edges);
+	read_values(in, u, part.faces);
+	read_values(in, u, part.vols);
+}
+
+/**	For each element, the number of dofs followed by their values is written.
+ * Elements which are not contained in the grid function have no dofs.*/
+template <typename TDomain, typename TAlgebra>
+template <class TElem>
+void Checkpoint<TDomain, TAlgebra>::
+write_values(BinaryBuffer& out, const TGridFunction& u,
+			 const std::vector<TElem*>& elems)
+{
+	std::vector<DoFIndex> ind;
+	std::vector<number> vals;
+	for(size_t i = 0; i < elems.size(); ++i){
+		ind.clear();
+		if(u.is_contained(elems[i])){
+			for(size_t fct = 0; fct < u.num_fct(); ++fct)
+				u.inner_dof_indices(elems[i], fct, ind, false);
+		}
+
+		int numDoFs = (int)ind.size();
+		out.write((const char*)&numDoFs, sizeof(int));
+		if(numDoFs == 0)
+			continue;
+
+		vals.resize(numDoFs);
+		for(size_t j = 0; j < ind.size(); ++j)
+			vals[j] = DoFRef(u, ind[j]);
+		out.write((const char*)&vals.front(), numDoFs * sizeof(number));
+	}
+}
+
+template <typename TDomain, typename TAlgebra>
+template <class TElem>
+void Checkpoint<TDomain, TAlgebra>::
+read_values(BinaryBuffer& in, TGridFunction& u,
+			const std::vector<TElem*>& elems)
+{
+	std::vector<DoFIndex> ind;
+	std::vector<number> vals;
+	for(size_t i = 0; i < elems.size(); ++i){
+		int numDoFs;
+		in.read((char*)&numDoFs, sizeof(int));
+		if(numDoFs == 0)
+			continue;
+
+		vals.resize(numDoFs);
+		in.read((char*)&vals.front(), numDoFs * sizeof(number));
+
+	//	copies which are not contained in the restored grid function are skipped
+		if(!u.is_contained(elems[i]))
+			continue;
+
+		ind.clear();
+		for(size_t fct = 0; fct < u.num_fct(); ++fct)
+			u.inner_dof_indices(elems[i], fct, ind, false);
+
+		UG_COND_THROW((int)ind.size() != numDoFs,
+					  "Checkpoint: number of dofs of an element does not match. "
+					  "Make sure that the approximation space matches the one "
+					  "used when writing the checkpoint.");
+
+		for(size_t j = 0; j < ind.size(); ++j)
+			DoFRef(u, ind[j]) = vals[j];
+	}
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__IO__CHECKPOINT_IMPL__ */
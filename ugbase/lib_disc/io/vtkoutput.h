@@ -42,6 +42,7 @@
 #include "common/util/base64_file_writer.h"
 #include "lib_disc/common/function_group.h"
 #include "lib_disc/domain.h"
+#include "lib_disc/dof_manager/element_view.h"
 #include "lib_disc/spatial_disc/user_data/user_data.h"
 
 namespace ug{
@@ -104,6 +105,36 @@ struct IteratorProvider<MGSubsetHandler>
 	}
 };
 
+template <typename TDomain, typename TAlgebra> class GridFunction;
+
+///	iterates grid functions through the cached element views of their dof distribution
+template <typename TDomain, typename TAlgebra>
+struct IteratorProvider<GridFunction<TDomain, TAlgebra> >
+{
+	private:
+	typedef GridFunction<TDomain, TAlgebra> T;
+
+	public:
+	template <typename TElem>
+	struct traits
+	{
+		typedef typename ElementView<TElem>::iterator iterator;
+		typedef typename ElementView<TElem>::const_iterator const_iterator;
+	};
+
+	template <typename TElem>
+	static typename traits<TElem>::const_iterator begin(const T& provider, int si)
+	{
+		return provider.dd()->template element_view<TElem>(si).begin();
+	}
+
+	template <typename TElem>
+	static typename traits<TElem>::const_iterator end(const T& provider, int si)
+	{
+		return provider.dd()->template element_view<TElem>(si).end();
+	}
+};
+
 
 /// output writer to the VTK file format
 /**
@@ -1431,7 +1431,7 @@ write_nodal_data_elementwise(VTKFileWriter& File, TFunction& u, number time,
 		TElem *elem = *iterBegin;
 
 	//	update the reference mapping for the corners
-		CollectCornerCoordinates(vCorner, *elem, u.domain()->position_accessor(), true);
+		ElementCornerCoordinates(&vCorner[0], iterBegin, elem, u.domain()->position_accessor());
 
 	//	get subset
 		int theSI = si;
@@ -1445,7 +1445,7 @@ write_nodal_data_elementwise(VTKFileWriter& File, TFunction& u, number time,
 			LocalVector locU;
 
 		// 	get global indices
-			u.indices(elem, ind);
+			ElementIndices(ind, iterBegin, elem, *u.dd());
 
 		// 	adapt local algebra
 			locU.resize(ind);
@@ -2000,7 +2000,7 @@ write_cell_data_elementwise(VTKFileWriter& File, TFunction& u, number time,
 		TElem *elem = *iterBegin;
 
 	//	update the reference mapping for the corners
-		CollectCornerCoordinates(vCorner, *elem, u.domain()->position_accessor(), true);
+		ElementCornerCoordinates(&vCorner[0], iterBegin, elem, u.domain()->position_accessor());
 
 	//	compute global integration points
 		AveragePositions(globIP, &vCorner[0], numCo);
@@ -2017,7 +2017,7 @@ write_cell_data_elementwise(VTKFileWriter& File, TFunction& u, number time,
 			LocalVector locU;
 
 		// 	get global indices
-			u.indices(elem, ind);
+			ElementIndices(ind, iterBegin, elem, *u.dd());
 
 		// 	adapt local algebra
 			locU.resize(ind);
@@ -2201,7 +2201,7 @@ write_cell_values_elementwise(VTKFileWriter& File, TFunction& u,
 		for(size_t f = 0; f < vFct.size(); ++f)
 		{
 		//	get multi index of vertex for the function
-			if(u.dof_indices(elem, vFct[f], vMultInd) != vNsh[f])
+			if(ElementDoFIndices(vMultInd, iterBegin, elem, *u.dd(), vFct[f]) != vNsh[f])
 				UG_THROW("VTK:write_cell_values_elementwise: "
 						"Number of shape functions for component "<<vFct[f]<<
 						" does not match number of DoFs");
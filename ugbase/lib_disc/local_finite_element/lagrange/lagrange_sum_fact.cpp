@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <cmath>
+
+#include "lagrange_sum_fact.h"
+#include "lagrange.h"
+#include "../common/lagrange1d.h"
+
+namespace ug{
+
+////////////////////////////////////////////////////////////////////////////////
+// helper
+////////////////////////////////////////////////////////////////////////////////
+
+///	computes the mapping shape index -> lexicographic index (first coord slowest)
+template <typename TRefElem>
+static void ComputeLexicographicIndex(std::vector<size_t>& vLexIndex, size_t p)
+{
+	static const int dim = TRefElem::dim;
+
+	FlexLagrangeLSFS<TRefElem> lsfs(p);
+	vLexIndex.resize(lsfs.num_sh());
+	for(size_t sh = 0; sh < lsfs.num_sh(); ++sh)
+	{
+		const MathVector<dim,int>& ind = lsfs.multi_index(sh);
+
+		size_t lex = 0;
+		for(int d = 0; d < dim; ++d)
+			lex = lex * (p+1) + ind[d];
+
+		vLexIndex[sh] = lex;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// LagrangeSumFactorization
+////////////////////////////////////////////////////////////////////////////////
+
+template <int TDim>
+LagrangeSumFactorization<TDim>::
+LagrangeSumFactorization(size_t order, const MathVector<dim>* vLocIP, size_t numIP)
+	: m_p(order), m_n1(order+1), m_nip(numIP), m_vLocIP(vLocIP)
+{
+	if(order < 1)
+		UG_THROW("LagrangeSumFactorization: order must be >= 1, but "
+				<<order<<" requested.");
+
+	if(!IsTensorProductRule(vLocIP, numIP, &m_nq))
+		UG_THROW("LagrangeSumFactorization: integration points are not of "
+				"tensor product structure.");
+
+//	number of shapes
+	m_nsh = 1;
+	for(int d = 0; d < dim; ++d) m_nsh *= m_n1;
+
+//	shape -> lexicographic mapping
+	switch(dim){
+		case 1: ComputeLexicographicIndex<ReferenceEdge>(m_vLexIndex, m_p); break;
+		case 2: ComputeLexicographicIndex<ReferenceQuadrilateral>(m_vLexIndex, m_p); break;
+		case 3: ComputeLexicographicIndex<ReferenceHexahedron>(m_vLexIndex, m_p); break;
+		default: UG_THROW("LagrangeSumFactorization: only for dim 1, 2 and 3.");
+	}
+
+//	1d polynomials at 1d points (the first coordinate runs slowest)
+	size_t stride = 1;
+	for(int d = 1; d < dim; ++d) stride *= m_nq;
+
+	m_vB.resize(m_nq * m_n1); m_vD.resize(m_nq * m_n1);
+	m_vBt.resize(m_nq * m_n1); m_vDt.resize(m_nq * m_n1);
+	for(size_t i = 0; i < m_n1; ++i)
+	{
+		const EquidistantLagrange1D poly(i, m_p);
+		const Polynomial1D dpoly = poly.derivative();
+
+		for(size_t q = 0; q < m_nq; ++q)
+		{
+			const number x = vLocIP[q * stride][0];
+			m_vB[q * m_n1 + i] = m_vBt[i * m_nq + q] = poly.value(x);
+			m_vD[q * m_n1 + i] = m_vDt[i * m_nq + q] = dpoly.value(x);
+		}
+	}
+
+//	size of workspace buffers
+	m_bufSize = 1;
+	for(int d = 0; d < dim; ++d) m_bufSize *= std::max(m_n1, m_nq);
+}
+
+template <int TDim>
+bool LagrangeSumFactorization<TDim>::
+IsTensorProductRule(const MathVector<dim>* vLocIP, size_t numIP, size_t* pNum1d)
+{
+	if(vLocIP == NULL || numIP == 0) return false;
+
+//	number of 1d points
+	const size_t nq = (size_t)std::floor(std::pow((number)numIP, 1.0/dim) + 0.5);
+	size_t stride = 1;
+	for(int d = 1; d < dim; ++d) stride *= nq;
+	if(stride * nq != numIP) return false;
+
+//	check that point (q_0,...,q_{d-1}) is (x_{q_0},...,x_{q_{d-1}})
+	const number eps = 1e-12;
+	for(size_t ip = 0; ip < numIP; ++ip)
+	{
+		size_t rest = ip;
+		for(int d = dim-1; d >= 0; --d)
+		{
+			const size_t q = rest % nq; rest /= nq;
+			if(std::fabs(vLocIP[ip][d] - vLocIP[q * stride][0]) > eps)
+				return false;
+		}
+	}
+
+	if(pNum1d) *pNum1d = nq;
+	return true;
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+apply_1d(number* out, const number* M, size_t nQ,
+         const number* in, size_t nA, size_t nB, size_t nC)
+{
+	for(size_t a = 0; a < nA; ++a)
+	{
+		const number* inA = in + a * nB * nC;
+		for(size_t q = 0; q < nQ; ++q)
+		{
+			number* o = out + (a * nQ + q) * nC;
+			for(size_t c = 0; c < nC; ++c) o[c] = 0.0;
+
+			const number* m = M + q * nB;
+			for(size_t b = 0; b < nB; ++b)
+			{
+				const number* i = inA + b * nC;
+				const number mb = m[b];
+				for(size_t c = 0; c < nC; ++c)
+					o[c] += mb * i[c];
+			}
+		}
+	}
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+tensor_apply(number* out, const number* in,
+             const number* const vM[], size_t nOut, size_t nIn,
+             Workspace& ws) const
+{
+	size_t nA = 1, nC = 1;
+	for(int d = 1; d < dim; ++d) nC *= nIn;
+
+	const number* src = in;
+	for(int d = 0; d < dim; ++d)
+	{
+		number* dst = (d == dim-1) ? out : ((d % 2 == 0) ? &ws.vTmp1[0] : &ws.vTmp2[0]);
+
+		apply_1d(dst, vM[d], nOut, src, nA, nIn, nC);
+
+		src = dst;
+		nA *= nOut;
+		if(d < dim-1) nC /= nIn;
+	}
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+prepare(Workspace& ws) const
+{
+	if(ws.vLex.size() >= m_bufSize) return;
+	ws.vLex.resize(m_bufSize);
+	ws.vIP.resize(m_bufSize);
+	ws.vTmp1.resize(m_bufSize);
+	ws.vTmp2.resize(m_bufSize);
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+to_lex(const number vCoeff[], Workspace& ws) const
+{
+	prepare(ws);
+	for(size_t sh = 0; sh < m_nsh; ++sh)
+		ws.vLex[m_vLexIndex[sh]] = vCoeff[sh];
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+values(number vValue[], const number vCoeff[], Workspace& ws) const
+{
+	to_lex(vCoeff, ws);
+
+	const number* vM[dim];
+	for(int d = 0; d < dim; ++d) vM[d] = &m_vB[0];
+
+	tensor_apply(vValue, &ws.vLex[0], vM, m_nq, m_n1, ws);
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+local_grads(MathVector<dim> vLocGrad[], const number vCoeff[],
+            Workspace& ws) const
+{
+	to_lex(vCoeff, ws);
+
+	const number* vM[dim];
+	for(int dir = 0; dir < dim; ++dir)
+	{
+		for(int d = 0; d < dim; ++d)
+			vM[d] = (d == dir) ? &m_vD[0] : &m_vB[0];
+
+		tensor_apply(&ws.vIP[0], &ws.vLex[0], vM, m_nq, m_n1, ws);
+
+		for(size_t ip = 0; ip < m_nip; ++ip)
+			vLocGrad[ip][dir] = ws.vIP[ip];
+	}
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+values_and_local_grads(number vValue[], MathVector<dim> vLocGrad[],
+                       const number vCoeff[], Workspace& ws) const
+{
+	values(vValue, vCoeff, ws);
+	local_grads(vLocGrad, vCoeff, ws);
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+add_tested_values(number vRes[], const number vValue[], Workspace& ws) const
+{
+	prepare(ws);
+
+	const number* vM[dim];
+	for(int d = 0; d < dim; ++d) vM[d] = &m_vBt[0];
+
+	tensor_apply(&ws.vLex[0], vValue, vM, m_n1, m_nq, ws);
+
+	for(size_t sh = 0; sh < m_nsh; ++sh)
+		vRes[sh] += ws.vLex[m_vLexIndex[sh]];
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+add_tested_local_grads(number vRes[], const MathVector<dim> vLocGrad[],
+                       Workspace& ws) const
+{
+	prepare(ws);
+
+	const number* vM[dim];
+	for(int dir = 0; dir < dim; ++dir)
+	{
+		for(size_t ip = 0; ip < m_nip; ++ip)
+			ws.vIP[ip] = vLocGrad[ip][dir];
+
+		for(int d = 0; d < dim; ++d)
+			vM[d] = (d == dir) ? &m_vDt[0] : &m_vBt[0];
+
+		tensor_apply(&ws.vLex[0], &ws.vIP[0], vM, m_n1, m_nq, ws);
+
+		for(size_t sh = 0; sh < m_nsh; ++sh)
+			vRes[sh] += ws.vLex[m_vLexIndex[sh]];
+	}
+}
+
+template <int TDim>
+void LagrangeSumFactorization<TDim>::
+add_tested(number vRes[], const number vValue[],
+           const MathVector<dim> vLocGrad[], Workspace& ws) const
+{
+	add_tested_values(vRes, vValue, ws);
+	add_tested_local_grads(vRes, vLocGrad, ws);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// LagrangeSumFactorizationProvider
+////////////////////////////////////////////////////////////////////////////////
+
+template <int TDim>
+const LagrangeSumFactorization<TDim>*
+LagrangeSumFactorizationProvider<TDim>::
+get(ReferenceObjectID roid, const LFEID& lfeID,
+    const MathVector<TDim>* vLocIP, size_t numIP)
+{
+//	only for tensor product elements
+	if(dim == 1 && roid != ROID_EDGE) return NULL;
+	if(dim == 2 && roid != ROID_QUADRILATERAL) return NULL;
+	if(dim == 3 && roid != ROID_HEXAHEDRON) return NULL;
+
+//	only for lagrange spaces of fixed order
+	if(lfeID.type() != LFEID::LAGRANGE || lfeID.dim() != dim
+		|| lfeID.order() < 1) return NULL;
+
+//	lookup kernel or create it if points are suitable
+	const LagrangeSumFactorization<TDim>* pKernel = NULL;
+	#ifdef UG_OPENMP
+		#pragma omp critical(ug_lagrange_sum_fact_provider)
+	#endif
+	{
+		map_type& map = kernels();
+		const key_type key(lfeID.order(), vLocIP);
+		typename map_type::iterator iter = map.find(key);
+		if(iter != map.end()) pKernel = iter->second.get();
+		else
+		{
+			SmartPtr<LagrangeSumFactorization<TDim> > sp;
+			if(LagrangeSumFactorization<TDim>::IsTensorProductRule(vLocIP, numIP))
+				sp = make_sp(new LagrangeSumFactorization<TDim>(lfeID.order(), vLocIP, numIP));
+
+			map[key] = sp;
+			pKernel = sp.get();
+		}
+	}
+	return pKernel;
+}
+
+template class LagrangeSumFactorization<1>;
+template class LagrangeSumFactorization<2>;
+template class LagrangeSumFactorization<3>;
+
+template class LagrangeSumFactorizationProvider<1>;
+template class LagrangeSumFactorizationProvider<2>;
+template class LagrangeSumFactorizationProvider<3>;
+
+} // end namespace ug
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__LOCAL_SHAPE_FUNCTION_SET__LAGRANGE__LAGRANGE_SUM_FACT__
+#define __H__UG__LIB_DISC__LOCAL_SHAPE_FUNCTION_SET__LAGRANGE__LAGRANGE_SUM_FACT__
+
+#include <vector>
+#include <map>
+
+#include "common/math/ugmath.h"
+#include "common/util/smart_pointer.h"
+#include "lib_disc/local_finite_element/local_finite_element_id.h"
+#include "lib_grid/grid/grid_base_objects.h"
+
+namespace ug{
+
+///	scratch memory for the evaluations of LagrangeSumFactorization
+/**
+ * The buffers are resized on first use and can be reused for all evaluations
+ * of a thread, independent of the dimension and order of the kernel. Users
+ * should keep a workspace alive across elements to avoid allocations in the
+ * element loop.
+ */
+struct LagrangeSumFactorizationWorkspace
+{
+	std::vector<number> vLex, vIP, vTmp1, vTmp2;
+};
+
+/// Sum-factorized evaluation of Lagrange shape functions on edges, quads and hexahedra
+/**
+ * The Lagrange shape functions on the reference edge, quadrilateral and hexahedron
+ * are tensor products of the one dimensional equidistant Lagrange polynomials
+ * \f$ \phi_{(i_0,\dots,i_{d-1})}(x) = \prod_{k} L_{i_k}(x_k)\f$. If the
+ * integration points have a tensor product structure as well (e.g. the rules
+ * GaussQuadratureQuadrilateral and GaussQuadratureHexahedron), the evaluation
+ * of a finite element function
+ * \f[
+ * 		u(x_q) = \sum_{sh} u_{sh} \phi_{sh}(x_q)
+ * \f]
+ * and its local gradient at all integration points can be carried out
+ * dimension by dimension with the 1d matrices \f$ B_{qi} = L_i(x_q)\f$ and
+ * \f$ D_{qi} = L_i'(x_q)\f$. This reduces the costs from
+ * \f$ O(p^{2d}) \f$ to \f$ O(p^{d+1}) \f$. The same holds for the transposed
+ * operation, i.e. the testing of integration point values with all shape
+ * functions as needed for element-local residuals and matrix-free applies.
+ *
+ * Coefficients and results are passed in the shape function ordering of the
+ * LagrangeLSFS / FlexLagrangeLSFS of the same order, integration point values
+ * in the ordering of the passed rule.
+ *
+ * The kernels are shared between all users (see
+ * LagrangeSumFactorizationProvider) and do not modify their state during the
+ * evaluation. Intermediate results are stored in a Workspace owned by the
+ * caller, thus concurrent evaluations are safe as long as every thread uses
+ * a workspace of its own.
+ *
+ * \tparam	TDim		reference dimension (1 = edge, 2 = quadrilateral, 3 = hexahedron)
+ */
+template <int TDim>
+class LagrangeSumFactorization
+{
+	public:
+	///	reference dimension
+		static const int dim = TDim;
+
+	///	scratch memory for the evaluations
+		typedef LagrangeSumFactorizationWorkspace Workspace;
+
+	public:
+	///	constructor
+	/**
+	 * Creates the kernel for the given order and integration points. The
+	 * integration points must be a tensor product of a 1d point set, where
+	 * the first coordinate runs slowest, i.e. the point with 1d-indices
+	 * (q_0,...,q_{d-1}) is stored at position (q_0*n + q_1)*n + ... . If this is
+	 * not the case, an exception is thrown. Use IsTensorProductRule to check.
+	 *
+	 * \param[in]	order		order of the Lagrange shape functions
+	 * \param[in]	vLocIP		integration points
+	 * \param[in]	numIP		number of integration points
+	 */
+		LagrangeSumFactorization(size_t order,
+		                         const MathVector<dim>* vLocIP, size_t numIP);
+
+	///	order of shape functions
+		size_t order() const {return m_p;}
+
+	///	number of shape functions
+		size_t num_sh() const {return m_nsh;}
+
+	///	number of integration points
+		size_t num_ip() const {return m_nip;}
+
+	///	number of integration points per direction
+		size_t num_ip_1d() const {return m_nq;}
+
+	///	integration points the kernel is prepared for
+		const MathVector<dim>* local_ips() const {return m_vLocIP;}
+
+	///	evaluates sum_sh vCoeff[sh] * phi_sh at all integration points
+		void values(number vValue[], const number vCoeff[],
+		            Workspace& ws) const;
+
+	///	evaluates sum_sh vCoeff[sh] * grad phi_sh at all integration points
+		void local_grads(MathVector<dim> vLocGrad[], const number vCoeff[],
+		                 Workspace& ws) const;
+
+	///	evaluates values and local gradients at all integration points
+		void values_and_local_grads(number vValue[],
+		                            MathVector<dim> vLocGrad[],
+		                            const number vCoeff[],
+		                            Workspace& ws) const;
+
+	///	adds sum_ip vValue[ip] * phi_sh(ip) to vRes[sh] for all shapes
+		void add_tested_values(number vRes[], const number vValue[],
+		                       Workspace& ws) const;
+
+	///	adds sum_ip vLocGrad[ip] * grad phi_sh(ip) to vRes[sh] for all shapes
+		void add_tested_local_grads(number vRes[],
+		                            const MathVector<dim> vLocGrad[],
+		                            Workspace& ws) const;
+
+	///	adds the tested values and local gradients to vRes[sh]
+	/**
+	 * Computes for all shape functions
+	 * \f[
+	 * 	r_{sh} \mathrel{+}= \sum_{ip} v_{ip} \phi_{sh}(x_{ip})
+	 * 						+ g_{ip} \cdot \nabla \phi_{sh}(x_{ip}).
+	 * \f]
+	 * Integration weights, determinants and the transformation of the
+	 * gradients have to be incorporated into the passed values by the caller.
+	 */
+		void add_tested(number vRes[], const number vValue[],
+		                const MathVector<dim> vLocGrad[],
+		                Workspace& ws) const;
+
+	///	returns if the passed points are of tensor product structure
+		static bool IsTensorProductRule(const MathVector<dim>* vLocIP,
+		                                size_t numIP, size_t* pNum1d = NULL);
+
+	protected:
+	///	applies the 1d matrices vM[d] in direction d to a dim-tensor
+	/**
+	 * Input tensor has extent nIn in every direction, output tensor has
+	 * extent nOut. The matrices are stored row-major with size nOut x nIn.
+	 */
+		void tensor_apply(number* out, const number* in,
+		                  const number* const vM[], size_t nOut, size_t nIn,
+		                  Workspace& ws) const;
+
+	///	applies the 1d matrix M in direction d (out[a][q][c] = M[q][b] in[a][b][c])
+		static void apply_1d(number* out, const number* M, size_t nQ,
+		                     const number* in, size_t nA, size_t nB, size_t nC);
+
+	///	resizes the buffers of the workspace
+		void prepare(Workspace& ws) const;
+
+	///	copies the coefficients to lexicographic ordering
+		void to_lex(const number vCoeff[], Workspace& ws) const;
+
+	protected:
+	///	order
+		size_t m_p;
+
+	///	number of 1d shape functions (p+1)
+		size_t m_n1;
+
+	///	number of 1d integration points
+		size_t m_nq;
+
+	///	number of shape functions
+		size_t m_nsh;
+
+	///	number of integration points
+		size_t m_nip;
+
+	///	integration points
+		const MathVector<dim>* m_vLocIP;
+
+	///	1d shape values and derivatives at 1d points (size: nq x (p+1))
+		std::vector<number> m_vB, m_vD;
+
+	///	transposed 1d matrices (size: (p+1) x nq)
+		std::vector<number> m_vBt, m_vDt;
+
+	///	mapping shape index -> lexicographic index
+		std::vector<size_t> m_vLexIndex;
+
+	///	size of the workspace buffers
+		size_t m_bufSize;
+};
+
+/// provides sum-factorization kernels for Lagrange spaces
+/**
+ * The kernels are stored per (order, integration points) and are only valid
+ * for rules with persistent storage, e.g. those returned by the
+ * QuadratureRuleProvider. If no kernel can be used for the request (e.g.
+ * non-Lagrange space, simplices or points without tensor structure) NULL is
+ * returned and the caller should fall back to the standard evaluation.
+ * The lookup may be called concurrently.
+ */
+template <int TDim>
+class LagrangeSumFactorizationProvider
+{
+	public:
+	///	reference dimension
+		static const int dim = TDim;
+
+	///	returns a kernel or NULL, if not applicable
+		static const LagrangeSumFactorization<TDim>*
+		get(ReferenceObjectID roid, const LFEID& lfeID,
+		    const MathVector<TDim>* vLocIP, size_t numIP);
+
+	protected:
+		typedef std::pair<int, const MathVector<TDim>*> key_type;
+		typedef std::map<key_type, SmartPtr<LagrangeSumFactorization<TDim> > > map_type;
+
+	///	storage of kernels
+		static map_type& kernels() {static map_type s_map; return s_map;}
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__LOCAL_SHAPE_FUNCTION_SET__LAGRANGE__LAGRANGE_SUM_FACT__ */
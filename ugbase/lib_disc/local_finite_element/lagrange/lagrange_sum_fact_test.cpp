@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <cmath>
+#include <vector>
+
+#include "lagrange_sum_fact_test.h"
+#include "lagrange_sum_fact.h"
+#include "lagrange.h"
+#include "common/log.h"
+#include "lib_disc/quadrature/quadrature_provider.h"
+
+namespace ug{
+
+///	tests the kernels for one reference element and order
+template <typename TRefElem>
+static bool TestLagrangeSumFactorization(size_t p, size_t quadOrder)
+{
+	static const int dim = TRefElem::dim;
+	const ReferenceObjectID roid = TRefElem::REFERENCE_OBJECT_ID;
+	const number eps = 1e-10;
+
+	const QuadratureRule<dim>& rQuad =
+			QuadratureRuleProvider<dim>::get(roid, quadOrder);
+	const MathVector<dim>* vLocIP = rQuad.points();
+	const size_t nip = rQuad.size();
+
+	const LagrangeSumFactorization<dim>* pSumFact =
+		LagrangeSumFactorizationProvider<dim>::get(roid, LFEID(LFEID::LAGRANGE, dim, p),
+		                                           vLocIP, nip);
+	if(pSumFact == NULL){
+		UG_LOG("TestLagrangeSumFactorization: no kernel for "<<roid<<", order "
+				<<p<<", quadrature order "<<quadOrder<<".\n");
+		return false;
+	}
+
+	FlexLagrangeLSFS<TRefElem> lsfs(p);
+	const size_t nsh = lsfs.num_sh();
+
+//	some coefficients and ip values
+	std::vector<number> vCoeff(nsh), vIPVal(nip);
+	std::vector<MathVector<dim> > vIPGrad(nip);
+	for(size_t sh = 0; sh < nsh; ++sh) vCoeff[sh] = std::sin(1.0 + sh);
+	for(size_t ip = 0; ip < nip; ++ip){
+		vIPVal[ip] = std::cos(0.5 + ip);
+		for(int d = 0; d < dim; ++d) vIPGrad[ip][d] = std::sin(0.3 * ip + d);
+	}
+
+//	kernel results
+	typename LagrangeSumFactorization<dim>::Workspace ws;
+	std::vector<number> vVal(nip), vRes(nsh, 0.0);
+	std::vector<MathVector<dim> > vGrad(nip);
+	pSumFact->values_and_local_grads(&vVal[0], &vGrad[0], &vCoeff[0], ws);
+	pSumFact->add_tested(&vRes[0], &vIPVal[0], &vIPGrad[0], ws);
+
+//	direct evaluation
+	bool bSuccess = true;
+	std::vector<number> vResDirect(nsh, 0.0);
+	for(size_t ip = 0; ip < nip; ++ip)
+	{
+		number val = 0.0;
+		MathVector<dim> grad(0.0);
+		for(size_t sh = 0; sh < nsh; ++sh)
+		{
+			const number phi = lsfs.shape(sh, vLocIP[ip]);
+			MathVector<dim> g;
+			lsfs.grad(g, sh, vLocIP[ip]);
+
+			val += vCoeff[sh] * phi;
+			VecScaleAppend(grad, vCoeff[sh], g);
+			vResDirect[sh] += vIPVal[ip] * phi + VecDot(vIPGrad[ip], g);
+		}
+
+		if(std::fabs(val - vVal[ip]) > eps){
+			UG_LOG("TestLagrangeSumFactorization: "<<roid<<", order "<<p
+					<<": value at ip "<<ip<<" is "<<vVal[ip]<<", expected "<<val<<".\n");
+			bSuccess = false;
+		}
+		for(int d = 0; d < dim; ++d)
+			if(std::fabs(grad[d] - vGrad[ip][d]) > eps){
+				UG_LOG("TestLagrangeSumFactorization: "<<roid<<", order "<<p
+						<<": local gradient at ip "<<ip<<" is "<<vGrad[ip]
+						<<", expected "<<grad<<".\n");
+				bSuccess = false;
+				break;
+			}
+	}
+
+	for(size_t sh = 0; sh < nsh; ++sh)
+		if(std::fabs(vResDirect[sh] - vRes[sh]) > eps){
+			UG_LOG("TestLagrangeSumFactorization: "<<roid<<", order "<<p
+					<<": tested value for shape "<<sh<<" is "<<vRes[sh]
+					<<", expected "<<vResDirect[sh]<<".\n");
+			bSuccess = false;
+		}
+
+	return bSuccess;
+}
+
+bool TestLagrangeSumFactorization(size_t maxOrder)
+{
+	bool bSuccess = true;
+	for(size_t p = 1; p <= maxOrder; ++p)
+	{
+		bSuccess &= TestLagrangeSumFactorization<ReferenceEdge>(p, 2*p);
+		bSuccess &= TestLagrangeSumFactorization<ReferenceQuadrilateral>(p, 2*p);
+		bSuccess &= TestLagrangeSumFactorization<ReferenceHexahedron>(p, 2*p);
+	}
+
+	UG_LOG("TestLagrangeSumFactorization: "<<(bSuccess ? "passed" : "FAILED")<<".\n");
+	return bSuccess;
+}
+
+} // end namespace ug
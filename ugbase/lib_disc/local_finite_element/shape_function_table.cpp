@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include "shape_function_table.h"
+#include "local_finite_element_provider.h"
+#include "lib_disc/quadrature/quadrature_provider.h"
+
+namespace ug{
+
+////////////////////////////////////////////////////////////////////////////////
+// ShapeFunctionTable
+////////////////////////////////////////////////////////////////////////////////
+
+///	greatest common divisor
+static size_t GCD(size_t a, size_t b)
+{
+	while(b != 0) {const size_t t = a % b; a = b; b = t;}
+	return a;
+}
+
+///	rounds n up to the next multiple of step
+static size_t RoundUp(size_t n, size_t step)
+{
+	return ((n + step - 1) / step) * step;
+}
+
+template <int TDim>
+template <typename T>
+T* ShapeFunctionTable<TDim>::aligned_begin(std::vector<T>& v)
+{
+	for(size_t i = 0; i < v.size(); ++i)
+		if(((size_t)&v[i]) % alignment == 0)
+			return &v[i];
+
+	UG_THROW("ShapeFunctionTable: cannot align storage.");
+}
+
+template <int TDim>
+ShapeFunctionTable<TDim>::
+ShapeFunctionTable(ReferenceObjectID roid, const LFEID& lfeID,
+                   const QuadratureRule<dim>& rQuadRule)
+	: m_roid(roid), m_lfeID(lfeID), m_rQuadRule(rQuadRule),
+	  m_nip(rQuadRule.size()), m_nsh(0),
+	  m_pShape(NULL), m_pGrad(NULL)
+{
+	try{
+	const LocalShapeFunctionSet<dim>& rLSFS
+		= LocalFiniteElementProvider::get<dim>(roid, lfeID);
+
+	m_nsh = rLSFS.num_sh();
+
+//	row lengths, such that every row starts aligned
+	m_ldShape = RoundUp(m_nsh, alignment / GCD(alignment, sizeof(number)));
+	m_ldGrad = RoundUp(m_nsh, alignment / GCD(alignment, sizeof(MathVector<dim>)));
+
+//	allocate memory (oversized to allow alignment)
+	const size_t pad = alignment / sizeof(number);
+	m_vShapeMem.resize(m_nip * m_ldShape + pad, 0.0);
+	m_vGradMem.resize(m_nip * m_ldGrad + pad, MathVector<dim>(0.0));
+	m_pShape = aligned_begin(m_vShapeMem);
+	m_pGrad = aligned_begin(m_vGradMem);
+
+//	evaluate shapes and gradients at all ips
+	for(size_t ip = 0; ip < m_nip; ++ip)
+	{
+		rLSFS.shapes(m_pShape + ip * m_ldShape, rQuadRule.point(ip));
+		rLSFS.grads(m_pGrad + ip * m_ldGrad, rQuadRule.point(ip));
+	}
+
+	}UG_CATCH_THROW("ShapeFunctionTable: cannot evaluate shape functions for "
+					<<lfeID<<" on "<<roid<<".");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// ShapeFunctionTableProvider
+////////////////////////////////////////////////////////////////////////////////
+
+template <int TDim>
+const ShapeFunctionTable<TDim>&
+ShapeFunctionTableProvider<TDim>::
+get(ReferenceObjectID roid, const LFEID& lfeID,
+    const QuadratureRule<TDim>& rQuadRule)
+{
+	map_type& map = tables();
+	const Key key(roid, lfeID, &rQuadRule);
+
+	typename map_type::iterator iter = map.find(key);
+	if(iter != map.end()) return *(iter->second);
+
+	SmartPtr<ShapeFunctionTable<TDim> > sp
+		= make_sp(new ShapeFunctionTable<TDim>(roid, lfeID, rQuadRule));
+	map[key] = sp;
+	return *sp;
+}
+
+template <int TDim>
+const ShapeFunctionTable<TDim>&
+ShapeFunctionTableProvider<TDim>::
+get(ReferenceObjectID roid, const LFEID& lfeID, size_t quadOrder)
+{
+	return get(roid, lfeID, QuadratureRuleProvider<TDim>::get(roid, quadOrder));
+}
+
+template class ShapeFunctionTable<1>;
+template class ShapeFunctionTable<2>;
+template class ShapeFunctionTable<3>;
+
+template class ShapeFunctionTableProvider<1>;
+template class ShapeFunctionTableProvider<2>;
+template class ShapeFunctionTableProvider<3>;
+
+} // end namespace ug
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__SHAPE_FUNCTION_TABLE__
+#define __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__SHAPE_FUNCTION_TABLE__
+
+#include <vector>
+#include <map>
+
+#include "common/math/ugmath.h"
+#include "common/util/smart_pointer.h"
+#include "lib_disc/local_finite_element/local_finite_element_id.h"
+#include "lib_disc/quadrature/quadrature.h"
+#include "lib_grid/grid/grid_base_objects.h"
+
+namespace ug{
+
+/// \ingroup lib_disc_local_finite_elements
+/// @{
+
+/// immutable table of shape values and local gradients at quadrature points
+/**
+ * For a reference element, a local finite element and a quadrature rule the
+ * shape functions and their local gradients evaluated at the integration
+ * points do not depend on the actual element. This class stores those values
+ * once in contiguous arrays, where the row of each integration point starts
+ * at a 64 byte boundary. Thus, loops over the shape functions of one
+ * integration point run over aligned, contiguous memory and can be vectorized.
+ *
+ * The tables are shared by all geometries and are accessed through the
+ * ShapeFunctionTableProvider.
+ *
+ * \tparam	TDim	reference element dimension
+ */
+template <int TDim>
+class ShapeFunctionTable
+{
+	public:
+	///	reference dimension
+		static const int dim = TDim;
+
+	///	alignment of rows in bytes
+		static const size_t alignment = 64;
+
+	public:
+	///	constructor, evaluating the shape functions at the rule's points
+		ShapeFunctionTable(ReferenceObjectID roid, const LFEID& lfeID,
+		                   const QuadratureRule<dim>& rQuadRule);
+
+	///	reference object id
+		ReferenceObjectID roid() const {return m_roid;}
+
+	///	local finite element id
+		const LFEID& lfe_id() const {return m_lfeID;}
+
+	///	quadrature rule
+		const QuadratureRule<dim>& quad_rule() const {return m_rQuadRule;}
+
+	///	number of integration points
+		size_t num_ip() const {return m_nip;}
+
+	///	number of shape functions
+		size_t num_sh() const {return m_nsh;}
+
+	///	local integration points
+		const MathVector<dim>* local_ips() const {return m_rQuadRule.points();}
+
+	///	quadrature weights
+		const number* weights() const {return m_rQuadRule.weights();}
+
+	///	shape function at ip
+		number shape(size_t ip, size_t sh) const
+		{
+			UG_ASSERT(ip < m_nip, "Wrong index"); UG_ASSERT(sh < m_nsh, "Wrong index");
+			return m_pShape[ip * m_ldShape + sh];
+		}
+
+	///	shape functions at ip (size: num_sh)
+		const number* shapes(size_t ip) const
+		{
+			UG_ASSERT(ip < m_nip, "Wrong index");
+			return m_pShape + ip * m_ldShape;
+		}
+
+	///	local gradient at ip
+		const MathVector<dim>& local_grad(size_t ip, size_t sh) const
+		{
+			UG_ASSERT(ip < m_nip, "Wrong index"); UG_ASSERT(sh < m_nsh, "Wrong index");
+			return m_pGrad[ip * m_ldGrad + sh];
+		}
+
+	///	local gradients at ip (size: num_sh)
+		const MathVector<dim>* local_grads(size_t ip) const
+		{
+			UG_ASSERT(ip < m_nip, "Wrong index");
+			return m_pGrad + ip * m_ldGrad;
+		}
+
+	protected:
+	///	returns aligned begin of a vector that has been oversized by alignment
+		template <typename T>
+		static T* aligned_begin(std::vector<T>& v);
+
+	protected:
+		ReferenceObjectID m_roid;
+		LFEID m_lfeID;
+		const QuadratureRule<dim>& m_rQuadRule;
+
+		size_t m_nip;
+		size_t m_nsh;
+
+	///	leading dimension (row length incl. padding)
+		size_t m_ldShape, m_ldGrad;
+
+	///	storage and aligned begin of the shape values (size: nip x ldShape)
+		std::vector<number> m_vShapeMem;
+		number* m_pShape;
+
+	///	storage and aligned begin of the local gradients (size: nip x ldGrad)
+		std::vector<MathVector<dim> > m_vGradMem;
+		MathVector<dim>* m_pGrad;
+
+	private:
+	//	disallow copy, since pointers point into own storage
+		ShapeFunctionTable(const ShapeFunctionTable&);
+		ShapeFunctionTable& operator=(const ShapeFunctionTable&);
+};
+
+/// provides the shape function tables
+/**
+ * The tables are created on first request and kept for the lifetime of the
+ * program. Since quadrature rules are provided as singletons by the
+ * QuadratureRuleProvider, the rule can be used as a key.
+ */
+template <int TDim>
+class ShapeFunctionTableProvider
+{
+	public:
+	///	reference dimension
+		static const int dim = TDim;
+
+	///	returns the table for reference element, finite element and rule
+		static const ShapeFunctionTable<TDim>&
+		get(ReferenceObjectID roid, const LFEID& lfeID,
+		    const QuadratureRule<TDim>& rQuadRule);
+
+	///	returns the table using the rule of the QuadratureRuleProvider
+		static const ShapeFunctionTable<TDim>&
+		get(ReferenceObjectID roid, const LFEID& lfeID, size_t quadOrder);
+
+	protected:
+		struct Key{
+			Key(ReferenceObjectID roid_, const LFEID& lfeID_,
+			    const QuadratureRule<TDim>* pRule_)
+				: roid(roid_), lfeID(lfeID_), pRule(pRule_) {}
+
+			bool operator<(const Key& k) const
+			{
+				if(roid != k.roid) return roid < k.roid;
+				if(pRule != k.pRule) return pRule < k.pRule;
+				return lfeID < k.lfeID;
+			}
+
+			ReferenceObjectID roid;
+			LFEID lfeID;
+			const QuadratureRule<TDim>* pRule;
+		};
+
+		typedef std::map<Key, SmartPtr<ShapeFunctionTable<TDim> > > map_type;
+
+	///	storage of tables
+		static map_type& tables() {static map_type s_map; return s_map;}
+};
+
+/// @}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__LOCAL_FINITE_ELEMENT__SHAPE_FUNCTION_TABLE__ */
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <fstream>
+#include <sstream>
+#include "mg_cycle_profile.h"
+#include "common/common.h"
+#include "common/util/table.h"
+#include "common/util/stringify.h"
+
+#ifdef UG_PARALLEL
+#include "pcl/pcl.h"
+#endif
+
+namespace ug{
+
+MGCycleProfile::MGCycleProfile() :
+	m_numCycles(0), m_bEnabled(true)
+{}
+
+void MGCycleProfile::clear()
+{
+	m_vvEntry.clear();
+	m_numCycles = 0;
+}
+
+void MGCycleProfile::level_required(int lvl)
+{
+	if((int)m_vvEntry.size() <= lvl)
+		m_vvEntry.resize(lvl + 1, std::vector<Entry>(NUM_PHASES));
+}
+
+void MGCycleProfile::add(int lvl, Phase phase, double seconds,
+                         number bytes, number flops)
+{
+	if(!m_bEnabled || lvl < 0) return;
+	UG_ASSERT(phase < NUM_PHASES, "Invalid phase: "<<phase);
+
+	level_required(lvl);
+	Entry& e = m_vvEntry[lvl][phase];
+	++e.calls;
+	e.time += seconds;
+	e.bytes += bytes;
+	e.flops += flops;
+}
+
+const MGCycleProfile::Entry& MGCycleProfile::entry(int lvl, Phase phase) const
+{
+	static const Entry s_empty;
+	if(lvl < 0 || lvl >= (int)m_vvEntry.size() || phase < 0 || phase >= NUM_PHASES)
+		return s_empty;
+	return m_vvEntry[lvl][phase];
+}
+
+double MGCycleProfile::level_time(int lvl) const
+{
+	double t = 0.0;
+	for(int p = 0; p < NUM_PHASES; ++p)
+		t += entry(lvl, (Phase)p).time;
+	return t;
+}
+
+double MGCycleProfile::total_time() const
+{
+	double t = 0.0;
+	for(size_t lvl = 0; lvl < m_vvEntry.size(); ++lvl)
+		t += level_time(lvl);
+	return t;
+}
+
+const char* MGCycleProfile::phase_name(Phase phase)
+{
+	const char* names[] = {	"pre_smooth",
+							"post_smooth",
+							"residual",
+							"restriction",
+							"prolongation",
+							"base_solve",
+							"comm_pack",
+							"comm_wait",
+							"invalid"};
+	if(phase < 0 || phase > NUM_PHASES) phase = NUM_PHASES;
+	return names[phase];
+}
+
+void MGCycleProfile::global_entries(std::vector<std::vector<Entry> >& vvEntry) const
+{
+	vvEntry = m_vvEntry;
+
+#ifdef UG_PARALLEL
+	if(pcl::NumProcs() == 1) return;
+
+	pcl::ProcessCommunicator com;
+	const size_t numLev = com.allreduce(m_vvEntry.size(), PCL_RO_MAX);
+	vvEntry.resize(numLev, std::vector<Entry>(NUM_PHASES));
+
+	const size_t n = numLev * NUM_PHASES;
+	std::vector<double> vTime(n), vCost(3 * n);
+	for(size_t lvl = 0; lvl < numLev; ++lvl){
+		for(int p = 0; p < NUM_PHASES; ++p){
+			const Entry& e = vvEntry[lvl][p];
+			const size_t i = lvl * NUM_PHASES + p;
+			vTime[i] = e.time;
+			vCost[3*i + 0] = (double)e.calls;
+			vCost[3*i + 1] = e.bytes;
+			vCost[3*i + 2] = e.flops;
+		}
+	}
+
+	std::vector<double> vTimeMax, vCostSum;
+	com.allreduce(vTime, vTimeMax, PCL_RO_MAX);
+	com.allreduce(vCost, vCostSum, PCL_RO_SUM);
+
+	for(size_t lvl = 0; lvl < numLev; ++lvl){
+		for(int p = 0; p < NUM_PHASES; ++p){
+			Entry& e = vvEntry[lvl][p];
+			const size_t i = lvl * NUM_PHASES + p;
+			e.time = vTimeMax[i];
+			e.calls = (size_t)vCostSum[3*i + 0];
+			e.bytes = vCostSum[3*i + 1];
+			e.flops = vCostSum[3*i + 2];
+		}
+	}
+#endif
+}
+
+void MGCycleProfile::print() const
+{
+	std::vector<std::vector<Entry> > vvEntry;
+	global_entries(vvEntry);
+
+	StringTable t;
+	t(0, 0) = "lvl";
+	for(int p = 0; p < NUM_PHASES; ++p)
+		t(0, p+1) = phase_name((Phase)p);
+	t(0, NUM_PHASES+1) = "total";
+	t(0, NUM_PHASES+2) = "GFlop/s";
+
+	for(size_t lvl = 0; lvl < vvEntry.size(); ++lvl){
+		const int r = vvEntry.size() - lvl;
+		double time = 0.0, flops = 0.0;
+		t(r, 0) = mkstr(lvl);
+		for(int p = 0; p < NUM_PHASES; ++p){
+			const Entry& e = vvEntry[lvl][p];
+			t(r, p+1) = mkstr(e.time);
+			time += e.time; flops += e.flops;
+		}
+		t(r, NUM_PHASES+1) = mkstr(time);
+		t(r, NUM_PHASES+2) = mkstr(((time > 0) ? flops / time * 1e-9 : 0.0));
+	}
+
+	UG_LOG("MGCycleProfile: times in seconds for " << m_numCycles << " cycles:\n");
+	UG_LOG(t << std::endl);
+}
+
+void MGCycleProfile::write_csv(std::ostream& out) const
+{
+	std::vector<std::vector<Entry> > vvEntry;
+	global_entries(vvEntry);
+
+	out << "level,phase,calls,time,bytes,flops\n";
+	for(size_t lvl = 0; lvl < vvEntry.size(); ++lvl){
+		for(int p = 0; p < NUM_PHASES; ++p){
+			const Entry& e = vvEntry[lvl][p];
+			out << lvl << "," << phase_name((Phase)p) << "," << e.calls << ","
+				<< e.time << "," << e.bytes << "," << e.flops << "\n";
+		}
+	}
+}
+
+void MGCycleProfile::write_json(std::ostream& out) const
+{
+	std::vector<std::vector<Entry> > vvEntry;
+	global_entries(vvEntry);
+
+	out << "{\n  \"num_cycles\": " << m_numCycles << ",\n  \"levels\": [";
+	for(size_t lvl = 0; lvl < vvEntry.size(); ++lvl){
+		if(lvl > 0) out << ",";
+		out << "\n    {\"level\": " << lvl << ", \"phases\": {";
+		for(int p = 0; p < NUM_PHASES; ++p){
+			const Entry& e = vvEntry[lvl][p];
+			if(p > 0) out << ",";
+			out << "\n      \"" << phase_name((Phase)p) << "\": {"
+				<< "\"calls\": " << e.calls << ", \"time\": " << e.time
+				<< ", \"bytes\": " << e.bytes << ", \"flops\": " << e.flops << "}";
+		}
+		out << "\n    }}";
+	}
+	out << "\n  ]\n}\n";
+}
+
+void MGCycleProfile::save_csv(const char* filename) const
+{
+	std::stringstream ss;
+	write_csv(ss);
+
+	#ifdef UG_PARALLEL
+	if(pcl::ProcRank() != 0) return;
+	#endif
+
+	std::ofstream out(filename);
+	UG_COND_THROW(!out, "MGCycleProfile: Couldn't open '" << filename << "' for writing.");
+	out << ss.str();
+}
+
+void MGCycleProfile::save_json(const char* filename) const
+{
+	std::stringstream ss;
+	write_json(ss);
+
+	#ifdef UG_PARALLEL
+	if(pcl::ProcRank() != 0) return;
+	#endif
+
+	std::ofstream out(filename);
+	UG_COND_THROW(!out, "MGCycleProfile: Couldn't open '" << filename << "' for writing.");
+	out << ss.str();
+}
+
+} // end namespace ug
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__MULTI_GRID_SOLVER__MG_CYCLE_PROFILE__
+#define __H__UG__LIB_DISC__MULTI_GRID_SOLVER__MG_CYCLE_PROFILE__
+
+#include <string>
+#include <vector>
+#include <ostream>
+
+#include "common/types.h"
+#include "common/stopwatch.h"
+
+namespace ug{
+
+/// Records per-level costs of the parts of a multigrid cycle
+/**
+ * AssembledMultiGridCycle reports to this class the wall-clock time spent in
+ * each phase of the cycle (smoothing, residual updates, restriction,
+ * prolongation, base solve and communication) together with estimates for
+ * the number of bytes moved and floating point operations performed. The
+ * values are accumulated per level over all cycles until clear() is called.
+ *
+ * The byte and flop counts are estimates derived from the sizes of the level
+ * vectors and the number of nonzeros of the level matrices (one matrix sweep
+ * per smoothing step, one sparse matrix-vector product per residual update,
+ * one multiply-add per fine level index for the transfer operators). For the
+ * base solver only the time is recorded. Communication bytes are the number
+ * of interface entries times the size of a vector entry.
+ *
+ * In parallel, the reports of print, write_csv and write_json are reduced
+ * over all processes (maximum for times, sum for bytes and flops) and are
+ * therefore collective operations.
+ */
+class MGCycleProfile
+{
+	public:
+	///	parts of the cycle
+		enum Phase {
+			PRE_SMOOTH,
+			POST_SMOOTH,
+			RESIDUAL,
+			RESTRICTION,
+			PROLONGATION,
+			BASE_SOLVE,
+			COMM_PACK,
+			COMM_WAIT,
+			NUM_PHASES					// always last!
+		};
+
+	///	accumulated data of one phase on one level
+		struct Entry
+		{
+			Entry() : calls(0), time(0.0), bytes(0.0), flops(0.0) {}
+			size_t calls;	///< number of calls
+			double time;	///< wall-clock time in seconds
+			number bytes;	///< estimated bytes moved
+			number flops;	///< estimated floating point operations
+		};
+
+	public:
+	///	constructor
+		MGCycleProfile();
+
+	///	enables/disables recording (enabled by default)
+		void set_enabled(bool bEnable) {m_bEnabled = bEnable;}
+
+	///	returns if recording is enabled
+		bool enabled() const {return m_bEnabled;}
+
+	///	removes all recorded data
+		void clear();
+
+	///	adds a measurement for a phase on a level
+		void add(int lvl, Phase phase, double seconds,
+		         number bytes = 0.0, number flops = 0.0);
+
+	///	marks the end of a multigrid cycle
+		void cycle_finished() {if(m_bEnabled) ++m_numCycles;}
+
+	///	number of recorded cycles
+		size_t num_cycles() const {return m_numCycles;}
+
+	///	number of levels with recorded data
+		size_t num_levels() const {return m_vvEntry.size();}
+
+	///	returns the data of a phase on a level
+		const Entry& entry(int lvl, Phase phase) const;
+
+	///	time spent in a phase on a level (in seconds)
+		double time(int lvl, int phase) const {return entry(lvl, (Phase)phase).time;}
+
+	///	estimated bytes moved in a phase on a level
+		number bytes(int lvl, int phase) const {return entry(lvl, (Phase)phase).bytes;}
+
+	///	estimated flops performed in a phase on a level
+		number flops(int lvl, int phase) const {return entry(lvl, (Phase)phase).flops;}
+
+	///	number of calls of a phase on a level
+		size_t calls(int lvl, int phase) const {return entry(lvl, (Phase)phase).calls;}
+
+	///	total time of a level (in seconds)
+		double level_time(int lvl) const;
+
+	///	total time of all levels (in seconds)
+		double total_time() const;
+
+	///	returns the name of a phase
+		static const char* phase_name(Phase phase);
+
+	///	prints a table of times per level and phase
+		void print() const;
+
+	///	writes the data in csv format (one line per level and phase)
+		void write_csv(std::ostream& out) const;
+
+	///	writes the data in json format
+		void write_json(std::ostream& out) const;
+
+	///	writes the data in csv format to a file
+		void save_csv(const char* filename) const;
+
+	///	writes the data in json format to a file
+		void save_json(const char* filename) const;
+
+	protected:
+	///	returns the data reduced over all processes
+		void global_entries(std::vector<std::vector<Entry> >& vvEntry) const;
+
+	///	ensures that storage for the level exists
+		void level_required(int lvl);
+
+	protected:
+	///	data per level and phase
+		std::vector<std::vector<Entry> > m_vvEntry;
+
+	///	number of cycles
+		size_t m_numCycles;
+
+	///	flag if recording is enabled
+		bool m_bEnabled;
+};
+
+/// Measures the time of a scope and adds it to a MGCycleProfile
+/**
+ * If no profile is passed (NULL) or the profile is disabled, nothing is
+ * recorded. Bytes and flops can be passed on construction or increased
+ * while the timer is running. The measurement can be paused in order to
+ * exclude parts of a scope.
+ */
+class MGPhaseTimer
+{
+	public:
+		MGPhaseTimer(MGCycleProfile* pProfile, int lvl, MGCycleProfile::Phase phase,
+		             number bytes = 0.0, number flops = 0.0)
+			: m_pProfile((pProfile && pProfile->enabled()) ? pProfile : NULL),
+			  m_lvl(lvl), m_phase(phase), m_bytes(bytes), m_flops(flops),
+			  m_elapsed(0.0), m_start(m_pProfile ? get_clock_s() : 0.0),
+			  m_bRunning(true)
+		{}
+
+		~MGPhaseTimer() {stop();}
+
+	///	adds to the estimated costs
+		void add_costs(number bytes, number flops) {m_bytes += bytes; m_flops += flops;}
+
+	///	interrupts the time measurement
+		void pause()
+		{
+			if(!m_pProfile || !m_bRunning) return;
+			m_elapsed += get_clock_s() - m_start;
+			m_bRunning = false;
+		}
+
+	///	continues an interrupted time measurement
+		void resume()
+		{
+			if(!m_pProfile || m_bRunning) return;
+			m_start = get_clock_s();
+			m_bRunning = true;
+		}
+
+	///	stops the timer and records the data (called by destructor)
+		void stop()
+		{
+			if(!m_pProfile) return;
+			pause();
+			m_pProfile->add(m_lvl, m_phase, m_elapsed, m_bytes, m_flops);
+			m_pProfile = NULL;
+		}
+
+	protected:
+		MGCycleProfile* m_pProfile;
+		int m_lvl;
+		MGCycleProfile::Phase m_phase;
+		number m_bytes, m_flops;
+		double m_elapsed, m_start;
+		bool m_bRunning;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__MULTI_GRID_SOLVER__MG_CYCLE_PROFILE__ */
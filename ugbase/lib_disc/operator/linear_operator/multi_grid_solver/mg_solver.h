@@ -35,6 +35,7 @@
 
 // extern includes
 #include <vector>
+#include <map>
 #include <iostream>
 
 // other ug4 modules
@@ -58,6 +59,7 @@
 #include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
 
 #include "mg_stats.h"
+#include "mg_cycle_profile.h"
 
 namespace ug{
 
@@ -119,6 +121,16 @@ class AssembledMultiGridCycle :
 		void set_mg_stats(SmartPtr<mg_stats_type> mgstats)
 			{m_mgstats = mgstats;}
 
+	///	sets a profile recording time, bytes and flops per level and phase
+	/**	Setting a MGCycleProfile is optional. The overhead is a few clock
+	 * readings per level and cycle.
+	 * \sa MGCycleProfile*/
+		void set_cycle_profile(SmartPtr<MGCycleProfile> spProfile)
+			{m_spCycleProfile = spProfile;}
+
+	///	returns the cycle profile (may be invalid)
+		SmartPtr<MGCycleProfile> cycle_profile() {return m_spCycleProfile;}
+
 	/// sets the approximation space
 		void set_approximation_space(SmartPtr<ApproximationSpace<TDomain> > approxSpace);
 
@@ -139,6 +151,39 @@ class AssembledMultiGridCycle :
 	///	sets if the base solver is applied in parallel
 		void set_gathered_base_solver_if_ambiguous(bool bGathered) {m_bGatheredBaseIfAmbiguous = bGathered;}
 
+	///	sets the number of processes whose base level is agglomerated onto one process
+	/**
+	 * If the base level is solved in parallel (i.e. not gathered over vertical
+	 * interfaces), the base level matrix and vectors can be agglomerated onto
+	 * a subset of the processes: the processes of the base level are grouped
+	 * into consecutive groups of numProcsPerProc processes, each group is
+	 * collected onto its first process and the base solver is applied on the
+	 * sub-communicator of these processes only. All other processes wait
+	 * for the broadcasted correction. Together with set_base_level this allows
+	 * to solve the coarse levels on fewer processes, where communication
+	 * latency would otherwise dominate. A value of 1 disables agglomeration.
+	 */
+		void set_base_agglomeration(size_t numProcsPerProc) {m_numBaseAggloProcsPerProc = numProcsPerProc;}
+
+	///	sets the number of processes whose level is agglomerated onto one process
+	/**
+	 * Telescoping of the coarse levels above the base level: on level lev the
+	 * processes are grouped into consecutive groups of numProcsPerProc
+	 * processes and the level matrix of each group is collected onto its
+	 * first process. In every cycle, the defect of the level is gathered on
+	 * these processes, all smoothing steps of the level are performed on
+	 * their sub-communicator and the resulting correction is broadcasted
+	 * back, while all other processes wait. Restriction and prolongation
+	 * remain on the original distribution, since they are grid based.
+	 * Usually the groups grow towards the base level, so that the coarse
+	 * levels shrink onto fewer and fewer processes. The level must be
+	 * fully refined and distributed horizontally only, and the smoother must
+	 * not depend on the grid (e.g. Jacobi, ILU, GaussSeidel). The base level
+	 * itself is agglomerated by set_base_agglomeration. A value of 1
+	 * disables agglomeration on the level.
+	 */
+		void set_level_agglomeration(int lev, size_t numProcsPerProc) {m_mLevAggloProcsPerProc[lev] = numProcsPerProc;}
+
 	///	sets if copies should be used to emulate a full-refined grid
 		void set_emulate_full_refined_grid(bool bEmulate){
 			if(bEmulate) m_GridLevelType = GridLevel::SURFACE;
@@ -272,6 +317,9 @@ class AssembledMultiGridCycle :
 	///	performs prolongation to the level above
 		void prolongation_and_postsmooth(int lev);
 
+	///	performs the smoothing steps of an agglomerated level on the agglomeration roots
+		void agglomerated_smooth(int lev, bool bPreSmooth);
+
 	///	compute base solver
 		void base_solve(int lev);
 	//	end of section
@@ -286,6 +334,9 @@ class AssembledMultiGridCycle :
 	///	initializes the smoother and base solver
 		void init_smoother();
 
+	///	collects the level matrices of agglomerated levels and initializes their smoothers
+		void init_agglomerated_smoother(int lev);
+
 	///	initializes the coarse grid matrices
 		void assemble_level_operator();
 		void init_rap_operator();
@@ -408,6 +459,8 @@ class AssembledMultiGridCycle :
 
 		struct LevData
 		{
+			LevData() : numAggloProcsPerProc(1), bAggloRoot(false) {}
+
 		///	Level matrix operator
 			SmartPtr<MatrixOperator<matrix_type, vector_type> > A;
 
@@ -442,6 +495,27 @@ class AssembledMultiGridCycle :
 
 		///	missing coarse grid correction
 			matrix_type RimCpl_Coarse_Fine;
+
+		///	number of processes agglomerated onto one process for smoothing
+			size_t numAggloProcsPerProc;
+
+		///	flag if this process is an agglomeration root of the level
+			bool bAggloRoot;
+
+		///	agglomerated level matrix (only on agglomeration roots)
+			SmartPtr<MatrixOperator<matrix_type, vector_type> > AggloA;
+
+		///	smoother for the agglomerated level matrix (only on agglomeration roots)
+			SmartPtr<ILinearIterator<vector_type> > AggloPreSmoother;
+			SmartPtr<ILinearIterator<vector_type> > AggloPostSmoother;
+
+		///	agglomerated vectors (only on agglomeration roots)
+			SmartPtr<vector_type> aggloC, aggloD, aggloT;
+
+#ifdef UG_PARALLEL
+		///	agglomeration layouts (master on roots, slave on all other processes)
+			IndexLayout aggloMaster, aggloSlave;
+#endif
 		};
 
 	///	storage for all level
@@ -465,6 +539,29 @@ class AssembledMultiGridCycle :
 	///	returns if gathered base master
 		bool gathered_base_master() const;
 
+	///	number of processes agglomerated onto one process for the base solver
+		size_t m_numBaseAggloProcsPerProc;
+
+	///	number of processes agglomerated onto one process per level
+		std::map<int, size_t> m_mLevAggloProcsPerProc;
+
+	///	flag if the base level is agglomerated onto a subset of processes
+		bool m_bAggloBaseUsed;
+
+	///	flag if this process is an agglomeration root
+		bool m_bAggloBaseRoot;
+
+	///	Matrix for agglomerated base solver (only on agglomeration roots)
+		SmartPtr<MatrixOperator<matrix_type, vector_type> > m_spAggloBaseMat;
+
+	///	vectors for agglomerated base solver (only on agglomeration roots)
+		SmartPtr<vector_type> m_spAggloBaseCorr, m_spAggloBaseDef;
+
+#ifdef UG_PARALLEL
+	///	agglomeration layouts (master on roots, slave on all other processes)
+		IndexLayout m_aggloBaseMaster, m_aggloBaseSlave;
+#endif
+
 	///	current surface correction
 		GF* m_pC;
 
@@ -543,6 +640,17 @@ class AssembledMultiGridCycle :
 	///	Calls MGStats::set_defect (if available) with the given parameters
 		void mg_stats_defect(GF& gf, int lvl, typename mg_stats_type::Stage stage);
 
+	///	estimated bytes and flops of one matrix-vector product on a level
+		void level_matvec_costs(int lev, number& bytes, number& flops) const;
+
+	///	bytes of a vector on a level
+		number level_vector_bytes(int lev) const;
+
+#ifdef UG_PARALLEL
+	///	bytes of a vector restricted to the entries of a layout
+		number layout_bytes(const IndexLayout& layout) const;
+#endif
+
 	///	Debug Writer
 		SmartPtr<GridFunctionDebugWriter<TDomain, TAlgebra> > m_spDebugWriter;
 
@@ -551,6 +659,9 @@ class AssembledMultiGridCycle :
 
 	///	MGStats are used for debugging to record statistics on individual iterations
 		SmartPtr<mg_stats_type>	m_mgstats;
+
+	///	optional profile of the cycle per level
+		SmartPtr<MGCycleProfile> m_spCycleProfile;
 };
 
 ////////////////////////////////////////////////////////////////////////////////
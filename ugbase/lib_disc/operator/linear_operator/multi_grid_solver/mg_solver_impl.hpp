@@ -46,6 +46,7 @@
 
 #ifdef UG_PARALLEL
 	#include "lib_algebra/parallelization/parallelization.h"
+	#include "lib_algebra/parallelization/collect_matrix.h"
 	#include "pcl/pcl_util.h"
 //	the debug barrier is used to eliminate synchronization overhead from
 //	profiling stats. Only used for parallel builds.
@@ -91,6 +92,8 @@ AssembledMultiGridCycle() :
 	m_spBaseSolver(new LU<TAlgebra>()),
 	m_bGatheredBaseIfAmbiguous(true),
 	m_ignoreInitForBaseSolver(false),
+	m_numBaseAggloProcsPerProc(1),
+	m_bAggloBaseUsed(false), m_bAggloBaseRoot(false),
 	m_spDebugWriter(NULL), m_dbgIterCnt(0)
 {};
 
@@ -113,6 +116,8 @@ AssembledMultiGridCycle(SmartPtr<ApproximationSpace<TDomain> > approxSpace) :
 	m_spBaseSolver(new LU<TAlgebra>()),
 	m_bGatheredBaseIfAmbiguous(true),
 	m_ignoreInitForBaseSolver(false),
+	m_numBaseAggloProcsPerProc(1),
+	m_bAggloBaseUsed(false), m_bAggloBaseRoot(false),
 	m_spDebugWriter(NULL), m_dbgIterCnt(0)
 {};
 
@@ -134,6 +139,10 @@ clone()
 
 	clone->set_base_level(m_baseLev);
 	clone->set_base_solver(m_spBaseSolver);
+	clone->set_base_agglomeration(m_numBaseAggloProcsPerProc);
+	for(std::map<int, size_t>::const_iterator it = m_mLevAggloProcsPerProc.begin();
+		it != m_mLevAggloProcsPerProc.end(); ++it)
+		clone->set_level_agglomeration(it->first, it->second);
 	clone->set_cycle_type(m_cycleType);
 	clone->set_debug(m_spDebugWriter);
 	clone->set_discretization(m_spAss);
@@ -145,6 +154,7 @@ clone()
 	clone->set_presmoother(m_spPreSmootherPrototype);
 	clone->set_postsmoother(m_spPostSmootherPrototype);
 	clone->set_surface_level(m_surfaceLev);
+	clone->set_cycle_profile(m_spCycleProfile);
 
 	for(size_t i = 0; i < m_vspProlongationPostProcess.size(); ++i)
 		clone->add_prolongation_post_process(m_vspProlongationPostProcess[i]);
@@ -224,6 +234,7 @@ apply(vector_type& rC, const vector_type& rD)
 	//	start mg-cycle
 		GMG_PROFILE_BEGIN(GMG_Apply_lmgc);
 		lmgc(m_topLev, m_cycleType);
+		if(m_spCycleProfile.valid()) m_spCycleProfile->cycle_finished();
 		GMG_PROFILE_END();
 
 	//	project top lev to surface
@@ -1110,6 +1121,15 @@ init_smoother()
 	{
 		LevData& ld = *m_vLevData[lev];
 
+	//	agglomerated levels are smoothed on the agglomeration roots only
+		if(ld.numAggloProcsPerProc > 1){
+			try{
+				init_agglomerated_smoother(lev);
+			}
+			UG_CATCH_THROW("GMG::init: Cannot agglomerate level "<<lev);
+			continue;
+		}
+
 		UG_DLOG(LIB_DISC_MULTIGRID, 4, "  init_smoother: initializing pre-smoother on lev "<<lev<<"\n");
 		bool success;
 		try {success = ld.PreSmoother->init(ld.A, *ld.sc);}
@@ -1130,6 +1150,82 @@ init_smoother()
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop init_smoother\n");
 }
 
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+init_agglomerated_smoother(int lev)
+{
+	GMG_PROFILE_FUNC();
+	UG_DLOG(LIB_DISC_MULTIGRID, 4, "  init_smoother: agglomerating level "<<lev<<"\n");
+
+	LevData& ld = *m_vLevData[lev];
+	ld.bAggloRoot = false;
+	ld.AggloA = SPNULL;
+	ld.AggloPreSmoother = SPNULL;
+	ld.AggloPostSmoother = SPNULL;
+	ld.aggloC = SPNULL;
+	ld.aggloD = SPNULL;
+	ld.aggloT = SPNULL;
+
+#ifdef UG_PARALLEL
+//	processes without indices on the level do not participate
+	const pcl::ProcessCommunicator& pc = ld.A->layouts()->proc_comm();
+	if(pc.empty()) return;
+
+//	the smoothing on the level must not depend on other levels or on a
+//	vertical distribution (checked on all processes to avoid a deadlock)
+	const bool bAgglomerable = ld.vShadowing.empty()
+							&& lev <= m_LocalFullRefLevel
+							&& ld.t->layouts()->vertical_master().empty()
+							&& ld.t->layouts()->vertical_slave().empty();
+	if(!pcl::AllProcsTrue(bAgglomerable, pc))
+		UG_THROW("GMG: Agglomeration of level "<<lev<<" requires a fully "
+				"refined level without vertical interfaces.");
+
+//	collect the level matrix on the group roots
+	ld.AggloA = SmartPtr<MatrixOperator<matrix_type, vector_type> >(
+						new MatrixOperator<matrix_type, vector_type>);
+	ld.bAggloRoot = CollectMatrixOnProcGroups(*ld.A, *ld.AggloA,
+	                                          ld.aggloMaster, ld.aggloSlave,
+	                                          ld.numAggloProcsPerProc);
+
+//  only init on agglomeration roots
+	if(!ld.bAggloRoot){
+		ld.AggloA = SPNULL;
+		return;
+	}
+
+	ConstSmartPtr<AlgebraLayouts> spLayouts = ld.AggloA->layouts();
+	const size_t numAggloIndex = ld.AggloA->num_rows();
+	ld.aggloC = make_sp(new vector_type(numAggloIndex));
+	ld.aggloC->set_layouts(spLayouts);
+	ld.aggloD = make_sp(new vector_type(numAggloIndex));
+	ld.aggloD->set_layouts(spLayouts);
+	ld.aggloT = make_sp(new vector_type(numAggloIndex));
+	ld.aggloT->set_layouts(spLayouts);
+	ld.aggloC->set(0.0);
+
+	ld.AggloPreSmoother = m_spPreSmootherPrototype->clone();
+	if(m_spPreSmootherPrototype == m_spPostSmootherPrototype)
+		ld.AggloPostSmoother = ld.AggloPreSmoother;
+	else
+		ld.AggloPostSmoother = m_spPostSmootherPrototype->clone();
+
+	bool success;
+	try {success = ld.AggloPreSmoother->init(ld.AggloA, *ld.aggloC);}
+	UG_CATCH_THROW("GMG::init: Cannot init agglomerated pre-smoother for level "<<lev);
+	if (!success)
+		UG_THROW("GMG::init: Cannot init agglomerated pre-smoother for level "<<lev);
+
+	if(ld.AggloPreSmoother != ld.AggloPostSmoother)
+	{
+		try {success = ld.AggloPostSmoother->init(ld.AggloA, *ld.aggloC);}
+		UG_CATCH_THROW("GMG::init: Cannot init agglomerated post-smoother for level "<<lev);
+		if (!success)
+			UG_THROW("GMG::init: Cannot init agglomerated post-smoother for level "<<lev);
+	}
+#endif
+}
+
 template <typename TDomain, typename TAlgebra>
 void AssembledMultiGridCycle<TDomain, TAlgebra>::
 init_base_solver()
@@ -1165,6 +1261,55 @@ init_base_solver()
 		if(!m_spBaseSolver->init(spGatheredBaseMat, *ld.t))
 			UG_THROW("GMG::init: Cannot init base solver on baselevel "<< m_baseLev);
 	}
+#ifdef UG_PARALLEL
+//	check, if the base level is agglomerated onto a subset of the processes
+	else if(m_bAggloBaseUsed)
+	{
+		m_bAggloBaseRoot = false;
+		m_spAggloBaseMat = SPNULL;
+		m_spAggloBaseCorr = SPNULL;
+		m_spAggloBaseDef = SPNULL;
+
+	//	processes without indices on the base level do not participate
+		if(ld.A->layouts()->proc_comm().empty()) return;
+
+		if(!ld.st->layouts()->vertical_master().empty() ||
+			!ld.st->layouts()->vertical_slave().empty())
+			UG_THROW("GMG: Base level agglomeration requires a base level "
+					"without vertical interfaces. Choose a base level on which"
+					" the grid is distributed horizontally only.");
+
+	//	collect the base level matrix on the group roots
+		m_spAggloBaseMat = SmartPtr<MatrixOperator<matrix_type, vector_type> >(
+								new MatrixOperator<matrix_type, vector_type>);
+		m_bAggloBaseRoot = CollectMatrixOnProcGroups(*ld.A, *m_spAggloBaseMat,
+		                                             m_aggloBaseMaster, m_aggloBaseSlave,
+		                                             m_numBaseAggloProcsPerProc);
+
+	//  only init on agglomeration roots
+		if(!m_bAggloBaseRoot){
+			m_spAggloBaseMat = SPNULL;
+			return;
+		}
+
+		ConstSmartPtr<AlgebraLayouts> spLayouts = m_spAggloBaseMat->layouts();
+		if(spLayouts->proc_comm().size() > 1 && !m_spBaseSolver->supports_parallel())
+			UG_THROW("GMG: Base level is agglomerated onto "<<spLayouts->proc_comm().size()
+					<<" processes, but the chosen base solver "<<m_spBaseSolver->name()<<
+					" does not support parallel solving. Choose a parallel"
+					" base solver or increase the agglomeration.");
+
+		const size_t numAggloIndex = m_spAggloBaseMat->num_rows();
+		m_spAggloBaseCorr = make_sp(new vector_type(numAggloIndex));
+		m_spAggloBaseCorr->set_layouts(spLayouts);
+		m_spAggloBaseDef = make_sp(new vector_type(numAggloIndex));
+		m_spAggloBaseDef->set_layouts(spLayouts);
+
+		m_spAggloBaseCorr->set(0.0);
+		if(!m_spBaseSolver->init(m_spAggloBaseMat, *m_spAggloBaseCorr))
+			UG_THROW("GMG::init: Cannot init base solver on baselevel "<< m_baseLev);
+	}
+#endif
 	else
 	{
 #ifdef UG_PARALLEL
@@ -1523,6 +1668,13 @@ init_level_memory(int baseLev, int topLev)
 
 		ld.Projection = m_spProjectionPrototype->clone();
 
+	//	levels above the base level may be agglomerated onto fewer processes
+		#ifdef UG_PARALLEL
+		std::map<int, size_t>::const_iterator itAgglo = m_mLevAggloProcsPerProc.find(lev);
+		if(lev > baseLev && itAgglo != m_mLevAggloProcsPerProc.end())
+			ld.numAggloProcsPerProc = itAgglo->second;
+		#endif
+
 		ld.Prolongation = m_spProlongationPrototype->clone();
 		if(m_spProlongationPrototype == m_spRestrictionPrototype)
 			ld.Restriction = ld.Prolongation;
@@ -1554,8 +1706,18 @@ init_level_memory(int baseLev, int topLev)
 //	Note: levels not containing any dof, are skipped from computation anyway
 	if(!bHasVertConn) m_bGatheredBaseUsed = false;
 
+//	agglomeration onto a subset of processes is only used for the parallel
+//	(i.e. not gathered) base solver
+	m_bAggloBaseUsed = false;
+	#ifdef UG_PARALLEL
+	if(!m_bGatheredBaseUsed && m_numBaseAggloProcsPerProc > 1)
+		m_bAggloBaseUsed = true;
+	#endif
+
 //	check if parallel solver is available, if not, try to use gathered
+//	(if agglomerated, the check is performed for the agglomeration roots)
 	if(!m_bGatheredBaseUsed
+		&& !m_bAggloBaseUsed
 		&& bHasHorrConn
 		&& !m_spBaseSolver->supports_parallel())
 	{
@@ -1641,15 +1803,32 @@ presmooth_and_restriction(int lev)
 	LevData& lf = *m_vLevData[lev];
 	LevData& lc = *m_vLevData[lev-1];
 
+//	estimated costs for cycle profile
+	MGCycleProfile* pProf = m_spCycleProfile.get();
+	number mvBytes = 0, mvFlops = 0;
+	if(pProf) level_matvec_costs(lev, mvBytes, mvFlops);
+
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - presmooth on level "<<lev<<"\n");
 	log_debug_data(lev, "BeforePreSmooth");
 	mg_stats_defect(*lf.sd, lev, mg_stats_type::BEFORE_PRE_SMOOTH);
 
 //	PRESMOOTH
 	GMG_PROFILE_BEGIN(GMG_PreSmooth);
+	MGPhaseTimer tPreSmooth(pProf, lev, MGCycleProfile::PRE_SMOOTH,
+	                        2*m_numPreSmooth*mvBytes, 2*m_numPreSmooth*mvFlops);
 	try{
+	//	smooth on the agglomeration roots, then update the defect once
+		const bool bAgglo = (lf.numAggloProcsPerProc > 1 && m_numPreSmooth > 0);
+		if(bAgglo)
+		{
+			agglomerated_smooth(lev, true);
+			lf.A->apply_sub(*lf.sd, *lf.st);
+			(*lf.sc) += (*lf.st);
+		}
+
 	//	smooth several times
-		for(int nu = 0; nu < m_numPreSmooth; ++nu)
+		const int numSmooth = bAgglo ? 0 : m_numPreSmooth;
+		for(int nu = 0; nu < numSmooth; ++nu)
 		{
 		//	a)  Compute t = B*d with some iterator B
 			if(!lf.PreSmoother->apply(*lf.st, *lf.sd))
@@ -1680,6 +1859,7 @@ presmooth_and_restriction(int lev)
 		}
 	}
 	UG_CATCH_THROW("GMG: Pre-Smoothing on level "<<lev<<" failed.");
+	tPreSmooth.stop();
 	GMG_PROFILE_END();
 
 	log_debug_data(lev, "AfterPreSmooth_BeforeCom");
@@ -1703,6 +1883,10 @@ presmooth_and_restriction(int lev)
 		//	We use a temporary vector including ghost, such that the no-ghost defect
 		//	remains valid and can be used when the cycle comes back to this level.
 
+		MGPhaseTimer tPack(pProf, lev, MGCycleProfile::COMM_PACK);
+		if(pProf) tPack.add_costs(layout_bytes(lf.t->layouts()->vertical_slave())
+		                        + layout_bytes(lf.t->layouts()->vertical_master()), 0);
+
 		GMG_PROFILE_BEGIN(GMG_Restrict_CopyNoghostToGhost);
 		SetLayoutValues(&(*lf.t), lf.t->layouts()->vertical_master(), 0);
 		copy_noghost_to_ghost(lf.t, lf.sd, lf.vMapPatchToGlobal);
@@ -1713,8 +1897,11 @@ presmooth_and_restriction(int lev)
 		m_Com.receive_data(lf.t->layouts()->vertical_master(), cpVecAdd);
 		m_Com.communicate_and_resume();
 		GMG_PROFILE_END();
+		tPack.stop();
+
 		if(!m_bCommCompOverlap){
 			GMG_PROFILE_BEGIN(GMG_Restrict_RecieveAndExtract_NoOverlap);
+			MGPhaseTimer tWait(pProf, lev, MGCycleProfile::COMM_WAIT);
 			m_Com.wait();
 			GMG_PROFILE_END();
 		}
@@ -1735,6 +1922,7 @@ presmooth_and_restriction(int lev)
 	#ifdef UG_PARALLEL
 	if(m_bCommCompOverlap){
 		GMG_PROFILE_BEGIN(GMG_Restrict_RecieveAndExtract_WithOverlap);
+		MGPhaseTimer tWait(pProf, lev, MGCycleProfile::COMM_WAIT);
 		m_Com.wait();
 		GMG_PROFILE_END();
 	}
@@ -1744,6 +1932,10 @@ presmooth_and_restriction(int lev)
 	log_debug_data(lev, "BeforeRestrict");
 
 //	RESTRICTION:
+	MGPhaseTimer tRestrict(pProf, lev, MGCycleProfile::RESTRICTION);
+	if(pProf) tRestrict.add_costs(level_vector_bytes(lev) + level_vector_bytes(lev-1),
+	                              2*spD->size());
+
 	GMG_PROFILE_BEGIN(GMG_Restrict_Transfer);
 	try{
 		lf.Restriction->do_restrict(*lc.sd, *spD);
@@ -1756,6 +1948,7 @@ presmooth_and_restriction(int lev)
 	for(size_t i = 0; i < m_vspRestrictionPostProcess.size(); ++i)
 		m_vspRestrictionPostProcess[i]->post_process(lc.sd);
 	GMG_PROFILE_END();
+	tRestrict.stop();
 
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - restriction on level "<<lev<<"\n");
 }
@@ -1768,12 +1961,19 @@ prolongation_and_postsmooth(int lev)
 	LevData& lf = *m_vLevData[lev];
 	LevData& lc = *m_vLevData[lev-1];
 
+//	estimated costs for cycle profile
+	MGCycleProfile* pProf = m_spCycleProfile.get();
+	number mvBytes = 0, mvFlops = 0;
+	if(pProf) level_matvec_costs(lev, mvBytes, mvFlops);
+
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - prolongation on level "<<lev<<"\n");
 	log_debug_data(lev, "BeforeProlong");
 
 //	ADAPTIVE CASE:
 	if(lev > m_LocalFullRefLevel)
 	{
+		MGPhaseTimer tRim(pProf, lev, MGCycleProfile::RESIDUAL);
+
 		//	write computed correction to surface
 		GMG_PROFILE_BEGIN(GMG_AddCorrectionToSurface);
 		try{
@@ -1804,12 +2004,17 @@ prolongation_and_postsmooth(int lev)
 		spT = lf.t;
 	}
 	#endif
+	MGPhaseTimer tProlong(pProf, lev, MGCycleProfile::PROLONGATION);
+	if(pProf) tProlong.add_costs(level_vector_bytes(lev) + level_vector_bytes(lev-1),
+	                             2*spT->size());
+
 	GMG_PROFILE_BEGIN(GMG_Prolongate_Transfer);
 	try{
 		lf.Prolongation->prolongate(*spT, *lc.sc);
 	}
 	UG_CATCH_THROW("GMG: Prolongation from lev "<<lev-1<<" to "<<lev<<" failed.");
 	GMG_PROFILE_END();
+	tProlong.pause();
 
 //	PARALLEL CASE:
 #ifdef UG_PARALLEL
@@ -1822,14 +2027,24 @@ prolongation_and_postsmooth(int lev)
 		//	If there are vertical slaves/masters on the coarser level, we now copy
 		//	the correction values from the v-master DoFs to the v-slave	DoFs.
 		GMG_PROFILE_BEGIN(GMG_Prolongate_SendAndRecieve);
+		MGPhaseTimer tPack(pProf, lev, MGCycleProfile::COMM_PACK);
+		if(pProf) tPack.add_costs(layout_bytes(lf.t->layouts()->vertical_slave())
+		                        + layout_bytes(lf.t->layouts()->vertical_master()), 0);
 		ComPol_VecCopy<vector_type> cpVecCopy(lf.t.get());
 		m_Com.receive_data(lf.t->layouts()->vertical_slave(), cpVecCopy);
 		m_Com.send_data(lf.t->layouts()->vertical_master(), cpVecCopy);
-		m_Com.communicate();
+		m_Com.communicate_and_resume();
+		tPack.stop();
+
+		MGPhaseTimer tWait(pProf, lev, MGCycleProfile::COMM_WAIT);
+		m_Com.wait();
+		tWait.stop();
 		GMG_PROFILE_END();
 
 		GMG_PROFILE_BEGIN(GMG_Prolongate_GhostToNoghost);
+		MGPhaseTimer tUnpack(pProf, lev, MGCycleProfile::COMM_PACK);
 		copy_ghost_to_noghost(lf.st, lf.t, lf.vMapPatchToGlobal);
+		tUnpack.stop();
 		GMG_PROFILE_END();
 
 		UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - copy_to_vertical_slaves\n");
@@ -1837,6 +2052,7 @@ prolongation_and_postsmooth(int lev)
 #endif
 
 //	apply post processes
+	tProlong.resume();
 	GMG_PROFILE_BEGIN(GMG_Prolongate_PostProcess);
 	for(size_t i = 0; i < m_vspProlongationPostProcess.size(); ++i)
 		m_vspProlongationPostProcess[i]->post_process(lf.st);
@@ -1846,6 +2062,7 @@ prolongation_and_postsmooth(int lev)
 	GMG_PROFILE_BEGIN(GMG_AddCoarseGridCorrection);
 	(*lf.sc) += (*lf.st);
 	GMG_PROFILE_END();
+	tProlong.stop();
 
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - prolongation on level "<<lev<<"\n");
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-start - postsmooth on level "<<lev<<"\n");
@@ -1853,9 +2070,25 @@ prolongation_and_postsmooth(int lev)
 
 // 	POST-SMOOTH:
 	GMG_PROFILE_BEGIN(GMG_PostSmooth);
+	MGPhaseTimer tPostSmooth(pProf, lev, MGCycleProfile::POST_SMOOTH,
+	                         2*m_numPostSmooth*mvBytes, 2*m_numPostSmooth*mvFlops);
 	try{
+	//	smooth on the agglomeration roots. The defect is updated by the
+	//	total smoothing correction below.
+		const bool bAgglo = (lf.numAggloProcsPerProc > 1 && m_numPostSmooth > 0);
+		if(bAgglo)
+		{
+			lf.A->apply_sub(*lf.sd, *lf.st);
+			log_debug_data(lev, "BeforePostSmooth");
+			mg_stats_defect(*lf.sd, lev, mg_stats_type::BEFORE_POST_SMOOTH);
+
+			agglomerated_smooth(lev, false);
+			(*lf.sc) += (*lf.st);
+		}
+
 	//	smooth several times
-		for(int nu = 0; nu < m_numPostSmooth; ++nu)
+		const int numSmooth = bAgglo ? 0 : m_numPostSmooth;
+		for(int nu = 0; nu < numSmooth; ++nu)
 		{
 		//	update defect
 			lf.A->apply_sub(*lf.sd, *lf.st);
@@ -1884,6 +2117,7 @@ prolongation_and_postsmooth(int lev)
 		}
 	}
 	UG_CATCH_THROW("GMG: Post-Smoothing on level "<<lev<<" failed. ")
+	tPostSmooth.stop();
 	GMG_PROFILE_END();
 
 //	update the defect if required. In full-ref case, the defect is not needed
@@ -1892,6 +2126,7 @@ prolongation_and_postsmooth(int lev)
 //	We also need it if we want to write stats or debug data
 	if(lev >= m_LocalFullRefLevel || m_mgstats.valid() || m_spDebugWriter.valid()){
 		GMG_PROFILE_BEGIN(GMG_UpdateDefectAfterPostSmooth);
+		MGPhaseTimer tResidual(pProf, lev, MGCycleProfile::RESIDUAL, mvBytes, mvFlops);
 		lf.A->apply_sub(*lf.sd, *lf.st);
 		GMG_PROFILE_END();
 	}
@@ -1901,6 +2136,69 @@ prolongation_and_postsmooth(int lev)
 	UG_DLOG(LIB_DISC_MULTIGRID, 3, "gmg-stop - postsmooth on level "<<lev<<"\n");
 }
 
+// performs the smoothing of an agglomerated level
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+agglomerated_smooth(int lev, bool bPreSmooth)
+{
+	GMG_PROFILE_FUNC();
+	LevData& ld = *m_vLevData[lev];
+	ld.st->set(0.0);
+
+//	The defect is gathered on the agglomeration roots, where all smoothing
+//	steps are performed. The total correction is broadcasted into ld.st,
+//	while the defect ld.sd on the original distribution remains unchanged.
+	#ifdef UG_PARALLEL
+	if(ld.sd->layouts()->proc_comm().empty()) return;
+
+	MGCycleProfile* pProf = m_spCycleProfile.get();
+	const int numSmooth = bPreSmooth ? m_numPreSmooth : m_numPostSmooth;
+
+//	gather the defect
+	GMG_PROFILE_BEGIN(GMG_AggloSmooth_Defect_Gather);
+	MGPhaseTimer tGather(pProf, lev, MGCycleProfile::COMM_WAIT);
+	if(pProf) tGather.add_costs(layout_bytes(ld.aggloMaster)
+	                          + layout_bytes(ld.aggloSlave), 0);
+	GatherVectorOnOne(ld.aggloMaster, ld.aggloSlave, m_Com,
+	                  ld.bAggloRoot ? *ld.aggloD : static_cast<vector_type&>(*ld.st),
+	                  *ld.sd, PST_ADDITIVE, ld.bAggloRoot);
+	tGather.stop();
+	GMG_PROFILE_END();
+
+//	smooth on the agglomeration roots
+	if(ld.bAggloRoot)
+	{
+		ILinearIterator<vector_type>& smoother =
+				bPreSmooth ? *ld.AggloPreSmoother : *ld.AggloPostSmoother;
+
+		ld.aggloC->set(0.0);
+		for(int nu = 0; nu < numSmooth; ++nu)
+		{
+			if(nu > 0)
+				ld.AggloA->apply_sub(*ld.aggloD, *ld.aggloT);
+
+			if(!smoother.apply(*ld.aggloT, *ld.aggloD))
+				UG_THROW("GMG: Agglomerated smoothing step "<<nu+1<<" on level "<<lev<<" failed.");
+
+			(*ld.aggloC) += (*ld.aggloT);
+		}
+		ld.aggloC->change_storage_type(PST_CONSISTENT);
+	}
+
+//	broadcast the correction
+	GMG_PROFILE_BEGIN(GMG_AggloSmooth_Correction_Broadcast);
+	MGPhaseTimer tBcast(pProf, lev, MGCycleProfile::COMM_WAIT);
+	if(pProf) tBcast.add_costs(layout_bytes(ld.aggloMaster)
+	                         + layout_bytes(ld.aggloSlave), 0);
+	BroadcastVectorFromOne(ld.aggloMaster, ld.aggloSlave, m_Com,
+	                       static_cast<vector_type&>(*ld.st),
+	                       ld.bAggloRoot ? *ld.aggloC : static_cast<vector_type&>(*ld.sd),
+	                       PST_CONSISTENT, ld.bAggloRoot);
+	tBcast.stop();
+	GMG_PROFILE_END();
+	#endif
+}
+
 // performs the base solving
 template <typename TDomain, typename TAlgebra>
 void AssembledMultiGridCycle<TDomain, TAlgebra>::
@@ -1912,19 +2210,77 @@ base_solve(int lev)
 
 	try{
 	LevData& ld = *m_vLevData[lev];
+	MGCycleProfile* pProf = m_spCycleProfile.get();
 
 //	SOLVE BASE PROBLEM
-//	Here we distinguish two possibilities:
+//	Here we distinguish three possibilities:
 //	a) The coarse grid problem is solved in parallel, using a parallel solver
 //	b) First all vectors are gathered to one process, solved on this one
 //	   process and then again distributed
+//	c) The vectors are agglomerated onto a subset of the processes, solved
+//	   there in parallel and then again distributed
+
+//	CASE c): We agglomerate the processes onto a subset, solve there in
+//	parallel and distribute again
+	if(m_bAggloBaseUsed)
+	{
+		UG_DLOG(LIB_DISC_MULTIGRID, 3, " GMG: entering agglomerated basesolver branch.\n");
+
+		#ifdef UG_PARALLEL
+		if(!ld.sd->layouts()->proc_comm().empty())
+		{
+		//	gather the defect
+			GMG_PROFILE_BEGIN(GMG_AggloBaseSolver_Defect_Gather);
+			MGPhaseTimer tGather(pProf, lev, MGCycleProfile::COMM_WAIT);
+			if(pProf) tGather.add_costs(layout_bytes(m_aggloBaseMaster)
+			                          + layout_bytes(m_aggloBaseSlave), 0);
+			vector_type& d = *ld.sd;
+			GatherVectorOnOne(m_aggloBaseMaster, m_aggloBaseSlave, m_Com,
+			                  m_bAggloBaseRoot ? *m_spAggloBaseDef : static_cast<vector_type&>(*ld.sc),
+			                  d, PST_ADDITIVE, m_bAggloBaseRoot);
+			tGather.stop();
+			GMG_PROFILE_END();
+
+		//	only solve on agglomeration roots
+			if(m_bAggloBaseRoot)
+			{
+				GMG_PROFILE_BEGIN(GMG_AggloBaseSolver_Apply);
+				MGPhaseTimer tBase(pProf, lev, MGCycleProfile::BASE_SOLVE);
+
+				m_spAggloBaseCorr->set(0.0);
+				try{
+					if(!m_spBaseSolver->apply(*m_spAggloBaseCorr, *m_spAggloBaseDef))
+						UG_THROW("GMG::lmgc: Base solver on base level "<<lev<<" failed.");
+				}
+				UG_CATCH_THROW("GMG: BaseSolver::apply failed. (case: c).")
+				m_spAggloBaseCorr->change_storage_type(PST_CONSISTENT);
+				GMG_PROFILE_END();
+			}
+
+		//	broadcast the correction
+			GMG_PROFILE_BEGIN(GMG_AggloBaseSolver_Correction_Broadcast);
+			MGPhaseTimer tBcast(pProf, lev, MGCycleProfile::COMM_WAIT);
+			if(pProf) tBcast.add_costs(layout_bytes(m_aggloBaseMaster)
+			                         + layout_bytes(m_aggloBaseSlave), 0);
+			BroadcastVectorFromOne(m_aggloBaseMaster, m_aggloBaseSlave, m_Com,
+			                       static_cast<vector_type&>(*ld.sc),
+			                       m_bAggloBaseRoot ? *m_spAggloBaseCorr : d,
+			                       PST_CONSISTENT, m_bAggloBaseRoot);
+			tBcast.stop();
+			GMG_PROFILE_END();
+		}
+		#endif
+
+		UG_DLOG(LIB_DISC_MULTIGRID, 3, " GMG: exiting agglomerated basesolver branch.\n");
+	}
 
 //	CASE a): We solve the problem in parallel (or normally for sequential code)
-	if(!m_bGatheredBaseUsed)
+	else if(!m_bGatheredBaseUsed)
 	{
 		UG_DLOG(LIB_DISC_MULTIGRID, 3, " GMG: entering distributed basesolver branch.\n");
 
 		GMG_PROFILE_BEGIN(GMG_BaseSolver_Apply);
+		MGPhaseTimer tBase(pProf, lev, MGCycleProfile::BASE_SOLVE);
 		try{
 			if(!m_spBaseSolver->apply(*ld.sc, *ld.sd))
 				UG_THROW("GMG::lmgc: Base solver on base level "<<lev<<" failed.");
@@ -1945,6 +2301,10 @@ base_solve(int lev)
 		if( !ld.t->layouts()->vertical_slave().empty() ||
 			!ld.t->layouts()->vertical_master().empty())
 		{
+			MGPhaseTimer tPack(pProf, lev, MGCycleProfile::COMM_PACK);
+			if(pProf) tPack.add_costs(layout_bytes(ld.t->layouts()->vertical_slave())
+			                        + layout_bytes(ld.t->layouts()->vertical_master()), 0);
+
 			GMG_PROFILE_BEGIN(GMG_GatheredBaseSolver_Defect_CopyNoghostToGhost);
 			SetLayoutValues(&(*ld.t), ld.t->layouts()->vertical_master(), 0);
 			copy_noghost_to_ghost(ld.t, ld.sd, ld.vMapPatchToGlobal);
@@ -1954,7 +2314,12 @@ base_solve(int lev)
 			ComPol_VecAddSetZero<vector_type> cpVecAdd(ld.t.get());
 			m_Com.send_data(ld.t->layouts()->vertical_slave(), cpVecAdd);
 			m_Com.receive_data(ld.t->layouts()->vertical_master(), cpVecAdd);
-			m_Com.communicate();
+			m_Com.communicate_and_resume();
+			tPack.stop();
+
+			MGPhaseTimer tWait(pProf, lev, MGCycleProfile::COMM_WAIT);
+			m_Com.wait();
+			tWait.stop();
 			GMG_PROFILE_END();
 		}
 		#endif
@@ -1964,6 +2329,7 @@ base_solve(int lev)
 		{
 			UG_DLOG(LIB_DISC_MULTIGRID, 3, " GMG: Start serial base solver.\n");
 			GMG_PROFILE_BEGIN(GMG_GatheredBaseSolver_Apply);
+			MGPhaseTimer tBase(pProf, lev, MGCycleProfile::BASE_SOLVE);
 
 		//	Reset correction
 			spGatheredBaseCorr->set(0.0);
@@ -1985,10 +2351,18 @@ base_solve(int lev)
 		if(gathered_base_master()) spC = spGatheredBaseCorr;
 
 		GMG_PROFILE_BEGIN(GMG_GatheredBaseSolver_Correction_SendAndRecieve);
+		MGPhaseTimer tPack(pProf, lev, MGCycleProfile::COMM_PACK);
+		if(pProf) tPack.add_costs(layout_bytes(spC->layouts()->vertical_slave())
+		                        + layout_bytes(spC->layouts()->vertical_master()), 0);
 		ComPol_VecCopy<vector_type> cpVecCopy(spC.get());
 		m_Com.send_data(spC->layouts()->vertical_master(), cpVecCopy);
 		m_Com.receive_data(spC->layouts()->vertical_slave(), cpVecCopy);
-		m_Com.communicate();
+		m_Com.communicate_and_resume();
+		tPack.stop();
+
+		MGPhaseTimer tWait(pProf, lev, MGCycleProfile::COMM_WAIT);
+		m_Com.wait();
+		tWait.stop();
 		GMG_PROFILE_END();
 		if(gathered_base_master()){
 			GMG_PROFILE_BEGIN(GMG_GatheredBaseSolver_Correction_CopyGhostToNoghost);
@@ -2007,6 +2381,9 @@ base_solve(int lev)
 //	we must keep track of the defect on the surface
 	if(lev >= m_LocalFullRefLevel){
 		GMG_PROFILE_BEGIN(GMG_UpdateDefectAfterBaseSolver);
+		number mvBytes = 0, mvFlops = 0;
+		if(pProf) level_matvec_costs(lev, mvBytes, mvFlops);
+		MGPhaseTimer tResidual(pProf, lev, MGCycleProfile::RESIDUAL, mvBytes, mvFlops);
 		ld.A->apply_sub(*ld.sd, *ld.sc);
 		GMG_PROFILE_END();
 	}
@@ -2201,6 +2578,43 @@ mg_stats_defect(GF& gf, int lvl, typename mg_stats_type::Stage stage)
 		m_mgstats->set_defect(gf, lvl, stage);
 }
 
+template <typename TDomain, typename TAlgebra>
+void AssembledMultiGridCycle<TDomain, TAlgebra>::
+level_matvec_costs(int lev, number& bytes, number& flops) const
+{
+	const LevData& ld = *m_vLevData[lev];
+	if(ld.A.invalid()) {bytes = flops = 0; return;}
+
+	typedef typename matrix_type::value_type matrix_value_type;
+	typedef typename vector_type::value_type vector_value_type;
+
+//	one multiply-add per nonzero, matrix entries and column indices are read,
+//	two vectors are read and one is written
+	const number nnz = ld.A->total_num_connections();
+	const number n = ld.A->num_rows();
+	flops = 2 * nnz;
+	bytes = nnz * (sizeof(matrix_value_type) + sizeof(size_t))
+			+ 3 * n * sizeof(vector_value_type);
+}
+
+template <typename TDomain, typename TAlgebra>
+number AssembledMultiGridCycle<TDomain, TAlgebra>::
+level_vector_bytes(int lev) const
+{
+	typedef typename vector_type::value_type vector_value_type;
+	return m_vLevData[lev]->sd->size() * sizeof(vector_value_type);
+}
+
+#ifdef UG_PARALLEL
+template <typename TDomain, typename TAlgebra>
+number AssembledMultiGridCycle<TDomain, TAlgebra>::
+layout_bytes(const IndexLayout& layout) const
+{
+	typedef typename vector_type::value_type vector_value_type;
+	return layout.num_interface_elements() * sizeof(vector_value_type);
+}
+#endif
+
 template <typename TDomain, typename TAlgebra>
 std::string
 AssembledMultiGridCycle<TDomain, TAlgebra>::
@@ -2223,8 +2637,15 @@ config_string() const
 		ss << " Postsmoother ( " << m_numPostSmooth << "x): " << ConfigShift(m_spPostSmootherPrototype->config_string());
 	}
 	ss << "\n";
-	ss << " Basesolver ( Baselevel = " << m_baseLev << ", gathered base = " << (m_bGatheredBaseIfAmbiguous ? "true" : "false") << "): ";
+	ss << " Basesolver ( Baselevel = " << m_baseLev << ", gathered base = " << (m_bGatheredBaseIfAmbiguous ? "true" : "false");
+	if(m_numBaseAggloProcsPerProc > 1)
+		ss << ", agglomeration = " << m_numBaseAggloProcsPerProc;
+	ss << "): ";
 	ss << ConfigShift(m_spBaseSolver->config_string());
+	for(std::map<int, size_t>::const_iterator it = m_mLevAggloProcsPerProc.begin();
+		it != m_mLevAggloProcsPerProc.end(); ++it)
+		if(it->second > 1)
+			ss << " Level agglomeration ( Level = " << it->first << ", procs per proc = " << it->second << ")\n";
 	return ss.str();
 
 }
@@ -144,6 +144,19 @@ class NewtonSolver
 		void clear_step_update(SmartPtr<INewtonUpdate > NU)
 			{m_stepUpdate.clear();}
 
+	///	sets if the Jacobian of the last call to apply is reused
+	/**
+	 * If enabled, the Jacobian and the initialized linear solver (including its
+	 * preconditioner) of the previous call to apply are kept for all Newton
+	 * steps, i.e. a simplified Newton method is performed. This is only done if
+	 * the discretization, the grid level and the size of the system did not
+	 * change; otherwise the Jacobian is assembled as usual.
+	 */
+		void set_reuse_jacobian(bool bReuse) {m_bReuseJacobian = bReuse;}
+
+	///	returns if the Jacobian of the last call to apply is reused
+		bool reuse_jacobian() const {return m_bReuseJacobian;}
+
 	private:
 	///	help functions for debug output
 	///	\{
@@ -183,6 +196,9 @@ class NewtonSolver
 		int m_dgbCall;
 		int m_lastNumSteps;
 
+	///	flag if the last Jacobian is reused
+		bool m_bReuseJacobian;
+
 	/// convergence history of linear solver
 	/// \{
 		std::vector<int> m_vTotalLinSolverSteps;
@@ -65,7 +65,8 @@ NewtonSolver(SmartPtr<ILinearOperatorInverse<vector_type> > LinearSolver,
 			m_J(NULL),
 			m_spAss(NULL),
 			m_dgbCall(0),
-			m_lastNumSteps(0)
+			m_lastNumSteps(0),
+			m_bReuseJacobian(false)
 {};
 
 template <typename TAlgebra>
@@ -78,7 +79,8 @@ NewtonSolver() :
 	m_J(NULL),
 	m_spAss(NULL),
 	m_dgbCall(0),
-	m_lastNumSteps(0)
+	m_lastNumSteps(0),
+	m_bReuseJacobian(false)
 {};
 
 template <typename TAlgebra>
@@ -91,7 +93,8 @@ NewtonSolver(SmartPtr<IOperator<vector_type> > N) :
 	m_J(NULL),
 	m_spAss(NULL),
 	m_dgbCall(0),
-	m_lastNumSteps(0)
+	m_lastNumSteps(0),
+	m_bReuseJacobian(false)
 {
 	init(N);
 };
@@ -106,7 +109,8 @@ NewtonSolver(SmartPtr<IAssemble<TAlgebra> > spAss) :
 	m_J(NULL),
 	m_spAss(NULL),
 	m_dgbCall(0),
-	m_lastNumSteps(0)
+	m_lastNumSteps(0),
+	m_bReuseJacobian(false)
 {
 	m_spAss = spAss;
 	m_N = SmartPtr<AssembledOperator<TAlgebra> >(new AssembledOperator<TAlgebra>(m_spAss));
@@ -152,6 +156,12 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 	if(m_spLinearSolver.invalid())
 		UG_THROW("NewtonSolver::apply: Linear Solver not set.");
 
+//	the Jacobian of the last call can only be reused for the same system
+	const bool bReuseJacobian = m_bReuseJacobian && m_J.valid()
+								&& m_J->discretization() == m_spAss
+								&& m_J->level() == m_N->level()
+								&& m_J->get_matrix().num_rows() == u.size();
+
 //	Jacobian
 	if(m_J.invalid() || m_J->discretization() != m_spAss) {
 		m_J = make_sp(new AssembledLinearOperator<TAlgebra>(m_spAss));
@@ -211,29 +221,33 @@ bool NewtonSolver<TAlgebra>::apply(vector_type& u)
 		for(size_t i = 0; i < m_innerStepUpdate.size(); ++i)
 			m_innerStepUpdate[i]->update();
 
-	// 	Compute Jacobian
-		try{
-		NEWTON_PROFILE_BEGIN(NewtonComputeJacobian);
-		m_J->init(u);
-		NEWTON_PROFILE_END();
-		}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Jacobian failed.");
+	//	a reused Jacobian and linear solver are kept for all steps (simplified Newton)
+		if(!bReuseJacobian)
+		{
+		// 	Compute Jacobian
+			try{
+			NEWTON_PROFILE_BEGIN(NewtonComputeJacobian);
+			m_J->init(u);
+			NEWTON_PROFILE_END();
+			}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Jacobian failed.");
 
-	//	Write Jacobian for debug
-		std::string matname("NEWTON_Jacobian");
-		matname.append(ext);
-		write_debug(m_J->get_matrix(), matname.c_str());
+		//	Write Jacobian for debug
+			std::string matname("NEWTON_Jacobian");
+			matname.append(ext);
+			write_debug(m_J->get_matrix(), matname.c_str());
 
-	// 	Init Jacobi Inverse
-		try{
-		NEWTON_PROFILE_BEGIN(NewtonPrepareLinSolver);
-		if(!m_spLinearSolver->init(m_J, u))
-		{
-			UG_LOG("ERROR in 'NewtonSolver::apply': Cannot init Inverse Linear "
-					"Operator for Jacobi-Operator.\n");
-			return false;
+		// 	Init Jacobi Inverse
+			try{
+			NEWTON_PROFILE_BEGIN(NewtonPrepareLinSolver);
+			if(!m_spLinearSolver->init(m_J, u))
+			{
+				UG_LOG("ERROR in 'NewtonSolver::apply': Cannot init Inverse Linear "
+						"Operator for Jacobi-Operator.\n");
+				return false;
+			}
+			NEWTON_PROFILE_END();
+			}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Linear Solver failed.");
 		}
-		NEWTON_PROFILE_END();
-		}UG_CATCH_THROW("NewtonSolver::apply: Initialization of Linear Solver failed.");
 
 	// 	Solve Linearized System
 		try{
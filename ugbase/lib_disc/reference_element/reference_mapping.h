@@ -33,6 +33,7 @@
 #ifndef __H__UG__LIB_DISC__REFERENCE_ELEMENT__REFERENCE_ELEMENT_MAPPING__
 #define __H__UG__LIB_DISC__REFERENCE_ELEMENT__REFERENCE_ELEMENT_MAPPING__
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <sstream>
@@ -192,6 +193,12 @@ class BaseReferenceMapping
 {
 	public:
 	///	returns if mapping is affine
+	/**
+	 * Mappings that are not affine for all elements (i.e. isLinear = false)
+	 * may shadow this method and return true if the current corners give an
+	 * affine mapping (e.g. parallelograms). The methods for n local positions
+	 * then compute the Jacobian only once.
+	 */
 		bool is_linear() const {return isLinear;}
 
 	///	map local coordinate to global coordinate for n local positions
@@ -269,7 +276,7 @@ class BaseReferenceMapping
 							 const size_t maxIter = 1000,
 							 const number tol = 1e-10) const
 		{
-			if(isLinear){
+			if(getImpl().is_linear()){
 				if(n == 0) return;
 
 				MathMatrix<worldDim, dim> J;
@@ -321,7 +328,7 @@ class BaseReferenceMapping
 		void jacobian(MathMatrix<worldDim, dim>* vJ,
 					  const MathVector<dim>* vLocPos, size_t n) const
 		{
-			if(isLinear){
+			if(getImpl().is_linear()){
 				if(n == 0) return;
 				getImpl().jacobian(vJ[0], vLocPos[0]);
 				for(size_t ip = 1; ip < n; ++ip) vJ[ip] = vJ[0];
@@ -346,7 +353,7 @@ class BaseReferenceMapping
 		void jacobian_transposed(MathMatrix<dim, worldDim>* vJT,
 								 const MathVector<dim>* vLocPos, size_t n) const
 		{
-			if(isLinear){
+			if(getImpl().is_linear()){
 				if(n == 0) return;
 				getImpl().jacobian_transposed(vJT[0], vLocPos[0]);
 				for(size_t ip = 1; ip < n; ++ip) vJT[ip] = vJT[0];
@@ -383,7 +390,7 @@ class BaseReferenceMapping
 		                                 number* vDet,
 										 const MathVector<dim>* vLocPos, size_t n) const
 		{
-			if(isLinear){
+			if(getImpl().is_linear()){
 				if(n == 0) return;
 				vDet[0] = getImpl().jacobian_transposed_inverse(vJTInv[0], vLocPos[0]);
 				for(size_t ip = 1; ip < n; ++ip) vJTInv[ip] = vJTInv[0];
@@ -399,7 +406,7 @@ class BaseReferenceMapping
 		void jacobian_transposed_inverse(MathMatrix<worldDim, dim>* vJTInv,
 										 const MathVector<dim>* vLocPos, size_t n) const
 		{
-			if(isLinear){
+			if(getImpl().is_linear()){
 				if(n == 0) return;
 				getImpl().jacobian_transposed_inverse(vJTInv[0], vLocPos[0]);
 				for(size_t ip = 1; ip < n; ++ip) vJTInv[ip] = vJTInv[0];
@@ -440,7 +447,7 @@ class BaseReferenceMapping
 	///	returns the determinate of the jacobian for n local positions
 		void sqrt_gram_det(number* vDet, const MathVector<dim>* vLocPos, size_t n) const
 		{
-			if(isLinear){
+			if(getImpl().is_linear()){
 				if(n == 0) return;
 				vDet[0] = sqrt_gram_det(vLocPos[0]);
 				for(size_t ip = 1; ip < n; ++ip) vDet[ip] = vDet[0];
@@ -461,6 +468,18 @@ class BaseReferenceMapping
 		}
 
 	protected:
+	///	returns if an affine coefficient vanishes relative to the element size
+	/**
+	 * Multilinear mappings (quadrilateral, prism, hexahedron) are affine if
+	 * all coefficients of the mixed terms vanish. This is checked relative to
+	 * the squared size of the element, passed as sizeSq.
+	 */
+		static bool affine_coeff_vanishes(const MathVector<worldDim>& coeff,
+		                                  number sizeSq)
+		{
+			return VecTwoNormSq(coeff) <= 1e-20 * sizeSq;
+		}
+
 	///	access to implementation
 		TImpl& getImpl() {return static_cast<TImpl&>(*this);}
 
@@ -711,7 +730,7 @@ class ReferenceMapping<ReferenceQuadrilateral, TWorldDim>
 
 	public:
 	///	Default Constructor
-		ReferenceMapping() {}
+		ReferenceMapping() : m_bAffine(false) {}
 
 	///	Constructor setting the corners
 	/// \{
@@ -732,8 +751,13 @@ class ReferenceMapping<ReferenceQuadrilateral, TWorldDim>
 		{
 			for(int co = 0; co < ReferenceQuadrilateral::numCorners; ++co)
 				x[co] = vCornerCoord[co];
+
+			m_bAffine = affine();
 		}
 
+	///	returns if mapping is affine for the current corners
+		bool is_linear() const {return m_bAffine;}
+
 	///	map local coordinate to global coordinate
 		void local_to_global(MathVector<worldDim>& globPos,
 							 const MathVector<dim>& locPos) const
@@ -761,8 +785,28 @@ class ReferenceMapping<ReferenceQuadrilateral, TWorldDim>
 				JT(1, i) = b*(x[3][i] - x[0][i]) + locPos[0]*(x[2][i] - x[1][i]);
 		}
 
+	protected:
+		using base_type::affine_coeff_vanishes;
+
+	///	checks if the corners form a parallelogram
+		bool affine() const
+		{
+			MathVector<worldDim> e1, e3, c;
+			VecSubtract(e1, x[1], x[0]);
+			VecSubtract(e3, x[3], x[0]);
+			const number sizeSq = std::max(VecTwoNormSq(e1), VecTwoNormSq(e3));
+
+		//	coefficient of the bilinear term: x0 - x1 + x2 - x3
+			VecSubtract(c, x[2], x[3]);
+			VecSubtract(c, c, e1);
+			return affine_coeff_vanishes(c, sizeSq);
+		}
+
 	private:
 		MathVector<worldDim> x[ReferenceQuadrilateral::numCorners];
+
+	///	flag if current corners give an affine mapping
+		bool m_bAffine;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -990,7 +1034,7 @@ class ReferenceMapping<ReferencePrism, TWorldDim>
 
 	public:
 	///	Default Constructor
-		ReferenceMapping() {}
+		ReferenceMapping() : m_bAffine(false) {}
 
 	///	Constructor setting the corners
 	/// \{
@@ -1011,8 +1055,13 @@ class ReferenceMapping<ReferencePrism, TWorldDim>
 		{
 			for(int co = 0; co < ReferencePrism::numCorners; ++co)
 				x[co] = vCornerCoord[co];
+
+			m_bAffine = affine();
 		}
 
+	///	returns if mapping is affine for the current corners
+		bool is_linear() const {return m_bAffine;}
+
 	///	map local coordinate to global coordinate
 		void local_to_global(MathVector<worldDim>& globPos,
 							 const MathVector<dim>& locPos) const
@@ -1049,8 +1098,30 @@ class ReferenceMapping<ReferencePrism, TWorldDim>
 			}
 		}
 
+	protected:
+		using base_type::affine_coeff_vanishes;
+
+	///	checks if the top triangle is a translation of the bottom triangle
+		bool affine() const
+		{
+			MathVector<worldDim> c;
+			number sizeSq = 0.0;
+			for(int co = 1; co < 4; ++co)
+				sizeSq = std::max(sizeSq, VecDistanceSq(x[co], x[0]));
+
+		//	coefficients of the mixed terms: x0 - x1 - x3 + x4, x0 - x2 - x3 + x5
+			for(int d = 0; d < worldDim; ++d) c[d] = x[0][d]-x[1][d]-x[3][d]+x[4][d];
+			if(!affine_coeff_vanishes(c, sizeSq)) return false;
+
+			for(int d = 0; d < worldDim; ++d) c[d] = x[0][d]-x[2][d]-x[3][d]+x[5][d];
+			return affine_coeff_vanishes(c, sizeSq);
+		}
+
 	private:
 		MathVector<worldDim> x[ReferencePrism::numCorners];
+
+	///	flag if current corners give an affine mapping
+		bool m_bAffine;
 };
 
 
@@ -1084,7 +1155,7 @@ class ReferenceMapping<ReferenceHexahedron, TWorldDim>
 
 	public:
 	///	Default Constructor
-		ReferenceMapping() {}
+		ReferenceMapping() : m_bAffine(false) {}
 
 	///	Constructor setting the corners
 	/// \{
@@ -1105,8 +1176,13 @@ class ReferenceMapping<ReferenceHexahedron, TWorldDim>
 		{
 			for(int co = 0; co < ReferenceHexahedron::numCorners; ++co)
 				x[co] = vCornerCoord[co];
+
+			m_bAffine = affine();
 		}
 
+	///	returns if mapping is affine for the current corners
+		bool is_linear() const {return m_bAffine;}
+
 	///	map local coordinate to global coordinate
 		void local_to_global(MathVector<worldDim>& globPos,
 							 const MathVector<dim>& locPos) const
@@ -1162,8 +1238,38 @@ class ReferenceMapping<ReferenceHexahedron, TWorldDim>
 						+ a2*(x[6][d]-x[2][d])+a3*(x[7][d]-x[3][d]);
 		}
 
+	protected:
+		using base_type::affine_coeff_vanishes;
+
+	///	checks if the corners form a parallelepiped
+		bool affine() const
+		{
+			MathVector<worldDim> c;
+			number sizeSq = 0.0;
+			sizeSq = std::max(sizeSq, VecDistanceSq(x[1], x[0]));
+			sizeSq = std::max(sizeSq, VecDistanceSq(x[3], x[0]));
+			sizeSq = std::max(sizeSq, VecDistanceSq(x[4], x[0]));
+
+		//	coefficients of the mixed terms xy, xz, yz and xyz
+			for(int d = 0; d < worldDim; ++d) c[d] = x[0][d]-x[1][d]+x[2][d]-x[3][d];
+			if(!affine_coeff_vanishes(c, sizeSq)) return false;
+
+			for(int d = 0; d < worldDim; ++d) c[d] = x[0][d]-x[1][d]-x[4][d]+x[5][d];
+			if(!affine_coeff_vanishes(c, sizeSq)) return false;
+
+			for(int d = 0; d < worldDim; ++d) c[d] = x[0][d]-x[3][d]-x[4][d]+x[7][d];
+			if(!affine_coeff_vanishes(c, sizeSq)) return false;
+
+			for(int d = 0; d < worldDim; ++d)
+				c[d] = -x[0][d]+x[1][d]-x[2][d]+x[3][d]+x[4][d]-x[5][d]+x[6][d]-x[7][d];
+			return affine_coeff_vanishes(c, sizeSq);
+		}
+
 	private:
 		MathVector<worldDim> x[ReferenceHexahedron::numCorners];
+
+	///	flag if current corners give an affine mapping
+		bool m_bAffine;
 };
 
 ///////////////////////////////////////////////////////////////////////////////
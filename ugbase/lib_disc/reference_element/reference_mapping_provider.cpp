@@ -52,7 +52,7 @@ class DimReferenceMappingWrapper
 
 	public:
 	///	returns if mapping is affine
-		virtual bool is_linear() const {return TRefMapping::isLinear;}
+		virtual bool is_linear() const {return TRefMapping::is_linear();}
 
 	///	refresh mapping for new set of corners
 		virtual void update(const MathVector<worldDim>* vCorner)
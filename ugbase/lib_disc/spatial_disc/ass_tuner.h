@@ -150,6 +150,9 @@ class AssemblingTuner
 	 */
 		void set_marker(BoolMarker* mark = NULL){ m_pBoolMarker = mark; }
 
+	///	returns if a marker is used to exclude elements from assembling
+		bool marker_used() const {return (m_pBoolMarker != NULL);}
+
 	///	sets a selector of elements for assembling
 	/**
 	 * This methods sets an element list. Only elements of this list will be
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ *
+ * This file is part of UG4.
+ *
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ *
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ *
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__AFFINE_MAPPING_CACHE__
+#define __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__AFFINE_MAPPING_CACHE__
+
+#include <vector>
+
+#include "common/common.h"
+#include "common/math/ugmath.h"
+#include "common/util/message_hub.h"
+#include "lib_grid/multi_grid.h"
+#include "lib_grid/lib_grid_messages.h"
+#include "lib_grid/grid_objects/grid_dim_traits.h"
+#include "lib_disc/reference_element/reference_mapping_provider.h"
+
+namespace ug{
+
+/// Per-element cache of the Jacobian data of affine elements
+/**
+ * For elements with an affine reference mapping (simplices, parallelograms,
+ * parallelepipeds, ...) the transposed inverse of the Jacobian and its
+ * determinant do not depend on the integration point. This class computes
+ * these quantities once for all elements of a grid and stores them in a grid
+ * attachment, such that they can be reused by subsequent assemblies.
+ *
+ * The data are invalidated when the grid has been adapted, loaded or
+ * distributed and when the vertex positions have been changed (see
+ * GridMessage_PositionsChanged). They are recomputed on the next call of
+ * update. Elements created without such a message are reported as not
+ * cached, since their attachment entry is not marked as affine.
+ *
+ * During an assembly the cache of the assembled domain is made active by an
+ * AffineMappingCacheScope. The finite element and finite volume geometries
+ * then take the Jacobian data from the active cache via lookup() instead
+ * of recomputing them. A cache is only activated if all elements of the
+ * grid are affine.
+ *
+ * \tparam	TWorldDim	world dimension
+ * \tparam	TDim		dimension of the cached elements
+ */
+template <int TWorldDim, int TDim = TWorldDim>
+class AffineMappingCache
+{
+	public:
+	///	world dimension
+		static const int worldDim = TWorldDim;
+
+	///	element dimension
+		static const int dim = TDim;
+
+	///	element type
+		typedef typename grid_dim_traits<dim>::grid_base_object elem_type;
+
+	///	cached data per element
+		struct Entry
+		{
+			Entry() : detJ(0.0), affine(false) {}
+
+		///	transposed inverse of the Jacobian
+			MathMatrix<worldDim,dim> JTInv;
+
+		///	determinant (sqrt of gram determinant) of the Jacobian
+			number detJ;
+
+		///	flag if entry is valid
+			bool affine;
+		};
+
+	///	attachment type
+		typedef Attachment<Entry> AEntry;
+
+	///	position accessor type
+		typedef Grid::VertexAttachmentAccessor<Attachment<MathVector<worldDim> > >
+			position_accessor_type;
+
+	public:
+	///	constructor, registers the cache at the message hub of the grid
+		AffineMappingCache(SmartPtr<MultiGrid> spGrid)
+			: m_spGrid(spGrid), m_bValid(false), m_numElem(0), m_numAffine(0)
+		{
+			SPMessageHub msgHub = m_spGrid->message_hub();
+			m_spAdaptionCallbackID = msgHub->register_class_callback(this,
+								&AffineMappingCache::grid_adaption_callback);
+			m_spCreationCallbackID = msgHub->register_class_callback(this,
+								&AffineMappingCache::grid_creation_callback);
+			m_spDistributionCallbackID = msgHub->register_class_callback(this,
+								&AffineMappingCache::grid_distribution_callback);
+			m_spPositionsCallbackID = msgHub->register_class_callback(this,
+								&AffineMappingCache::positions_changed_callback);
+		}
+
+	///	destructor
+		~AffineMappingCache()
+		{
+			if(active() == this) set_active(NULL);
+			if(m_spGrid->template has_attachment<elem_type>(m_aEntry))
+				m_spGrid->template detach_from<elem_type>(m_aEntry);
+		}
+
+	///	computes the data for all elements of the grid, if invalid
+		void update(const position_accessor_type& aaPos)
+		{
+			if(m_bValid) return;
+
+			if(!m_spGrid->template has_attachment<elem_type>(m_aEntry))
+				m_spGrid->template attach_to<elem_type>(m_aEntry);
+			m_aaEntry.access(*m_spGrid, m_aEntry);
+
+			MathVector<dim> locPos; VecSet(locPos, 0.0);
+			std::vector<MathVector<worldDim> > vCorner;
+
+			m_numElem = m_numAffine = 0;
+			typedef typename Grid::traits<elem_type>::iterator iter_type;
+			iter_type iterEnd = m_spGrid->template end<elem_type>();
+			for(iter_type iter = m_spGrid->template begin<elem_type>();
+					iter != iterEnd; ++iter)
+			{
+				elem_type* elem = *iter;
+				Entry& entry = m_aaEntry[elem];
+				++m_numElem;
+
+				Grid::traits<Vertex>::secure_container vrts;
+				m_spGrid->associated_elements_sorted(vrts, elem);
+				vCorner.resize(vrts.size());
+				for(size_t i = 0; i < vrts.size(); ++i)
+					vCorner[i] = aaPos[vrts[i]];
+
+				try{
+				DimReferenceMapping<dim, worldDim>& rMapping
+					= ReferenceMappingProvider::get<dim, worldDim>
+						(elem->reference_object_id(), &vCorner[0]);
+
+				entry.affine = rMapping.is_linear();
+				if(!entry.affine) continue;
+
+				entry.detJ = rMapping.jacobian_transposed_inverse(entry.JTInv, locPos);
+				}
+				UG_CATCH_THROW("AffineMappingCache::update: Cannot compute "
+								"mapping for element.");
+
+				++m_numAffine;
+			}
+
+			m_bValid = true;
+		}
+
+	///	marks the data as outdated, they are recomputed on the next update
+		void invalidate()
+		{
+			m_bValid = false;
+			if(m_aaEntry.valid()){
+				typedef typename Grid::traits<elem_type>::iterator iter_type;
+				iter_type iterEnd = m_spGrid->template end<elem_type>();
+				for(iter_type iter = m_spGrid->template begin<elem_type>();
+						iter != iterEnd; ++iter)
+					m_aaEntry[*iter].affine = false;
+			}
+		}
+
+	///	returns if data are up to date
+		bool valid() const {return m_bValid;}
+
+	///	returns if all elements have been affine at the last update
+		bool all_affine() const {return m_bValid && m_numAffine == m_numElem;}
+
+	///	number of elements considered in the last update
+		size_t num_elem() const {return m_numElem;}
+
+	///	number of affine elements found in the last update
+		size_t num_affine() const {return m_numAffine;}
+
+	///	returns if data for the element is cached
+	/**
+	 * The element must be part of the grid of the cache.
+	 */
+		bool affine(GridObject* elem) const
+		{
+			if(!m_bValid || elem->base_object_id() != dim) return false;
+			return m_aaEntry[static_cast<elem_type*>(elem)].affine;
+		}
+
+	///	returns transposed inverse of the Jacobian of an affine element
+		const MathMatrix<worldDim,dim>& jacobian_transposed_inverse(GridObject* elem) const
+		{
+			UG_ASSERT(affine(elem), "No cached data for element.");
+			return m_aaEntry[static_cast<elem_type*>(elem)].JTInv;
+		}
+
+	///	returns determinant of the Jacobian of an affine element
+		number sqrt_gram_det(GridObject* elem) const
+		{
+			UG_ASSERT(affine(elem), "No cached data for element.");
+			return m_aaEntry[static_cast<elem_type*>(elem)].detJ;
+		}
+
+	public:
+	///	returns the cache of the currently assembled grid (or NULL)
+		static const AffineMappingCache* active() {return active_ptr();}
+
+	///	sets the cache of the currently assembled grid (NULL to disable)
+		static void set_active(const AffineMappingCache* pCache) {active_ptr() = pCache;}
+
+	///	copies the cached data of an element from the active cache
+	/**
+	 * \returns	false if no cache is active or the element is not cached
+	 */
+		static bool lookup(GridObject* elem, MathMatrix<worldDim,dim>& JTInv,
+		                   number& detJ)
+		{
+			const AffineMappingCache* pCache = active();
+			if(pCache == NULL || !pCache->affine(elem)) return false;
+
+			const Entry& entry = pCache->m_aaEntry[static_cast<elem_type*>(elem)];
+			JTInv = entry.JTInv;
+			detJ = entry.detJ;
+			return true;
+		}
+
+	protected:
+		static const AffineMappingCache*& active_ptr()
+		{
+			static const AffineMappingCache* s_pActive = NULL;
+			return s_pActive;
+		}
+
+		void grid_adaption_callback(const GridMessage_Adaption& msg)
+		{
+			if(msg.adaption_ends()) invalidate();
+		}
+
+		void grid_creation_callback(const GridMessage_Creation& msg)
+		{
+			if(msg.msg() == GMCT_CREATION_STOPS) invalidate();
+		}
+
+		void grid_distribution_callback(const GridMessage_Distribution& msg)
+		{
+			if(msg.msg() == GMDT_DISTRIBUTION_STOPS) invalidate();
+		}
+
+		void positions_changed_callback(const GridMessage_PositionsChanged&)
+		{
+			invalidate();
+		}
+
+	protected:
+	///	grid the data is attached to
+		SmartPtr<MultiGrid> m_spGrid;
+
+	///	attachment and accessor
+		AEntry m_aEntry;
+		Grid::AttachmentAccessor<elem_type, AEntry> m_aaEntry;
+
+	///	flag if data are up to date
+		bool m_bValid;
+
+	///	number of elements and number of affine elements
+		size_t m_numElem, m_numAffine;
+
+	///	callbacks of the message hub
+		MessageHub::SPCallbackId m_spAdaptionCallbackID;
+		MessageHub::SPCallbackId m_spCreationCallbackID;
+		MessageHub::SPCallbackId m_spDistributionCallbackID;
+		MessageHub::SPCallbackId m_spPositionsCallbackID;
+};
+
+
+///	activates the affine mapping cache of a domain for the lifetime of the object
+/**
+ * The cache of the domain is brought up to date and made active, if all
+ * full-dimensional elements of the domain are affine. The previously active
+ * cache is restored on destruction. For elements of lower dimension than the
+ * domain (manifold elements) no cache is used.
+ *
+ * \tparam	TWorldDim	world dimension
+ * \tparam	TDim		dimension of the assembled elements
+ */
+template <int TWorldDim, int TDim>
+class AffineMappingCacheScope
+{
+	public:
+		template <typename TDomain>
+		AffineMappingCacheScope(const TDomain&) {}
+};
+
+template <int TWorldDim>
+class AffineMappingCacheScope<TWorldDim, TWorldDim>
+{
+	public:
+		typedef AffineMappingCache<TWorldDim, TWorldDim> cache_type;
+
+		template <typename TDomain>
+		AffineMappingCacheScope(const TDomain& dom)
+			: m_pPrevious(cache_type::active())
+		{
+			const cache_type& cache = *dom.affine_mapping_cache();
+			cache_type::set_active(cache.all_affine() ? &cache : NULL);
+		}
+
+		~AffineMappingCacheScope() {cache_type::set_active(m_pPrevious);}
+
+	protected:
+		const cache_type* m_pPrevious;
+};
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__SPATIAL_DISC__DISC_UTIL__AFFINE_MAPPING_CACHE__ */
@@ -44,23 +44,26 @@ namespace ug{
 template <int TWorldDim, int TRefDim>
 DimFEGeometry<TWorldDim,TRefDim>::
 DimFEGeometry() :
-	m_roid(ROID_UNKNOWN), m_quadOrder(0),
+	m_roid(ROID_UNKNOWN), m_pElem(NULL), m_quadOrder(0),
 	m_lfeID(),
-	m_vIPLocal(NULL), m_vQuadWeight(NULL)
+	m_vIPLocal(NULL), m_vQuadWeight(NULL),
+	m_pShapeTable(NULL)
 {}
 
 template <int TWorldDim, int TRefDim>
 DimFEGeometry<TWorldDim,TRefDim>::
 DimFEGeometry(size_t order, LFEID lfeid) :
-	m_roid(ROID_UNKNOWN), m_quadOrder(order), m_lfeID(lfeid),
-	m_vIPLocal(NULL), m_vQuadWeight(NULL)
+	m_roid(ROID_UNKNOWN), m_pElem(NULL), m_quadOrder(order), m_lfeID(lfeid),
+	m_vIPLocal(NULL), m_vQuadWeight(NULL),
+	m_pShapeTable(NULL)
 {}
 
 template <int TWorldDim, int TRefDim>
 DimFEGeometry<TWorldDim,TRefDim>::
 DimFEGeometry(ReferenceObjectID roid, size_t order, LFEID lfeid) :
-	m_roid(roid), m_quadOrder(order), m_lfeID(lfeid),
-	m_vIPLocal(NULL), m_vQuadWeight(NULL)
+	m_roid(roid), m_pElem(NULL), m_quadOrder(order), m_lfeID(lfeid),
+	m_vIPLocal(NULL), m_vQuadWeight(NULL),
+	m_pShapeTable(NULL)
 {}
 
 template <int TWorldDim, int TRefDim>
@@ -83,41 +86,17 @@ update_local(ReferenceObjectID roid, const LFEID& lfeID, size_t orderQuad)
 	m_vIPLocal = quadRule.points();
 	m_vQuadWeight = quadRule.weights();
 
-	}UG_CATCH_THROW("FEGeometry::update: Quadrature Rule error.");
+//	request for precomputed shapes and gradients
+	m_pShapeTable = &ShapeFunctionTableProvider<dim>::get(roid, m_lfeID, quadRule);
+	m_nsh = m_pShapeTable->num_sh();
+
+	}UG_CATCH_THROW("FEGeometry::update: Shape Function error.");
 
 //	resize for number of integration points
 	m_vIPGlobal.resize(m_nip);
 	m_vJTInv.resize(m_nip);
 	m_vDetJ.resize(m_nip);
-
-	m_vvGradGlobal.resize(m_nip);
-	m_vvGradLocal.resize(m_nip);
-	m_vvShape.resize(m_nip);
-
-//	request for trial space
-	try{
-	const LocalShapeFunctionSet<dim>& lsfs
-		 = LocalFiniteElementProvider::get<dim>(roid, m_lfeID);
-
-//	copy shape infos
-	m_nsh = lsfs.num_sh();
-
-//	resize for number of shape functions
-	for(size_t ip = 0; ip < m_nip; ++ip)
-	{
-		m_vvGradGlobal[ip].resize(m_nsh);
-		m_vvGradLocal[ip].resize(m_nsh);
-		m_vvShape[ip].resize(m_nsh);
-	}
-
-//	get all shapes by on call
-	for(size_t ip = 0; ip < m_nip; ++ip)
-	{
-		lsfs.shapes(&(m_vvShape[ip][0]), m_vIPLocal[ip]);
-		lsfs.grads(&(m_vvGradLocal[ip][0]), m_vIPLocal[ip]);
-	}
-
-	}UG_CATCH_THROW("FEGeometry::update: Shape Function error.");
+	m_vGradGlobal.resize(m_nip * m_nsh);
 }
 
 template <int TWorldDim, int TRefDim>
@@ -146,14 +125,29 @@ update(GridObject* pElem, const MathVector<worldDim>* vCorner,
 	map.local_to_global(&(m_vIPGlobal[0]), &(m_vIPLocal[0]), m_nip);
 
 // 	compute transformation inverse and determinate at ip
-	map.jacobian_transposed_inverse(&(m_vJTInv[0]), &(m_vDetJ[0]),
-	                                &(m_vIPLocal[0]), m_nip);
+	MathMatrix<worldDim,dim> JTInv; number detJ;
+	if(AffineMappingCache<worldDim,dim>::lookup(pElem, JTInv, detJ))
+	{
+	//	use cached data of affine element
+		for(size_t ip = 0; ip < m_nip; ++ip){
+			m_vJTInv[ip] = JTInv;
+			m_vDetJ[ip] = detJ;
+		}
+	}
+	else
+		map.jacobian_transposed_inverse(&(m_vJTInv[0]), &(m_vDetJ[0]),
+		                                &(m_vIPLocal[0]), m_nip);
 
 // 	compute global gradients
 	for(size_t ip = 0; ip < m_nip; ++ip)
+	{
+		const MathVector<dim>* vLocGrad = m_pShapeTable->local_grads(ip);
+		MathVector<worldDim>* vGlobGrad = &m_vGradGlobal[ip * m_nsh];
+		const MathMatrix<worldDim,dim>& JTInv = m_vJTInv[ip];
+
 		for(size_t sh = 0; sh < m_nsh; ++sh)
-			MatVecMult(m_vvGradGlobal[ip][sh],
-			           m_vJTInv[ip], m_vvGradLocal[ip][sh]);
+			MatVecMult(vGlobGrad[sh], JTInv, vLocGrad[sh]);
+	}
 
 	}UG_CATCH_THROW("FEGeometry::update: Reference Mapping error.");
 }
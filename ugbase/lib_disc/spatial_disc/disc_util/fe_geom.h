@@ -36,6 +36,8 @@
 #include "lib_grid/tools/subset_handler_interface.h"
 #include "lib_disc/quadrature/quadrature.h"
 #include "lib_disc/local_finite_element/local_finite_element_provider.h"
+#include "lib_disc/local_finite_element/shape_function_table.h"
+#include "affine_mapping_cache.h"
 #include "lib_disc/reference_element/reference_mapping_provider.h"
 #include "lib_disc/reference_element/reference_mapping.h"
 #include "common/util/provider.h"
@@ -237,25 +239,44 @@ class DimFEGeometry
 	/// shape function at ip
 		number shape(size_t ip, size_t sh) const
 		{
-			UG_ASSERT(ip < m_vvShape.size(), "Wrong index");
-			UG_ASSERT(sh < m_vvShape[ip].size(), "Wrong index");
-			return m_vvShape[ip][sh];
+			UG_ASSERT(m_pShapeTable != NULL, "Local data not prepared");
+			return m_pShapeTable->shape(ip, sh);
+		}
+
+	/// shape functions at ip (size: num_sh)
+		const number* shape_vector(size_t ip) const
+		{
+			UG_ASSERT(m_pShapeTable != NULL, "Local data not prepared");
+			return m_pShapeTable->shapes(ip);
 		}
 
 	/// local gradient at ip
 		const MathVector<dim>& local_grad(size_t ip, size_t sh) const
 		{
-			UG_ASSERT(ip < m_vvGradLocal.size(), "Wrong index");
-			UG_ASSERT(sh < m_vvGradLocal[ip].size(), "Wrong index");
-			return m_vvGradLocal[ip][sh];
+			UG_ASSERT(m_pShapeTable != NULL, "Local data not prepared");
+			return m_pShapeTable->local_grad(ip, sh);
+		}
+
+	/// local gradients at ip (size: num_sh)
+		const MathVector<dim>* local_grad_vector(size_t ip) const
+		{
+			UG_ASSERT(m_pShapeTable != NULL, "Local data not prepared");
+			return m_pShapeTable->local_grads(ip);
 		}
 
 	/// global gradient at ip
 		const MathVector<worldDim>& global_grad(size_t ip, size_t sh) const
 		{
-			UG_ASSERT(ip < m_vvGradGlobal.size(), "Wrong index");
-			UG_ASSERT(sh < m_vvGradGlobal[ip].size(), "Wrong index");
-			return m_vvGradGlobal[ip][sh];
+			UG_ASSERT(ip < m_nip, "Wrong index");
+			UG_ASSERT(sh < m_nsh, "Wrong index");
+			return m_vGradGlobal[ip * m_nsh + sh];
+		}
+
+	/// global gradients at ip (size: num_sh)
+		const MathVector<worldDim>* global_grad_vector(size_t ip) const
+		{
+			UG_ASSERT(ip < m_nip, "Wrong index");
+			return &m_vGradGlobal[ip * m_nsh];
 		}
 
 	/// update Geometry for roid
@@ -457,14 +478,11 @@ class DimFEGeometry
 	///	number of shape functions
 		size_t m_nsh;
 
-	///	shape functions evaluated at ip (size = nip x nsh)
-		std::vector<std::vector<number> > m_vvShape;
-
-	///	global gradient evaluated at ip (size = nip x nsh)
-		std::vector<std::vector<MathVector<dim> > > m_vvGradLocal;
+	///	shared table of shapes and local gradients at ip
+		const ShapeFunctionTable<dim>* m_pShapeTable;
 
-	///	local gradient evaluated at ip (size = nip x nsh)
-		std::vector<std::vector<MathVector<worldDim> > > m_vvGradGlobal;
+	///	global gradient evaluated at ip (size = nip x nsh, row-major)
+		std::vector<MathVector<worldDim> > m_vGradGlobal;
 };
 
 } // end namespace ug
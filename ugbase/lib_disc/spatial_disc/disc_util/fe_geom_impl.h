@@ -94,9 +94,18 @@ update(GridObject* elem, const MathVector<worldDim>* vCorner,
 //	compute global integration points
 	m_mapping.local_to_global(&m_vIPGlobal[0], local_ips(), nip);
 
-//	evaluate global data
-	m_mapping.jacobian_transposed_inverse(&m_vJTInv[0], &m_vDetJ[0],
-	                                      local_ips(), nip);
+//	evaluate global data (taken from the cache for affine elements)
+	MathMatrix<worldDim,dim> JTInv; number detJ;
+	if(AffineMappingCache<worldDim,dim>::lookup(pElem, JTInv, detJ))
+	{
+		for(size_t ip = 0; ip < nip; ++ip){
+			m_vJTInv[ip] = JTInv;
+			m_vDetJ[ip] = detJ;
+		}
+	}
+	else
+		m_mapping.jacobian_transposed_inverse(&m_vJTInv[0], &m_vDetJ[0],
+		                                      local_ips(), nip);
 
 // 	compute global gradients
 	for(size_t ip = 0; ip < nip; ++ip)
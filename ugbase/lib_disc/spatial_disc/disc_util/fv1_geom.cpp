@@ -994,12 +994,17 @@ update(GridObject* elem, const MathVector<worldDim>* vCornerCoords, const ISubse
 // 	Shapes and Derivatives
 	m_mapping.update(vCornerCoords);
 
-//	if mapping is linear, compute jacobian only once and copy
-	if(ReferenceMapping<ref_elem_type, worldDim>::isLinear)
+//	if mapping is linear, compute jacobian only once (or take it from the
+//	cache of affine elements) and copy
+	MathMatrix<worldDim,dim> JtInv;
+	number detJ;
+	const bool bCached = AffineMappingCache<worldDim,dim>::lookup(elem, JtInv, detJ);
+	if(bCached || m_mapping.is_linear())
 	{
-		MathMatrix<worldDim,dim> JtInv;
-		m_mapping.jacobian_transposed_inverse(JtInv, m_vSCVF[0].local_ip());
-		const number detJ = m_mapping.sqrt_gram_det(m_vSCVF[0].local_ip());
+		if(!bCached){
+			m_mapping.jacobian_transposed_inverse(JtInv, m_vSCVF[0].local_ip());
+			detJ = m_mapping.sqrt_gram_det(m_vSCVF[0].local_ip());
+		}
 
 		for(size_t i = 0; i < num_scvf(); ++i)
 		{
@@ -1505,12 +1510,17 @@ update(GridObject* pElem, const MathVector<worldDim>* vCornerCoords, const ISubs
 	rMapping.update(vCornerCoords);
 
 	//\todo compute with on virt. call
-//	compute jacobian for linear mapping
-	if(rMapping.is_linear())
+//	compute jacobian for linear mapping (or take it from the cache of
+//	affine elements)
+	MathMatrix<worldDim,dim> JtInv;
+	number detJ;
+	const bool bCached = AffineMappingCache<worldDim,dim>::lookup(pElem, JtInv, detJ);
+	if(bCached || rMapping.is_linear())
 	{
-		MathMatrix<worldDim,dim> JtInv;
-		rMapping.jacobian_transposed_inverse(JtInv, m_vSCVF[0].local_ip());
-		const number detJ = rMapping.sqrt_gram_det(m_vSCVF[0].local_ip());
+		if(!bCached){
+			rMapping.jacobian_transposed_inverse(JtInv, m_vSCVF[0].local_ip());
+			detJ = rMapping.sqrt_gram_det(m_vSCVF[0].local_ip());
+		}
 
 		for(size_t i = 0; i < num_scvf(); ++i)
 		{
@@ -52,6 +52,7 @@
 #include "lib_disc/quadrature/gauss/gauss_quad.h"
 #include "fv_util.h"
 #include "fv_geom_base.h"
+#include "affine_mapping_cache.h"
 
 namespace ug{
 
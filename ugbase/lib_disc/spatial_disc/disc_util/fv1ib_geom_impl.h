@@ -683,7 +683,7 @@ update(GridObject* elem, const MathVector<worldDim>* vCornerCoords, const ISubse
 	m_mapping.update(vCornerCoords);
 
 //	if mapping is linear, compute jacobian only once and copy
-	if(ReferenceMapping<ref_elem_type, worldDim>::isLinear)
+	if(m_mapping.is_linear())
 	{
 		MathMatrix<worldDim,dim> JtInv;
 		m_mapping.jacobian_transposed_inverse(JtInv, m_vSCVF[0].local_ip());
@@ -1066,7 +1066,7 @@ update(GridObject* elem, const MathVector<worldDim>* vCornerCoords, const ISubse
 	m_mapping.update(vCornerCoords);
 
 //	compute jacobian for linear mapping
-	if(ReferenceMapping<ref_elem_type, worldDim>::isLinear)
+	if(m_mapping.is_linear())
 	{
 		MathMatrix<worldDim,dim> JtInv;
 		m_mapping.jacobian_transposed_inverse(JtInv, m_vSCVF[0].local_ip());
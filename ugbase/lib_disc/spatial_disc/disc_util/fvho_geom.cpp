@@ -1175,7 +1175,7 @@ update(GridObject* elem, const MathVector<worldDim>* vCornerCoords, const ISubse
 	}
 
 //	if mapping is linear, compute jacobian only once and copy
-	if(ReferenceMapping<ref_elem_type, worldDim>::isLinear)
+	if(m_rMapping.is_linear())
 	{
 		MathMatrix<worldDim,dim> JtInv;
 		m_rMapping.jacobian_transposed_inverse(JtInv, m_vSCVF[0].local_ip(0));
@@ -578,10 +578,30 @@ update(GridObject* elem, const MathVector<worldDim>* vCornerCoords, const ISubse
 	const size_t num_sh = ref_elem_type::numCorners;
 	m_numSh = num_sh;
 
+//	if mapping is linear, compute jacobian only once and copy
+	MathMatrix<worldDim,dim> JtInv;
+	number detJ = 0.0;
+	const bool bCached = AffineMappingCache<worldDim,dim>::lookup(elem, JtInv, detJ);
+	const bool bLinear = bCached || m_rMapping.is_linear();
+	if(bLinear && !bCached)
+	{
+		MathVector<dim> locPos; VecSet(locPos, 0.0);
+		m_rMapping.jacobian_transposed_inverse(JtInv, locPos);
+		detJ = m_rMapping.sqrt_gram_det(locPos);
+	}
+
 	for(size_t i = 0; i < num_scvf(); ++i)
 	{
-		m_rMapping.jacobian_transposed_inverse(m_vSCVF[i].JtInv, m_vSCVF[i].localIP);
-		m_vSCVF[i].detj = m_rMapping.sqrt_gram_det(m_vSCVF[i].localIP);
+		if(bLinear)
+		{
+			m_vSCVF[i].JtInv = JtInv;
+			m_vSCVF[i].detj = detJ;
+		}
+		else
+		{
+			m_rMapping.jacobian_transposed_inverse(m_vSCVF[i].JtInv, m_vSCVF[i].localIP);
+			m_vSCVF[i].detj = m_rMapping.sqrt_gram_det(m_vSCVF[i].localIP);
+		}
 
 		const LocalShapeFunctionSet<ref_elem_type::dim>& TrialSpace =
 				LocalFiniteElementProvider::
@@ -1171,10 +1191,30 @@ update(GridObject* pElem, const MathVector<worldDim>* vCornerCoords, const ISubs
 	const size_t num_sh = TrialSpace.num_sh();
 	m_numSh = num_sh;
 
+//	if mapping is linear, compute jacobian only once and copy
+	MathMatrix<worldDim,dim> JtInv;
+	number detJ = 0.0;
+	const bool bCached = AffineMappingCache<worldDim,dim>::lookup(pElem, JtInv, detJ);
+	const bool bLinear = bCached || m_rMapping->is_linear();
+	if(bLinear && !bCached)
+	{
+		MathVector<dim> locPos; VecSet(locPos, 0.0);
+		m_rMapping->jacobian_transposed_inverse(JtInv, locPos);
+		detJ = m_rMapping->sqrt_gram_det(locPos);
+	}
+
 	for(size_t i = 0; i < num_scvf(); ++i)
 	{
-		m_rMapping->jacobian_transposed_inverse(m_vSCVF[i].JtInv, m_vSCVF[i].localIP);
-		m_vSCVF[i].detj = m_rMapping->sqrt_gram_det(m_vSCVF[i].localIP);
+		if(bLinear)
+		{
+			m_vSCVF[i].JtInv = JtInv;
+			m_vSCVF[i].detj = detJ;
+		}
+		else
+		{
+			m_rMapping->jacobian_transposed_inverse(m_vSCVF[i].JtInv, m_vSCVF[i].localIP);
+			m_vSCVF[i].detj = m_rMapping->sqrt_gram_det(m_vSCVF[i].localIP);
+		}
 
 		m_vSCVF[i].vShape.resize(num_sh);
 		m_vSCVF[i].localGrad.resize(num_sh);
@@ -1192,8 +1232,16 @@ update(GridObject* pElem, const MathVector<worldDim>* vCornerCoords, const ISubs
 	
 	for(size_t i = 0; i < num_scv(); ++i)
 	{
-		m_rMapping->jacobian_transposed_inverse(m_vSCV[i].JtInv, m_vSCVF[i].m_vLocPos[0]);
-		m_vSCVF[i].detj = m_rMapping->sqrt_gram_det(m_vSCV[i].m_vLocPos[0]);
+		if(bLinear)
+		{
+			m_vSCV[i].JtInv = JtInv;
+			m_vSCVF[i].detj = detJ;
+		}
+		else
+		{
+			m_rMapping->jacobian_transposed_inverse(m_vSCV[i].JtInv, m_vSCVF[i].m_vLocPos[0]);
+			m_vSCVF[i].detj = m_rMapping->sqrt_gram_det(m_vSCV[i].m_vLocPos[0]);
+		}
 
 		TrialSpace.shapes(&(m_vSCV[i].vShape[0]), m_vSCV[i].m_vLocPos[0]);
 		TrialSpace.grads(&(m_vSCV[i].localGrad[0]), m_vSCV[i].m_vLocPos[0]);
@@ -44,6 +44,7 @@
 #include "lib_disc/reference_element/reference_element.h"
 #include "lib_disc/local_finite_element/local_finite_element_provider.h"
 #include "fv_util.h"
+#include "affine_mapping_cache.h"
 #include "fv1_geom.h"
 
 namespace ug{
@@ -33,6 +33,9 @@
 #ifndef __H__UG__LIB_DISC__SPATIAL_DISC__DOMAIN_DISC__
 #define __H__UG__LIB_DISC__SPATIAL_DISC__DOMAIN_DISC__
 
+#include <map>
+#include <vector>
+
 // other ug4 modules
 #include "common/common.h"
 #include "common/util/string_util.h"
@@ -476,6 +479,19 @@ public:
 				add(di->constraint(i));
 		}
 
+	///	discards the cached constant mass and stiffness matrices
+	/**
+	 * If all element discretizations declare constant matrices (cf.
+	 * IElemDiscBase::set_constant_matrices), the time-dependent assembling of
+	 * the jacobian and the linear system reuses the matrices assembled in a
+	 * previous call. The matrices are cached separately for each dof
+	 * distribution (e.g. for each level of a multigrid hierarchy). The cache
+	 * is renewed automatically if the approximation space or the set of
+	 * element discretizations changes; this method must be called if the
+	 * parameters of the element discretizations are modified.
+	 */
+		void invalidate_constant_matrices() {m_mConstMat.clear();}
+
 	///	returns number of registered constraints
 		virtual size_t num_constraints() const {return m_vConstraint.size();}
 
@@ -494,6 +510,32 @@ public:
 	///	returns the level dof distribution
 		ConstSmartPtr<DoFDistribution> dd(const GridLevel& gl) const{return m_spApproxSpace->dof_distribution(gl);}
 
+	protected:
+	///	returns if the cached constant mass and stiffness matrices can be used
+		bool constant_matrices_usable() const;
+
+	///	cached constant matrices of one dof distribution
+		struct ConstantMatrices
+		{
+		///	mass and stationary stiffness part (s_a0 = 0)
+			matrix_type MS;
+		///	time-dependent stiffness part (scaled by s_a0)
+			matrix_type A;
+		///	revision of the approximation space and elem discs the matrices are valid for
+			RevisionCounter revision;
+			std::vector<IElemDisc<TDomain>*> vElemDisc;
+		};
+
+	///	returns the constant matrices of the dof distribution, assembles them if necessary
+		const ConstantMatrices& update_constant_matrices(ConstSmartPtr<VectorTimeSeries<vector_type> > vSol,
+		                                                 ConstSmartPtr<DoFDistribution> dd);
+
+	///	assembles the element contributions of the time-dependent jacobian
+		void assemble_jacobian_elem_loop(matrix_type& J,
+		                                 ConstSmartPtr<VectorTimeSeries<vector_type> > vSol,
+		                                 const number s_a0,
+		                                 ConstSmartPtr<DoFDistribution> dd);
+
 	protected:
 	///	vector holding all registered elem discs
 		std::vector<SmartPtr<IElemDisc<TDomain> > > m_vDomainElemDisc;
@@ -515,6 +557,9 @@ public:
 		
 	///	this object provides tools to adapt the assemble routine
 		SmartPtr<AssemblingTuner<TAlgebra> > m_spAssTuner;
+
+	///	cached constant matrices for each dof distribution
+		std::map<const DoFDistribution*, ConstantMatrices> m_mConstMat;
 	
 	private:
 	//---- Auxiliary function templates for the assembling ----//
@@ -36,8 +36,10 @@
 #include "common/profiler/profiler.h"
 #include "domain_disc.h"
 #include "lib_disc/common/groups_util.h"
+#include "lib_disc/dof_manager/element_view.h"
 #include "lib_disc/function_spaces/error_indicator_util.h"
 #include "lib_disc/spatial_disc/subset_assemble_util.h"
+#include "lib_algebra/algebra_common/sparsematrix_util.h"
 #ifdef UG_PARALLEL
 #include "lib_disc/parallelization/parallelization_util.h"
 #endif
@@ -284,9 +286,10 @@ AssembleMassMatrix( const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	else
 	{
 		//	general case: assembling over all elements in subset si
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template AssembleMassMatrix<TElem>
 			(vElemDisc, m_spApproxSpace->domain(), dd,
-				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+				view.begin(), view.end(), si,
 					bNonRegularGrid, M, u, m_spAssTuner);
 	}
 }
@@ -440,9 +443,10 @@ AssembleStiffnessMatrix(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	else
 	{
 		//	general case: assembling over all elements in subset si
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template AssembleStiffnessMatrix<TElem>
 			(vElemDisc, m_spApproxSpace->domain(), dd,
-				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+				view.begin(), view.end(), si,
 					bNonRegularGrid, A, u, m_spAssTuner);
 	}
 }
@@ -620,9 +624,10 @@ AssembleJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	else
 	{
 		//	general case: assembling over all elements in subset si
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template AssembleJacobian<TElem>
 			(vElemDisc, m_spApproxSpace->domain(), dd,
-				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+				view.begin(), view.end(), si,
 					bNonRegularGrid, J, u, m_spAssTuner);
 	}
 }
@@ -805,9 +810,10 @@ AssembleDefect( const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	else
 	{
 		//	general case: assembling over all elements in subset si
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template AssembleDefect<TElem>
 			(vElemDisc, m_spApproxSpace->domain(), dd,
-				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+				view.begin(), view.end(), si,
 					bNonRegularGrid, d, u, m_spAssTuner);
 	}
 }
@@ -962,9 +968,10 @@ AssembleLinear( const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	else
 	{
 		//	general case: assembling over all elements in subset si
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template AssembleLinear<TElem>
 			(vElemDisc, m_spApproxSpace->domain(), dd,
-				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+				view.begin(), view.end(), si,
 					bNonRegularGrid, A, rhs, m_spAssTuner);
 	}
 }
@@ -1117,8 +1124,9 @@ AssembleRhs(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	else
 	{
 		//	general case: assembling over all elements in subset si
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template AssembleRhs<TElem>
-			(vElemDisc, m_spApproxSpace->domain(), dd, dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+			(vElemDisc, m_spApproxSpace->domain(), dd, view.begin(), view.end(), si,
 					bNonRegularGrid, rhs, u, m_spAssTuner);
 	}
 }
@@ -1331,9 +1339,10 @@ PrepareTimestepElem(const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	else
 	{
 		//	general case: assembling over all elements in subset si
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template PrepareTimestepElem<TElem>
 			(vElemDisc, m_spApproxSpace->domain(), dd,
-				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+				view.begin(), view.end(), si,
 					bNonRegularGrid, vSol, m_spAssTuner);
 	}
 }
@@ -1362,15 +1371,6 @@ assemble_jacobian(matrix_type& J,
 //	get current time
 	const number time = vSol->time(0);
 
-//	Union of Subsets
-	SubsetGroup unionSubsets;
-	std::vector<SubsetGroup> vSSGrp;
-
-//	create list of all subsets
-	try{
-		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
-	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
-
 //	preprocess -  modifies the solution, used for computing the defect
 	ConstSmartPtr<VectorTimeSeries<vector_type> > pModifyU = vSol;
 	SmartPtr<VectorTimeSeries<vector_type> > pModifyMemory;
@@ -1387,6 +1387,52 @@ assemble_jacobian(matrix_type& J,
 		} UG_CATCH_THROW("'DomainDiscretization': Cannot modify solution.");
 	}
 
+//	assemble element contributions or reuse the constant matrices
+	if(constant_matrices_usable())
+	{
+		const ConstantMatrices& cm = update_constant_matrices(pModifyU, dd);
+		MatAdd(J, 1.0, cm.MS, s_a0, cm.A);
+	}
+	else
+		assemble_jacobian_elem_loop(J, pModifyU, s_a0, dd);
+
+//	post process
+	try{
+	for(int type = 1; type < CT_ALL; type = type << 1){
+		if(!(m_spAssTuner->constraint_type_enabled(type))) continue;
+		for(size_t i = 0; i < m_vConstraint.size(); ++i)
+			if(m_vConstraint[i]->type() & type)
+			{
+				m_vConstraint[i]->set_ass_tuner(m_spAssTuner);
+				m_vConstraint[i]->adjust_jacobian(J, *pModifyU->solution(0), dd, type, time, pModifyU,s_a0);
+			}
+	}
+	post_assemble_loop(m_vElemDisc);
+	}UG_CATCH_THROW("Cannot adjust jacobian.");
+
+//	Remember parallel storage type
+#ifdef UG_PARALLEL
+	J.set_storage_type(PST_ADDITIVE);
+	J.set_layouts(dd->layouts());
+#endif
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+void DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+assemble_jacobian_elem_loop(matrix_type& J,
+                            ConstSmartPtr<VectorTimeSeries<vector_type> > vSol,
+                            const number s_a0,
+                            ConstSmartPtr<DoFDistribution> dd)
+{
+//	Union of Subsets
+	SubsetGroup unionSubsets;
+	std::vector<SubsetGroup> vSSGrp;
+
+//	create list of all subsets
+	try{
+		CreateSubsetGroups(vSSGrp, unionSubsets, m_vElemDisc, dd->subset_handler());
+	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
+
 //	loop subsets
 	for(size_t i = 0; i < unionSubsets.size(); ++i)
 	{
@@ -1415,33 +1461,33 @@ assemble_jacobian(matrix_type& J,
 		{
 		case 1:
 			this->template AssembleJacobian<RegularEdge>
-				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, pModifyU, s_a0);
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, vSol, s_a0);
 			// When assembling over lower-dim manifolds that contain hanging nodes:
 			this->template AssembleJacobian<ConstrainingEdge>
-				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, pModifyU, s_a0);
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, vSol, s_a0);
 			break;
 		case 2:
 			this->template AssembleJacobian<Triangle>
-				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, pModifyU, s_a0);
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, vSol, s_a0);
 			this->template AssembleJacobian<Quadrilateral>
-				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, pModifyU, s_a0);
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, vSol, s_a0);
 			// When assembling over lower-dim manifolds that contain hanging nodes:
 			this->template AssembleJacobian<ConstrainingTriangle>
-				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, pModifyU, s_a0);
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, vSol, s_a0);
 			this->template AssembleJacobian<ConstrainingQuadrilateral>
-				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, pModifyU, s_a0);
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, vSol, s_a0);
 			break;
 		case 3:
 			this->template AssembleJacobian<Tetrahedron>
-				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, pModifyU, s_a0);
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, vSol, s_a0);
 			this->template AssembleJacobian<Pyramid>
-				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, pModifyU, s_a0);
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, vSol, s_a0);
 			this->template AssembleJacobian<Prism>
-				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, pModifyU, s_a0);
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, vSol, s_a0);
 			this->template AssembleJacobian<Hexahedron>
-				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, pModifyU, s_a0);
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, vSol, s_a0);
 			this->template AssembleJacobian<Octahedron>
-				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, pModifyU, s_a0);
+				(vSubsetElemDisc, dd, si, bNonRegularGrid, J, vSol, s_a0);
 			break;
 		default:
 			UG_THROW("DomainDiscretization::assemble_jacobian (instationary):"
@@ -1452,26 +1498,71 @@ assemble_jacobian(matrix_type& J,
 						" Assembling of elements of Dimension " << dim << " in "
 						" subset "<<si<< " failed.");
 	}
+}
 
-//	post process
-	try{
-	for(int type = 1; type < CT_ALL; type = type << 1){
-		if(!(m_spAssTuner->constraint_type_enabled(type))) continue;
-		for(size_t i = 0; i < m_vConstraint.size(); ++i)
-			if(m_vConstraint[i]->type() & type)
-			{
-				m_vConstraint[i]->set_ass_tuner(m_spAssTuner);
-				m_vConstraint[i]->adjust_jacobian(J, *pModifyU->solution(0), dd, type, time, pModifyU,s_a0);
-			}
+///////////////////////////////////////////////////////////////////////////////
+// Constant Matrices (instationary)
+///////////////////////////////////////////////////////////////////////////////
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+bool DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+constant_matrices_usable() const
+{
+//	all elem discs must declare their matrices constant
+	if(m_vElemDisc.empty()) return false;
+	for(size_t i = 0; i < m_vElemDisc.size(); ++i)
+		if(!m_vElemDisc[i]->constant_matrices()) return false;
+
+//	partial assemblings are not cached
+	if(m_spAssTuner->selected_elements_used()
+		|| m_spAssTuner->marker_used()
+		|| m_spAssTuner->single_index_assembling_enabled())
+		return false;
+
+	return true;
+}
+
+template <typename TDomain, typename TAlgebra, typename TGlobAssembler>
+const typename DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::ConstantMatrices&
+DomainDiscretizationBase<TDomain, TAlgebra, TGlobAssembler>::
+update_constant_matrices(ConstSmartPtr<VectorTimeSeries<vector_type> > vSol,
+                         ConstSmartPtr<DoFDistribution> dd)
+{
+	typedef typename std::map<const DoFDistribution*, ConstantMatrices>::iterator iter_type;
+
+//	check if cached matrices are still valid
+	const RevisionCounter revision = m_spApproxSpace->revision();
+	iter_type iter = m_mConstMat.find(dd.get());
+	if(iter != m_mConstMat.end()
+		&& iter->second.revision == revision
+		&& iter->second.vElemDisc == m_vElemDisc)
+		return iter->second;
+
+	PROFILE_FUNC_GROUP("discretization");
+
+//	matrices of an outdated approximation space or other elem discs are
+//	discarded, since the dof distributions they belong to may no longer exist
+	for(iter = m_mConstMat.begin(); iter != m_mConstMat.end();){
+		if(iter->second.revision != revision || iter->second.vElemDisc != m_vElemDisc)
+			m_mConstMat.erase(iter++);
+		else
+			++iter;
 	}
-	post_assemble_loop(m_vElemDisc);
-	}UG_CATCH_THROW("Cannot adjust jacobian.");
 
-//	Remember parallel storage type
-#ifdef UG_PARALLEL
-	J.set_storage_type(PST_ADDITIVE);
-	J.set_layouts(dd->layouts());
-#endif
+	ConstantMatrices& cm = m_mConstMat[dd.get()];
+
+//	mass and stationary stiffness part: J(s_a0 = 0)
+	m_spAssTuner->resize(dd, cm.MS);
+	assemble_jacobian_elem_loop(cm.MS, vSol, 0.0, dd);
+
+//	time-dependent stiffness part: J(s_a0 = 1) - J(s_a0 = 0)
+	m_spAssTuner->resize(dd, cm.A);
+	assemble_jacobian_elem_loop(cm.A, vSol, 1.0, dd);
+	MatAdd(cm.A, 1.0, cm.A, -1.0, cm.MS);
+
+//	remember state
+	cm.revision = revision;
+	cm.vElemDisc = m_vElemDisc;
+	return cm;
 }
 
 /**
@@ -1511,9 +1602,10 @@ AssembleJacobian(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	}
 	else
 	{
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template AssembleJacobian<TElem>
 			(vElemDisc, m_spApproxSpace->domain(), dd,
-				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+				view.begin(), view.end(), si,
 					bNonRegularGrid, J, vSol, s_a0, m_spAssTuner);
 	}
 }
@@ -1687,9 +1779,10 @@ AssembleDefect( const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	else
 	{
 		//	general case: assembling over all elements in subset si
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template AssembleDefect<TElem>
 			(vElemDisc, m_spApproxSpace->domain(), dd,
-				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+				view.begin(), view.end(), si,
 					bNonRegularGrid, d, vSol, vScaleMass, vScaleStiff, m_spAssTuner);
 	}
 }
@@ -1714,6 +1807,17 @@ assemble_linear(matrix_type& mat, vector_type& rhs,
 		m_spAssTuner->resize(dd, mat);
 	m_spAssTuner->resize(dd, rhs);
 
+//	reuse the constant matrices (the schemes use s_m0 == 1), such that only
+//	the right-hand side is assembled element-wise
+	const bool bConstMat = !m_spAssTuner->matrix_is_const()
+							&& vScaleMass[0] == 1.0 && constant_matrices_usable();
+	if(bConstMat)
+	{
+		const ConstantMatrices& cm = update_constant_matrices(vSol, dd);
+		MatAdd(mat, 1.0, cm.MS, vScaleStiff[0], cm.A);
+		m_spAssTuner->set_matrix_is_const(true);
+	}
+
 //	Union of Subsets
 	SubsetGroup unionSubsets;
 	std::vector<SubsetGroup> vSSGrp;
@@ -1724,6 +1828,7 @@ assemble_linear(matrix_type& mat, vector_type& rhs,
 	}UG_CATCH_THROW("'DomainDiscretization': Can not create Subset Groups and Union.");
 
 //	loop subsets
+	try{
 	for(size_t i = 0; i < unionSubsets.size(); ++i)
 	{
 	//	get subset
@@ -1788,6 +1893,13 @@ assemble_linear(matrix_type& mat, vector_type& rhs,
 						" Assembling of elements of Dimension " << dim << " in "
 						" subset "<<si<< " failed.");
 	}
+	}
+	catch(...)
+	{
+		if(bConstMat) m_spAssTuner->set_matrix_is_const(false);
+		throw;
+	}
+	if(bConstMat) m_spAssTuner->set_matrix_is_const(false);
 
 //	post process
 	try{
@@ -1853,9 +1965,10 @@ AssembleLinear( const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	else
 	{
 		//	general case: assembling over all elements in subset si
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template AssembleLinear<TElem>
 			(vElemDisc, m_spApproxSpace->domain(), dd,
-				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+				view.begin(), view.end(), si,
 					bNonRegularGrid, A, rhs, vSol, vScaleMass, vScaleStiff, m_spAssTuner);
 	}
 }
@@ -2012,9 +2125,10 @@ AssembleRhs(	const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	else
 	{
 		//	general case: assembling over all elements in subset si
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template AssembleRhs<TElem>
 			(vElemDisc, m_spApproxSpace->domain(), dd,
-				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+				view.begin(), view.end(), si,
 					bNonRegularGrid, rhs, vSol, vScaleMass, vScaleStiff, m_spAssTuner);
 	}
 }
@@ -2350,9 +2464,10 @@ AssembleErrorEstimator(	const std::vector<IElemError<domain_type>*>& vElemDisc,
 						const vector_type& u)
 {
 	//	general case: assembling over all elements in subset si
+	const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 	gass_type::template AssembleErrorEstimator<TElem>
 		(vElemDisc, m_spApproxSpace->domain(), dd,
-			dd->template begin<TElem>(si), dd->template end<TElem>(si),
+			view.begin(), view.end(),
 				si, bNonRegularGrid, u);
 }
 
@@ -2612,9 +2727,10 @@ AssembleErrorEstimator(	const std::vector<IElemError<domain_type>*>& vElemDisc,
 						ConstSmartPtr<VectorTimeSeries<vector_type> > vSol)
 {
 	//	general case: assembling over all elements in subset si
+	const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 	gass_type::template AssembleErrorEstimator<TElem>
 		(vElemDisc, m_spApproxSpace->domain(), dd,
-			dd->template begin<TElem>(si), dd->template end<TElem>(si),
+			view.begin(), view.end(),
 				si, bNonRegularGrid, vScaleMass, vScaleStiff, vSol);
 }
 
@@ -2818,9 +2934,10 @@ FinishTimestepElem(const std::vector<IElemDisc<domain_type>*>& vElemDisc,
 	else
 	{
 		//	general case: assembling over all elements in subset si
+		const ElementView<TElem>& view = dd->template element_view<TElem>(si);
 		gass_type::template FinishTimestepElem<TElem>
 			(vElemDisc, m_spApproxSpace->domain(), dd,
-				dd->template begin<TElem>(si), dd->template end<TElem>(si), si,
+				view.begin(), view.end(), si,
 					bNonRegularGrid, vSol, m_spAssTuner);
 	}
 }
@@ -45,7 +45,9 @@
 #include "./elem_disc_interface.h"
 #include "lib_disc/common/function_group.h"
 #include "lib_disc/common/local_algebra.h"
+#include "lib_disc/dof_manager/element_view.h"
 #include "lib_disc/spatial_disc/user_data/data_evaluator.h"
+#include "lib_disc/spatial_disc/disc_util/affine_mapping_cache.h"
 #include "bridge/util_algebra_dependent.h"
 
 #define PROFILE_ELEM_LOOP
@@ -124,6 +126,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -148,13 +153,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locU.resize(ind); locA.resize(ind);
@@ -231,6 +236,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -256,13 +264,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locU.resize(ind); locM.resize(ind);
@@ -338,6 +346,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -363,13 +374,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locU.resize(ind); locJ.resize(ind);
@@ -451,6 +462,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -486,13 +500,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locU.resize(ind); locJ.resize(ind);
@@ -589,6 +603,9 @@ public:
 	//	check if at least one element exists, else return
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -614,13 +631,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locU.resize(ind); locD.resize(ind); tmpLocD.resize(ind);
@@ -726,6 +743,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -765,13 +785,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locD.resize(ind); tmpLocD.resize(ind);
@@ -914,6 +934,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -943,13 +966,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locRhs.resize(ind); locA.resize(ind);
@@ -1045,6 +1068,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -1084,13 +1110,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locRhs.resize(ind); tmpLocRhs.resize(ind);
@@ -1261,6 +1287,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -1286,13 +1315,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locU.resize(ind); locRhs.resize(ind);
@@ -1375,6 +1404,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -1414,13 +1446,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locRhs.resize(ind); tmpLocRhs.resize(ind);
@@ -1606,6 +1638,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -1639,13 +1674,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locU.resize(ind);
@@ -1755,6 +1790,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -1789,13 +1827,13 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	check if elem is skipped from assembling
 			if(!spAssTuner->element_used(elem)) continue;
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locU.resize(ind);
@@ -1855,6 +1893,9 @@ public:
 	//	check if there are any elements at all, otherwise return immediately
 		if(iterBegin == iterEnd) return;
 
+	//	use cached Jacobians if all elements of the domain are affine
+		AffineMappingCacheScope<domain_type::dim, TElem::dim> affineScope(*spDomain);
+
 	//	reference object id
 		static const ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
 
@@ -1880,10 +1921,10 @@ public:
 			TElem* elem = *iter;
 
 		//	get corner coordinates
-			FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+			ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 		//	get global indices
-			dd->indices(elem, ind, Eval.use_hanging());
+			ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 		//	adapt local algebra
 			locU.resize(ind);
@@ -2004,10 +2045,10 @@ public:
 				TElem* elem = *iter;
 
 			//	get corner coordinates
-				FillCornerCoordinates(vCornerCoords, *elem, *spDomain);
+				ElementCornerCoordinates(vCornerCoords, iter, elem, spDomain->position_accessor());
 
 			//	get global indices
-				dd->indices(elem, ind, Eval.use_hanging());
+				ElementIndices(ind, iter, elem, *dd, Eval.use_hanging());
 
 			//	read local values of time series
 				locTimeSeries.read_values(vSol, ind);
@@ -38,7 +38,8 @@ namespace ug{
 template <typename TDomain>
 IElemDiscBase<TDomain>::IElemDiscBase(const char* functions, const char* subsets)
 	:	m_spApproxSpace(NULL), m_spFctPattern(0),
-	  	m_timePoint(0), m_pLocalVectorTimeSeries(NULL), m_bStationaryForced(false)
+	  	m_timePoint(0), m_pLocalVectorTimeSeries(NULL), m_bStationaryForced(false),
+	  	m_bConstMatrices(false)
 		//,m_id(ROID_UNKNOWN)
 {
 	if(functions == NULL) functions = "";
@@ -54,7 +55,8 @@ IElemDiscBase<TDomain>::
 IElemDiscBase(const std::vector<std::string>& vFct,
                               const std::vector<std::string>& vSubset)
 	: 	m_spApproxSpace(NULL), m_spFctPattern(0),
-		m_timePoint(0), m_pLocalVectorTimeSeries(NULL), m_bStationaryForced(false)
+		m_timePoint(0), m_pLocalVectorTimeSeries(NULL), m_bStationaryForced(false),
+		m_bConstMatrices(false)
 		//,m_id(ROID_UNKNOWN)
 {
 	set_functions(vFct);
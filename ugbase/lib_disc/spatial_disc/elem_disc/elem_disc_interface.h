@@ -649,6 +649,18 @@ class IElemDiscBase
 		void set_stationary(bool bStationaryForced = true) {m_bStationaryForced = bStationaryForced;}
 		void set_stationary() {set_stationary(true);}
 
+	///	sets that the mass and stiffness matrices do not depend on time or solution
+	/**
+	 * If all element discretizations of a domain discretization declare their
+	 * jacobians (mass and stiffness part) as constant, the domain discretization
+	 * assembles them only once and forms the matrices of subsequent time steps
+	 * as a linear combination of the cached parts. The default is false.
+	 */
+		void set_constant_matrices(bool bConstMatrices) {m_bConstMatrices = bConstMatrices;}
+
+	///	returns if the mass and stiffness matrices are constant
+		bool constant_matrices() const {return m_bConstMatrices;}
+
 	///	returns if local time series needed by assembling
 	/**
 	 * This callback must be implemented by a derived Elem Disc in order to handle
@@ -716,6 +728,9 @@ class IElemDiscBase
 	///	flag if stationary assembling is to be used even in instationary assembling
 		bool m_bStationaryForced;
 
+	///	flag if mass and stiffness matrices are time- and solution-independent
+		bool m_bConstMatrices;
+
 	
 
 	////////////////////////////
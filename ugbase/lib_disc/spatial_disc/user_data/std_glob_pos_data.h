@@ -48,6 +48,13 @@ namespace ug{
  *
  * inline TRet evaluate(TData& D, const MathVector<dim>& x, number time, int si) const
  *
+ * Evaluations at several points are forwarded to evaluate_batch, which calls
+ * evaluate for each point by default. A deriving class may implement
+ *
+ * inline void evaluate_batch(TData vValue[], const MathVector<dim> vGlobIP[],
+ *                            number time, int si, const size_t nip) const
+ *
+ * to evaluate all points at once.
  */
 template <typename TImpl, typename TData, int dim, typename TRet = void>
 class StdGlobPosData
@@ -64,6 +71,14 @@ class StdGlobPosData
 		virtual void operator()(TData vValue[],
 								const MathVector<dim> vGlobIP[],
 								number time, int si, const size_t nip) const
+		{
+			this->getImpl().evaluate_batch(vValue, vGlobIP, time, si, nip);
+		}
+
+	///	evaluates the data at nip points. Calls evaluate for each point.
+		inline void evaluate_batch(TData vValue[],
+		                           const MathVector<dim> vGlobIP[],
+		                           number time, int si, const size_t nip) const
 		{
 			for(size_t ip = 0; ip < nip; ++ip)
 				this->getImpl().evaluate(vValue[ip], vGlobIP[ip], time, si);
@@ -80,8 +95,7 @@ class StdGlobPosData
 		                     LocalVector* u,
 		                     const MathMatrix<refDim, dim>* vJT = NULL) const
 		{
-			for(size_t ip = 0; ip < nip; ++ip)
-				this->getImpl().evaluate(vValue[ip],vGlobIP[ip],time,si);
+			this->getImpl().evaluate_batch(vValue, vGlobIP, time, si, nip);
 		}
 
 	///	implement as a UserData
@@ -92,8 +106,8 @@ class StdGlobPosData
 			const int si = this->subset();
 
 			for(size_t s = 0; s < this->num_series(); ++s)
-				for(size_t ip = 0; ip < this->num_ip(s); ++ip)
-					this->getImpl().evaluate(this->value(s,ip), this->ip(s, ip), t, si);
+				this->getImpl().evaluate_batch(this->values(s), this->ips(s), t, si,
+				                               this->num_ip(s));
 		}
 
 	///	implement as a UserData
@@ -103,8 +117,8 @@ class StdGlobPosData
 			const int si = this->subset();
 
 			for(size_t s = 0; s < this->num_series(); ++s)
-				for(size_t ip = 0; ip < this->num_ip(s); ++ip)
-					this->getImpl().evaluate(this->value(s,ip), this->ip(s, ip), this->time(s), si);
+				this->getImpl().evaluate_batch(this->values(s), this->ips(s), this->time(s), si,
+				                               this->num_ip(s));
 		}
 
 	///	returns if data is constant
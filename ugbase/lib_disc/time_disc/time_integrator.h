@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__TIME_DISC__TIME_INTEGRATOR__
+#define __H__UG__LIB_DISC__TIME_DISC__TIME_INTEGRATOR__
+
+// extern libraries
+#include <string>
+#include <vector>
+
+// other ug libraries
+#include "common/common.h"
+
+// modul intern libraries
+#include "lib_disc/assemble_interface.h"
+#include "lib_disc/function_spaces/grid_function.h"
+#include "lib_disc/io/checkpoint.h"
+#include "lib_disc/operator/non_linear_operator/assembled_non_linear_operator.h"
+#include "lib_disc/operator/non_linear_operator/newton_solver/newton.h"
+#include "lib_disc/time_disc/theta_time_step.h"
+
+namespace ug{
+
+/// \ingroup lib_disc_time_assemble
+/// @{
+
+/// time integration with adaptive step size control
+/**
+ * This class performs the time loop for an ITimeDiscretization in C++, i.e.,
+ * it iterates over time steps and stages, solves each stage by a NewtonSolver
+ * and controls the step size based on an estimate of the local error.
+ *
+ * The local error is estimated by comparing the computed solution
+ * \f$ u_{n+1} \f$ to the polynomial extrapolation \f$ u^P_{n+1} \f$ of degree
+ * \f$ p \f$ through the last \f$ p+1 \f$ accepted solutions (predictor-corrector
+ * estimate, exact for BDF(p) with constant steps):
+ * \f[
+ * 	\epsilon = \frac{\Delta t}{t_{n+1} - t_{n-p}} \cdot
+ * 		\frac{\|u_{n+1} - u^P_{n+1}\|}{atol + rtol \cdot \|u_{n+1}\|}
+ * \f]
+ * A step is accepted if \f$ \epsilon \leq 1 \f$. The next step size is chosen
+ * by a PI controller
+ * \f[
+ * 	\Delta t_{new} = \Delta t \cdot s \cdot \epsilon_n^{-k_I/(p+1)}
+ * 		\cdot (\epsilon_{n-1}/\epsilon_n)^{k_P/(p+1)},
+ * \f]
+ * where the factor is limited to \f$ [f_{min}, f_{max}] \f$. If the preceding
+ * attempt of the step was rejected, the factor is additionally limited to 1,
+ * i.e. the step size is not increased. A rejected step is repeated with
+ * \f$ \Delta t \cdot \max(f_{min}, \min(1, s \cdot \epsilon^{-1/(p+1)})) \f$.
+ * As long as not enough accepted solutions are available for the predictor,
+ * the degree is lowered and the first step is accepted without estimate. BDF
+ * schemes are started by increasing the order with the number of available
+ * solutions.
+ *
+ * Rejected steps do not touch the history of accepted solutions, thus nothing
+ * but the stages of the rejected step has to be recomputed. If the step size
+ * of the repetition differs only slightly from the rejected one, the Jacobian
+ * and the preconditioner of the rejected step are reused (see
+ * NewtonSolver::set_reuse_jacobian). If the Newton solver fails, the step size
+ * is reduced. If the step size falls below the minimal step size, the last
+ * accepted solution is restored, an optional checkpoint is written and the
+ * integration is stopped.
+ *
+ * \tparam	TDomain		Domain type
+ * \tparam	TAlgebra	Algebra type
+ */
+template <typename TDomain, typename TAlgebra>
+class AdaptiveTimeIntegrator
+{
+	public:
+	/// Type of algebra
+		typedef TAlgebra algebra_type;
+
+	/// Type of algebra vector
+		typedef typename algebra_type::vector_type vector_type;
+
+	///	Type of grid function
+		typedef GridFunction<TDomain, TAlgebra> grid_function_type;
+
+	///	Type of time discretization
+		typedef ITimeDiscretization<TAlgebra> time_disc_type;
+
+	///	Type of nonlinear solver
+		typedef NewtonSolver<TAlgebra> solver_type;
+
+	public:
+	///	constructor
+		AdaptiveTimeIntegrator(SmartPtr<ITimeDiscretization<TAlgebra> > spTimeDisc,
+		                       SmartPtr<NewtonSolver<TAlgebra> > spSolver);
+
+	///	sets the relative and absolute tolerance for the local error
+		void set_tolerance(number rtol, number atol) {m_rtol = rtol; m_atol = atol;}
+
+	///	sets the order of the error estimator (default: num_prev_steps() of the time disc)
+		void set_error_order(int order) {m_errOrder = order;}
+
+	///	sets the initial step size
+		void set_step_size(number dt) {m_dt = dt;}
+
+	///	sets the minimal step size (default: 1e-6 times the initial step size)
+	/**	Integration stops if the step size falls below this value. Values which
+	 * are not positive select the default.*/
+		void set_min_step_size(number dt) {m_dtMin = dt;}
+
+	///	sets the maximal step size
+		void set_max_step_size(number dt) {m_dtMax = dt;}
+
+	///	sets the safety factor of the step size controller
+		void set_safety_factor(number s) {m_safety = s;}
+
+	///	sets the bounds for the change of the step size within one step
+		void set_step_factor_bounds(number minFac, number maxFac) {m_minFac = minFac; m_maxFac = maxFac;}
+
+	///	sets the integral and proportional gain of the step size controller
+		void set_pi_gains(number kI, number kP) {m_kI = kI; m_kP = kP;}
+
+	///	sets the factor the step size is reduced by if the Newton solver fails
+		void set_reduction_factor(number red) {m_reductionFactor = red;}
+
+	///	sets the relative change of the step size up to which the Jacobian of a rejected step is reused (0 disables)
+		void set_reuse_threshold(number relChange) {m_reuseThreshold = relChange;}
+
+	///	sets if finish_step_elem of the time disc is called for accepted steps
+		void set_finish_step(bool bFinish) {m_bFinishStep = bFinish;}
+
+	///	sets a checkpoint that is written if the step size becomes too small
+	/**	The solution passed to apply must have been added to the checkpoint.*/
+		void set_checkpoint(SmartPtr<Checkpoint<TDomain, TAlgebra> > spCheckpoint,
+		                    const char* filename)
+			{m_spCheckpoint = spCheckpoint; m_checkpointFile = filename;}
+
+	///	integrates from t0 to tEnd, returns false if the step size became too small
+		bool apply(SmartPtr<grid_function_type> spU, number t0, number tEnd);
+
+	///	returns the time of the last accepted solution
+		number time() const {return m_time;}
+
+	///	returns the step size proposed for the next step
+		number step_size() const {return m_dt;}
+
+	///	statistics of the last call to apply
+	/// \{
+		size_t num_accepted_steps() const {return m_numAccepted;}
+		size_t num_rejected_steps() const {return m_numRejected;}
+		size_t num_jacobian_reuses() const {return m_numReuses;}
+	/// \}
+
+	protected:
+	///	performs all stages of one step, returns false if the Newton solver failed
+		bool solve_step(vector_type& u, number dt, number& tNew);
+
+	///	computes the predictor of the given degree at time tNew, returns the estimator scaling
+		number compute_predictor(vector_type& pred, size_t degree, number tNew) const;
+
+	protected:
+		SmartPtr<ITimeDiscretization<TAlgebra> > m_spTimeDisc;	///< time discretization
+		SmartPtr<NewtonSolver<TAlgebra> > m_spSolver;			///< nonlinear solver
+
+		SmartPtr<VectorTimeSeries<vector_type> > m_spSeries;	///< accepted solutions
+		std::vector<SmartPtr<vector_type> > m_vStageSol;		///< intermediate stage solutions
+
+		number m_rtol, m_atol;			///< tolerances for the local error
+		int m_errOrder;					///< order of the estimator (< 0: automatic)
+		number m_dt;					///< (proposed) step size
+		number m_dtMin, m_dtMax;		///< bounds for the step size
+		number m_safety;				///< safety factor of the controller
+		number m_minFac, m_maxFac;		///< bounds for the change of the step size
+		number m_kI, m_kP;				///< gains of the PI controller
+		number m_reductionFactor;		///< reduction if the Newton solver fails
+		number m_reuseThreshold;		///< relative change allowing Jacobian reuse
+		bool m_bFinishStep;				///< call finish_step_elem for accepted steps
+
+		SmartPtr<Checkpoint<TDomain, TAlgebra> > m_spCheckpoint;	///< checkpoint on failure
+		std::string m_checkpointFile;								///< checkpoint filename
+
+		number m_time;					///< time of last accepted solution
+		size_t m_numAccepted, m_numRejected, m_numReuses;
+};
+
+/// @}
+
+} // end namespace ug
+
+// include implementation
+#include "time_integrator_impl.h"
+
+#endif /* __H__UG__LIB_DISC__TIME_DISC__TIME_INTEGRATOR__ */
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__UG__LIB_DISC__TIME_DISC__TIME_INTEGRATOR_IMPL__
+#define __H__UG__LIB_DISC__TIME_DISC__TIME_INTEGRATOR_IMPL__
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "time_integrator.h"
+
+namespace ug{
+
+template <typename TDomain, typename TAlgebra>
+AdaptiveTimeIntegrator<TDomain, TAlgebra>::
+AdaptiveTimeIntegrator(SmartPtr<ITimeDiscretization<TAlgebra> > spTimeDisc,
+                       SmartPtr<NewtonSolver<TAlgebra> > spSolver)
+	: m_spTimeDisc(spTimeDisc), m_spSolver(spSolver),
+	  m_rtol(1e-3), m_atol(1e-6), m_errOrder(-1),
+	  m_dt(0.0), m_dtMin(-1.0), m_dtMax(std::numeric_limits<number>::max()),
+	  m_safety(0.9), m_minFac(0.2), m_maxFac(5.0),
+	  m_kI(0.3), m_kP(0.4),
+	  m_reductionFactor(0.5), m_reuseThreshold(0.2), m_bFinishStep(false),
+	  m_spCheckpoint(NULL),
+	  m_time(0.0), m_numAccepted(0), m_numRejected(0), m_numReuses(0)
+{
+	UG_COND_THROW(m_spTimeDisc.invalid(), "AdaptiveTimeIntegrator: no time discretization passed.");
+	UG_COND_THROW(m_spSolver.invalid(), "AdaptiveTimeIntegrator: no solver passed.");
+}
+
+template <typename TDomain, typename TAlgebra>
+number AdaptiveTimeIntegrator<TDomain, TAlgebra>::
+compute_predictor(vector_type& pred, size_t degree, number tNew) const
+{
+	const VectorTimeSeries<vector_type>& series = *m_spSeries;
+
+//	extrapolate by the Lagrange polynomial through the latest solutions
+	for(size_t i = 0; i <= degree; ++i)
+	{
+		number w = 1.0;
+		for(size_t j = 0; j <= degree; ++j)
+			if(j != i)
+				w *= (tNew - series.time(j)) / (series.time(i) - series.time(j));
+
+		if(i == 0) VecScaleAssign(pred, w, *series.solution(0));
+		else VecScaleAdd(pred, 1.0, pred, w, *series.solution(i));
+	}
+
+	return (tNew - series.time(0)) / (tNew - series.time(degree));
+}
+
+template <typename TDomain, typename TAlgebra>
+bool AdaptiveTimeIntegrator<TDomain, TAlgebra>::
+solve_step(vector_type& u, number dt, number& tNew)
+{
+	const size_t numStages = m_spTimeDisc->num_stages();
+	if(m_vStageSol.size() + 1 < numStages)
+		m_vStageSol.resize(numStages - 1);
+
+	size_t numPushed = 0;
+	bool bConverged = true;
+	for(size_t stage = 1; stage <= numStages; ++stage)
+	{
+		m_spTimeDisc->set_stage(stage);
+		m_spTimeDisc->prepare_step(m_spSeries, dt);
+
+		if(!m_spSolver->apply(u)) {bConverged = false; break;}
+		tNew = m_spTimeDisc->future_time();
+
+	//	intermediate stage solutions are passed as latest solution to the next
+	//	stage. They are removed afterwards, thus the history of accepted
+	//	solutions remains untouched.
+		if(stage < numStages)
+		{
+			SmartPtr<vector_type>& spStage = m_vStageSol[stage-1];
+			if(spStage.invalid()) spStage = u.clone();
+			else VecAssign(*spStage, u);
+			m_spSeries->push(spStage, tNew);
+			++numPushed;
+		}
+	}
+
+	for(size_t i = 0; i < numPushed; ++i)
+		m_spSeries->remove_latest();
+
+	return bConverged;
+}
+
+template <typename TDomain, typename TAlgebra>
+bool AdaptiveTimeIntegrator<TDomain, TAlgebra>::
+apply(SmartPtr<grid_function_type> spU, number t0, number tEnd)
+{
+	PROFILE_BEGIN_GROUP(AdaptiveTimeIntegrator_apply, "discretization AdaptiveTimeIntegrator");
+	UG_COND_THROW(m_dt <= 0.0, "AdaptiveTimeIntegrator: initial step size must be positive.");
+
+//	without a positive lower bound, rejected steps would be reduced forever
+	const number dtMin = (m_dtMin > 0.0) ? m_dtMin : 1e-6 * m_dt;
+
+	vector_type& u = *spU;
+
+//	BDF schemes are started by increasing the order
+	SmartPtr<BDF<TAlgebra> > spBDF = m_spTimeDisc.template cast_dynamic<BDF<TAlgebra> >();
+	const size_t numPrevSteps = m_spTimeDisc->num_prev_steps();
+	const size_t errOrder = (m_errOrder < 0) ? numPrevSteps : (size_t) m_errOrder;
+	const size_t maxHistory = std::max(numPrevSteps, errOrder + 1);
+
+//	history of accepted solutions
+	m_spSeries = make_sp(new VectorTimeSeries<vector_type>());
+	m_spSeries->push(spU->clone(), t0);
+	SmartPtr<vector_type> spPred = spU->clone_without_values();
+	m_vStageSol.clear();
+
+//	the nonlinear problem is given by the time discretization
+	m_spSolver->init(make_sp(new AssembledOperator<TAlgebra>(m_spTimeDisc, spU->grid_level())));
+	m_spSolver->set_reuse_jacobian(false);
+
+	m_time = t0;
+	m_numAccepted = m_numRejected = m_numReuses = 0;
+	number errPrev = -1.0;
+	bool bLastRejected = false;
+	bool bSuccess = true;
+
+	while((tEnd - m_time) > 1e-10 * (tEnd - t0))
+	{
+	//	clip the step to the end time, but keep the proposed step size
+		m_dt = std::min(m_dt, m_dtMax);
+		number dt = m_dt;
+		if(m_time + dt > tEnd || (tEnd - (m_time + dt)) < 1e-8 * dt)
+			dt = tEnd - m_time;
+
+		if(spBDF.valid())
+			spBDF->set_order(std::min(numPrevSteps, m_spSeries->size()));
+		const size_t degree = std::min(errOrder, m_spSeries->size() - 1);
+
+		const bool bReused = m_spSolver->reuse_jacobian();
+		if(bReused) ++m_numReuses;
+
+		number tNew = m_time + dt;
+		const bool bConverged = solve_step(u, dt, tNew);
+		m_spSolver->set_reuse_jacobian(false);
+
+	//	Newton failed: retry with a fresh Jacobian, then with a smaller step
+		if(!bConverged)
+		{
+			VecAssign(u, *m_spSeries->latest());
+			if(bReused)
+			{
+				UG_LOG("++++++ Newton solver failed with reused Jacobian, reassembling.\n");
+				continue;
+			}
+
+			++m_numRejected;
+			bLastRejected = true;
+			m_dt = dt * m_reductionFactor;
+			UG_LOG("++++++ Newton solver failed. Trying decreased step size " << m_dt << ".\n");
+			if(m_dt < dtMin) {bSuccess = false; break;}
+			continue;
+		}
+
+	//	estimate the local error by the predictor
+		number err = 0.0;
+		if(degree > 0)
+		{
+			const number scale = compute_predictor(*spPred, degree, tNew);
+			VecScaleAdd(*spPred, 1.0, u, -1.0, *spPred);
+			err = scale * spPred->norm() / (m_atol + m_rtol * u.norm());
+			err = std::max(err, 1e-10);
+		}
+		const number k = degree + 1;
+
+	//	reject step: repeat with a smaller step size
+		if(err > 1.0)
+		{
+			++m_numRejected;
+			bLastRejected = true;
+
+			number fac = m_safety * std::pow(err, -1.0 / k);
+			fac = std::max(m_minFac, std::min(fac, 1.0));
+			m_dt = dt * fac;
+
+		//	the Jacobian of the rejected step is a good approximation if the
+		//	step size changes only slightly
+			m_spSolver->set_reuse_jacobian(std::fabs(fac - 1.0) <= m_reuseThreshold);
+
+			UG_LOG("++++++ Step rejected (time: " << m_time << ", dt: " << dt
+			       << ", est. error: " << err << "). Trying step size " << m_dt << ".\n");
+
+			VecAssign(u, *m_spSeries->latest());
+			if(m_dt < dtMin) {bSuccess = false; break;}
+			continue;
+		}
+
+	//	accept step
+		++m_numAccepted;
+		m_time = tNew;
+
+		if(m_spSeries->size() < maxHistory)
+			m_spSeries->push(spU->clone(), m_time);
+		else
+		{
+			SmartPtr<vector_type> spOldest = m_spSeries->oldest();
+			VecAssign(*spOldest, u);
+			m_spSeries->push_discard_oldest(spOldest, m_time);
+		}
+
+		if(m_bFinishStep)
+			m_spTimeDisc->finish_step_elem(m_spSeries, spU->grid_level());
+
+		UG_LOG("++++++ TIMESTEP " << m_numAccepted << " accepted (time: " << m_time
+		       << ", dt: " << dt << ", est. error: " << err << ").\n");
+
+	//	PI controller for the next step size, no increase directly after a rejection
+		if(degree > 0)
+		{
+			number fac = m_safety * std::pow(err, -m_kI / k);
+			if(errPrev > 0.0) fac *= std::pow(errPrev / err, m_kP / k);
+			if(bLastRejected) fac = std::min(fac, 1.0);
+			fac = std::max(m_minFac, std::min(fac, m_maxFac));
+			m_dt = std::min(dt * fac, m_dtMax);
+			errPrev = err;
+		}
+		bLastRejected = false;
+	}
+
+	if(spBDF.valid())
+		spBDF->set_order(numPrevSteps);
+
+	if(!bSuccess)
+	{
+		UG_LOG("++++++ Time step size " << m_dt << " below minimal step size "
+		       << dtMin << ". Stopping at time " << m_time << ".\n");
+
+		if(m_spCheckpoint.valid())
+		{
+			UG_LOG("++++++ Writing checkpoint '" << m_checkpointFile << "'.\n");
+			m_spCheckpoint->write(*spU->domain(), m_checkpointFile.c_str());
+		}
+	}
+
+	return bSuccess;
+}
+
+} // end namespace ug
+
+#endif /* __H__UG__LIB_DISC__TIME_DISC__TIME_INTEGRATOR_IMPL__ */
@@ -0,0 +1,1032 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <algorithm>
+#include <queue>
+#include <utility>
+#include "multilevel_graph_partitioner.h"
+#include "common/error.h"
+
+using namespace std;
+
+namespace ug{
+
+////////////////////////////////////////////////////////////////////////////////
+//	helpers
+////////////////////////////////////////////////////////////////////////////////
+static int TotalVertexWeight(const WeightedGraph& g)
+{
+	const int numVrts = g.num_vertices();
+	if(g.vrtWeights.empty())
+		return numVrts;
+
+	int total = 0;
+	for(int i = 0; i < numVrts; ++i)
+		total += g.vrtWeights[i];
+	return total;
+}
+
+static int MaxVertexWeight(const WeightedGraph& g)
+{
+	int maxWeight = 0;
+	for(int i = 0; i < g.num_vertices(); ++i)
+		maxWeight = max(maxWeight, g.vertex_weight(i));
+	return maxWeight;
+}
+
+///	a deterministic permutation of 0, ..., num-1
+static void PseudoRandomOrder(vector<int>& orderOut, int num, unsigned int seed)
+{
+	orderOut.resize(num);
+	for(int i = 0; i < num; ++i)
+		orderOut[i] = i;
+
+	unsigned int state = seed;
+	for(int i = num - 1; i > 0; --i){
+		state = state * 1103515245u + 12345u;
+		int j = (int)((state >> 8) % (unsigned int)(i + 1));
+		swap(orderOut[i], orderOut[j]);
+	}
+}
+
+///	returns the position of val in the sorted vector vec or -1 if it isn't contained
+static int SortedIndex(const vector<int>& vec, int val)
+{
+	vector<int>::const_iterator iter = lower_bound(vec.begin(), vec.end(), val);
+	if((iter == vec.end()) || (*iter != val))
+		return -1;
+	return (int)(iter - vec.begin());
+}
+
+static bool ValidPart(int part, int numParts)
+{
+	return (part >= 0) && (part < numParts);
+}
+
+
+///	matches each vertex with its unmatched neighbor with the heaviest connection
+/**	If initPart is specified, only vertices of the same initial part are matched.
+ * \returns the number of vertices of the coarse graph.*/
+static int HeavyEdgeMatching(vector<int>& coarseMapOut, const WeightedGraph& g,
+							 const vector<int>* initPart, int maxVrtWeight)
+{
+	const int numVrts = g.num_vertices();
+
+	vector<int> order;
+	PseudoRandomOrder(order, numVrts, 4711u + (unsigned int)numVrts);
+
+	vector<int> match(numVrts, -1);
+	coarseMapOut.assign(numVrts, -1);
+	int numCoarse = 0;
+
+	for(int iOrder = 0; iOrder < numVrts; ++iOrder){
+		const int v = order[iOrder];
+		if(match[v] != -1)
+			continue;
+
+		const int vw = g.vertex_weight(v);
+		int best = -1;
+		int bestWeight = -1;
+		for(int i = g.adjStart[v]; i < g.adjStart[v + 1]; ++i){
+			const int u = g.adjacency[i];
+			if((u == v) || (match[u] != -1))
+				continue;
+			if(initPart && ((*initPart)[u] != (*initPart)[v]))
+				continue;
+			if(vw + g.vertex_weight(u) > maxVrtWeight)
+				continue;
+
+			const int w = g.edge_weight(i);
+			if((w > bestWeight)
+				|| ((w == bestWeight) && (g.vertex_weight(u) < g.vertex_weight(best))))
+			{
+				best = u;
+				bestWeight = w;
+			}
+		}
+
+		if(best == -1){
+			match[v] = v;
+			coarseMapOut[v] = numCoarse++;
+		}
+		else{
+			match[v] = best;
+			match[best] = v;
+			coarseMapOut[v] = coarseMapOut[best] = numCoarse++;
+		}
+	}
+
+	return numCoarse;
+}
+
+
+///	creates the coarse graph defined by coarseMap
+static void ContractGraph(WeightedGraph& cg, const WeightedGraph& g,
+						  const vector<int>& coarseMap, int numCoarse)
+{
+	const int numVrts = g.num_vertices();
+
+//	group fine vertices by their coarse vertex
+	vector<int> firstMember(numCoarse + 1, 0);
+	for(int i = 0; i < numVrts; ++i)
+		++firstMember[coarseMap[i] + 1];
+	for(int i = 0; i < numCoarse; ++i)
+		firstMember[i + 1] += firstMember[i];
+
+	vector<int> members(numVrts);
+	{
+		vector<int> fillPos(firstMember.begin(), firstMember.end() - 1);
+		for(int i = 0; i < numVrts; ++i)
+			members[fillPos[coarseMap[i]]++] = i;
+	}
+
+	cg.adjStart.resize(numCoarse + 1);
+	cg.vrtWeights.assign(numCoarse, 0);
+	cg.adjacency.clear();
+	cg.edgeWeights.clear();
+	cg.adjacency.reserve(g.adjacency.size());
+	cg.edgeWeights.reserve(g.adjacency.size());
+
+	vector<int> entryPos(numCoarse, -1);
+	for(int c = 0; c < numCoarse; ++c){
+		const int rowStart = (int)cg.adjacency.size();
+		cg.adjStart[c] = rowStart;
+
+		for(int iMem = firstMember[c]; iMem < firstMember[c + 1]; ++iMem){
+			const int v = members[iMem];
+			cg.vrtWeights[c] += g.vertex_weight(v);
+
+			for(int i = g.adjStart[v]; i < g.adjStart[v + 1]; ++i){
+				const int cu = coarseMap[g.adjacency[i]];
+				if(cu == c)
+					continue;
+				if(entryPos[cu] == -1){
+					entryPos[cu] = (int)cg.adjacency.size();
+					cg.adjacency.push_back(cu);
+					cg.edgeWeights.push_back(g.edge_weight(i));
+				}
+				else
+					cg.edgeWeights[entryPos[cu]] += g.edge_weight(i);
+			}
+		}
+
+		for(size_t i = rowStart; i < cg.adjacency.size(); ++i)
+			entryPos[cg.adjacency[i]] = -1;
+	}
+	cg.adjStart[numCoarse] = (int)cg.adjacency.size();
+}
+
+
+///	creates the subgraph induced by the given vertices
+static void ExtractSubgraph(WeightedGraph& subOut, const WeightedGraph& g,
+							const vector<int>& vrts, vector<int>& localIndTmp)
+{
+	localIndTmp.resize(g.num_vertices(), -1);
+	for(size_t i = 0; i < vrts.size(); ++i)
+		localIndTmp[vrts[i]] = (int)i;
+
+	subOut.adjStart.resize(vrts.size() + 1);
+	subOut.vrtWeights.resize(vrts.size());
+	subOut.adjacency.clear();
+	subOut.edgeWeights.clear();
+
+	for(size_t iv = 0; iv < vrts.size(); ++iv){
+		const int v = vrts[iv];
+		subOut.adjStart[iv] = (int)subOut.adjacency.size();
+		subOut.vrtWeights[iv] = g.vertex_weight(v);
+		for(int i = g.adjStart[v]; i < g.adjStart[v + 1]; ++i){
+			const int lu = localIndTmp[g.adjacency[i]];
+			if(lu != -1){
+				subOut.adjacency.push_back(lu);
+				subOut.edgeWeights.push_back(g.edge_weight(i));
+			}
+		}
+	}
+	subOut.adjStart[vrts.size()] = (int)subOut.adjacency.size();
+
+	for(size_t i = 0; i < vrts.size(); ++i)
+		localIndTmp[vrts[i]] = -1;
+}
+
+
+///	returns the vertex which was reached last by a breadth-first search starting at start
+static int LastVertexOfBFS(const WeightedGraph& g, int start)
+{
+	vector<bool> visited(g.num_vertices(), false);
+	queue<int> q;
+	q.push(start);
+	visited[start] = true;
+	int last = start;
+	while(!q.empty()){
+		last = q.front();
+		q.pop();
+		for(int i = g.adjStart[last]; i < g.adjStart[last + 1]; ++i){
+			const int u = g.adjacency[i];
+			if(!visited[u]){
+				visited[u] = true;
+				q.push(u);
+			}
+		}
+	}
+	return last;
+}
+
+
+///	grows a region of weight targetWeight around seed. side is 0 inside the region and 1 outside.
+/**	Vertices are added in the order of decreasing gain, i.e. the vertex which
+ * reduces the weight of the cut edges the most is added first.
+ * \returns	the edge-cut of the bisection.*/
+static int GrowRegion(vector<int>& sideOut, const WeightedGraph& g, int seed,
+					  int targetWeight)
+{
+	const int numVrts = g.num_vertices();
+	sideOut.assign(numVrts, 1);
+
+//	gain of moving a vertex into the region
+	vector<int> gain(numVrts, 0);
+	for(int v = 0; v < numVrts; ++v){
+		for(int i = g.adjStart[v]; i < g.adjStart[v + 1]; ++i)
+			gain[v] -= g.edge_weight(i);
+	}
+
+	priority_queue<pair<int, int> > pq;
+	pq.push(make_pair(gain[seed], seed));
+	int regionWeight = 0;
+	int nextUnvisited = 0;
+
+	while(regionWeight < targetWeight){
+		if(pq.empty()){
+		//	the region is disconnected from the remaining vertices
+			while((nextUnvisited < numVrts) && (sideOut[nextUnvisited] == 0))
+				++nextUnvisited;
+			if(nextUnvisited == numVrts)
+				break;
+			pq.push(make_pair(gain[nextUnvisited], nextUnvisited));
+		}
+
+		const int v = pq.top().second;
+		const int vGain = pq.top().first;
+		pq.pop();
+		if((sideOut[v] == 0) || (vGain != gain[v]))
+			continue;
+
+		const int vw = g.vertex_weight(v);
+		if((regionWeight > 0) && (regionWeight + vw - targetWeight > targetWeight - regionWeight))
+			break;
+
+		sideOut[v] = 0;
+		regionWeight += vw;
+
+		for(int i = g.adjStart[v]; i < g.adjStart[v + 1]; ++i){
+			const int u = g.adjacency[i];
+			if(sideOut[u] == 1){
+				gain[u] += 2 * g.edge_weight(i);
+				pq.push(make_pair(gain[u], u));
+			}
+		}
+	}
+
+	return MultilevelGraphPartitioner::edge_cut(g, sideOut);
+}
+
+
+///	Fiduccia-Mattheyses refinement of a bisection
+/**	In each pass, vertices are moved one after another to the other side in the
+ * order of decreasing gain, even if the gain is negative. Each vertex is moved at
+ * most once per pass. Afterwards the pass is rolled back to the state with the
+ * smallest cut which respects the weight bounds.*/
+static void RefineBisectionFM(vector<int>& side, const WeightedGraph& g,
+							  const int maxWeights[2], int numPasses)
+{
+	const int numVrts = g.num_vertices();
+	int sideWeights[2] = {0, 0};
+	for(int v = 0; v < numVrts; ++v)
+		sideWeights[side[v]] += g.vertex_weight(v);
+
+	vector<int> gain(numVrts);
+	vector<bool> locked(numVrts);
+	vector<int> moves;
+
+	for(int iPass = 0; iPass < numPasses; ++iPass){
+		priority_queue<pair<int, int> > pq;
+		for(int v = 0; v < numVrts; ++v){
+			gain[v] = 0;
+			bool boundary = false;
+			for(int i = g.adjStart[v]; i < g.adjStart[v + 1]; ++i){
+				if(side[g.adjacency[i]] != side[v]){
+					gain[v] += g.edge_weight(i);
+					boundary = true;
+				}
+				else
+					gain[v] -= g.edge_weight(i);
+			}
+			locked[v] = false;
+			if(boundary)
+				pq.push(make_pair(gain[v], v));
+		}
+
+		moves.clear();
+		int curGain = 0;
+		int bestGain = 0;
+		size_t bestNumMoves = 0;
+	//	limit the number of unsuccessful moves in a row
+		const size_t maxFutileMoves = max(50, numVrts / 20);
+
+		while(!pq.empty()){
+			const int v = pq.top().second;
+			const int vGain = pq.top().first;
+			pq.pop();
+			if(locked[v] || (vGain != gain[v]))
+				continue;
+
+			const int from = side[v];
+			const int to = 1 - from;
+			const int vw = g.vertex_weight(v);
+			if((sideWeights[to] + vw > maxWeights[to]) || (sideWeights[from] == vw))
+				continue;
+
+			side[v] = to;
+			locked[v] = true;
+			sideWeights[from] -= vw;
+			sideWeights[to] += vw;
+			curGain += vGain;
+			moves.push_back(v);
+
+			if(curGain > bestGain){
+				bestGain = curGain;
+				bestNumMoves = moves.size();
+			}
+			else if(moves.size() - bestNumMoves > maxFutileMoves)
+				break;
+
+			for(int i = g.adjStart[v]; i < g.adjStart[v + 1]; ++i){
+				const int u = g.adjacency[i];
+				if(locked[u])
+					continue;
+				if(side[u] == to)
+					gain[u] -= 2 * g.edge_weight(i);
+				else
+					gain[u] += 2 * g.edge_weight(i);
+				pq.push(make_pair(gain[u], u));
+			}
+		}
+
+	//	roll back to the best state
+		for(size_t i = moves.size(); i > bestNumMoves; --i){
+			const int v = moves[i - 1];
+			const int vw = g.vertex_weight(v);
+			sideWeights[side[v]] -= vw;
+			side[v] = 1 - side[v];
+			sideWeights[side[v]] += vw;
+		}
+
+		if(bestGain == 0)
+			break;
+	}
+}
+
+
+///	relabels the parts of partInOut so that they overlap with initialPart as much as possible
+static void RemapParts(vector<int>& partInOut, const vector<int>& initialPart,
+					   const WeightedGraph& g, int numParts)
+{
+//	collect the overlap of new and initial parts
+	vector<pair<long long, int> > keys;
+	for(size_t i = 0; i < partInOut.size(); ++i){
+		if(ValidPart(initialPart[i], numParts)){
+			keys.push_back(make_pair((long long)partInOut[i] * numParts + initialPart[i],
+									 g.vertex_weight((int)i)));
+		}
+	}
+	sort(keys.begin(), keys.end());
+
+	vector<pair<int, pair<int, int> > > overlaps;// (weight, (newPart, oldPart))
+	for(size_t i = 0; i < keys.size();){
+		int weight = 0;
+		size_t j = i;
+		for(; (j < keys.size()) && (keys[j].first == keys[i].first); ++j)
+			weight += keys[j].second;
+		overlaps.push_back(make_pair(weight, make_pair((int)(keys[i].first / numParts),
+													   (int)(keys[i].first % numParts))));
+		i = j;
+	}
+	sort(overlaps.rbegin(), overlaps.rend());
+
+	vector<int> newToOld(numParts, -1);
+	vector<bool> oldUsed(numParts, false);
+	for(size_t i = 0; i < overlaps.size(); ++i){
+		const int newPart = overlaps[i].second.first;
+		const int oldPart = overlaps[i].second.second;
+		if((newToOld[newPart] == -1) && !oldUsed[oldPart]){
+			newToOld[newPart] = oldPart;
+			oldUsed[oldPart] = true;
+		}
+	}
+
+	int nextFree = 0;
+	for(int i = 0; i < numParts; ++i){
+		if(newToOld[i] != -1)
+			continue;
+		while(oldUsed[nextFree])
+			++nextFree;
+		newToOld[i] = nextFree;
+		oldUsed[nextFree] = true;
+	}
+
+	for(size_t i = 0; i < partInOut.size(); ++i)
+		partInOut[i] = newToOld[partInOut[i]];
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	MultilevelGraphPartitioner
+////////////////////////////////////////////////////////////////////////////////
+MultilevelGraphPartitioner::
+MultilevelGraphPartitioner() :
+	m_imbalanceTol(0.05),
+	m_numRefinementPasses(8),
+	m_coarseningThreshold(20),
+	m_migrationCost(1)
+{
+}
+
+int MultilevelGraphPartitioner::
+edge_cut(const WeightedGraph& g, const std::vector<int>& partition)
+{
+	int cut = 0;
+	for(int v = 0; v < g.num_vertices(); ++v){
+		for(int i = g.adjStart[v]; i < g.adjStart[v + 1]; ++i){
+			if(partition[g.adjacency[i]] != partition[v])
+				cut += g.edge_weight(i);
+		}
+	}
+	return cut / 2;
+}
+
+int MultilevelGraphPartitioner::
+migrated_weight(const WeightedGraph& g, const std::vector<int>& partition,
+				const std::vector<int>& initialPartition)
+{
+	int weight = 0;
+	for(int v = 0; v < g.num_vertices(); ++v){
+		if(partition[v] != initialPartition[v])
+			weight += g.vertex_weight(v);
+	}
+	return weight;
+}
+
+void MultilevelGraphPartitioner::
+max_part_weights(std::vector<int>& maxWeightsOut, const WeightedGraph& g,
+				 int numParts) const
+{
+//	on coarse levels single vertices may be heavier than the tolerance allows.
+	const number avg = (number)TotalVertexWeight(g) / (number)numParts;
+	maxWeightsOut.assign(numParts, (int)max<number>((1. + m_imbalanceTol) * avg,
+													avg + MaxVertexWeight(g)));
+}
+
+bool MultilevelGraphPartitioner::
+is_balanced(const WeightedGraph& g, const std::vector<int>& part, int numParts) const
+{
+	vector<int> partWeights(numParts, 0);
+	for(int v = 0; v < g.num_vertices(); ++v)
+		partWeights[part[v]] += g.vertex_weight(v);
+
+	vector<int> maxWeights;
+	max_part_weights(maxWeights, g, numParts);
+	for(int i = 0; i < numParts; ++i){
+		if((partWeights[i] > maxWeights[i])
+			|| ((partWeights[i] == 0) && (g.num_vertices() >= numParts)))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+
+void MultilevelGraphPartitioner::
+coarsen(std::vector<Level>& levels, const WeightedGraph& g, int numParts,
+		const std::vector<int>* initialPart)
+{
+	levels.clear();
+	levels.push_back(Level());
+	if(initialPart)
+		levels.back().initialPart = *initialPart;
+
+	const int coarsenTo = max(numParts * m_coarseningThreshold, 64);
+	const int maxVrtWeight = max(1, (int)(1.5 * TotalVertexWeight(g) / coarsenTo));
+
+	const WeightedGraph* fine = &g;
+	while(fine->num_vertices() > coarsenTo){
+		Level& fineLvl = levels.back();
+		const vector<int>* finePart = initialPart ? &fineLvl.initialPart : NULL;
+
+		Level coarseLvl;
+		const int numCoarse = HeavyEdgeMatching(coarseLvl.coarseMap, *fine,
+												finePart, maxVrtWeight);
+
+	//	stop if the graph can't be coarsened considerably anymore
+		if(numCoarse > 0.95 * fine->num_vertices())
+			break;
+
+		ContractGraph(coarseLvl.graph, *fine, coarseLvl.coarseMap, numCoarse);
+		if(initialPart){
+			coarseLvl.initialPart.resize(numCoarse);
+			for(size_t i = 0; i < coarseLvl.coarseMap.size(); ++i)
+				coarseLvl.initialPart[coarseLvl.coarseMap[i]] = (*finePart)[i];
+		}
+
+		levels.push_back(coarseLvl);
+		fine = &levels.back().graph;
+	}
+}
+
+
+void MultilevelGraphPartitioner::
+uncoarsen(std::vector<int>& partInOut, std::vector<Level>& levels,
+		  const WeightedGraph& g, int numParts, const std::vector<int>* initialPart)
+{
+	for(size_t iLvl = levels.size() - 1; iLvl > 0; --iLvl){
+		const Level& coarseLvl = levels[iLvl];
+		const WeightedGraph& fine = (iLvl == 1) ? g : levels[iLvl - 1].graph;
+
+		vector<int> finePart(fine.num_vertices());
+		for(size_t i = 0; i < finePart.size(); ++i)
+			finePart[i] = partInOut[coarseLvl.coarseMap[i]];
+		partInOut.swap(finePart);
+
+		vector<int> maxWeights;
+		max_part_weights(maxWeights, fine, numParts);
+		if(!is_balanced(fine, partInOut, numParts))
+			balance(partInOut, fine, numParts, maxWeights);
+		refine(partInOut, fine, numParts,
+			   initialPart ? &levels[iLvl - 1].initialPart : NULL, maxWeights);
+	}
+}
+
+
+///	recursively bisects g and writes parts firstPart, ..., firstPart + numParts - 1 to partOut
+void MultilevelGraphPartitioner::
+recursive_bisection(std::vector<int>& partOut, const WeightedGraph& g,
+					const std::vector<int>& globalInds, int numParts,
+					int firstPart, std::vector<int>& localIndTmp)
+{
+	const int numVrts = g.num_vertices();
+	if(numVrts == 0)
+		return;
+
+	if(numParts == 1){
+		for(int i = 0; i < numVrts; ++i)
+			partOut[globalInds[i]] = firstPart;
+		return;
+	}
+
+	const int numPartsLeft = numParts / 2;
+	const int totalWeight = TotalVertexWeight(g);
+	const int targetWeight = (int)(((long long)totalWeight * numPartsLeft) / numParts);
+
+//	try a few seeds and keep the bisection with the smallest cut.
+//	The first seed is a pseudo peripheral vertex.
+	vector<int> side, bestSide;
+	int bestCut = -1;
+	const int numTrials = min(4, numVrts);
+	for(int iTrial = 0; iTrial < numTrials; ++iTrial){
+		int seed;
+		if(iTrial == 0)
+			seed = LastVertexOfBFS(g, LastVertexOfBFS(g, 0));
+		else
+			seed = (int)(((long long)iTrial * numVrts) / numTrials);
+
+		const int cut = GrowRegion(side, g, seed, targetWeight);
+		if((bestCut == -1) || (cut < bestCut)){
+			bestCut = cut;
+			bestSide.swap(side);
+		}
+	}
+
+//	improve the bisection. The allowed weight of each side is proportional to
+//	the number of parts it will be split into.
+	{
+		const int maxVrtWeight = MaxVertexWeight(g);
+		int maxWeights[2];
+		maxWeights[0] = max((int)((1. + m_imbalanceTol) * targetWeight),
+							targetWeight + maxVrtWeight);
+		maxWeights[1] = max((int)((1. + m_imbalanceTol) * (totalWeight - targetWeight)),
+							totalWeight - targetWeight + maxVrtWeight);
+		RefineBisectionFM(bestSide, g, maxWeights, m_numRefinementPasses);
+	}
+
+	vector<int> vrts[2];
+	for(int i = 0; i < numVrts; ++i)
+		vrts[bestSide[i]].push_back(i);
+
+	const int numSubParts[2] = {numPartsLeft, numParts - numPartsLeft};
+	const int firstSubPart[2] = {firstPart, firstPart + numPartsLeft};
+	for(int iSide = 0; iSide < 2; ++iSide){
+		WeightedGraph sub;
+		ExtractSubgraph(sub, g, vrts[iSide], localIndTmp);
+		vector<int> subGlobalInds(vrts[iSide].size());
+		for(size_t i = 0; i < vrts[iSide].size(); ++i)
+			subGlobalInds[i] = globalInds[vrts[iSide][i]];
+		recursive_bisection(partOut, sub, subGlobalInds, numSubParts[iSide],
+							firstSubPart[iSide], localIndTmp);
+	}
+}
+
+
+void MultilevelGraphPartitioner::
+balance(std::vector<int>& part, const WeightedGraph& g, int numParts,
+		const std::vector<int>& maxWeights)
+{
+	const int numVrts = g.num_vertices();
+	const number avg = (number)TotalVertexWeight(g) / (number)numParts;
+
+	vector<int> partWeights(numParts);
+	vector<vector<int> > partNbrs(numParts);
+	vector<vector<number> > flows(numParts);
+	vector<number> x, r, d, q;
+
+//	candidate moves: (gain, (vertex, targetPart))
+	typedef pair<int, pair<int, int> > Move;
+	vector<Move> moves;
+
+	const int maxNumRounds = 8;
+	for(int iRound = 0; iRound < maxNumRounds; ++iRound){
+		partWeights.assign(numParts, 0);
+		for(int v = 0; v < numVrts; ++v)
+			partWeights[part[v]] += g.vertex_weight(v);
+
+		bool balanced = true;
+		for(int i = 0; i < numParts; ++i){
+			if(partWeights[i] > maxWeights[i]){
+				balanced = false;
+				break;
+			}
+		}
+		if(balanced)
+			break;
+
+	//	the quotient graph, whose vertices are the parts
+		for(int i = 0; i < numParts; ++i)
+			partNbrs[i].clear();
+		for(int v = 0; v < numVrts; ++v){
+			for(int i = g.adjStart[v]; i < g.adjStart[v + 1]; ++i){
+				const int p = part[g.adjacency[i]];
+				if(p != part[v])
+					partNbrs[part[v]].push_back(p);
+			}
+		}
+		for(int i = 0; i < numParts; ++i){
+			sort(partNbrs[i].begin(), partNbrs[i].end());
+			partNbrs[i].erase(unique(partNbrs[i].begin(), partNbrs[i].end()),
+							  partNbrs[i].end());
+		}
+
+	//	the flow between neighbored parts which balances the weights is given by
+	//	the gradient of the solution of L x = w - avg, where L is the Laplacian
+	//	of the quotient graph. The system is solved by conjugate gradients.
+		x.assign(numParts, 0);
+		r.resize(numParts);
+		for(int i = 0; i < numParts; ++i)
+			r[i] = partWeights[i] - avg;
+		d = r;
+		q.resize(numParts);
+		number rr = 0;
+		for(int i = 0; i < numParts; ++i)
+			rr += r[i] * r[i];
+		const number rr0 = rr;
+		for(int iter = 0; (iter < 10 * numParts + 100) && (rr > 1e-12 * rr0); ++iter){
+			number dq = 0;
+			for(int i = 0; i < numParts; ++i){
+				q[i] = (number)partNbrs[i].size() * d[i];
+				for(size_t j = 0; j < partNbrs[i].size(); ++j)
+					q[i] -= d[partNbrs[i][j]];
+				dq += d[i] * q[i];
+			}
+			if(dq <= 0)
+				break;
+			const number alpha = rr / dq;
+			number rrNew = 0;
+			for(int i = 0; i < numParts; ++i){
+				x[i] += alpha * d[i];
+				r[i] -= alpha * q[i];
+				rrNew += r[i] * r[i];
+			}
+			const number beta = rrNew / rr;
+			rr = rrNew;
+			for(int i = 0; i < numParts; ++i)
+				d[i] = r[i] + beta * d[i];
+		}
+
+		for(int i = 0; i < numParts; ++i){
+			flows[i].resize(partNbrs[i].size());
+			for(size_t j = 0; j < partNbrs[i].size(); ++j)
+				flows[i][j] = x[i] - x[partNbrs[i][j]];
+		}
+
+	//	move boundary vertices along the flows. Moves with a high gain are performed first.
+		bool movedAny = false;
+		for(int iSweep = 0; iSweep < 64; ++iSweep){
+			moves.clear();
+			for(int v = 0; v < numVrts; ++v){
+				const int own = part[v];
+				const int vw = g.vertex_weight(v);
+
+				int bestPart = -1;
+				int bestGain = 0;
+				for(int i = g.adjStart[v]; i < g.adjStart[v + 1]; ++i){
+					const int p = part[g.adjacency[i]];
+					if((p == own) || (p == bestPart))
+						continue;
+				//	parts which became neighbors during this round are ignored
+					const int j = SortedIndex(partNbrs[own], p);
+					if((j == -1) || (flows[own][j] < 0.5 * vw))
+						continue;
+
+					int gain = 0;
+					for(int k = g.adjStart[v]; k < g.adjStart[v + 1]; ++k){
+						const int pk = part[g.adjacency[k]];
+						if(pk == p)
+							gain += g.edge_weight(k);
+						else if(pk == own)
+							gain -= g.edge_weight(k);
+					}
+					if((bestPart == -1) || (gain > bestGain)){
+						bestPart = p;
+						bestGain = gain;
+					}
+				}
+
+				if(bestPart != -1)
+					moves.push_back(Move(bestGain, make_pair(v, bestPart)));
+			}
+
+			sort(moves.rbegin(), moves.rend());
+
+			int numMoves = 0;
+			for(size_t i = 0; i < moves.size(); ++i){
+				const int v = moves[i].second.first;
+				const int to = moves[i].second.second;
+				const int own = part[v];
+				const int vw = g.vertex_weight(v);
+				const int j = SortedIndex(partNbrs[own], to);
+				if((j == -1) || (flows[own][j] < 0.5 * vw) || (partWeights[own] == vw))
+					continue;
+
+				const int jBack = SortedIndex(partNbrs[to], own);
+				flows[own][j] -= vw;
+				flows[to][jBack] += vw;
+				part[v] = to;
+				partWeights[own] -= vw;
+				partWeights[to] += vw;
+				++numMoves;
+			}
+
+			if(numMoves == 0)
+				break;
+			movedAny = true;
+		}
+
+		if(!movedAny)
+			break;
+	}
+}
+
+
+void MultilevelGraphPartitioner::
+refine(std::vector<int>& part, const WeightedGraph& g, int numParts,
+	   const std::vector<int>* initialPart, const std::vector<int>& maxWeights)
+{
+	const int numVrts = g.num_vertices();
+	vector<int> partWeights(numParts, 0);
+	for(int v = 0; v < numVrts; ++v)
+		partWeights[part[v]] += g.vertex_weight(v);
+
+	vector<int> conn(numParts, 0);
+	vector<int> touched;
+
+	for(int iPass = 0; iPass < m_numRefinementPasses; ++iPass){
+		int numMoves = 0;
+		for(int v = 0; v < numVrts; ++v){
+			const int own = part[v];
+			const int vw = g.vertex_weight(v);
+
+		//	the weights of the connections to each neighbored part
+			touched.clear();
+			for(int i = g.adjStart[v]; i < g.adjStart[v + 1]; ++i){
+				const int p = part[g.adjacency[i]];
+				if(conn[p] == 0)
+					touched.push_back(p);
+				conn[p] += g.edge_weight(i);
+			}
+
+			const int init = initialPart ? (*initialPart)[v] : -1;
+			const bool considerMigration = ValidPart(init, numParts);
+
+			int bestPart = -1;
+			number bestGain = 0;
+			for(size_t i = 0; i < touched.size(); ++i){
+				const int p = touched[i];
+				if((p == own) || (partWeights[p] + vw > maxWeights[p]))
+					continue;
+
+				number gain = conn[p] - conn[own];
+				if(considerMigration){
+					if(p == init)
+						gain += m_migrationCost * vw;
+					else if(own == init)
+						gain -= m_migrationCost * vw;
+				}
+
+				if((bestPart == -1) || (gain > bestGain)
+					|| ((gain == bestGain) && (partWeights[p] < partWeights[bestPart])))
+				{
+					bestPart = p;
+					bestGain = gain;
+				}
+			}
+
+			for(size_t i = 0; i < touched.size(); ++i)
+				conn[touched[i]] = 0;
+
+		//	moves have to reduce the cut, improve the balance or relieve an overweight part.
+		//	parts are never emptied.
+			if((bestPart == -1) || (partWeights[own] == vw))
+				continue;
+
+			if((bestGain > 0)
+				|| ((bestGain == 0) && (partWeights[bestPart] + vw < partWeights[own]))
+				|| (partWeights[own] > maxWeights[own]))
+			{
+				part[v] = bestPart;
+				partWeights[own] -= vw;
+				partWeights[bestPart] += vw;
+				++numMoves;
+			}
+		}
+
+		if(numMoves == 0)
+			break;
+	}
+}
+
+
+int MultilevelGraphPartitioner::
+partition(std::vector<int>& partitionOut, const WeightedGraph& g, int numParts)
+{
+	UG_COND_THROW(numParts < 1, "MultilevelGraphPartitioner: at least one part is required.");
+
+	const int numVrts = g.num_vertices();
+	partitionOut.assign(numVrts, 0);
+	if((numParts == 1) || (numVrts == 0))
+		return 0;
+
+	vector<Level> levels;
+	coarsen(levels, g, numParts, NULL);
+
+	const WeightedGraph& coarsest = (levels.size() > 1) ? levels.back().graph : g;
+	vector<int> part(coarsest.num_vertices(), 0);
+	{
+		vector<int> globalInds(coarsest.num_vertices());
+		for(size_t i = 0; i < globalInds.size(); ++i)
+			globalInds[i] = (int)i;
+		vector<int> localIndTmp;
+		recursive_bisection(part, coarsest, globalInds, numParts, 0, localIndTmp);
+	}
+
+	vector<int> maxWeights;
+	max_part_weights(maxWeights, coarsest, numParts);
+	refine(part, coarsest, numParts, NULL, maxWeights);
+
+	uncoarsen(part, levels, g, numParts, NULL);
+	partitionOut.swap(part);
+	return edge_cut(g, partitionOut);
+}
+
+
+int MultilevelGraphPartitioner::
+repartition(std::vector<int>& partitionOut, const WeightedGraph& g, int numParts,
+			const std::vector<int>& initialPartition)
+{
+	UG_COND_THROW(numParts < 1, "MultilevelGraphPartitioner: at least one part is required.");
+	UG_COND_THROW((int)initialPartition.size() != g.num_vertices(),
+				  "MultilevelGraphPartitioner: an initial part is required for each vertex.");
+
+	const int numVrts = g.num_vertices();
+	partitionOut.assign(numVrts, 0);
+	if((numParts == 1) || (numVrts == 0))
+		return 0;
+
+//	diffusion: start from the initial partition and improve it level by level
+	vector<Level> levels;
+	coarsen(levels, g, numParts, &initialPartition);
+
+	const Level& coarsestLvl = levels.back();
+	const WeightedGraph& coarsest = (levels.size() > 1) ? coarsestLvl.graph : g;
+	const int numCoarse = coarsest.num_vertices();
+
+	vector<int> part(numCoarse, -1);
+	int numUnassigned = 0;
+	for(int i = 0; i < numCoarse; ++i){
+		if(ValidPart(coarsestLvl.initialPart[i], numParts))
+			part[i] = coarsestLvl.initialPart[i];
+		else
+			++numUnassigned;
+	}
+
+//	vertices without valid initial part join the neighbored part to which they
+//	are connected most strongly. Isolated ones are assigned to the lightest part.
+	vector<int> conn(numParts, 0);
+	while(numUnassigned > 0){
+		int numAssigned = 0;
+		for(int v = 0; v < numCoarse; ++v){
+			if(part[v] != -1)
+				continue;
+			int bestPart = -1;
+			for(int i = coarsest.adjStart[v]; i < coarsest.adjStart[v + 1]; ++i){
+				const int p = part[coarsest.adjacency[i]];
+				if(p == -1)
+					continue;
+				conn[p] += coarsest.edge_weight(i);
+				if((bestPart == -1) || (conn[p] > conn[bestPart]))
+					bestPart = p;
+			}
+			for(int i = coarsest.adjStart[v]; i < coarsest.adjStart[v + 1]; ++i){
+				const int p = part[coarsest.adjacency[i]];
+				if(p != -1)
+					conn[p] = 0;
+			}
+			if(bestPart != -1){
+				part[v] = bestPart;
+				++numAssigned;
+			}
+		}
+
+		if(numAssigned == 0){
+			vector<int> partWeights(numParts, 0);
+			for(int v = 0; v < numCoarse; ++v){
+				if(part[v] != -1)
+					partWeights[part[v]] += coarsest.vertex_weight(v);
+			}
+			for(int v = 0; v < numCoarse; ++v){
+				if(part[v] == -1){
+					part[v] = (int)(min_element(partWeights.begin(), partWeights.end())
+									- partWeights.begin());
+					partWeights[part[v]] += coarsest.vertex_weight(v);
+					++numAssigned;
+					break;
+				}
+			}
+		}
+		numUnassigned -= numAssigned;
+	}
+
+	vector<int> maxWeights;
+	max_part_weights(maxWeights, coarsest, numParts);
+	balance(part, coarsest, numParts, maxWeights);
+	refine(part, coarsest, numParts, &coarsestLvl.initialPart, maxWeights);
+	uncoarsen(part, levels, g, numParts, &initialPartition);
+
+	if(is_balanced(g, part, numParts)){
+		partitionOut.swap(part);
+		return edge_cut(g, partitionOut);
+	}
+
+//	scratch-remap: the initial partition couldn't be balanced by diffusion.
+	const int cut = partition(partitionOut, g, numParts);
+	RemapParts(partitionOut, initialPartition, g, numParts);
+	return cut;
+}
+
+}//	end of namespace
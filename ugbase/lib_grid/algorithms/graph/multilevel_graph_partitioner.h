@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__LIB_GRID__MULTILEVEL_GRAPH_PARTITIONER__
+#define __H__LIB_GRID__MULTILEVEL_GRAPH_PARTITIONER__
+
+#include <vector>
+#include "common/types.h"
+
+namespace ug{
+
+///	A weighted undirected graph in compressed row storage
+/**	The neighbors of vertex i are stored in adjacency[adjStart[i]] up to
+ * (but not including) adjacency[adjStart[i+1]]. Each connection has to be
+ * stored in both directions. edgeWeights (if not empty) holds one weight for
+ * each entry in adjacency, vrtWeights (if not empty) one weight for each vertex.
+ * If one of the weight arrays is empty, a weight of 1 is assumed for each
+ * vertex or connection respectively.
+ *
+ * The layout is the same as the one produced by ConstructDualGraph and
+ * ParallelDualGraph.*/
+struct WeightedGraph{
+	std::vector<int>	adjStart;
+	std::vector<int>	adjacency;
+	std::vector<int>	vrtWeights;
+	std::vector<int>	edgeWeights;
+
+	int num_vertices() const	{return adjStart.empty() ? 0 : (int)adjStart.size() - 1;}
+	int vertex_weight(int vrt) const	{return vrtWeights.empty() ? 1 : vrtWeights[vrt];}
+	int edge_weight(int adjInd) const	{return edgeWeights.empty() ? 1 : edgeWeights[adjInd];}
+};
+
+
+///	Multilevel k-way partitioning of weighted graphs which minimizes the edge-cut
+/**	The graph is coarsened by heavy-edge matching until it is small enough.
+ * The coarsest graph is partitioned by recursive bisection with greedy graph
+ * growing. During uncoarsening the partition is improved on each level by
+ * greedy boundary refinement, which moves vertices to neighboring parts if
+ * this reduces the weight of cut edges without violating the balance constraint.
+ *
+ * repartition takes an existing partition into account. Vertices are only
+ * matched with vertices of the same initial part and the refinement considers
+ * the cost of moving a vertex away from its initial part (see set_migration_cost).
+ * If the initial partition can't be balanced that way (e.g. because the number
+ * of parts grew), a new partition is computed from scratch and its parts are
+ * relabeled so that they overlap with the initial parts as much as possible.
+ *
+ * All methods are deterministic.*/
+class MultilevelGraphPartitioner{
+	public:
+		MultilevelGraphPartitioner();
+
+	///	maximal relative overweight of a part. 0.05 by default.
+		void set_imbalance_tolerance(number tol)	{m_imbalanceTol = tol;}
+		number imbalance_tolerance() const			{return m_imbalanceTol;}
+
+	///	maximal number of refinement passes on each level of the graph hierarchy. 8 by default.
+		void set_num_refinement_passes(int num)		{m_numRefinementPasses = num;}
+		int num_refinement_passes() const			{return m_numRefinementPasses;}
+
+	///	coarsening stops once the graph has less vertices per part than specified. 20 by default.
+		void set_coarsening_threshold(int numVrtsPerPart)	{m_coarseningThreshold = numVrtsPerPart;}
+		int coarsening_threshold() const					{return m_coarseningThreshold;}
+
+	///	cost of moving one unit of vertex weight relative to one unit of edge weight
+	/**	Only used by repartition. The higher the cost, the fewer vertices are
+	 * moved away from their initial part. 1 by default.*/
+		void set_migration_cost(number cost)		{m_migrationCost = cost;}
+		number migration_cost() const				{return m_migrationCost;}
+
+	///	partitions the given graph into numParts parts.
+	/**	partitionOut contains the part of each vertex afterwards.
+	 * \returns	the edge-cut of the resulting partition.*/
+		int partition(std::vector<int>& partitionOut, const WeightedGraph& g,
+					  int numParts);
+
+	///	partitions the graph so that only few vertices leave their initial part.
+	/**	initialPartition has to contain an entry for each vertex. Entries which
+	 * are negative or not smaller than numParts are treated as unknown.
+	 * \returns	the edge-cut of the resulting partition.*/
+		int repartition(std::vector<int>& partitionOut, const WeightedGraph& g,
+						int numParts, const std::vector<int>& initialPartition);
+
+	///	returns the sum of the weights of all edges whose vertices lie in different parts
+		static int edge_cut(const WeightedGraph& g, const std::vector<int>& partition);
+
+	///	returns the weight of the vertices whose part differs from their initial part
+		static int migrated_weight(const WeightedGraph& g, const std::vector<int>& partition,
+								   const std::vector<int>& initialPartition);
+
+	private:
+		struct Level{
+			WeightedGraph		graph;
+			std::vector<int>	coarseMap;///< maps vertices of the finer level to this level
+			std::vector<int>	initialPart;
+		};
+
+	///	creates the graph hierarchy. levels[0] corresponds to the input graph, but holds no copy of it.
+		void coarsen(std::vector<Level>& levels, const WeightedGraph& g, int numParts,
+					 const std::vector<int>* initialPart);
+
+	///	projects the partition of the coarsest level back to g and refines it on each level.
+		void uncoarsen(std::vector<int>& partInOut, std::vector<Level>& levels,
+					   const WeightedGraph& g, int numParts,
+					   const std::vector<int>* initialPart);
+
+	///	recursively bisects g and writes parts firstPart, ..., firstPart + numParts - 1 to partOut
+		void recursive_bisection(std::vector<int>& partOut, const WeightedGraph& g,
+								 const std::vector<int>& globalInds, int numParts,
+								 int firstPart, std::vector<int>& localIndTmp);
+
+	///	greedy boundary refinement. Moves vertices to neighbored parts if the cut is reduced.
+		void refine(std::vector<int>& part, const WeightedGraph& g, int numParts,
+					const std::vector<int>* initialPart,
+					const std::vector<int>& maxWeights);
+
+	///	moves vertices between neighbored parts along a balancing flow until maxWeights are respected.
+		void balance(std::vector<int>& part, const WeightedGraph& g, int numParts,
+					 const std::vector<int>& maxWeights);
+
+		void max_part_weights(std::vector<int>& maxWeightsOut, const WeightedGraph& g,
+							  int numParts) const;
+
+		bool is_balanced(const WeightedGraph& g, const std::vector<int>& part,
+						 int numParts) const;
+
+		number	m_imbalanceTol;
+		int		m_numRefinementPasses;
+		int		m_coarseningThreshold;
+		number	m_migrationCost;
+};
+
+}//	end of namespace
+
+#endif
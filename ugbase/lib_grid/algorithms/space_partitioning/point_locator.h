@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__point_locator__
+#define __H__UG__point_locator__
+
+#include <vector>
+#include "common/types.h"
+#include "common/math/ugmath_types.h"
+#include "common/math/misc/shapes.h"
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/algorithms/geom_obj_util/geom_obj_util.h"
+
+namespace ug{
+
+///	Persistent bounding volume hierarchy for locating points in grid elements
+/**	TElem has to be one of the base object types Edge, Face or Volume.
+ *
+ * The PointLocator stores the given elements in a binary bounding volume
+ * hierarchy (BVH). Leafs hold at most max_leaf_size() elements together with
+ * their bounding boxes.
+ *
+ * If incremental updates are enabled, the locator observes its grid. Elements
+ * which are created as children of located elements replace their parents,
+ * and erased elements are removed (in a MultiGrid their parents are located
+ * again). This corresponds to the surface view of an adaptively refined
+ * MultiGrid. Only the affected leafs are modified. Their boxes are refitted
+ * and overfull leafs are split on the next query, since vertex positions of
+ * new elements are not yet known while the grid is being refined.
+ *
+ * Queries may pass the element found for a nearby point as hint. The search
+ * then starts in the leaf of the hint and climbs towards the root, so that
+ * coherent queries only touch a few nodes. Batch queries sort the points along
+ * a Morton curve and use the previous result as hint for the next point.
+ * They are distributed onto several threads if OpenMP is enabled.
+ *
+ * \note	Queries only read the tree and the grid and may thus run
+ * 			concurrently, as long as the grid is not changed.
+ */
+template <class TElem, int world_dim>
+class PointLocator : public GridObserver
+{
+	public:
+		typedef MathVector<world_dim>	vector_t;
+		typedef AABox<vector_t>			box_t;
+		typedef Attachment<vector_t>	position_attachment_t;
+
+		PointLocator();
+		PointLocator(Grid& grid, position_attachment_t aPos);
+		virtual ~PointLocator();
+
+	///	sets the grid and the position attachment. Clears the locator.
+		void set_grid(Grid& grid, position_attachment_t aPos);
+
+	///	removes all elements
+		void clear();
+
+	///	builds the hierarchy from scratch for the given elements
+		template <class TIterator>
+		void create_tree(TIterator elemsBegin, TIterator elemsEnd);
+
+	///	maximal number of elements in a leaf (default: 8)
+		void set_max_leaf_size(size_t maxLeafSize);
+		size_t max_leaf_size() const					{return m_maxLeafSize;}
+
+	///	if enabled, the locator is updated on refinement and coarsening
+		void enable_incremental_update(bool enable);
+		bool incremental_update_enabled() const			{return m_incremental;}
+
+	///	returns the number of located elements
+		size_t size() const								{return m_numElems;}
+		bool empty() const								{return m_numElems == 0;}
+
+	///	returns true if the given element is located by this locator
+		bool contains(TElem* elem) const;
+
+	///	returns the bounding box of all located elements
+	/**	\returns false if the locator is empty.*/
+		bool bounding_box(box_t& boxOut) const;
+
+	///	refits and splits all leafs which were changed by incremental updates
+	/**	This is called by all queries. Call it explicitly before concurrent
+	 * single-point queries after the grid has been changed.*/
+		void update() const;
+
+	///	finds an element containing the given point
+	/**	If hint is a located element, the search starts at its leaf.
+	 * \returns false if no element contains the point.*/
+		bool locate(TElem*& elemOut, const vector_t& point, TElem* hint = NULL) const;
+
+	///	finds the containing elements for a set of points
+	/**	elemsOut[i] is set to the element containing points[i] or to NULL, if
+	 * no such element exists.
+	 * \returns the number of points which were found.*/
+		size_t locate(std::vector<TElem*>& elemsOut,
+					  const std::vector<vector_t>& points) const;
+
+	//	grid observer callbacks
+		virtual void grid_to_be_destroyed(Grid* grid);
+		virtual void elements_to_be_cleared(Grid* grid);
+
+		virtual void edge_created(Grid* grid, Edge* e, GridObject* pParent = NULL,
+								  bool replacesParent = false);
+		virtual void face_created(Grid* grid, Face* f, GridObject* pParent = NULL,
+								  bool replacesParent = false);
+		virtual void volume_created(Grid* grid, Volume* vol, GridObject* pParent = NULL,
+									bool replacesParent = false);
+
+		virtual void edge_to_be_erased(Grid* grid, Edge* e, Edge* replacedBy = NULL);
+		virtual void face_to_be_erased(Grid* grid, Face* f, Face* replacedBy = NULL);
+		virtual void volume_to_be_erased(Grid* grid, Volume* vol, Volume* replacedBy = NULL);
+
+	public:
+	///	an element together with its bounding box
+		struct Entry{
+			Entry()	: elem(NULL)	{}
+			Entry(TElem* e) : elem(e)	{}
+			TElem*	elem;
+			box_t	box;
+		};
+
+	private:
+		struct Node{
+			Node() : parent(-1), hasBox(false), dirty(false)
+			{child[0] = child[1] = -1;}
+
+			bool is_leaf() const	{return child[0] == -1;}
+
+			box_t				box;
+			int					parent;
+			int					child[2];
+			std::vector<Entry>	entries;
+			bool				hasBox;
+			bool				dirty;
+		};
+
+		typedef Attachment<int>							ALeaf;
+		typedef Grid::AttachmentAccessor<TElem, ALeaf>	leaf_accessor_t;
+
+	//	copying would register the copy at the grid
+		PointLocator(const PointLocator&);
+		PointLocator& operator=(const PointLocator&);
+
+		void calculate_bounding_box(box_t& boxOut, TElem* elem) const;
+		int create_node(int parent) const;
+		void fill_node(int node, std::vector<Entry>& entries,
+					   size_t begin, size_t end) const;
+		void refit_leaf(int node) const;
+		void refit_ancestors(int node) const;
+
+		bool search_subtree(TElem*& elemOut, const vector_t& point, int root) const;
+		bool search_leaf(TElem*& elemOut, const vector_t& point, int node) const;
+
+	///	leaf indices of replaced parents are stored as -(leaf + 2), so that
+	///	all of their children are inserted into the same leaf.
+		static int replaced_code(int leaf)				{return -(leaf + 2);}
+		int leaf_of_parent(TElem* parent) const
+		{
+			const int code = m_aaLeaf[parent];
+			return (code >= -1) ? code : -(code + 2);
+		}
+
+		void insert_into_leaf(TElem* elem, int leaf);
+		void remove_from_leaf(TElem* elem);
+
+	//	overloads which filter the element type of the observer callbacks
+		void elem_created(TElem* elem, GridObject* pParent, bool replacesParent);
+		void elem_created(GridObject*, GridObject*, bool)	{}
+		void elem_to_be_erased(TElem* elem, TElem* replacedBy);
+		void elem_to_be_erased(GridObject*, GridObject*)	{}
+
+	private:
+		Grid*								m_pGrid;
+		Grid::VertexAttachmentAccessor<position_attachment_t>	m_aaPos;
+		ALeaf								m_aLeaf;
+		mutable leaf_accessor_t				m_aaLeaf;
+
+	//	the tree is refitted lazily during queries
+		mutable std::vector<Node>			m_nodes;
+		mutable std::vector<int>			m_dirtyLeafs;
+
+		size_t	m_numElems;
+		size_t	m_maxLeafSize;
+		number	m_tolerance;
+		bool	m_incremental;
+};
+
+}//	end of namespace
+
+
+////////////////////////////////
+//	include implementation
+#include "point_locator_impl.h"
+
+#endif
@@ -0,0 +1,652 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__point_locator_impl__
+#define __H__UG__point_locator_impl__
+
+#include <algorithm>
+#include "lib_grid/multi_grid.h"
+#include "common/util/omp_util.h"
+
+
+namespace ug{
+
+///	compares the centers of the bounding boxes of two entries along one axis
+template <class TEntry>
+struct PointLocatorCompareCenters{
+	PointLocatorCompareCenters(int axis) : m_axis(axis)	{}
+	bool operator()(const TEntry& e1, const TEntry& e2) const
+	{
+		return e1.box.min[m_axis] + e1.box.max[m_axis]
+			 < e2.box.min[m_axis] + e2.box.max[m_axis];
+	}
+	int m_axis;
+};
+
+///	interleaves the bits of the quantized coordinates of a point (Morton order)
+template <int dim>
+uint64 PointLocatorMortonKey(const MathVector<dim>& p, const AABox<MathVector<dim> >& box)
+{
+	const int numBits = std::min(21, 63 / dim);
+	const number maxCoord = (number)(((uint64)1 << numBits) - 1);
+
+	uint64 coords[dim];
+	for(int i = 0; i < dim; ++i){
+		const number ext = box.max[i] - box.min[i];
+		number c = (ext > 0) ? (p[i] - box.min[i]) / ext : 0;
+		c = std::min<number>(1, std::max<number>(0, c));
+		coords[i] = (uint64)(c * maxCoord);
+	}
+
+	uint64 key = 0;
+	for(int b = numBits - 1; b >= 0; --b){
+		for(int i = 0; i < dim; ++i)
+			key = (key << 1) | ((coords[i] >> b) & 1);
+	}
+	return key;
+}
+
+
+template <class TElem, int world_dim>
+PointLocator<TElem, world_dim>::
+PointLocator() :
+	m_pGrid(NULL),
+	m_numElems(0),
+	m_maxLeafSize(8),
+	m_tolerance(0),
+	m_incremental(false)
+{
+}
+
+template <class TElem, int world_dim>
+PointLocator<TElem, world_dim>::
+PointLocator(Grid& grid, position_attachment_t aPos) :
+	m_pGrid(NULL),
+	m_numElems(0),
+	m_maxLeafSize(8),
+	m_tolerance(0),
+	m_incremental(false)
+{
+	set_grid(grid, aPos);
+}
+
+template <class TElem, int world_dim>
+PointLocator<TElem, world_dim>::
+~PointLocator()
+{
+	if(m_pGrid){
+		if(m_incremental)
+			m_pGrid->unregister_observer(this);
+		m_pGrid->detach_from<TElem>(m_aLeaf);
+	}
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+set_grid(Grid& grid, position_attachment_t aPos)
+{
+	const bool incremental = m_incremental;
+	if(m_pGrid){
+		enable_incremental_update(false);
+		m_pGrid->detach_from<TElem>(m_aLeaf);
+	}
+
+	m_nodes.clear();
+	m_dirtyLeafs.clear();
+	m_numElems = 0;
+
+	m_pGrid = &grid;
+	if(!grid.has_vertex_attachment(aPos))
+		grid.attach_to_vertices(aPos);
+	m_aaPos.access(grid, aPos);
+
+	grid.attach_to_dv<TElem>(m_aLeaf, -1);
+	m_aaLeaf.access(grid, m_aLeaf);
+
+	enable_incremental_update(incremental);
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+clear()
+{
+//	reattaching resets the leaf indices of all elements, including the
+//	indices of replaced parents
+	if(m_pGrid){
+		m_pGrid->detach_from<TElem>(m_aLeaf);
+		m_pGrid->attach_to_dv<TElem>(m_aLeaf, -1);
+		m_aaLeaf.access(*m_pGrid, m_aLeaf);
+	}
+	m_nodes.clear();
+	m_dirtyLeafs.clear();
+	m_numElems = 0;
+}
+
+template <class TElem, int world_dim>
+template <class TIterator>
+void PointLocator<TElem, world_dim>::
+create_tree(TIterator elemsBegin, TIterator elemsEnd)
+{
+	UG_COND_THROW(!m_pGrid, "PointLocator::create_tree: No grid assigned.");
+	clear();
+
+	std::vector<Entry> entries;
+	for(; elemsBegin != elemsEnd; ++elemsBegin){
+		entries.push_back(Entry(*elemsBegin));
+		calculate_bounding_box(entries.back().box, entries.back().elem);
+	}
+
+	m_numElems = entries.size();
+	if(entries.empty())
+		return;
+
+//	elements are slightly enlarged, so that points on element boundaries are
+//	found regardless of rounding errors
+	box_t root = entries[0].box;
+	for(size_t i = 1; i < entries.size(); ++i)
+		root = box_t(root, entries[i].box);
+	m_tolerance = SMALL * VecDistance(root.min, root.max);
+	if(m_tolerance > 0){
+		vector_t offset;
+		VecSet(offset, m_tolerance);
+		for(size_t i = 0; i < entries.size(); ++i){
+			VecSubtract(entries[i].box.min, entries[i].box.min, offset);
+			VecAdd(entries[i].box.max, entries[i].box.max, offset);
+		}
+	}
+
+	create_node(-1);
+	fill_node(0, entries, 0, entries.size());
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+set_max_leaf_size(size_t maxLeafSize)
+{
+	UG_COND_THROW(maxLeafSize < 1, "PointLocator: The maximal leaf size has to be positive.");
+	m_maxLeafSize = maxLeafSize;
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+enable_incremental_update(bool enable)
+{
+	if(m_pGrid && (enable != m_incremental)){
+		if(enable)
+			m_pGrid->register_observer(this, OT_GRID_OBSERVER | OT_EDGE_OBSERVER
+											 | OT_FACE_OBSERVER | OT_VOLUME_OBSERVER);
+		else
+			m_pGrid->unregister_observer(this);
+	}
+	m_incremental = enable;
+}
+
+template <class TElem, int world_dim>
+bool PointLocator<TElem, world_dim>::
+contains(TElem* elem) const
+{
+	return m_pGrid && (m_aaLeaf[elem] >= 0);
+}
+
+template <class TElem, int world_dim>
+bool PointLocator<TElem, world_dim>::
+bounding_box(box_t& boxOut) const
+{
+	update();
+	if(m_nodes.empty() || !m_nodes[0].hasBox)
+		return false;
+	boxOut = m_nodes[0].box;
+	return true;
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+calculate_bounding_box(box_t& boxOut, TElem* elem) const
+{
+	const size_t numVrts = elem->num_vertices();
+	boxOut.min = boxOut.max = m_aaPos[elem->vertex(0)];
+	for(size_t i = 1; i < numVrts; ++i)
+		boxOut = box_t(boxOut, m_aaPos[elem->vertex(i)]);
+}
+
+template <class TElem, int world_dim>
+int PointLocator<TElem, world_dim>::
+create_node(int parent) const
+{
+	m_nodes.push_back(Node());
+	m_nodes.back().parent = parent;
+	return (int)m_nodes.size() - 1;
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+fill_node(int node, std::vector<Entry>& entries, size_t begin, size_t end) const
+{
+	if(end - begin <= m_maxLeafSize){
+		Node& n = m_nodes[node];
+		n.child[0] = n.child[1] = -1;
+		n.entries.assign(entries.begin() + begin, entries.begin() + end);
+		n.hasBox = (begin < end);
+		if(n.hasBox){
+			n.box = entries[begin].box;
+			for(size_t i = begin + 1; i < end; ++i)
+				n.box = box_t(n.box, entries[i].box);
+		}
+		for(size_t i = begin; i < end; ++i)
+			m_aaLeaf[entries[i].elem] = node;
+		return;
+	}
+
+//	split at the median of the element centers along the longest axis
+	box_t centers;
+	VecAdd(centers.min, entries[begin].box.min, entries[begin].box.max);
+	centers.max = centers.min;
+	for(size_t i = begin + 1; i < end; ++i){
+		vector_t c;
+		VecAdd(c, entries[i].box.min, entries[i].box.max);
+		centers = box_t(centers, c);
+	}
+
+	int axis = 0;
+	for(int i = 1; i < world_dim; ++i){
+		if(centers.max[i] - centers.min[i] > centers.max[axis] - centers.min[axis])
+			axis = i;
+	}
+
+	const size_t mid = (begin + end) / 2;
+	std::nth_element(entries.begin() + begin, entries.begin() + mid,
+					 entries.begin() + end, PointLocatorCompareCenters<Entry>(axis));
+
+//	note: create_node may reallocate m_nodes. References have to be renewed.
+	const int c0 = create_node(node);
+	const int c1 = create_node(node);
+	m_nodes[node].child[0] = c0;
+	m_nodes[node].child[1] = c1;
+	m_nodes[node].entries.clear();
+
+	fill_node(c0, entries, begin, mid);
+	fill_node(c1, entries, mid, end);
+
+	Node& n = m_nodes[node];
+	n.box = box_t(m_nodes[c0].box, m_nodes[c1].box);
+	n.hasBox = true;
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+refit_leaf(int node) const
+{
+	Node& n = m_nodes[node];
+	n.dirty = false;
+
+	std::vector<Entry>& entries = n.entries;
+	vector_t offset;
+	VecSet(offset, m_tolerance);
+	for(size_t i = 0; i < entries.size(); ++i){
+		calculate_bounding_box(entries[i].box, entries[i].elem);
+		VecSubtract(entries[i].box.min, entries[i].box.min, offset);
+		VecAdd(entries[i].box.max, entries[i].box.max, offset);
+	}
+
+	if(entries.size() > m_maxLeafSize){
+		std::vector<Entry> tmpEntries;
+		tmpEntries.swap(entries);
+		fill_node(node, tmpEntries, 0, tmpEntries.size());
+	}
+	else{
+		n.hasBox = !entries.empty();
+		if(n.hasBox){
+			n.box = entries[0].box;
+			for(size_t i = 1; i < entries.size(); ++i)
+				n.box = box_t(n.box, entries[i].box);
+		}
+	}
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+refit_ancestors(int node) const
+{
+	for(int i = m_nodes[node].parent; i != -1; i = m_nodes[i].parent){
+		Node& n = m_nodes[i];
+		const Node& c0 = m_nodes[n.child[0]];
+		const Node& c1 = m_nodes[n.child[1]];
+
+		n.hasBox = c0.hasBox || c1.hasBox;
+		if(c0.hasBox && c1.hasBox)
+			n.box = box_t(c0.box, c1.box);
+		else if(c0.hasBox)
+			n.box = c0.box;
+		else if(c1.hasBox)
+			n.box = c1.box;
+	}
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+update() const
+{
+	if(m_dirtyLeafs.empty())
+		return;
+
+	for(size_t i = 0; i < m_dirtyLeafs.size(); ++i){
+		if(m_nodes[m_dirtyLeafs[i]].dirty)
+			refit_leaf(m_dirtyLeafs[i]);
+	}
+
+	for(size_t i = 0; i < m_dirtyLeafs.size(); ++i)
+		refit_ancestors(m_dirtyLeafs[i]);
+
+	m_dirtyLeafs.clear();
+}
+
+template <class TElem, int world_dim>
+bool PointLocator<TElem, world_dim>::
+search_leaf(TElem*& elemOut, const vector_t& point, int node) const
+{
+	const std::vector<Entry>& entries = m_nodes[node].entries;
+	for(size_t i = 0; i < entries.size(); ++i){
+		if(entries[i].box.contains_point(point)
+		   && ContainsPoint(entries[i].elem, point, m_aaPos))
+		{
+			elemOut = entries[i].elem;
+			return true;
+		}
+	}
+	return false;
+}
+
+template <class TElem, int world_dim>
+bool PointLocator<TElem, world_dim>::
+search_subtree(TElem*& elemOut, const vector_t& point, int root) const
+{
+//	the depth of the tree isn't bounded, since incremental updates may
+//	split leafs repeatedly.
+	std::vector<int> stack;
+	stack.reserve(64);
+	stack.push_back(root);
+
+	while(!stack.empty()){
+		const int iNode = stack.back();
+		stack.pop_back();
+		const Node& n = m_nodes[iNode];
+		if(!n.hasBox || !n.box.contains_point(point))
+			continue;
+
+		if(n.is_leaf()){
+			if(search_leaf(elemOut, point, iNode))
+				return true;
+		}
+		else{
+			stack.push_back(n.child[1]);
+			stack.push_back(n.child[0]);
+		}
+	}
+	return false;
+}
+
+template <class TElem, int world_dim>
+bool PointLocator<TElem, world_dim>::
+locate(TElem*& elemOut, const vector_t& point, TElem* hint) const
+{
+	update();
+	if(m_nodes.empty())
+		return false;
+
+	int leaf = hint ? m_aaLeaf[hint] : -1;
+	if(leaf < 0)
+		return search_subtree(elemOut, point, 0);
+
+//	search the leaf of the hint first and then the siblings of its ancestors
+	if(search_leaf(elemOut, point, leaf))
+		return true;
+
+	int prev = leaf;
+	for(int node = m_nodes[leaf].parent; node != -1;
+		prev = node, node = m_nodes[node].parent)
+	{
+		const Node& n = m_nodes[node];
+		const int sibling = (n.child[0] == prev) ? n.child[1] : n.child[0];
+		if(search_subtree(elemOut, point, sibling))
+			return true;
+	}
+	return false;
+}
+
+template <class TElem, int world_dim>
+size_t PointLocator<TElem, world_dim>::
+locate(std::vector<TElem*>& elemsOut, const std::vector<vector_t>& points) const
+{
+	update();
+
+	const size_t numPoints = points.size();
+	elemsOut.assign(numPoints, NULL);
+	if(m_nodes.empty() || !m_nodes[0].hasBox)
+		return 0;
+
+//	coherent processing order along a space filling curve
+	std::vector<std::pair<uint64, size_t> > order(numPoints);
+	for(size_t i = 0; i < numPoints; ++i){
+		order[i].first = PointLocatorMortonKey<world_dim>(points[i], m_nodes[0].box);
+		order[i].second = i;
+	}
+	std::sort(order.begin(), order.end());
+
+	int numChunks = 1;
+	#ifdef UG_OPENMP
+		numChunks = NumOMPChunks(numPoints, 1024);
+	#endif
+
+	std::vector<size_t> numFound(numChunks, 0);
+
+	#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static, 1) if(numChunks > 1)
+	#endif
+	for(int iChunk = 0; iChunk < numChunks; ++iChunk){
+		const size_t begin = (iChunk * numPoints) / numChunks;
+		const size_t end = ((iChunk + 1) * numPoints) / numChunks;
+
+		TElem* hint = NULL;
+		for(size_t i = begin; i < end; ++i){
+			const size_t ind = order[i].second;
+			TElem* elem = NULL;
+			if(locate(elem, points[ind], hint)){
+				elemsOut[ind] = elem;
+				hint = elem;
+				++numFound[iChunk];
+			}
+		}
+	}
+
+	size_t totalFound = 0;
+	for(int i = 0; i < numChunks; ++i)
+		totalFound += numFound[i];
+	return totalFound;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	incremental updates
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+insert_into_leaf(TElem* elem, int leaf)
+{
+//	the leaf may have been split since the index was stored
+	while(!m_nodes[leaf].is_leaf())
+		leaf = m_nodes[leaf].child[0];
+
+	Node& n = m_nodes[leaf];
+	n.entries.push_back(Entry(elem));
+	m_aaLeaf[elem] = leaf;
+	++m_numElems;
+
+	if(!n.dirty){
+		n.dirty = true;
+		m_dirtyLeafs.push_back(leaf);
+	}
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+remove_from_leaf(TElem* elem)
+{
+	const int leaf = m_aaLeaf[elem];
+	if(leaf < 0)
+		return;
+
+	Node& n = m_nodes[leaf];
+	std::vector<Entry>& entries = n.entries;
+	for(size_t i = 0; i < entries.size(); ++i){
+		if(entries[i].elem == elem){
+			entries[i] = entries.back();
+			entries.pop_back();
+			break;
+		}
+	}
+	m_aaLeaf[elem] = -1;
+	--m_numElems;
+
+	if(!n.dirty){
+		n.dirty = true;
+		m_dirtyLeafs.push_back(leaf);
+	}
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+elem_created(TElem* elem, GridObject* pParent, bool replacesParent)
+{
+	if(!pParent || pParent->base_object_id() != TElem::BASE_OBJECT_ID)
+		return;
+
+	TElem* parent = static_cast<TElem*>(pParent);
+	const int leaf = leaf_of_parent(parent);
+	if(leaf < 0)
+		return;
+
+//	children replace their parents in the surface view. If replacesParent
+//	is true, the parent is removed by the following erase callback.
+	insert_into_leaf(elem, leaf);
+	if(!replacesParent && m_aaLeaf[parent] >= 0){
+		remove_from_leaf(parent);
+		m_aaLeaf[parent] = replaced_code(leaf);
+	}
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+elem_to_be_erased(TElem* elem, TElem* replacedBy)
+{
+	const int leaf = m_aaLeaf[elem];
+	if(leaf < 0)
+		return;
+
+	remove_from_leaf(elem);
+	if(replacedBy)
+		return;
+
+//	in a MultiGrid the parent of a coarsened element becomes a surface element
+	MultiGrid* mg = dynamic_cast<MultiGrid*>(m_pGrid);
+	if(mg){
+		GridObject* pParent = mg->get_parent(elem);
+		if(pParent && (pParent->base_object_id() == TElem::BASE_OBJECT_ID)){
+			TElem* parent = static_cast<TElem*>(pParent);
+			if(m_aaLeaf[parent] < 0)
+				insert_into_leaf(parent, leaf);
+		}
+	}
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+grid_to_be_destroyed(Grid*)
+{
+	m_pGrid = NULL;
+	m_incremental = false;
+	m_nodes.clear();
+	m_dirtyLeafs.clear();
+	m_numElems = 0;
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+elements_to_be_cleared(Grid*)
+{
+	clear();
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+edge_created(Grid*, Edge* e, GridObject* pParent, bool replacesParent)
+{
+	elem_created(e, pParent, replacesParent);
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+face_created(Grid*, Face* f, GridObject* pParent, bool replacesParent)
+{
+	elem_created(f, pParent, replacesParent);
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+volume_created(Grid*, Volume* vol, GridObject* pParent, bool replacesParent)
+{
+	elem_created(vol, pParent, replacesParent);
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+edge_to_be_erased(Grid*, Edge* e, Edge* replacedBy)
+{
+	elem_to_be_erased(e, replacedBy);
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+face_to_be_erased(Grid*, Face* f, Face* replacedBy)
+{
+	elem_to_be_erased(f, replacedBy);
+}
+
+template <class TElem, int world_dim>
+void PointLocator<TElem, world_dim>::
+volume_to_be_erased(Grid*, Volume* vol, Volume* replacedBy)
+{
+	elem_to_be_erased(vol, replacedBy);
+}
+
+}//	end of namespace
+
+#endif
@@ -148,5 +148,80 @@ void CheckAssociatedVolumesOfEdges(Grid& g)
 	g.end_marking();
 }
 
+///	collects the elements of type TElem associated with each vertex of g
+template <class TElem, class TIter>
+static void CollectAssociatedOfVertices(std::vector<std::vector<TElem*> >& vvElems,
+										Grid& g, bool useIterators,
+										TIter (Grid::*assocBegin)(Vertex*),
+										TIter (Grid::*assocEnd)(Vertex*))
+{
+	typedef typename Grid::traits<TElem>::secure_container	container_t;
+
+	vvElems.clear();
+	for(VertexIterator iter = g.vertices_begin(); iter != g.vertices_end(); ++iter){
+		Vertex* vrt = *iter;
+		vvElems.push_back(std::vector<TElem*>());
+		std::vector<TElem*>& vElems = vvElems.back();
+		if(useIterators){
+			TIter iterEnd = (g.*assocEnd)(vrt);
+			for(TIter i = (g.*assocBegin)(vrt); i != iterEnd; ++i)
+				vElems.push_back(*i);
+		}
+		else{
+			container_t elems;
+			g.associated_elements(elems, vrt);
+			for(size_t i = 0; i < elems.size(); ++i)
+				vElems.push_back(elems[i]);
+		}
+	}
+}
+
+template <class TElem, class TIter>
+static void CompareFrozenAndThawed(Grid& g, const char* elemName,
+								   TIter (Grid::*assocBegin)(Vertex*),
+								   TIter (Grid::*assocEnd)(Vertex*))
+{
+	std::vector<std::vector<TElem*> > vvThawed, vvFrozen;
+
+	for(int useIterators = 0; useIterators < 2; ++useIterators){
+		g.thaw_topology();
+		CollectAssociatedOfVertices(vvThawed, g, useIterators, assocBegin, assocEnd);
+		g.freeze_topology();
+		CollectAssociatedOfVertices(vvFrozen, g, useIterators, assocBegin, assocEnd);
+
+		UG_COND_THROW(vvThawed.size() != vvFrozen.size(),
+					  "Number of vertices differs between thawed and frozen grid.");
+		for(size_t i = 0; i < vvThawed.size(); ++i){
+			if(vvThawed[i] != vvFrozen[i]){
+				UG_THROW("Associated " << elemName << " of vertex " << i
+						 << " differ between thawed and frozen grid ("
+						 << vvThawed[i].size() << " thawed, "
+						 << vvFrozen[i].size() << " frozen"
+						 << (useIterators ? ", using iterators)." : ")."));
+			}
+		}
+	}
+}
+
+void CheckFrozenTopology(Grid& g)
+{
+	const bool wasFrozen = g.topology_frozen();
+
+	if(g.option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+		CompareFrozenAndThawed<Edge, Grid::AssociatedEdgeIterator>(g, "edges",
+				&Grid::associated_edges_begin, &Grid::associated_edges_end);
+	if(g.option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+		CompareFrozenAndThawed<Face, Grid::AssociatedFaceIterator>(g, "faces",
+				&Grid::associated_faces_begin, &Grid::associated_faces_end);
+	if(g.option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+		CompareFrozenAndThawed<Volume, Grid::AssociatedVolumeIterator>(g, "volumes",
+				&Grid::associated_volumes_begin, &Grid::associated_volumes_end);
+
+	if(wasFrozen)
+		g.freeze_topology();
+	else
+		g.thaw_topology();
+}
+
 }//	end of namespace
 }//	end of namespace
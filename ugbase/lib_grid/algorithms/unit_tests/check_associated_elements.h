@@ -54,6 +54,17 @@ void CheckAssociatedEdgesOfVolumes(Grid& g);
  * If something is wrong, the method throws an instance of UGError.
  */
 void CheckAssociatedVolumesOfEdges(Grid& g);
+
+/**
+ * compares the elements associated with each vertex of g in the thawed state
+ * with those returned in the frozen state (see Grid::freeze_topology).
+ * Both associated_elements and the associated_..._begin/end ranges have
+ * to return the same elements in the same order. The grid is left in the
+ * state in which it was passed.
+ *
+ * If something is wrong, the method throws an instance of UGError.
+ */
+void CheckFrozenTopology(Grid& g);
 }//	end of namespace
 }//	end of namespace
 
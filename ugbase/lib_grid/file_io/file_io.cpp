@@ -52,6 +52,7 @@
 #include "file_io_dump.h"
 #include "file_io_ncdf.h"
 #include "file_io_ugx.h"
+#include "file_io_ugxb.h"
 #include "file_io_msh.h"
 #include "file_io_stl.h"
 #include "file_io_tikz.h"
@@ -186,7 +187,16 @@ static bool LoadGrid(Grid& grid, ISubsetHandler* psh,
 	//	handled. Then all those which only work with 3d position types are processed.
 		string tfile = FindFileInStandardPaths(filename);
 		if(!tfile.empty()){
-			if(tfile.find(".ugx") != string::npos){
+			if(tfile.find(".ugxb") != string::npos){
+				if(psh)
+					retVal = LoadGridFromUGXB(grid, *psh, tfile.c_str(), aPos);
+				else{
+				//	we have to create a temporary subset handler
+					SubsetHandler shTmp(grid);
+					retVal = LoadGridFromUGXB(grid, shTmp, tfile.c_str(), aPos);
+				}
+			}
+			else if(tfile.find(".ugx") != string::npos){
 				if(psh)
 					retVal = LoadGridFromUGX(grid, *psh, tfile.c_str(), aPos);
 				else{
@@ -334,7 +344,15 @@ static bool SaveGrid(Grid& grid, ISubsetHandler* psh,
 					 const char* filename, TAPos& aPos)
 {
 	string strName = filename;
-	if(strName.find(".ugx") != string::npos){
+	if(strName.find(".ugxb") != string::npos){
+		if(psh)
+			return SaveGridToUGXB(grid, *psh, filename, aPos);
+		else {
+			SubsetHandler shTmp(grid);
+			return SaveGridToUGXB(grid, shTmp, filename, aPos);
+		}
+	}
+	else if(strName.find(".ugx") != string::npos){
 		if(psh)
 			return SaveGridToUGX(grid, *psh, filename, aPos);
 		else {
@@ -38,6 +38,7 @@
 #include "lib_grid/lg_base.h"
 #include "lib_grid/algorithms/geom_obj_util/geom_obj_util.h"
 #include "lib_grid/algorithms/attachment_util.h"
+#include "common/util/fast_number_parser.h"
 using namespace std;
 
 namespace ug
@@ -62,7 +63,7 @@ static void ReadIndices(vector<int>& vIndsOut, char* buffer,
 		
 	while(tok)
 	{
-		vIndsOut.push_back(atoi(tok));
+		vIndsOut.push_back(StringToInt(tok));
 		tok = strtok(NULL, delim);
 	}
 }
@@ -351,11 +352,11 @@ bool LoadGridFromART(Grid& grid, const char* filename,
 		RegularVertex* v = *grid.create<RegularVertex>();
 	//	read the coordinates
 //TODO:	make sure that everything is ok.
-		aaPos[v].x() = atof(tok);
+		aaPos[v].x() = StringToDouble(tok);
 		tok = strtok(NULL, delim);
-		aaPos[v].y() = atof(tok);
+		aaPos[v].y() = StringToDouble(tok);
 		tok = strtok(NULL, delim);
-		aaPos[v].z() = atof(tok);
+		aaPos[v].z() = StringToDouble(tok);
 
 	//	store the vertex in an array
 		vVrts.push_back(v);
@@ -381,11 +382,11 @@ bool LoadGridFromART(Grid& grid, const char* filename,
 	//	read the indices
 //TODO:	make sure that everything is ok.
 		int i1, i2;
-		//int si = atoi(tok);
+		//int si = StringToInt(tok);
 		tok = strtok(NULL, delim);
-		i1 = atoi(tok);
+		i1 = StringToInt(tok);
 		tok = strtok(NULL, delim);
-		i2 = atoi(tok);
+		i2 = StringToInt(tok);
 
 	//	create a new edge
 		RegularEdge* e = *grid.create<RegularEdge>(EdgeDescriptor(vVrts[i1], vVrts[i2]));
@@ -420,7 +421,7 @@ bool LoadGridFromART(Grid& grid, const char* filename,
 		if(*tok == '$')
 			break;
 
-		int si = atoi(tok);
+		int si = StringToInt(tok);
 		
 	//	read the indices
 		ReadIndices(vInds, buf, delim, false);
@@ -490,7 +491,7 @@ bool LoadGridFromART(Grid& grid, const char* filename,
 		if(*tok == '$')
 			break;
 
-		int si = atoi(tok);
+		int si = StringToInt(tok);
 		
 	//	read the indices
 		ReadIndices(vInds, buf, delim, false);
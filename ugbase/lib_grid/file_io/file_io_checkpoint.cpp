@@ -0,0 +1,483 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <algorithm>
+#include <cstdio>
+#include "common/common.h"
+#include "file_io_checkpoint.h"
+#include "lib_grid/algorithms/serialization.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl_base.h"
+	#include "pcl/parallel_file.h"
+	#include "lib_grid/parallelization/distributed_grid.h"
+	#include "lib_grid/parallelization/parallelization_util.h"
+#endif
+
+using namespace std;
+
+namespace ug
+{
+
+static const int CHECKPOINT_MAGIC = 0x50434755;	// "UGCP"
+static const int CHECKPOINT_VERSION = 1;
+
+static int CheckpointLocalProc()
+{
+	#ifdef UG_PARALLEL
+		return pcl::ProcRank();
+	#else
+		return 0;
+	#endif
+}
+
+static int CheckpointNumProcs()
+{
+	#ifdef UG_PARALLEL
+		return pcl::NumProcs();
+	#else
+		return 1;
+	#endif
+}
+
+///	the process which reads the given part (see pcl::PartitionedParallelFileTargetProc)
+static int CheckpointPartTargetProc(int part, int numParts, int numProcs)
+{
+	const int numReaders = std::min(numParts, numProcs);
+	return (int)(((long long)part * numReaders) / numParts);
+}
+
+
+void WriteCheckpointFile(BinaryBuffer& buf, const char* filename)
+{
+	#ifdef UG_PARALLEL
+		pcl::WritePartitionedParallelFile(buf, filename);
+	#else
+		FILE* file = fopen(filename, "wb");
+		UG_COND_THROW(!file, "WriteCheckpointFile: could not open " << filename);
+
+		const uint64 size = buf.write_pos();
+		uint64 header[3] = {1, 3 * sizeof(uint64), 3 * sizeof(uint64) + size};
+		bool success = (fwrite(header, sizeof(uint64), 3, file) == 3);
+		if(size > 0)
+			success &= (fwrite(buf.buffer(), 1, size, file) == size);
+		fclose(file);
+
+		UG_COND_THROW(!success, "WriteCheckpointFile: could not write " << filename);
+	#endif
+}
+
+int ReadCheckpointFile(std::vector<BinaryBuffer>& bufsOut, const char* filename)
+{
+	#ifdef UG_PARALLEL
+		int firstPart;
+		return pcl::ReadPartitionedParallelFile(bufsOut, firstPart, filename);
+	#else
+		FILE* file = fopen(filename, "rb");
+		UG_COND_THROW(!file, "ReadCheckpointFile: could not open " << filename);
+
+		uint64 numParts = 0;
+		bool success = (fread(&numParts, sizeof(uint64), 1, file) == 1)
+						&& (numParts > 0) && (numParts < ((uint64)1 << 31));
+
+		vector<uint64> offsets;
+		if(success){
+			offsets.resize(numParts + 1);
+			success = (fread(&offsets.front(), sizeof(uint64), offsets.size(), file)
+						== offsets.size());
+		}
+
+	//	a serial process reads all parts. They are stored consecutively.
+		if(success){
+			bufsOut.clear();
+			bufsOut.resize(numParts);
+			for(size_t i = 0; i < numParts && success; ++i){
+				const uint64 size = offsets[i + 1] - offsets[i];
+				if(size == 0)
+					continue;
+				bufsOut[i].reserve(size);
+				success = (fread(bufsOut[i].buffer(), 1, size, file) == size);
+				bufsOut[i].set_write_pos(size);
+			}
+		}
+		fclose(file);
+
+		UG_COND_THROW(!success, "ReadCheckpointFile: could not read " << filename);
+		return (int)numParts;
+	#endif
+}
+
+
+////////////////////////////////////////////////////////////////////////
+//	GridCheckpointWriter
+GridCheckpointWriter::
+GridCheckpointWriter(MultiGrid& mg) :
+	m_mg(mg),
+	m_attachedIDs(false)
+{
+	m_mg.attach_to_all(m_aInd);
+	m_aaInd.access(m_mg, m_aInd);
+}
+
+GridCheckpointWriter::
+~GridCheckpointWriter()
+{
+	m_mg.detach_from_all(m_aInd);
+	if(m_attachedIDs)
+		m_mg.detach_from_all(aGeomObjID);
+}
+
+template <class TElem>
+static void AssignLocalGeomObjIDs(MultiGrid& mg, int localProc)
+{
+	Grid::AttachmentAccessor<TElem, AGeomObjID> aaID(mg, aGeomObjID);
+	size_t count = 0;
+	for(typename MultiGrid::traits<TElem>::iterator iter = mg.begin<TElem>();
+		iter != mg.end<TElem>(); ++iter, ++count)
+	{
+		aaID[*iter] = MakeGeomObjID(localProc, count);
+	}
+}
+
+void GridCheckpointWriter::
+write_elements(BinaryBuffer& out, int worldDim)
+{
+//	global ids are required to merge parts on read
+	if(!m_mg.has_vertex_attachment(aGeomObjID)){
+		m_attachedIDs = true;
+		m_mg.attach_to_all(aGeomObjID);
+	}
+
+	#ifdef UG_PARALLEL
+	if(m_mg.is_parallel()){
+		GridLayoutMap& glm = m_mg.distributed_grid_manager()->grid_layout_map();
+		CreateAndDistributeGlobalIDs<Vertex>(m_mg, glm);
+		CreateAndDistributeGlobalIDs<Edge>(m_mg, glm);
+		CreateAndDistributeGlobalIDs<Face>(m_mg, glm);
+		CreateAndDistributeGlobalIDs<Volume>(m_mg, glm);
+	}
+	else
+	#endif
+	{
+		const int localProc = CheckpointLocalProc();
+		AssignLocalGeomObjIDs<Vertex>(m_mg, localProc);
+		AssignLocalGeomObjIDs<Edge>(m_mg, localProc);
+		AssignLocalGeomObjIDs<Face>(m_mg, localProc);
+		AssignLocalGeomObjIDs<Volume>(m_mg, localProc);
+	}
+
+	int header[5] = {CHECKPOINT_MAGIC, CHECKPOINT_VERSION, CheckpointNumProcs(),
+					 CheckpointLocalProc(), worldDim};
+	out.write((const char*)header, sizeof(header));
+
+	MultiElementAttachmentAccessor<AGeomObjID> aaID(m_mg, aGeomObjID);
+	if(!SerializeMultiGridElements(m_mg, m_mg.get_grid_objects(), m_aaInd, out, &aaID))
+		UG_THROW("GridCheckpointWriter: serialization of grid elements failed.");
+
+	collect_elements(m_vVrts);
+	collect_elements(m_vEdges);
+	collect_elements(m_vFaces);
+	collect_elements(m_vVols);
+}
+
+template <class TElem>
+void GridCheckpointWriter::
+collect_elements(std::vector<TElem*>& elemsOut)
+{
+	elemsOut.clear();
+	elemsOut.resize(m_mg.num<TElem>(), NULL);
+	for(typename MultiGrid::traits<TElem>::iterator iter = m_mg.begin<TElem>();
+		iter != m_mg.end<TElem>(); ++iter)
+	{
+		int ind = m_aaInd[*iter];
+		UG_ASSERT(ind >= 0 && ind < (int)elemsOut.size(), "Bad element index: " << ind);
+		elemsOut[ind] = *iter;
+	}
+}
+
+void GridCheckpointWriter::
+write_subsets_and_layouts(BinaryBuffer& out, ISubsetHandler& sh)
+{
+//	an empty goc writes the subset infos only
+	SerializeSubsetHandler(m_mg, sh, GridObjectCollection(), out);
+	write_subset_indices(out, sh, m_vVrts);
+	write_subset_indices(out, sh, m_vEdges);
+	write_subset_indices(out, sh, m_vFaces);
+	write_subset_indices(out, sh, m_vVols);
+
+	write_interfaces<Vertex>(out);
+	write_interfaces<Edge>(out);
+	write_interfaces<Face>(out);
+	write_interfaces<Volume>(out);
+}
+
+template <class TElem>
+void GridCheckpointWriter::
+write_subset_indices(BinaryBuffer& out, ISubsetHandler& sh,
+					 const std::vector<TElem*>& elems)
+{
+	vector<int> si(elems.size());
+	for(size_t i = 0; i < elems.size(); ++i)
+		si[i] = sh.get_subset_index(elems[i]);
+	if(!si.empty())
+		out.write((const char*)&si.front(), si.size() * sizeof(int));
+}
+
+/**	Interfaces are written as a sequence of (nodeType, proc, numEntries,
+ *	entries), where entries are element indices. The sequence is terminated
+ *	by a nodeType of 0.*/
+template <class TElem>
+void GridCheckpointWriter::
+write_interfaces(BinaryBuffer& out)
+{
+	#ifdef UG_PARALLEL
+	if(m_mg.is_parallel()){
+		typedef typename GridLayoutMap::Types<TElem>::Layout	Layout;
+		typedef typename Layout::Interface						Interface;
+
+		GridLayoutMap& glm = m_mg.distributed_grid_manager()->grid_layout_map();
+		const int nodeTypes[] = {INT_H_MASTER, INT_H_SLAVE, INT_V_MASTER, INT_V_SLAVE};
+		vector<int> inds;
+
+		for(size_t i = 0; i < 4; ++i){
+			if(!glm.has_layout<TElem>(nodeTypes[i]))
+				continue;
+
+			Layout& layout = glm.get_layout<TElem>(nodeTypes[i]);
+			for(size_t lvl = 0; lvl < layout.num_levels(); ++lvl){
+				for(typename Layout::iterator iiter = layout.begin(lvl);
+					iiter != layout.end(lvl); ++iiter)
+				{
+					Interface& itfc = layout.interface(iiter);
+					if(itfc.empty())
+						continue;
+
+					inds.clear();
+					for(typename Interface::iterator iter = itfc.begin();
+						iter != itfc.end(); ++iter)
+					{
+						inds.push_back(m_aaInd[itfc.get_element(iter)]);
+					}
+
+					int header[3] = {nodeTypes[i], layout.proc_id(iiter), (int)inds.size()};
+					out.write((const char*)header, sizeof(header));
+					out.write((const char*)&inds.front(), inds.size() * sizeof(int));
+				}
+			}
+		}
+	}
+	#endif
+
+	int terminator = 0;
+	out.write((const char*)&terminator, sizeof(int));
+}
+
+
+////////////////////////////////////////////////////////////////////////
+//	GridCheckpointReader
+GridCheckpointReader::
+GridCheckpointReader(MultiGrid& mg, ISubsetHandler& sh) :
+	m_mg(mg),
+	m_sh(sh),
+	m_attachedIDs(false),
+	m_partProc(0),
+	m_numParts(0)
+{
+	if(!m_mg.has_vertex_attachment(aGeomObjID)){
+		m_attachedIDs = true;
+		m_mg.attach_to_all(aGeomObjID);
+	}
+
+//	interfaces are created in finish
+	#ifdef UG_PARALLEL
+	if(m_mg.is_parallel())
+		m_mg.distributed_grid_manager()->enable_interface_management(false);
+	#endif
+}
+
+GridCheckpointReader::
+~GridCheckpointReader()
+{
+	if(m_attachedIDs)
+		m_mg.detach_from_all(aGeomObjID);
+}
+
+int GridCheckpointReader::
+read_elements(BinaryBuffer& in)
+{
+	int header[5];
+	in.read((char*)header, sizeof(header));
+	UG_COND_THROW(header[0] != CHECKPOINT_MAGIC,
+				  "GridCheckpointReader: invalid checkpoint data.");
+	UG_COND_THROW(header[1] != CHECKPOINT_VERSION,
+				  "GridCheckpointReader: unsupported checkpoint version: " << header[1]);
+
+	if(m_numParts == 0)
+		m_numParts = header[2];
+	UG_COND_THROW(m_numParts != header[2],
+				  "GridCheckpointReader: parts of different checkpoints can't be combined.");
+	m_partProc = header[3];
+
+	MultiElementAttachmentAccessor<AGeomObjID> aaID(m_mg, aGeomObjID);
+	if(!DeserializeMultiGridElements(m_mg, in, &m_vVrts, &m_vEdges,
+									 &m_vFaces, &m_vVols, &aaID))
+	{
+		UG_THROW("GridCheckpointReader: deserialization of grid elements failed "
+				 "for part " << m_partProc << ".");
+	}
+
+	return header[4];
+}
+
+void GridCheckpointReader::
+read_subsets_and_layouts(BinaryBuffer& in)
+{
+	DeserializeSubsetHandler(m_mg, m_sh, GridObjectCollection(), in);
+	read_subset_indices(in, m_vVrts);
+	read_subset_indices(in, m_vEdges);
+	read_subset_indices(in, m_vFaces);
+	read_subset_indices(in, m_vVols);
+
+	read_interfaces(in, m_vVrts, m_vVrtEntries);
+	read_interfaces(in, m_vEdges, m_vEdgeEntries);
+	read_interfaces(in, m_vFaces, m_vFaceEntries);
+	read_interfaces(in, m_vVols, m_vVolEntries);
+}
+
+template <class TElem>
+void GridCheckpointReader::
+read_subset_indices(BinaryBuffer& in, const std::vector<TElem*>& elems)
+{
+	vector<int> si(elems.size());
+	if(!si.empty())
+		in.read((char*)&si.front(), si.size() * sizeof(int));
+	for(size_t i = 0; i < elems.size(); ++i)
+		m_sh.assign_subset(elems[i], si[i]);
+}
+
+/**	Interfaces to parts which are read by the local process, too, are
+ *	dropped, since the corresponding elements were merged. All other
+ *	target processes are translated to the processes which read the
+ *	respective parts.*/
+template <class TElem>
+void GridCheckpointReader::
+read_interfaces(BinaryBuffer& in, const std::vector<TElem*>& elems,
+				std::vector<InterfaceEntry<TElem> >& entriesOut)
+{
+	const int localProc = CheckpointLocalProc();
+	const int numProcs = CheckpointNumProcs();
+
+	MultiElementAttachmentAccessor<AGeomObjID> aaID(m_mg, aGeomObjID);
+	vector<int> inds;
+
+	while(1){
+		int nodeType;
+		in.read((char*)&nodeType, sizeof(int));
+		if(nodeType == 0)
+			break;
+
+		int proc, num;
+		in.read((char*)&proc, sizeof(int));
+		in.read((char*)&num, sizeof(int));
+		UG_COND_THROW(proc < 0 || proc >= m_numParts || num < 0,
+					  "GridCheckpointReader: invalid interface in part " << m_partProc);
+
+		inds.resize(num);
+		if(num > 0)
+			in.read((char*)&inds.front(), num * sizeof(int));
+
+		const int newProc = CheckpointPartTargetProc(proc, m_numParts, numProcs);
+		if(newProc == localProc)
+			continue;
+
+		InterfaceEntry<TElem> entry;
+		entry.nodeType = nodeType;
+		entry.proc = newProc;
+		for(size_t i = 0; i < inds.size(); ++i){
+			UG_COND_THROW(inds[i] < 0 || inds[i] >= (int)elems.size(),
+						  "GridCheckpointReader: invalid interface entry in part " << m_partProc);
+			entry.elem = elems[inds[i]];
+			entry.id = aaID[entry.elem];
+			entriesOut.push_back(entry);
+		}
+	}
+}
+
+#ifdef UG_PARALLEL
+/**	Entries are sorted by node type, target process and global id. Since
+ *	this happens on both sides of each interface, the interface entries match.*/
+template <class TElem>
+void GridCheckpointReader::
+create_interfaces(std::vector<InterfaceEntry<TElem> >& entries)
+{
+	GridLayoutMap& glm = m_mg.distributed_grid_manager()->grid_layout_map();
+
+	sort(entries.begin(), entries.end());
+	for(size_t i = 0; i < entries.size(); ++i){
+		InterfaceEntry<TElem>& e = entries[i];
+	//	an element may be referenced by several merged parts
+		if(i > 0){
+			InterfaceEntry<TElem>& prev = entries[i - 1];
+			if(prev.elem == e.elem && prev.nodeType == e.nodeType && prev.proc == e.proc)
+				continue;
+		}
+		glm.get_layout<TElem>(e.nodeType).interface(e.proc, m_mg.get_level(e.elem))
+			.push_back(e.elem);
+	}
+}
+#endif
+
+void GridCheckpointReader::
+finish()
+{
+	#ifdef UG_PARALLEL
+	if(m_mg.is_parallel()){
+		create_interfaces(m_vVrtEntries);
+		create_interfaces(m_vEdgeEntries);
+		create_interfaces(m_vFaceEntries);
+		create_interfaces(m_vVolEntries);
+
+		DistributedGridManager& distGridMgr = *m_mg.distributed_grid_manager();
+		distGridMgr.grid_layout_map().remove_empty_interfaces();
+		distGridMgr.enable_interface_management(true);
+		distGridMgr.grid_layouts_changed(false);
+	}
+	#endif
+
+	m_vVrtEntries.clear();
+	m_vEdgeEntries.clear();
+	m_vFaceEntries.clear();
+	m_vVolEntries.clear();
+}
+
+}//	end of namespace
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__LIB_GRID__FILE_IO_CHECKPOINT__
+#define __H__LIB_GRID__FILE_IO_CHECKPOINT__
+
+#include <vector>
+#include "common/util/binary_buffer.h"
+#include "lib_grid/multi_grid.h"
+#include "lib_grid/tools/subset_handler_interface.h"
+#include "lib_grid/common_attachments.h"
+#include "lib_grid/parallelization/grid_object_id.h"
+
+namespace ug
+{
+
+////////////////////////////////////////////////////////////////////////
+//	Checkpoints
+/**	A checkpoint file contains one part per process which wrote it. Each
+ *	part holds the local multi-grid of the writing process (all levels,
+ *	including global ids, vertex positions and subset indices) and, in
+ *	parallel environments, the interfaces of its grid layouts. Arbitrary
+ *	data may be appended to each part, e.g. values of grid functions (see
+ *	ug::Checkpoint in lib_disc).
+ *
+ *	If a checkpoint is read on the same number of processes by which it was
+ *	written, each process reads the part it wrote and the distributed grid
+ *	is restored exactly - no refinement or redistribution is performed.
+ *	If the number of processes differs, the parts are read by the first
+ *	numReaders = min(numParts, numProcs) processes, part p by process
+ *	p * numReaders / numParts. Processes which read several parts merge them
+ *	by the global ids of their elements and the interfaces are translated
+ *	accordingly. If there are more processes than parts, the processes
+ *	numParts, ..., numProcs-1 remain empty and the grid has to be
+ *	redistributed afterwards (ug::Checkpoint does this automatically).
+ *
+ *	The file consists of a uint64 holding the number of parts, numParts+1
+ *	uint64 offsets and the data of the parts. Files can thus exceed 2GB.
+ */
+
+///	Writes the local checkpoint part of each process to a single file.
+/**	In parallel environments this is a collective operation. Throws an
+ *	instance of UGError if the file could not be written.*/
+void WriteCheckpointFile(BinaryBuffer& buf, const char* filename);
+
+///	Reads the checkpoint parts which are assigned to the local process.
+/**	In parallel environments this is a collective operation. Processes to
+ *	which no part is assigned return an empty bufsOut. Throws an instance
+ *	of UGError if the file could not be read.
+ *	\returns	the total number of parts in the file.*/
+int ReadCheckpointFile(std::vector<BinaryBuffer>& bufsOut, const char* filename);
+
+
+///	Writes a checkpoint of a (distributed) multi-grid.
+/**	Since the type of the position attachment is a template parameter,
+ *	ug::aPosition, ug::aPosition2 and ug::aPosition1 are supported.*/
+template <class TAPosition>
+void SaveGridCheckpoint(MultiGrid& mg, ISubsetHandler& sh,
+						const char* filename, TAPosition& aPos);
+
+///	Restores a (distributed) multi-grid from a checkpoint.
+/**	The multi-grid should be empty. aPos is attached if necessary.*/
+template <class TAPosition>
+void LoadGridCheckpoint(MultiGrid& mg, ISubsetHandler& sh,
+						const char* filename, TAPosition& aPos);
+
+
+////////////////////////////////////////////////////////////////////////
+///	Writes the local part of a (distributed) multi-grid to a checkpoint buffer.
+/**	During write, the elements of each base type are enumerated in the order
+ *	in which they are written. The enumerated elements can be accessed
+ *	through elements() until the writer is destroyed, so that data associated
+ *	with elements may be appended to the buffer in the same order.
+ *	GridCheckpointReader provides the elements in the identical order.
+ *
+ *	In parallel environments, write has to be called on all processes, since
+ *	global ids have to be communicated.
+ */
+class GridCheckpointWriter
+{
+	public:
+		GridCheckpointWriter(MultiGrid& mg);
+		~GridCheckpointWriter();
+
+		template <class TAPosition>
+		void write(BinaryBuffer& out, ISubsetHandler& sh, TAPosition& aPos);
+
+	///	the written elements of the given base type in the order of writing
+		template <class TElem>
+		const std::vector<TElem*>& elements() const;
+
+	protected:
+	///	writes the header and the elements and collects them in m_vVrts, ...
+		void write_elements(BinaryBuffer& out, int worldDim);
+	///	writes subset infos and indices and the interfaces of the grid layouts
+		void write_subsets_and_layouts(BinaryBuffer& out, ISubsetHandler& sh);
+
+		template <class TElem>
+		void collect_elements(std::vector<TElem*>& elemsOut);
+
+		template <class TElem>
+		void write_subset_indices(BinaryBuffer& out, ISubsetHandler& sh,
+								  const std::vector<TElem*>& elems);
+
+		template <class TElem>
+		void write_interfaces(BinaryBuffer& out);
+
+	protected:
+		MultiGrid&		m_mg;
+		AInt			m_aInd;
+		MultiElementAttachmentAccessor<AInt>	m_aaInd;
+		bool			m_attachedIDs;
+
+		std::vector<Vertex*>	m_vVrts;
+		std::vector<Edge*>		m_vEdges;
+		std::vector<Face*>		m_vFaces;
+		std::vector<Volume*>	m_vVols;
+};
+
+
+////////////////////////////////////////////////////////////////////////
+///	Restores a (distributed) multi-grid from the parts of a checkpoint.
+/**	Call read_part for each part returned by ReadCheckpointFile, then
+ *	call finish on all processes. After read_part returned, the elements of
+ *	the part which was read last are accessible through elements(), in the
+ *	same order as in GridCheckpointWriter::elements, and the read position of
+ *	the buffer points to the data appended by the writer.
+ */
+class GridCheckpointReader
+{
+	public:
+		GridCheckpointReader(MultiGrid& mg, ISubsetHandler& sh);
+		~GridCheckpointReader();
+
+	///	reads a part which was written by GridCheckpointWriter::write
+	/**	Elements which were already created by a previously read part are
+	 *	identified through their global ids and are not created again.*/
+		template <class TAPosition>
+		void read_part(BinaryBuffer& in, TAPosition& aPos);
+
+	///	the elements of the given base type of the part which was read last
+		template <class TElem>
+		const std::vector<TElem*>& elements() const;
+
+	///	creates the grid layouts from the interfaces of all parts.
+	/**	In parallel environments this has to be called on all processes,
+	 *	after all parts were read.*/
+		void finish();
+
+	protected:
+	///	reads the header and the elements. Returns the world dimension of the part.
+		int read_elements(BinaryBuffer& in);
+	///	reads subset infos and indices and the interfaces of the grid layouts
+		void read_subsets_and_layouts(BinaryBuffer& in);
+
+		template <class TElem>
+		void read_subset_indices(BinaryBuffer& in, const std::vector<TElem*>& elems);
+
+		template <class TElem>
+		struct InterfaceEntry{
+			TElem*		elem;
+			GeomObjID	id;
+			int			nodeType;
+			int			proc;
+
+			bool operator<(const InterfaceEntry& e) const
+			{
+				if(nodeType != e.nodeType)
+					return nodeType < e.nodeType;
+				if(proc != e.proc)
+					return proc < e.proc;
+				return id < e.id;
+			}
+		};
+
+		template <class TElem>
+		void read_interfaces(BinaryBuffer& in, const std::vector<TElem*>& elems,
+							 std::vector<InterfaceEntry<TElem> >& entriesOut);
+
+		template <class TElem>
+		void create_interfaces(std::vector<InterfaceEntry<TElem> >& entries);
+
+	protected:
+		MultiGrid&			m_mg;
+		ISubsetHandler&		m_sh;
+		bool				m_attachedIDs;
+		int					m_partProc;
+		int					m_numParts;
+
+		std::vector<Vertex*>	m_vVrts;
+		std::vector<Edge*>		m_vEdges;
+		std::vector<Face*>		m_vFaces;
+		std::vector<Volume*>	m_vVols;
+
+		std::vector<InterfaceEntry<Vertex> >	m_vVrtEntries;
+		std::vector<InterfaceEntry<Edge> >		m_vEdgeEntries;
+		std::vector<InterfaceEntry<Face> >		m_vFaceEntries;
+		std::vector<InterfaceEntry<Volume> >	m_vVolEntries;
+};
+
+}//	end of namespace
+
+////////////////////////////////
+//	include implementation
+#include "file_io_checkpoint_impl.hpp"
+
+#endif
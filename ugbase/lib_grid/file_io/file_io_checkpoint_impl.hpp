@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__LIB_GRID__FILE_IO_CHECKPOINT_IMPL__
+#define __H__LIB_GRID__FILE_IO_CHECKPOINT_IMPL__
+
+#include "common/error.h"
+
+namespace ug
+{
+
+template <class TAPosition>
+void SaveGridCheckpoint(MultiGrid& mg, ISubsetHandler& sh,
+						const char* filename, TAPosition& aPos)
+{
+	BinaryBuffer buf;
+	{
+		GridCheckpointWriter writer(mg);
+		writer.write(buf, sh, aPos);
+	}
+	WriteCheckpointFile(buf, filename);
+}
+
+template <class TAPosition>
+void LoadGridCheckpoint(MultiGrid& mg, ISubsetHandler& sh,
+						const char* filename, TAPosition& aPos)
+{
+	std::vector<BinaryBuffer> bufs;
+	ReadCheckpointFile(bufs, filename);
+
+	GridCheckpointReader reader(mg, sh);
+	for(size_t i = 0; i < bufs.size(); ++i){
+		reader.read_part(bufs[i], aPos);
+	//	free memory as early as possible
+		bufs[i] = BinaryBuffer();
+	}
+	reader.finish();
+}
+
+
+////////////////////////////////////////////////////////////////////////
+template <class TAPosition>
+void GridCheckpointWriter::
+write(BinaryBuffer& out, ISubsetHandler& sh, TAPosition& aPos)
+{
+	typedef typename TAPosition::ValueType	TPos;
+
+	UG_COND_THROW(!m_mg.has_vertex_attachment(aPos),
+				  "GridCheckpointWriter: position attachment is not attached to the vertices of the grid.");
+
+	write_elements(out, TPos::Size);
+
+	Grid::VertexAttachmentAccessor<TAPosition> aaPos(m_mg, aPos);
+	for(size_t i = 0; i < m_vVrts.size(); ++i)
+		out.write((const char*)&aaPos[m_vVrts[i]], sizeof(TPos));
+
+	write_subsets_and_layouts(out, sh);
+}
+
+template <> inline const std::vector<Vertex*>& GridCheckpointWriter::elements<Vertex>() const	{return m_vVrts;}
+template <> inline const std::vector<Edge*>& GridCheckpointWriter::elements<Edge>() const		{return m_vEdges;}
+template <> inline const std::vector<Face*>& GridCheckpointWriter::elements<Face>() const		{return m_vFaces;}
+template <> inline const std::vector<Volume*>& GridCheckpointWriter::elements<Volume>() const	{return m_vVols;}
+
+
+////////////////////////////////////////////////////////////////////////
+template <class TAPosition>
+void GridCheckpointReader::
+read_part(BinaryBuffer& in, TAPosition& aPos)
+{
+	typedef typename TAPosition::ValueType	TPos;
+
+	int worldDim = read_elements(in);
+	UG_COND_THROW(worldDim != TPos::Size,
+				  "GridCheckpointReader: checkpoint was written with world dimension "
+				  << worldDim << ", but a position attachment of dimension "
+				  << TPos::Size << " was specified.");
+
+	if(!m_mg.has_vertex_attachment(aPos))
+		m_mg.attach_to_vertices(aPos);
+
+	Grid::VertexAttachmentAccessor<TAPosition> aaPos(m_mg, aPos);
+	for(size_t i = 0; i < m_vVrts.size(); ++i)
+		in.read((char*)&aaPos[m_vVrts[i]], sizeof(TPos));
+
+	read_subsets_and_layouts(in);
+}
+
+template <> inline const std::vector<Vertex*>& GridCheckpointReader::elements<Vertex>() const	{return m_vVrts;}
+template <> inline const std::vector<Edge*>& GridCheckpointReader::elements<Edge>() const		{return m_vEdges;}
+template <> inline const std::vector<Face*>& GridCheckpointReader::elements<Face>() const		{return m_vFaces;}
+template <> inline const std::vector<Volume*>& GridCheckpointReader::elements<Volume>() const	{return m_vVols;}
+
+}//	end of namespace
+
+#endif
@@ -33,6 +33,7 @@
 #include <fstream>
 #include "file_io_dump.h"
 #include "common/util/loader/loader_util.h"
+#include "common/util/fast_number_parser.h"
 #include "lib_grid/lg_base.h"
 
 using namespace std;
@@ -77,9 +78,9 @@ static bool ReadTriangles(Grid& grid, ifstream& in,
 				for(int i = 0; i < 3; ++i)
 				{
 					v[i] = *grid.create<RegularVertex>();
-					aaPos[v[i]].x() = atof(paramVec[i*3].c_str());
-					aaPos[v[i]].y() = atof(paramVec[i*3 + 1].c_str());
-					aaPos[v[i]].z() = atof(paramVec[i*3 + 2].c_str());
+					aaPos[v[i]].x() = StringToDouble(paramVec[i*3].c_str());
+					aaPos[v[i]].y() = StringToDouble(paramVec[i*3 + 1].c_str());
+					aaPos[v[i]].z() = StringToDouble(paramVec[i*3 + 2].c_str());
 				}
 			//	create a triangle
 				grid.create<Triangle>(TriangleDescriptor(v[0], v[1], v[2]));
@@ -136,9 +137,9 @@ static bool ReadTetrahedrons(Grid& grid, ifstream& in,
 				for(int i = 0; i < 4; ++i)
 				{
 					v[i] = *grid.create<RegularVertex>();
-					aaPos[v[i]].x() = atof(paramVec[i*3].c_str());
-					aaPos[v[i]].y() = atof(paramVec[i*3 + 1].c_str());
-					aaPos[v[i]].z() = atof(paramVec[i*3 + 2].c_str());
+					aaPos[v[i]].x() = StringToDouble(paramVec[i*3].c_str());
+					aaPos[v[i]].y() = StringToDouble(paramVec[i*3 + 1].c_str());
+					aaPos[v[i]].z() = StringToDouble(paramVec[i*3 + 2].c_str());
 				}
 			//	create a triangle
 				grid.create<Tetrahedron>(TetrahedronDescriptor(v[0], v[1], v[2], v[3]));
@@ -215,7 +216,7 @@ bool LoadGridFromDUMP(Grid& grid, const char* filename,
 				
 				if(paramVec.size() > 2){
 					if(pSH)
-						pSH->set_default_subset_index(atoi(paramVec[2].c_str()));
+						pSH->set_default_subset_index(StringToInt(paramVec[2].c_str()));
 				}
 				
 			//	check second paramenter
@@ -30,13 +30,14 @@
  * GNU Lesser General Public License for more details.
  */
 
-#include <fstream>
 #include <vector>
 #include <string>
 #include <cctype>
 #include <algorithm>
 #include "file_io_msh.h"
 #include "../lg_base.h"
+#include "common/util/fast_number_parser.h"
+#include "common/util/file_util.h"
 
 using namespace std;
 
@@ -50,12 +51,14 @@ bool LoadGridFromMSH(Grid& grid, const char* filename,
 		grid.attach_to_vertices(aPos);
 	Grid::VertexAttachmentAccessor<APosition> aaPos(grid, aPos);
 
-//	open the file
-	ifstream in(filename);
-	if(!in){
+//	read the whole file. Numbers are parsed from memory, which is a lot
+//	faster than parsing them through an ifstream.
+	vector<char> fileContent;
+	if(!ReadFile(filename, fileContent, true)){
 		UG_LOG("File not found: " << filename << "\n");
 		return false;
 	}
+	FastNumberStream in(&fileContent.front(), fileContent.size() - 1);
 //	this buffer is used to find the commands
 	string buffer;	
 	
@@ -35,6 +35,7 @@
 #include "file_io_stl.h"
 #include "common/util/loader/loader_util.h"
 #include "common/util/string_util.h"
+#include "common/util/fast_number_parser.h"
 #include "lib_grid/lg_base.h"
 #include "lib_grid/algorithms/geom_obj_util/face_util.h"
 
@@ -124,9 +125,9 @@ bool LoadGridFromSTL_ASCII(Grid& grid, const char* filename,
 				
 				vector3 v;
 			//	read the position
-				v.x() = atof(paramVec[1].c_str());
-				v.y() = atof(paramVec[2].c_str());
-				v.z() = atof(paramVec[3].c_str());
+				v.x() = StringToDouble(paramVec[1].c_str());
+				v.y() = StringToDouble(paramVec[2].c_str());
+				v.z() = StringToDouble(paramVec[3].c_str());
 				
 				positions.push_back(v);
 			}
@@ -147,9 +148,9 @@ bool LoadGridFromSTL_ASCII(Grid& grid, const char* filename,
 				}
 				
 			//	read the normal
-				n.x() = atof(paramVec[2].c_str());
-				n.y() = atof(paramVec[3].c_str());
-				n.z() = atof(paramVec[4].c_str());
+				n.x() = StringToDouble(paramVec[2].c_str());
+				n.y() = StringToDouble(paramVec[3].c_str());
+				n.z() = StringToDouble(paramVec[4].c_str());
 			}
 			else if(str.compare("outer") == 0){
 				bool ok = false;
@@ -34,12 +34,23 @@
 #include "file_io_tetgen.h"
 #include "common/util/string_util.h"
 #include "../lg_base.h"
+#include "common/util/fast_number_parser.h"
+#include "common/util/file_util.h"
 
 using namespace std;
 
 namespace ug
 {
 
+///	reads the whole file into bufOut, which is null terminated in any case.
+static bool ReadTextFile(vector<char>& bufOut, const char* filename)
+{
+	if(ReadFile(filename, bufOut, true))
+		return true;
+	bufOut.assign(1, 0);
+	return false;
+}
+
 ////////////////////////////////////////////////////////////////////////
 bool LoadGridFromELE(Grid& grid, const char* filename, ISubsetHandler* pSH,
 					APosition& aPos)
@@ -136,8 +147,10 @@ bool ImportGridFromTETGEN(Grid& grid,
 	vector<RegularVertex*>	vVertices;
 
 	{
-		ifstream in(nodesFilename);
-		if(!in)
+		vector<char> fileContent;
+		bool fileFound = ReadTextFile(fileContent, nodesFilename);
+		FastNumberStream in(&fileContent.front(), fileContent.size() - 1);
+		if(!fileFound)
 		{
 			LOG("WARNING in ImportGridFromTETGEN: nodes file not found: " << nodesFilename << endl);
 			return false;
@@ -200,15 +213,15 @@ bool ImportGridFromTETGEN(Grid& grid,
 					aaBMVRT[v] = bm;
 			}
 		}
-
-		in.close();
 	}
 
 //	read faces
 	if(facesFilename != NULL)
 	{
-		ifstream in(facesFilename);
-		if(in)
+		vector<char> fileContent;
+		bool fileFound = ReadTextFile(fileContent, facesFilename);
+		FastNumberStream in(&fileContent.front(), fileContent.size() - 1);
+		if(fileFound)
 		{
 			int numFaces, numBoundaryMarkers;
 			in >> numFaces;
@@ -246,15 +259,15 @@ bool ImportGridFromTETGEN(Grid& grid,
 		}
 		else
 			LOG("WARNING in ImportGridFromTETGEN: faces file not found: " << facesFilename << endl);
-
-		in.close();
 	}
 
 //	read volumes
 	if(elemsFilename != NULL)
 	{
-		ifstream in(elemsFilename);
-		if(in)
+		vector<char> fileContent;
+		bool fileFound = ReadTextFile(fileContent, elemsFilename);
+		FastNumberStream in(&fileContent.front(), fileContent.size() - 1);
+		if(fileFound)
 		{
 			int numTets, numNodesPerTet, numAttribs;
 			in >> numTets;
@@ -289,8 +302,6 @@ bool ImportGridFromTETGEN(Grid& grid,
 		}
 		else
 			LOG("WARNING in ImportGridFromTETGEN: elems file not found: " << elemsFilename << endl);
-
-		in.close();
 	}
 
 	return true;
@@ -309,8 +320,10 @@ bool ImportGridFromTETGEN(Grid& grid,
 	vector<RegularVertex*>	vVertices;
 
 	{
-		ifstream in(nodesFilename);
-		if(!in)
+		vector<char> fileContent;
+		bool fileFound = ReadTextFile(fileContent, nodesFilename);
+		FastNumberStream in(&fileContent.front(), fileContent.size() - 1);
+		if(!fileFound)
 		{
 			LOG("WARNING in ImportGridFromTETGEN: nodes file not found: " << nodesFilename << endl);
 			return false;
@@ -369,15 +382,15 @@ bool ImportGridFromTETGEN(Grid& grid,
 					psh->assign_subset(v, bm);
 			}
 		}
-
-		in.close();
 	}
 
 //	read faces
 	if(facesFilename != NULL)
 	{
-		ifstream in(facesFilename);
-		if(in)
+		vector<char> fileContent;
+		bool fileFound = ReadTextFile(fileContent, facesFilename);
+		FastNumberStream in(&fileContent.front(), fileContent.size() - 1);
+		if(fileFound)
 		{
 			int numFaces, numBoundaryMarkers;
 			in >> numFaces;
@@ -404,15 +417,15 @@ bool ImportGridFromTETGEN(Grid& grid,
 		}
 		else
 			LOG("WARNING in ImportGridFromTETGEN: faces file not found: " << facesFilename << endl);
-
-		in.close();
 	}
 
 //	read volumes
 	if(elemsFilename != NULL)
 	{
-		ifstream in(elemsFilename);
-		if(in)
+		vector<char> fileContent;
+		bool fileFound = ReadTextFile(fileContent, elemsFilename);
+		FastNumberStream in(&fileContent.front(), fileContent.size() - 1);
+		if(fileFound)
 		{
 			int numTets, numNodesPerTet, numAttribs;
 			in >> numTets;
@@ -440,8 +453,6 @@ bool ImportGridFromTETGEN(Grid& grid,
 		}
 		else
 			LOG("WARNING in ImportGridFromTETGEN: elems file not found: " << elemsFilename << endl);
-
-		in.close();
 	}
 
 	return true;
@@ -34,6 +34,8 @@
 #include <vector>
 #include "file_io_txt.h"
 #include "../lg_base.h"
+#include "common/util/fast_number_parser.h"
+#include "common/util/file_util.h"
 
 using namespace std;
 
@@ -42,22 +44,22 @@ namespace ug
 
 bool LoadGridFromTXT(Grid& grid, const char* filename, AVector3& aPos)
 {
-	ifstream in(filename);
-
-	if(!in)
+	vector<char> fileContent;
+	if(!ReadFile(filename, fileContent, true))
 		return false;
 
+	FastNumberStream in(&fileContent.front(), fileContent.size() - 1);
+
 	//grid.clear();
 
-	int numVrts, numTris;
+	int numVrts = 0, numTris = 0;
 
 	in >> numVrts;
 	in >> numTris;
 
 //	create points
 //	store pointers to the vertices on the fly in a vector.
-	vector<Vertex*>	vVrts;
-	vVrts.reserve(numVrts);
+	vector<Vertex*>	vVrts(numVrts);
 
 	for(int i = 0; i < numVrts; ++i)
 		vVrts[i] = *grid.create<RegularVertex>();
@@ -68,13 +70,13 @@ bool LoadGridFromTXT(Grid& grid, const char* filename, AVector3& aPos)
 
 //	read the points
 	{
-		for(VertexIterator iter = grid.vertices_begin(); iter != grid.vertices_end(); ++iter)
+		for(int i = 0; i < numVrts; ++i)
 		{
 			int Index;
 			in >> Index;
-			in >> aaPos[*iter].x();
-			in >> aaPos[*iter].y();
-			in >> aaPos[*iter].z();
+			in >> aaPos[vVrts[i]].x();
+			in >> aaPos[vVrts[i]].y();
+			in >> aaPos[vVrts[i]].z();
 		}
 	}
 
@@ -91,7 +93,6 @@ bool LoadGridFromTXT(Grid& grid, const char* filename, AVector3& aPos)
 		}
 	}
 
-	in.close();
 	return true;
 }
 
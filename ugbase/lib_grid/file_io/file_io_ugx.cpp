@@ -38,6 +38,7 @@
 #include "common/boost_serialization_routines.h"
 #include "common/parser/rapidxml/rapidxml_print.hpp"
 #include "common/util/archivar.h"
+#include "common/util/fast_number_parser.h"
 #include "common/util/factory.h"
 #include "lib_grid/algorithms/attachment_util.h"
 #include "lib_grid/refinement/projectors/projectors.h"
@@ -1053,7 +1054,7 @@ read_subset_handler_elements(ISubsetHandler& shOut,
 	while(elemNode)
 	{
 	//	read the indices
-		stringstream ss(elemNode->value(), ios_base::in);
+		FastNumberStream ss(elemNode->value(), elemNode->value_size());
 
 		size_t index;
 		while(!ss.eof()){
@@ -1159,7 +1160,7 @@ read_selector_elements(ISelector& selOut, const char* elemNodeName,
 	while(elemNode)
 	{
 	//	read the indices
-		stringstream ss(elemNode->value(), ios_base::in);
+		FastNumberStream ss(elemNode->value(), elemNode->value_size());
 
 		size_t index;
 		int state;
@@ -1366,37 +1367,44 @@ new_document_parsed()
 	return true;
 }
 
+///	reads the corner indices of all elements in the given node
+/**	Only complete elements are read. Returns false if an index does not
+ * reference one of the numVrts vertices.*/
+static bool ReadElementIndices(vector<int>& indsOut, rapidxml::xml_node<>* node,
+							   size_t numCorners, size_t numVrts,
+							   const char* caller)
+{
+	if(!ParseNumberBlock(indsOut, node->value(), node->value_size())
+	   || indsOut.size() % numCorners != 0)
+	{
+		UG_LOG("  ERROR in GridReaderUGX::" << caller << ": invalid entry in section '"
+				<< node->name() << "'.\n");
+		return false;
+	}
+
+	for(size_t i = 0; i < indsOut.size(); ++i){
+		if(indsOut[i] < 0 || indsOut[i] >= (int)numVrts){
+			UG_LOG("  ERROR in GridReaderUGX::" << caller << ": invalid vertex index: "
+					<< indsOut[i] << "\n");
+			return false;
+		}
+	}
+	return true;
+}
+
 bool GridReaderUGX::
 create_edges(std::vector<Edge*>& edgesOut,
 			Grid& grid, rapidxml::xml_node<>* node,
 			std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	read the edges
-	int i1, i2;
-	while(!ss.eof()){
-	//	read the indices
-		ss >> i1 >> i2;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-	//	make sure that the indices are valid
-		int maxInd = (int)vrts.size() - 1;
-		if(i1 < 0 || i1 > maxInd ||
-		   i2 < 0 || i2 > maxInd)
-		{
-			UG_LOG("  ERROR in GridReaderUGX::create_edges: invalid vertex index: "
-					"(" << i1 << ", " << i2 << ")\n");
-			return false;
-		}
+	vector<int> inds;
+	if(!ReadElementIndices(inds, node, 2, vrts.size(), "create_edges"))
+		return false;
 
-	//	create the edge
-		edgesOut.push_back(*grid.create<RegularEdge>(EdgeDescriptor(vrts[i1], vrts[i2])));
+	edgesOut.reserve(edgesOut.size() + inds.size() / 2);
+	for(size_t i = 0; i < inds.size(); i += 2){
+		edgesOut.push_back(
+			*grid.create<RegularEdge>(EdgeDescriptor(vrts[inds[i]], vrts[inds[i + 1]])));
 	}
 
 	return true;
@@ -1407,31 +1415,14 @@ create_constraining_edges(std::vector<Edge*>& edgesOut,
 						  Grid& grid, rapidxml::xml_node<>* node,
 			 			  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	read the edges
-	int i1, i2;
-	while(!ss.eof()){
-	//	read the indices
-		ss >> i1 >> i2;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-	//	make sure that the indices are valid
-		int maxInd = (int)vrts.size() - 1;
-		if(i1 < 0 || i1 > maxInd ||
-		   i2 < 0 || i2 > maxInd)
-		{
-			UG_LOG("  ERROR in GridReaderUGX::create_constraining_edges: invalid vertex index.\n");
-			return false;
-		}
+	vector<int> inds;
+	if(!ReadElementIndices(inds, node, 2, vrts.size(), "create_constraining_edges"))
+		return false;
 
-	//	create the edge
-		edgesOut.push_back(*grid.create<ConstrainingEdge>(EdgeDescriptor(vrts[i1], vrts[i2])));
+	edgesOut.reserve(edgesOut.size() + inds.size() / 2);
+	for(size_t i = 0; i < inds.size(); i += 2){
+		edgesOut.push_back(
+			*grid.create<ConstrainingEdge>(EdgeDescriptor(vrts[inds[i]], vrts[inds[i + 1]])));
 	}
 
 	return true;
@@ -1443,9 +1434,8 @@ create_constrained_edges(std::vector<Edge*>& edgesOut,
 						  Grid& grid, rapidxml::xml_node<>* node,
 			 			  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a stream with which we can access the data
+	FastNumberStream ss(node->value(), node->value_size());
 
 //	read the edges
 	int i1, i2;
@@ -1489,33 +1479,14 @@ create_triangles(std::vector<Face*>& facesOut,
 				  Grid& grid, rapidxml::xml_node<>* node,
 				  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	read the triangles
-	int i1, i2, i3;
-	while(!ss.eof()){
-	//	read the indices
-		ss >> i1 >> i2 >> i3;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-	//	make sure that the indices are valid
-		int maxInd = (int)vrts.size() - 1;
-		if(i1 < 0 || i1 > maxInd ||
-		   i2 < 0 || i2 > maxInd ||
-		   i3 < 0 || i3 > maxInd)
-		{
-			UG_LOG("  ERROR in GridReaderUGX::create_triangles: invalid vertex index.\n");
-			return false;
-		}
+	vector<int> inds;
+	if(!ReadElementIndices(inds, node, 3, vrts.size(), "create_triangles"))
+		return false;
 
-	//	create the triangle
+	facesOut.reserve(facesOut.size() + inds.size() / 3);
+	for(size_t i = 0; i < inds.size(); i += 3){
 		facesOut.push_back(
-			*grid.create<Triangle>(TriangleDescriptor(vrts[i1], vrts[i2], vrts[i3])));
+			*grid.create<Triangle>(TriangleDescriptor(vrts[inds[i]], vrts[inds[i + 1]], vrts[inds[i + 2]])));
 	}
 
 	return true;
@@ -1526,33 +1497,14 @@ create_constraining_triangles(std::vector<Face*>& facesOut,
 					  Grid& grid, rapidxml::xml_node<>* node,
 					  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	read the triangles
-	int i1, i2, i3;
-	while(!ss.eof()){
-	//	read the indices
-		ss >> i1 >> i2 >> i3;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-	//	make sure that the indices are valid
-		int maxInd = (int)vrts.size() - 1;
-		if(i1 < 0 || i1 > maxInd ||
-		   i2 < 0 || i2 > maxInd ||
-		   i3 < 0 || i3 > maxInd)
-		{
-			UG_LOG("  ERROR in GridReaderUGX::create_constraining_triangles: invalid vertex index.\n");
-			return false;
-		}
+	vector<int> inds;
+	if(!ReadElementIndices(inds, node, 3, vrts.size(), "create_constraining_triangles"))
+		return false;
 
-	//	create the triangle
+	facesOut.reserve(facesOut.size() + inds.size() / 3);
+	for(size_t i = 0; i < inds.size(); i += 3){
 		facesOut.push_back(
-			*grid.create<ConstrainingTriangle>(TriangleDescriptor(vrts[i1], vrts[i2], vrts[i3])));
+			*grid.create<ConstrainingTriangle>(TriangleDescriptor(vrts[inds[i]], vrts[inds[i + 1]], vrts[inds[i + 2]])));
 	}
 
 	return true;
@@ -1564,9 +1516,8 @@ create_constrained_triangles(std::vector<Face*>& facesOut,
 					  Grid& grid, rapidxml::xml_node<>* node,
 					  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a stream with which we can access the data
+	FastNumberStream ss(node->value(), node->value_size());
 
 //	read the triangles
 	int i1, i2, i3;
@@ -1611,35 +1562,15 @@ create_quadrilaterals(std::vector<Face*>& facesOut,
 					   Grid& grid, rapidxml::xml_node<>* node,
 					   std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	read the quadrilaterals
-	int i1, i2, i3, i4;
-	while(!ss.eof()){
-	//	read the indices
-		ss >> i1 >> i2 >> i3 >> i4;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-	//	make sure that the indices are valid
-		int maxInd = (int)vrts.size() - 1;
-		if(i1 < 0 || i1 > maxInd ||
-		   i2 < 0 || i2 > maxInd ||
-		   i3 < 0 || i3 > maxInd ||
-		   i4 < 0 || i4 > maxInd)
-		{
-			UG_LOG("  ERROR in GridReaderUGX::create_quadrilaterals: invalid vertex index.\n");
-			return false;
-		}
+	vector<int> inds;
+	if(!ReadElementIndices(inds, node, 4, vrts.size(), "create_quadrilaterals"))
+		return false;
 
-	//	create the quad
+	facesOut.reserve(facesOut.size() + inds.size() / 4);
+	for(size_t i = 0; i < inds.size(); i += 4){
 		facesOut.push_back(
-			*grid.create<Quadrilateral>(QuadrilateralDescriptor(vrts[i1], vrts[i2],
-															   vrts[i3], vrts[i4])));
+			*grid.create<Quadrilateral>(QuadrilateralDescriptor(vrts[inds[i]], vrts[inds[i + 1]],
+														   vrts[inds[i + 2]], vrts[inds[i + 3]])));
 	}
 
 	return true;
@@ -1650,36 +1581,16 @@ create_constraining_quadrilaterals(std::vector<Face*>& facesOut,
 					  Grid& grid, rapidxml::xml_node<>* node,
 					  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	read the quadrilaterals
-	int i1, i2, i3, i4;
-	while(!ss.eof()){
-	//	read the indices
-		ss >> i1 >> i2 >> i3 >> i4;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-	//	make sure that the indices are valid
-		int maxInd = (int)vrts.size() - 1;
-		if(i1 < 0 || i1 > maxInd ||
-		   i2 < 0 || i2 > maxInd ||
-		   i3 < 0 || i3 > maxInd ||
-		   i4 < 0 || i4 > maxInd)
-		{
-			UG_LOG("  ERROR in GridReaderUGX::create_quadrilaterals: invalid vertex index.\n");
-			return false;
-		}
+	vector<int> inds;
+	if(!ReadElementIndices(inds, node, 4, vrts.size(), "create_constraining_quadrilaterals"))
+		return false;
 
-	//	create the quad
+	facesOut.reserve(facesOut.size() + inds.size() / 4);
+	for(size_t i = 0; i < inds.size(); i += 4){
 		facesOut.push_back(
 			*grid.create<ConstrainingQuadrilateral>(QuadrilateralDescriptor(
-															vrts[i1], vrts[i2],
-															vrts[i3], vrts[i4])));
+														vrts[inds[i]], vrts[inds[i + 1]],
+														vrts[inds[i + 2]], vrts[inds[i + 3]])));
 	}
 
 	return true;
@@ -1691,9 +1602,8 @@ create_constrained_quadrilaterals(std::vector<Face*>& facesOut,
 					  Grid& grid, rapidxml::xml_node<>* node,
 					  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a stream with which we can access the data
+	FastNumberStream ss(node->value(), node->value_size());
 
 //	read the quadrilaterals
 	int i1, i2, i3, i4;
@@ -1742,35 +1652,15 @@ create_tetrahedrons(std::vector<Volume*>& volsOut,
 					 Grid& grid, rapidxml::xml_node<>* node,
 					 std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	read the tetrahedrons
-	int i1, i2, i3, i4;
-	while(!ss.eof()){
-	//	read the indices
-		ss >> i1 >> i2 >> i3 >> i4;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-	//	make sure that the indices are valid
-		int maxInd = (int)vrts.size() - 1;
-		if(i1 < 0 || i1 > maxInd ||
-		   i2 < 0 || i2 > maxInd ||
-		   i3 < 0 || i3 > maxInd ||
-		   i4 < 0 || i4 > maxInd)
-		{
-			UG_LOG("  ERROR in GridReaderUGX::create_tetrahedrons: invalid vertex index.\n");
-			return false;
-		}
+	vector<int> inds;
+	if(!ReadElementIndices(inds, node, 4, vrts.size(), "create_tetrahedrons"))
+		return false;
 
-	//	create the element
+	volsOut.reserve(volsOut.size() + inds.size() / 4);
+	for(size_t i = 0; i < inds.size(); i += 4){
 		volsOut.push_back(
-			*grid.create<Tetrahedron>(TetrahedronDescriptor(vrts[i1], vrts[i2],
-														   vrts[i3], vrts[i4])));
+			*grid.create<Tetrahedron>(TetrahedronDescriptor(vrts[inds[i]], vrts[inds[i + 1]],
+													   vrts[inds[i + 2]], vrts[inds[i + 3]])));
 	}
 
 	return true;
@@ -1781,39 +1671,15 @@ create_hexahedrons(std::vector<Volume*>& volsOut,
 					Grid& grid, rapidxml::xml_node<>* node,
 					std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	read the hexahedrons
-	int i1, i2, i3, i4, i5, i6, i7, i8;
-	while(!ss.eof()){
-	//	read the indices
-		ss >> i1 >> i2 >> i3 >> i4 >> i5 >> i6 >> i7 >> i8;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-	//	make sure that the indices are valid
-		int maxInd = (int)vrts.size() - 1;
-		if(i1 < 0 || i1 > maxInd ||
-		   i2 < 0 || i2 > maxInd ||
-		   i3 < 0 || i3 > maxInd ||
-		   i4 < 0 || i4 > maxInd ||
-		   i5 < 0 || i5 > maxInd ||
-		   i6 < 0 || i6 > maxInd ||
-		   i7 < 0 || i7 > maxInd ||
-		   i8 < 0 || i8 > maxInd)
-		{
-			UG_LOG("  ERROR in GridReaderUGX::create_hexahedrons: invalid vertex index.\n");
-			return false;
-		}
+	vector<int> inds;
+	if(!ReadElementIndices(inds, node, 8, vrts.size(), "create_hexahedrons"))
+		return false;
 
-	//	create the element
+	volsOut.reserve(volsOut.size() + inds.size() / 8);
+	for(size_t i = 0; i < inds.size(); i += 8){
 		volsOut.push_back(
-			*grid.create<Hexahedron>(HexahedronDescriptor(vrts[i1], vrts[i2], vrts[i3], vrts[i4],
-														  vrts[i5], vrts[i6], vrts[i7], vrts[i8])));
+			*grid.create<Hexahedron>(HexahedronDescriptor(vrts[inds[i]], vrts[inds[i + 1]], vrts[inds[i + 2]], vrts[inds[i + 3]],
+													  vrts[inds[i + 4]], vrts[inds[i + 5]], vrts[inds[i + 6]], vrts[inds[i + 7]])));
 	}
 
 	return true;
@@ -1824,37 +1690,15 @@ create_prisms(std::vector<Volume*>& volsOut,
 			  Grid& grid, rapidxml::xml_node<>* node,
 			  std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	read the hexahedrons
-	int i1, i2, i3, i4, i5, i6;
-	while(!ss.eof()){
-	//	read the indices
-		ss >> i1 >> i2 >> i3 >> i4 >> i5 >> i6;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-	//	make sure that the indices are valid
-		int maxInd = (int)vrts.size() - 1;
-		if(i1 < 0 || i1 > maxInd ||
-		   i2 < 0 || i2 > maxInd ||
-		   i3 < 0 || i3 > maxInd ||
-		   i4 < 0 || i4 > maxInd ||
-		   i5 < 0 || i5 > maxInd ||
-		   i6 < 0 || i6 > maxInd)
-		{
-			UG_LOG("  ERROR in GridReaderUGX::create_prisms: invalid vertex index.\n");
-			return false;
-		}
+	vector<int> inds;
+	if(!ReadElementIndices(inds, node, 6, vrts.size(), "create_prisms"))
+		return false;
 
-	//	create the element
+	volsOut.reserve(volsOut.size() + inds.size() / 6);
+	for(size_t i = 0; i < inds.size(); i += 6){
 		volsOut.push_back(
-			*grid.create<Prism>(PrismDescriptor(vrts[i1], vrts[i2], vrts[i3], vrts[i4],
-												vrts[i5], vrts[i6])));
+			*grid.create<Prism>(PrismDescriptor(vrts[inds[i]], vrts[inds[i + 1]], vrts[inds[i + 2]], vrts[inds[i + 3]],
+											vrts[inds[i + 4]], vrts[inds[i + 5]])));
 	}
 
 	return true;
@@ -1865,36 +1709,15 @@ create_pyramids(std::vector<Volume*>& volsOut,
 				Grid& grid, rapidxml::xml_node<>* node,
 				std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	read the hexahedrons
-	int i1, i2, i3, i4, i5;
-	while(!ss.eof()){
-	//	read the indices
-		ss >> i1 >> i2 >> i3 >> i4 >> i5;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-	//	make sure that the indices are valid
-		int maxInd = (int)vrts.size() - 1;
-		if(i1 < 0 || i1 > maxInd ||
-		   i2 < 0 || i2 > maxInd ||
-		   i3 < 0 || i3 > maxInd ||
-		   i4 < 0 || i4 > maxInd ||
-		   i5 < 0 || i5 > maxInd)
-		{
-			UG_LOG("  ERROR in GridReaderUGX::create_pyramids: invalid vertex index.\n");
-			return false;
-		}
+	vector<int> inds;
+	if(!ReadElementIndices(inds, node, 5, vrts.size(), "create_pyramids"))
+		return false;
 
-	//	create the element
+	volsOut.reserve(volsOut.size() + inds.size() / 5);
+	for(size_t i = 0; i < inds.size(); i += 5){
 		volsOut.push_back(
-			*grid.create<Pyramid>(PyramidDescriptor(vrts[i1], vrts[i2], vrts[i3],
-													vrts[i4], vrts[i5])));
+			*grid.create<Pyramid>(PyramidDescriptor(vrts[inds[i]], vrts[inds[i + 1]], vrts[inds[i + 2]],
+												vrts[inds[i + 3]], vrts[inds[i + 4]])));
 	}
 
 	return true;
@@ -1905,37 +1728,15 @@ create_octahedrons(std::vector<Volume*>& volsOut,
 					Grid& grid, rapidxml::xml_node<>* node,
 					std::vector<Vertex*>& vrts)
 {
-//	create a buffer with which we can access the data
-	string str(node->value(), node->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	read the octahedrons
-	int i1, i2, i3, i4, i5, i6;
-	while(!ss.eof()){
-	//	read the indices
-		ss >> i1 >> i2 >> i3 >> i4 >> i5 >> i6;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-	//	make sure that the indices are valid
-		int maxInd = (int)vrts.size() - 1;
-		if(i1 < 0 || i1 > maxInd ||
-		   i2 < 0 || i2 > maxInd ||
-		   i3 < 0 || i3 > maxInd ||
-		   i4 < 0 || i4 > maxInd ||
-		   i5 < 0 || i5 > maxInd ||
-		   i6 < 0 || i6 > maxInd)
-		{
-			UG_LOG("  ERROR in GridReaderUGX::create_octahedrons: invalid vertex index.\n");
-			return false;
-		}
+	vector<int> inds;
+	if(!ReadElementIndices(inds, node, 6, vrts.size(), "create_octahedrons"))
+		return false;
 
-	//	create the element
+	volsOut.reserve(volsOut.size() + inds.size() / 6);
+	for(size_t i = 0; i < inds.size(); i += 6){
 		volsOut.push_back(
-			*grid.create<Octahedron>(OctahedronDescriptor(	vrts[i1], vrts[i2], vrts[i3],
-															vrts[i4], vrts[i5], vrts[i6])));
+			*grid.create<Octahedron>(OctahedronDescriptor(	vrts[inds[i]], vrts[inds[i + 1]], vrts[inds[i + 2]],
+														vrts[inds[i + 3]], vrts[inds[i + 4]], vrts[inds[i + 5]])));
 	}
 
 	return true;
@@ -2196,9 +1997,8 @@ UGXFileInfo::calculate_vertex_node_bbox(rapidxml::xml_node<>* vrtNode, AABox<vec
 	if (numSrcCoords > 3)
 		return false;
 
-//	create a buffer with which we can access the data
-	std::string str(vrtNode->value(), vrtNode->value_size());
-	std::stringstream ss(str, std::ios_base::in);
+//	create a stream with which we can access the data
+	FastNumberStream ss(vrtNode->value(), vrtNode->value_size());
 
 	AABox<vector3> box(vector3(0, 0, 0), vector3(0, 0, 0));
 	vector3 min(0, 0, 0);
@@ -37,6 +37,7 @@
 #include <cstring>
 #include "lib_grid/algorithms/debug_util.h"
 #include "lib_grid/global_attachments.h"
+#include "common/util/fast_number_parser.h"
 
 namespace ug
 {
@@ -700,65 +701,39 @@ create_vertices(std::vector<Vertex*>& vrtsOut, Grid& grid,
 	if(numSrcCoords < 1 || numDestCoords < 1)
 		return false;
 
-//	create a buffer with which we can access the data
-	string str(vrtNode->value(), vrtNode->value_size());
-	stringstream ss(str, ios_base::in);
-
-//	if numDestCoords == numSrcCoords parsing will be faster
-	if(numSrcCoords == numDestCoords){
-		while(!ss.eof()){
-		//	read the data
-			typename TAAPos::ValueType v;
-
-			for(int i = 0; i < numSrcCoords; ++i)
-				ss >> v[i];
+//	parse all coordinates at once. Large blocks are parsed in parallel.
+	typedef typename TAAPos::ValueType::value_type coord_t;
+	vector<coord_t> coords;
+	if(!ParseNumberBlock(coords, vrtNode->value(), vrtNode->value_size())
+	   || coords.size() % numSrcCoords != 0)
+	{
+		UG_LOG("  ERROR in GridReaderUGX::create_vertices: invalid entry in section '"
+				<< vrtNode->name() << "'.\n");
+		return false;
+	}
 
-		//	make sure that everything went right
-			if(ss.fail())
-				break;
+//	if numDestCoords < numSrcCoords we'll ignore some coords,
+//	in the other case we'll add some 0's.
+	int minNumCoords = min(numSrcCoords, numDestCoords);
+	size_t numVrts = coords.size() / numSrcCoords;
 
-		//	create a new vertex
-			RegularVertex* vrt = *grid.create<RegularVertex>();
-			vrtsOut.push_back(vrt);
+	vrtsOut.reserve(vrtsOut.size() + numVrts);
+	for(size_t iVrt = 0; iVrt < numVrts; ++iVrt){
+		const coord_t* c = &coords[iVrt * numSrcCoords];
+		typename TAAPos::ValueType v;
 
-		//	set the coordinates
-			aaPos[vrt] = v;
-		}
-	}
-	else{
-	//	we have to be careful with reading.
-	//	if numDestCoords < numSrcCoords we'll ignore some coords,
-	//	in the other case we'll add some 0's.
-		int minNumCoords = min(numSrcCoords, numDestCoords);
-		typename TAAPos::ValueType::value_type dummy = 0;
-
-		while(!ss.eof()){
-		//	read the data
-			typename TAAPos::ValueType v;
-
-			int iMin;
-			for(iMin = 0; iMin < minNumCoords; ++iMin)
-				ss >> v[iMin];
-
-		//	ignore unused entries in the input buffer
-			for(int i = iMin; i < numSrcCoords; ++i)
-				ss >> dummy;
-
-		//	add 0's to the vector
-			for(int i = iMin; i < numDestCoords; ++i)
-				v[i] = 0;
-
-		//	make sure that everything went right
-			if(ss.fail())
-				break;
+		int i;
+		for(i = 0; i < minNumCoords; ++i)
+			v[i] = c[i];
+		for(; i < numDestCoords; ++i)
+			v[i] = 0;
 
-		//	create a new vertex
-			RegularVertex* vrt = *grid.create<RegularVertex>();
-			vrtsOut.push_back(vrt);
+	//	create a new vertex
+		RegularVertex* vrt = *grid.create<RegularVertex>();
+		vrtsOut.push_back(vrt);
 
-		//	set the coordinates
-			aaPos[vrt] = v;
-		}
+	//	set the coordinates
+		aaPos[vrt] = v;
 	}
 
 	return true;
@@ -785,9 +760,8 @@ create_constrained_vertices(std::vector<Vertex*>& vrtsOut,
 	if(numSrcCoords < 1 || numDestCoords < 1)
 		return false;
 
-//	create a buffer with which we can access the data
-	string str(vrtNode->value(), vrtNode->value_size());
-	stringstream ss(str, ios_base::in);
+//	create a stream with which we can access the data
+	FastNumberStream ss(vrtNode->value(), vrtNode->value_size());
 
 //	we have to be careful with reading.
 //	if numDestCoords < numSrcCoords we'll ignore some coords,
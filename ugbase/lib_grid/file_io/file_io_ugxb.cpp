@@ -0,0 +1,1381 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <fstream>
+#include <algorithm>
+#include <limits>
+#include "common/common.h"
+#include "common/util/binary_buffer.h"
+#include "common/util/smart_pointer.h"
+#include "file_io_ugxb.h"
+#include "file_io_ugx.h"
+#include "lib_grid/global_attachments.h"
+#include "lib_grid/algorithms/serialization.h"
+#include "lib_grid/grid/grid_util.h"
+#include "lib_grid/tools/subset_handler_grid.h"
+#include "lib_grid/tools/selector_grid.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl_base.h"
+	#include "pcl/pcl_process_communicator.h"
+	#include "lib_grid/parallelization/distributed_grid.h"
+#endif
+
+#ifdef UG_POSIX
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+namespace ug
+{
+
+static const char	UGXB_MAGIC[4] = {'U', 'G', 'X', 'B'};
+static const uint32	UGXB_VERSION = 1;
+///	magic, version, world dimension, number of sections, table offset, reserved
+static const size_t	UGXB_HEADER_SIZE = 32;
+///	type, index, objType, reserved, offset, size, count
+static const size_t	UGXB_SECTION_ENTRY_SIZE = 40;
+
+///	element types in the order in which they are stored in a ugxb file
+static const ReferenceObjectID UGXB_ELEM_TYPES[] = {
+		ROID_EDGE, ROID_TRIANGLE, ROID_QUADRILATERAL, ROID_TETRAHEDRON,
+		ROID_HEXAHEDRON, ROID_PRISM, ROID_PYRAMID, ROID_OCTAHEDRON};
+static const int UGXB_ELEM_BASE_TYPES[] = {
+		EDGE, FACE, FACE, VOLUME, VOLUME, VOLUME, VOLUME, VOLUME};
+static const uint32 UGXB_ELEM_NUM_CORNERS[] = {2, 3, 4, 4, 8, 6, 5, 6};
+static const size_t UGXB_NUM_ELEM_TYPES = 8;
+
+
+////////////////////////////////////////////////////////////////////////
+bool SaveGridToUGXB(Grid& grid, ISubsetHandler& sh, const char* filename)
+{
+	if(grid.has_vertex_attachment(aPosition))
+		return SaveGridToUGXB(grid, sh, filename, aPosition);
+	else if(grid.has_vertex_attachment(aPosition2))
+		return SaveGridToUGXB(grid, sh, filename, aPosition2);
+	else if(grid.has_vertex_attachment(aPosition1))
+		return SaveGridToUGXB(grid, sh, filename, aPosition1);
+
+	UG_LOG("ERROR in SaveGridToUGXB: no standard attachment found.\n");
+	return false;
+}
+
+bool LoadGridFromUGXB(Grid& grid, ISubsetHandler& sh, const char* filename,
+					  int siBegin, int siEnd)
+{
+	if(grid.has_vertex_attachment(aPosition))
+		return LoadGridFromUGXB(grid, sh, filename, aPosition, siBegin, siEnd);
+	else if(grid.has_vertex_attachment(aPosition2))
+		return LoadGridFromUGXB(grid, sh, filename, aPosition2, siBegin, siEnd);
+	else if(grid.has_vertex_attachment(aPosition1))
+		return LoadGridFromUGXB(grid, sh, filename, aPosition1, siBegin, siEnd);
+
+//	no standard position attachments are available.
+//	Attach aPosition and use it.
+	grid.attach_to_vertices(aPosition);
+	return LoadGridFromUGXB(grid, sh, filename, aPosition, siBegin, siEnd);
+}
+
+
+////////////////////////////////////////////////////////////////////////
+//	converters
+template <class TAPosition>
+static bool ConvertUGXToUGXB_IMPL(const char* ugxFilename,
+								  const char* ugxbFilename,
+								  TAPosition& aPos)
+{
+	GridReaderUGX ugxReader;
+	if(!ugxReader.parse_file(ugxFilename)){
+		UG_LOG("ERROR in ConvertUGXToUGXB: File not found: " << ugxFilename << endl);
+		return false;
+	}
+
+	if(ugxReader.num_grids() < 1){
+		UG_LOG("ERROR in ConvertUGXToUGXB: File contains no grid.\n");
+		return false;
+	}
+
+	Grid grid;
+	grid.attach_to_vertices(aPos);
+	if(!ugxReader.grid(grid, 0, aPos))
+		return false;
+
+	GridWriterUGXB ugxbWriter;
+	if(!ugxbWriter.add_grid(grid, aPos))
+		return false;
+
+	vector<SmartPtr<SubsetHandler> > vSH;
+	for(size_t i = 0; i < ugxReader.num_subset_handlers(0); ++i){
+		vSH.push_back(make_sp(new SubsetHandler(grid)));
+		ugxReader.subset_handler(*vSH.back(), i, 0);
+		ugxbWriter.add_subset_handler(*vSH.back(),
+									  ugxReader.get_subset_handler_name(0, i));
+	}
+
+	vector<SmartPtr<Selector> > vSel;
+	for(size_t i = 0; i < ugxReader.num_selectors(0); ++i){
+		vSel.push_back(make_sp(new Selector(grid)));
+		ugxReader.selector(*vSel.back(), i, 0);
+		ugxbWriter.add_selector(*vSel.back(), ugxReader.get_selector_name(0, i));
+	}
+
+	return ugxbWriter.write_to_file(ugxbFilename);
+}
+
+bool ConvertUGXToUGXB(const char* ugxFilename, const char* ugxbFilename)
+{
+	UGXFileInfo info;
+	if(!info.parse_file(ugxFilename) || info.num_grids() < 1){
+		UG_LOG("ERROR in ConvertUGXToUGXB: Can't read grid from " << ugxFilename << endl);
+		return false;
+	}
+
+	switch(info.physical_grid_dimension(0)){
+		case 0:
+		case 1:{
+			APosition1 aPos;
+			return ConvertUGXToUGXB_IMPL(ugxFilename, ugxbFilename, aPos);
+		}
+		case 2:{
+			APosition2 aPos;
+			return ConvertUGXToUGXB_IMPL(ugxFilename, ugxbFilename, aPos);
+		}
+		default:{
+			APosition aPos;
+			return ConvertUGXToUGXB_IMPL(ugxFilename, ugxbFilename, aPos);
+		}
+	}
+}
+
+template <class TAPosition>
+static bool ConvertUGXBToUGX_IMPL(GridReaderUGXB& ugxbReader,
+								  const char* ugxFilename,
+								  TAPosition& aPos)
+{
+	Grid grid;
+	grid.attach_to_vertices(aPos);
+	if(!ugxbReader.grid(grid, aPos))
+		return false;
+
+	GridWriterUGX ugxWriter;
+	if(!ugxWriter.add_grid(grid, "defGrid", aPos))
+		return false;
+
+	vector<SmartPtr<SubsetHandler> > vSH;
+	for(size_t i = 0; i < ugxbReader.num_subset_handlers(); ++i){
+		vSH.push_back(make_sp(new SubsetHandler(grid)));
+		if(!ugxbReader.subset_handler(*vSH.back(), i))
+			return false;
+		ugxWriter.add_subset_handler(*vSH.back(),
+									 ugxbReader.get_subset_handler_name(i), 0);
+	}
+
+	vector<SmartPtr<Selector> > vSel;
+	for(size_t i = 0; i < ugxbReader.num_selectors(); ++i){
+		vSel.push_back(make_sp(new Selector(grid)));
+		if(!ugxbReader.selector(*vSel.back(), i))
+			return false;
+		ugxWriter.add_selector(*vSel.back(), ugxbReader.get_selector_name(i), 0);
+	}
+
+	return ugxWriter.write_to_file(ugxFilename);
+}
+
+bool ConvertUGXBToUGX(const char* ugxbFilename, const char* ugxFilename)
+{
+	GridReaderUGXB ugxbReader;
+	if(!ugxbReader.open(ugxbFilename)){
+		UG_LOG("ERROR in ConvertUGXBToUGX: Can't open file: " << ugxbFilename << endl);
+		return false;
+	}
+
+	switch(ugxbReader.world_dimension()){
+		case 1:{
+			APosition1 aPos;
+			return ConvertUGXBToUGX_IMPL(ugxbReader, ugxFilename, aPos);
+		}
+		case 2:{
+			APosition2 aPos;
+			return ConvertUGXBToUGX_IMPL(ugxbReader, ugxFilename, aPos);
+		}
+		default:{
+			APosition aPos;
+			return ConvertUGXBToUGX_IMPL(ugxbReader, ugxFilename, aPos);
+		}
+	}
+}
+
+
+////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////
+//	GridWriterUGXB
+GridWriterUGXB::GridWriterUGXB() :
+	m_pGrid(NULL),
+	m_paPos(NULL),
+	m_worldDim(0),
+	m_writeCoords(NULL)
+{
+}
+
+void GridWriterUGXB::
+add_subset_handler(ISubsetHandler& sh, const char* name)
+{
+	m_vSH.push_back(make_pair(string(name), &sh));
+}
+
+void GridWriterUGXB::
+add_selector(ISelector& sel, const char* name)
+{
+	m_vSel.push_back(make_pair(string(name), &sel));
+}
+
+void GridWriterUGXB::
+write_string(std::ostream& out, const std::string& str)
+{
+	uint32 len = (uint32)str.size();
+	write_array(out, &len, 1);
+	out.write(str.c_str(), str.size());
+}
+
+void GridWriterUGXB::
+align(std::ostream& out)
+{
+//	all sections and the section table start at 8 byte aligned offsets
+	static const char padding[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+	uint64 pos = (uint64)out.tellp();
+	if(pos % 8 != 0)
+		out.write(padding, 8 - pos % 8);
+}
+
+void GridWriterUGXB::
+begin_section(std::ostream& out, uint32 type, uint32 index,
+			  uint32 objType, uint64 count)
+{
+	align(out);
+
+	UGXBSection s;
+	s.type = type;
+	s.index = index;
+	s.objType = objType;
+	s.reserved = 0;
+	s.offset = (uint64)out.tellp();
+	s.size = 0;
+	s.count = count;
+	m_vSections.push_back(s);
+}
+
+void GridWriterUGXB::
+end_section(std::ostream& out)
+{
+	UGXBSection& s = m_vSections.back();
+	s.size = (uint64)out.tellp() - s.offset;
+}
+
+template <class TElem>
+void GridWriterUGXB::
+write_elements(std::ostream& out, AAVrtIndex aaInd)
+{
+	typedef typename Grid::traits<TElem>::iterator iter_t;
+	Grid& grid = *m_pGrid;
+	const size_t chunkSize = 4096;
+
+	if(grid.num<TElem>() == 0)
+		return;
+
+	begin_section(out, UGXB_ELEMENTS, 0,
+				  (uint32)geometry_traits<TElem>::REFERENCE_OBJECT_ID,
+				  grid.num<TElem>());
+
+	vector<uint32> buf;
+	buf.reserve(chunkSize * TElem::NUM_VERTICES);
+	for(iter_t iter = grid.begin<TElem>(); iter != grid.end<TElem>(); ++iter){
+		TElem* e = *iter;
+		for(size_t i = 0; i < TElem::NUM_VERTICES; ++i)
+			buf.push_back((uint32)aaInd[e->vertex(i)]);
+
+		if(buf.size() >= chunkSize * TElem::NUM_VERTICES){
+			write_array(out, &buf.front(), buf.size());
+			buf.clear();
+		}
+	}
+
+	if(!buf.empty())
+		write_array(out, &buf.front(), buf.size());
+
+	end_section(out);
+}
+
+template <class TElem>
+void GridWriterUGXB::
+write_subset_indices(std::ostream& out, ISubsetHandler& sh, uint32 shIndex,
+					 const std::vector<TElem*>& elems)
+{
+	if(elems.empty())
+		return;
+
+	vector<int32> inds(elems.size());
+	for(size_t i = 0; i < elems.size(); ++i)
+		inds[i] = (int32)sh.get_subset_index(elems[i]);
+
+	begin_section(out, UGXB_SUBSET_INDICES, shIndex,
+				  (uint32)TElem::BASE_OBJECT_ID, inds.size());
+	write_array(out, &inds.front(), inds.size());
+	end_section(out);
+}
+
+template <class TElem>
+void GridWriterUGXB::
+write_selection_states(std::ostream& out, ISelector& sel, uint32 selIndex,
+					   const std::vector<TElem*>& elems)
+{
+	if(elems.empty())
+		return;
+
+	vector<ISelector::status_t> states(elems.size());
+	for(size_t i = 0; i < elems.size(); ++i)
+		states[i] = sel.get_selection_status(elems[i]);
+
+	begin_section(out, UGXB_SELECTION_STATES, selIndex,
+				  (uint32)TElem::BASE_OBJECT_ID, states.size());
+	out.write(reinterpret_cast<const char*>(&states.front()), states.size());
+	end_section(out);
+}
+
+template <class TElem>
+void GridWriterUGXB::
+write_global_attachments(std::ostream& out, const std::vector<TElem*>& elems)
+{
+	Grid& grid = *m_pGrid;
+	const vector<string>& attachmentNames = GlobalAttachments::declared_attachment_names();
+
+	for(size_t ia = 0; ia < attachmentNames.size(); ++ia){
+		const std::string& name = attachmentNames[ia];
+		if(!GlobalAttachments::is_attached<TElem>(grid, name))
+			continue;
+
+		GridDataSerializationHandler handler;
+		GlobalAttachments::add_data_serializer<TElem>(handler, grid, name);
+
+		BinaryBuffer buf;
+		handler.serialize(buf, elems.begin(), elems.end());
+
+		begin_section(out, UGXB_ATTACHMENT, (uint32)ia,
+					  (uint32)TElem::BASE_OBJECT_ID, elems.size());
+		write_string(out, name);
+		write_string(out, GlobalAttachments::type_name(name));
+		char passOn = GlobalAttachments::attachment_pass_on_behaviour(name) ? 1 : 0;
+		out.write(&passOn, 1);
+		out.write(buf.buffer(), buf.write_pos());
+		end_section(out);
+	}
+}
+
+bool GridWriterUGXB::
+write_to_file(const char* filename)
+{
+	if(!m_pGrid){
+		UG_LOG("GridWriterUGXB::write_to_file: no grid specified.\n");
+		return false;
+	}
+
+	Grid& grid = *m_pGrid;
+
+//	hanging node grids are not supported
+	if((grid.num<Vertex>() != grid.num<RegularVertex>())
+	   || (grid.num<Edge>() != grid.num<RegularEdge>())
+	   || (grid.num<Face>() != grid.num<Triangle>() + grid.num<Quadrilateral>())
+	   || (grid.num<Volume>() != grid.num<Tetrahedron>() + grid.num<Hexahedron>()
+			   	   	   	   	   + grid.num<Prism>() + grid.num<Pyramid>()
+			   	   	   	   	   + grid.num<Octahedron>()))
+	{
+		UG_LOG("GridWriterUGXB::write_to_file: the grid contains constrained or "
+			   "constraining elements, which are not supported by ugxb. "
+			   "Please use ugx instead.\n");
+		return false;
+	}
+
+	if(grid.num<Vertex>() > (size_t)numeric_limits<uint32>::max()){
+		UG_LOG("GridWriterUGXB::write_to_file: too many vertices.\n");
+		return false;
+	}
+
+	ofstream out(filename, ios::out | ios::binary);
+	if(!out){
+		UG_LOG("GridWriterUGXB::write_to_file: can't open " << filename << endl);
+		return false;
+	}
+
+	m_vSections.clear();
+
+//	the header is written at the end, since it contains the table offset.
+	vector<char> header(UGXB_HEADER_SIZE, 0);
+	out.write(&header.front(), header.size());
+
+//	collect elements in the order in which they are written
+	vector<Vertex*> vrts;
+	vrts.reserve(grid.num<Vertex>());
+	for(RegularVertexIterator iter = grid.begin<RegularVertex>();
+		iter != grid.end<RegularVertex>(); ++iter)
+		vrts.push_back(*iter);
+
+	vector<Edge*> edges(grid.begin<RegularEdge>(), grid.end<RegularEdge>());
+
+	vector<Face*> faces;
+	faces.reserve(grid.num<Face>());
+	faces.insert(faces.end(), grid.begin<Triangle>(), grid.end<Triangle>());
+	faces.insert(faces.end(), grid.begin<Quadrilateral>(), grid.end<Quadrilateral>());
+
+	vector<Volume*> vols;
+	vols.reserve(grid.num<Volume>());
+	vols.insert(vols.end(), grid.begin<Tetrahedron>(), grid.end<Tetrahedron>());
+	vols.insert(vols.end(), grid.begin<Hexahedron>(), grid.end<Hexahedron>());
+	vols.insert(vols.end(), grid.begin<Prism>(), grid.end<Prism>());
+	vols.insert(vols.end(), grid.begin<Pyramid>(), grid.end<Pyramid>());
+	vols.insert(vols.end(), grid.begin<Octahedron>(), grid.end<Octahedron>());
+
+//	vertices
+	begin_section(out, UGXB_VERTICES, 0, 0, vrts.size());
+	m_writeCoords(out, grid, *m_paPos, vrts);
+	end_section(out);
+
+//	elements
+	AInt aInd;
+	grid.attach_to_vertices(aInd);
+	AAVrtIndex aaInd(grid, aInd);
+	for(size_t i = 0; i < vrts.size(); ++i)
+		aaInd[vrts[i]] = (int)i;
+
+	write_elements<RegularEdge>(out, aaInd);
+	write_elements<Triangle>(out, aaInd);
+	write_elements<Quadrilateral>(out, aaInd);
+	write_elements<Tetrahedron>(out, aaInd);
+	write_elements<Hexahedron>(out, aaInd);
+	write_elements<Prism>(out, aaInd);
+	write_elements<Pyramid>(out, aaInd);
+	write_elements<Octahedron>(out, aaInd);
+
+	grid.detach_from_vertices(aInd);
+
+//	subset handlers
+	for(size_t ish = 0; ish < m_vSH.size(); ++ish){
+		ISubsetHandler& sh = *m_vSH[ish].second;
+		begin_section(out, UGXB_SUBSET_HANDLER, (uint32)ish, 0, sh.num_subsets());
+		write_string(out, m_vSH[ish].first);
+		uint32 numSubsets = (uint32)sh.num_subsets();
+		write_array(out, &numSubsets, 1);
+		for(int i = 0; i < sh.num_subsets(); ++i){
+			const SubsetInfo& si = sh.subset_info(i);
+			write_string(out, si.name);
+			double color[4];
+			for(size_t j = 0; j < 4; ++j)
+				color[j] = si.color[j];
+			write_array(out, color, 4);
+			uint32 state = (uint32)si.subsetState;
+			write_array(out, &state, 1);
+		}
+		end_section(out);
+
+		write_subset_indices(out, sh, (uint32)ish, vrts);
+		write_subset_indices(out, sh, (uint32)ish, edges);
+		write_subset_indices(out, sh, (uint32)ish, faces);
+		write_subset_indices(out, sh, (uint32)ish, vols);
+	}
+
+//	selectors
+	for(size_t isel = 0; isel < m_vSel.size(); ++isel){
+		ISelector& sel = *m_vSel[isel].second;
+		begin_section(out, UGXB_SELECTOR, (uint32)isel, 0, 0);
+		write_string(out, m_vSel[isel].first);
+		end_section(out);
+
+		write_selection_states(out, sel, (uint32)isel, vrts);
+		write_selection_states(out, sel, (uint32)isel, edges);
+		write_selection_states(out, sel, (uint32)isel, faces);
+		write_selection_states(out, sel, (uint32)isel, vols);
+	}
+
+//	global attachments
+	write_global_attachments(out, vrts);
+	write_global_attachments(out, edges);
+	write_global_attachments(out, faces);
+	write_global_attachments(out, vols);
+
+//	section table
+	align(out);
+	uint64 tableOffset = (uint64)out.tellp();
+	for(size_t i = 0; i < m_vSections.size(); ++i){
+		const UGXBSection& s = m_vSections[i];
+		uint32 ui[4] = {s.type, s.index, s.objType, s.reserved};
+		uint64 ul[3] = {s.offset, s.size, s.count};
+		write_array(out, ui, 4);
+		write_array(out, ul, 3);
+	}
+
+//	header
+	out.seekp(0);
+	out.write(UGXB_MAGIC, 4);
+	uint32 hui[3] = {UGXB_VERSION, m_worldDim, (uint32)m_vSections.size()};
+	uint64 hul[2] = {tableOffset, 0};
+	write_array(out, hui, 3);
+	write_array(out, hul, 2);
+
+	if(!out){
+		UG_LOG("GridWriterUGXB::write_to_file: failed to write " << filename << endl);
+		return false;
+	}
+	return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////
+//	GridReaderUGXB
+GridReaderUGXB::GridReaderUGXB() :
+	m_data(NULL),
+	m_size(0),
+	m_mapped(false),
+	m_worldDim(0),
+	m_rangeSH(0),
+	m_rangeBegin(0),
+	m_rangeEnd(-1)
+{
+}
+
+GridReaderUGXB::~GridReaderUGXB()
+{
+	close();
+}
+
+void GridReaderUGXB::
+close()
+{
+#ifdef UG_POSIX
+	if(m_mapped && m_data)
+		munmap(const_cast<char*>(m_data), m_size);
+#endif
+	m_data = NULL;
+	m_size = 0;
+	m_mapped = false;
+	m_buffer.clear();
+	m_vSections.clear();
+	m_vSHNames.clear();
+	m_vSelNames.clear();
+}
+
+bool GridReaderUGXB::
+open(const char* filename)
+{
+	close();
+
+#ifdef UG_POSIX
+	int fd = ::open(filename, O_RDONLY);
+	if(fd < 0)
+		return false;
+
+	struct stat st;
+	if(fstat(fd, &st) != 0 || st.st_size == 0){
+		::close(fd);
+		return false;
+	}
+
+	void* p = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if(p == MAP_FAILED)
+		return false;
+
+	m_data = static_cast<const char*>(p);
+	m_size = st.st_size;
+	m_mapped = true;
+#else
+	ifstream in(filename, ios::in | ios::binary);
+	if(!in)
+		return false;
+
+	in.seekg(0, ios::end);
+	m_buffer.resize((size_t)in.tellg());
+	in.seekg(0, ios::beg);
+	if(m_buffer.empty() || !in.read(&m_buffer.front(), m_buffer.size())){
+		m_buffer.clear();
+		return false;
+	}
+
+	m_data = &m_buffer.front();
+	m_size = m_buffer.size();
+#endif
+
+//	read the header
+	UGXBSection hs;
+	hs.offset = 0;
+	if(m_size < UGXB_HEADER_SIZE || memcmp(m_data, UGXB_MAGIC, 4) != 0){
+		UG_LOG("GridReaderUGXB::open: " << filename << " is not a ugxb file.\n");
+		close();
+		return false;
+	}
+
+	const uint32 version = value<uint32>(hs, 1);
+	m_worldDim = value<uint32>(hs, 2);
+	const uint32 numSections = value<uint32>(hs, 3);
+	const uint64 tableOffset = value<uint64>(hs, 2);
+
+	if(version != UGXB_VERSION){
+		UG_LOG("GridReaderUGXB::open: unsupported ugxb version " << version << ".\n");
+		close();
+		return false;
+	}
+
+	if(tableOffset + numSections * UGXB_SECTION_ENTRY_SIZE > m_size
+	   || m_worldDim < 1 || m_worldDim > 3)
+	{
+		UG_LOG("GridReaderUGXB::open: corrupt file " << filename << endl);
+		close();
+		return false;
+	}
+
+//	read the section table
+	m_vSections.resize(numSections);
+	for(size_t i = 0; i < numSections; ++i){
+		UGXBSection es;
+		es.offset = tableOffset + i * UGXB_SECTION_ENTRY_SIZE;
+		UGXBSection& s = m_vSections[i];
+		s.type = value<uint32>(es, 0);
+		s.index = value<uint32>(es, 1);
+		s.objType = value<uint32>(es, 2);
+		s.reserved = value<uint32>(es, 3);
+		s.offset = value<uint64>(es, 2);
+		s.size = value<uint64>(es, 3);
+		s.count = value<uint64>(es, 4);
+
+	//	make sure that all array accesses stay inside the file
+		uint64 minSize = 0;
+		switch(s.type){
+			case UGXB_VERTICES:			minSize = s.count * m_worldDim * sizeof(double); break;
+			case UGXB_SUBSET_INDICES:	minSize = s.count * sizeof(int32); break;
+			case UGXB_SELECTION_STATES:	minSize = s.count; break;
+			case UGXB_ELEMENTS:
+				for(size_t j = 0; j < UGXB_NUM_ELEM_TYPES; ++j){
+					if(s.objType == (uint32)UGXB_ELEM_TYPES[j])
+						minSize = s.count * UGXB_ELEM_NUM_CORNERS[j] * sizeof(uint32);
+				}
+				break;
+		}
+
+		if(s.offset + s.size > m_size || s.size < minSize){
+			UG_LOG("GridReaderUGXB::open: corrupt section in " << filename << endl);
+			close();
+			return false;
+		}
+
+		if(s.type == UGXB_SUBSET_HANDLER){
+			if(s.index >= m_vSHNames.size())
+				m_vSHNames.resize(s.index + 1);
+			const char* p = m_data + s.offset;
+			m_vSHNames[s.index] = read_string(p);
+		}
+		else if(s.type == UGXB_SELECTOR){
+			if(s.index >= m_vSelNames.size())
+				m_vSelNames.resize(s.index + 1);
+			const char* p = m_data + s.offset;
+			m_vSelNames[s.index] = read_string(p);
+		}
+	}
+
+	return true;
+}
+
+const UGXBSection* GridReaderUGXB::
+find_section(uint32 type, uint32 index, uint32 objType) const
+{
+	for(size_t i = 0; i < m_vSections.size(); ++i){
+		const UGXBSection& s = m_vSections[i];
+		if(s.type == type && s.index == index && s.objType == objType)
+			return &s;
+	}
+	return NULL;
+}
+
+std::string GridReaderUGXB::
+read_string(const char*& p) const
+{
+	UGXBSection s;
+	s.offset = p - m_data;
+	uint32 len = value<uint32>(s, 0);
+	p += sizeof(uint32);
+	UG_COND_THROW(p + len > m_data + m_size, "Corrupt string entry in ugxb file.");
+	string str(p, len);
+	p += len;
+	return str;
+}
+
+const char* GridReaderUGXB::
+get_subset_handler_name(size_t shIndex) const
+{
+	UG_COND_THROW(shIndex >= m_vSHNames.size(), "Bad subset handler index: " << shIndex);
+	return m_vSHNames[shIndex].c_str();
+}
+
+size_t GridReaderUGXB::
+num_subsets(size_t shIndex) const
+{
+	const UGXBSection* s = find_section(UGXB_SUBSET_HANDLER, (uint32)shIndex, 0);
+	UG_COND_THROW(!s, "Bad subset handler index: " << shIndex);
+	return (size_t)s->count;
+}
+
+const char* GridReaderUGXB::
+get_selector_name(size_t selIndex) const
+{
+	UG_COND_THROW(selIndex >= m_vSelNames.size(), "Bad selector index: " << selIndex);
+	return m_vSelNames[selIndex].c_str();
+}
+
+void GridReaderUGXB::
+set_subset_range(size_t shIndex, int siBegin, int siEnd)
+{
+	m_rangeSH = shIndex;
+	m_rangeBegin = siBegin;
+	m_rangeEnd = siEnd;
+}
+
+void GridReaderUGXB::
+collect_elements(int baseObjId, std::vector<uint32>& vrtsInOut)
+{
+	const UGXBSection* shInds = find_section(UGXB_SUBSET_INDICES,
+											 (uint32)m_rangeSH, baseObjId);
+	vector<uint32>& elemsOut = m_vFileInds[baseObjId];
+	vector<uint32> newVrts;
+	uint64 baseOffset = 0;
+
+	for(size_t itype = 0; itype < UGXB_NUM_ELEM_TYPES; ++itype){
+		if(UGXB_ELEM_BASE_TYPES[itype] != baseObjId)
+			continue;
+
+		const UGXBSection* elemSec = find_section(UGXB_ELEMENTS, 0,
+												  UGXB_ELEM_TYPES[itype]);
+		if(!elemSec)
+			continue;
+
+		const uint32 numCorners = UGXB_ELEM_NUM_CORNERS[itype];
+		for(uint64 i = 0; i < elemSec->count; ++i){
+			const uint64 fileInd = baseOffset + i;
+			int si = -1;
+			if(shInds && fileInd < shInds->count)
+				si = value<int32>(*shInds, fileInd);
+
+			if(si >= m_rangeBegin && si < m_rangeEnd){
+				elemsOut.push_back((uint32)fileInd);
+				for(uint32 j = 0; j < numCorners; ++j)
+					newVrts.push_back(value<uint32>(*elemSec, i * numCorners + j));
+			}
+			else if(!vrtsInOut.empty()){
+			//	elements of other subsets are loaded, if all their corners
+			//	belong to already collected elements of higher dimension.
+				bool allCornersLoaded = true;
+				for(uint32 j = 0; j < numCorners; ++j){
+					if(!binary_search(vrtsInOut.begin(), vrtsInOut.end(),
+									  value<uint32>(*elemSec, i * numCorners + j)))
+					{
+						allCornersLoaded = false;
+						break;
+					}
+				}
+				if(allCornersLoaded)
+					elemsOut.push_back((uint32)fileInd);
+			}
+		}
+		baseOffset += elemSec->count;
+	}
+
+	vrtsInOut.insert(vrtsInOut.end(), newVrts.begin(), newVrts.end());
+	sort(vrtsInOut.begin(), vrtsInOut.end());
+	vrtsInOut.erase(unique(vrtsInOut.begin(), vrtsInOut.end()), vrtsInOut.end());
+}
+
+bool GridReaderUGXB::
+collect_elements()
+{
+	for(int i = 0; i < 4; ++i)
+		m_vFileInds[i].clear();
+
+	if(m_rangeEnd < 0)
+		return true;
+
+	if(!find_section(UGXB_SUBSET_HANDLER, (uint32)m_rangeSH, 0)){
+		UG_LOG("GridReaderUGXB: bad subset handler index for subset range: "
+			   << m_rangeSH << endl);
+		return false;
+	}
+
+	vector<uint32> vrts;
+	collect_elements(VOLUME, vrts);
+	collect_elements(FACE, vrts);
+	collect_elements(EDGE, vrts);
+
+//	vertices
+	const UGXBSection* vrtSec = find_section(UGXB_VERTICES, 0, 0);
+	if(!vrtSec){
+		UG_LOG("GridReaderUGXB: no vertex section found.\n");
+		return false;
+	}
+
+	const UGXBSection* shInds = find_section(UGXB_SUBSET_INDICES,
+											 (uint32)m_rangeSH, VERTEX);
+	vector<uint32>& vrtsOut = m_vFileInds[VERTEX];
+	if(shInds){
+		for(uint64 i = 0; i < vrtSec->count && i < shInds->count; ++i){
+			int si = value<int32>(*shInds, i);
+			if(si >= m_rangeBegin && si < m_rangeEnd)
+				vrtsOut.push_back((uint32)i);
+		}
+	}
+
+	vector<uint32> tmp;
+	tmp.reserve(vrtsOut.size() + vrts.size());
+	set_union(vrtsOut.begin(), vrtsOut.end(), vrts.begin(), vrts.end(),
+			  back_inserter(tmp));
+	vrtsOut.swap(tmp);
+
+	if(!vrtsOut.empty() && vrtsOut.back() >= vrtSec->count){
+		UG_LOG("GridReaderUGXB: bad vertex index in element section.\n");
+		return false;
+	}
+	return true;
+}
+
+Vertex* GridReaderUGXB::
+file_vertex(uint32 vrtInd) const
+{
+	if(m_rangeEnd < 0){
+		if(vrtInd < m_vVrts.size())
+			return m_vVrts[vrtInd];
+		return NULL;
+	}
+
+	const vector<uint32>& vrtInds = m_vFileInds[VERTEX];
+	vector<uint32>::const_iterator iter = lower_bound(vrtInds.begin(),
+													  vrtInds.end(), vrtInd);
+	if(iter == vrtInds.end() || *iter != vrtInd)
+		return NULL;
+	return m_vVrts[iter - vrtInds.begin()];
+}
+
+bool GridReaderUGXB::
+create_elements(Grid& grid)
+{
+	const bool loadAll = (m_rangeEnd < 0);
+	uint64 baseOffsets[4] = {0, 0, 0, 0};
+	size_t nextInds[4] = {0, 0, 0, 0};
+
+	m_vEdges.clear();
+	m_vFaces.clear();
+	m_vVols.clear();
+
+	for(size_t itype = 0; itype < UGXB_NUM_ELEM_TYPES; ++itype){
+		const ReferenceObjectID roid = UGXB_ELEM_TYPES[itype];
+		const int baseType = UGXB_ELEM_BASE_TYPES[itype];
+		const uint32 numCorners = UGXB_ELEM_NUM_CORNERS[itype];
+
+		const UGXBSection* elemSec = find_section(UGXB_ELEMENTS, 0, roid);
+		if(!elemSec)
+			continue;
+
+		const uint64 baseOffset = baseOffsets[baseType];
+		baseOffsets[baseType] += elemSec->count;
+
+		const vector<uint32>& fileInds = m_vFileInds[baseType];
+		size_t& nextInd = nextInds[baseType];
+
+		for(uint64 i = 0; i < elemSec->count; ++i){
+		//	file indices are sorted. Skip all elements which are not contained.
+			if(!loadAll){
+				if(nextInd >= fileInds.size()
+				   || fileInds[nextInd] >= baseOffset + elemSec->count)
+				{
+					break;
+				}
+				i = fileInds[nextInd] - baseOffset;
+				++nextInd;
+			}
+
+			Vertex* v[8];
+			for(uint32 j = 0; j < numCorners; ++j){
+				v[j] = file_vertex(value<uint32>(*elemSec, i * numCorners + j));
+				if(!v[j]){
+					UG_LOG("GridReaderUGXB: bad vertex index in element section.\n");
+					return false;
+				}
+			}
+
+			switch(roid){
+				case ROID_EDGE:
+					m_vEdges.push_back(*grid.create<RegularEdge>(EdgeDescriptor(v[0], v[1])));
+					break;
+				case ROID_TRIANGLE:
+					m_vFaces.push_back(*grid.create<Triangle>(TriangleDescriptor(v[0], v[1], v[2])));
+					break;
+				case ROID_QUADRILATERAL:
+					m_vFaces.push_back(*grid.create<Quadrilateral>(
+								QuadrilateralDescriptor(v[0], v[1], v[2], v[3])));
+					break;
+				case ROID_TETRAHEDRON:
+					m_vVols.push_back(*grid.create<Tetrahedron>(
+								TetrahedronDescriptor(v[0], v[1], v[2], v[3])));
+					break;
+				case ROID_HEXAHEDRON:
+					m_vVols.push_back(*grid.create<Hexahedron>(
+								HexahedronDescriptor(v[0], v[1], v[2], v[3],
+													 v[4], v[5], v[6], v[7])));
+					break;
+				case ROID_PRISM:
+					m_vVols.push_back(*grid.create<Prism>(
+								PrismDescriptor(v[0], v[1], v[2], v[3], v[4], v[5])));
+					break;
+				case ROID_PYRAMID:
+					m_vVols.push_back(*grid.create<Pyramid>(
+								PyramidDescriptor(v[0], v[1], v[2], v[3], v[4])));
+					break;
+				case ROID_OCTAHEDRON:
+					m_vVols.push_back(*grid.create<Octahedron>(
+								OctahedronDescriptor(v[0], v[1], v[2], v[3], v[4], v[5])));
+					break;
+				default:
+					break;
+			}
+		}
+	}
+
+	return true;
+}
+
+template <class TElem>
+void GridReaderUGXB::
+read_global_attachments(Grid& grid, std::vector<TElem*>& elems)
+{
+	for(size_t isec = 0; isec < m_vSections.size(); ++isec){
+		const UGXBSection& s = m_vSections[isec];
+		if(s.type != UGXB_ATTACHMENT || s.objType != (uint32)TElem::BASE_OBJECT_ID)
+			continue;
+
+		const char* p = m_data + s.offset;
+		string name = read_string(p);
+		string type = read_string(p);
+		bool passOn = (*p != 0);
+		++p;
+
+		if(!GlobalAttachments::is_declared(name)){
+			if(GlobalAttachments::type_is_registered(type))
+				GlobalAttachments::declare_attachment(name, type, passOn);
+			else
+				continue;
+		}
+
+		UG_COND_THROW(type.compare(GlobalAttachments::type_name(name)) != 0,
+					  "Attachment type mismatch. Expecting type: " <<
+					  GlobalAttachments::type_name(name)
+					  << ", but given type is: " << type);
+
+		UG_COND_THROW(s.count != elems.size(),
+					  "Attachment " << name << " in ugxb file does not match "
+					  "the number of elements.");
+
+		GlobalAttachments::attach<TElem>(grid, name);
+
+		GridDataSerializationHandler handler;
+		GlobalAttachments::add_data_serializer<TElem>(handler, grid, name);
+
+		BinaryBuffer buf;
+		buf.write(p, (size_t)(m_data + s.offset + s.size - p));
+		handler.deserialization_starts();
+		handler.deserialize(buf, elems.begin(), elems.end());
+		handler.deserialization_done();
+	}
+}
+
+bool GridReaderUGXB::
+read_global_attachments(Grid& grid)
+{
+	read_global_attachments(grid, m_vVrts);
+	read_global_attachments(grid, m_vEdges);
+	read_global_attachments(grid, m_vFaces);
+	read_global_attachments(grid, m_vVols);
+	return true;
+}
+
+void GridReaderUGXB::
+begin_parallel_range_load(Grid& grid)
+{
+	m_vProcRanges.clear();
+	m_vSharedVrts.clear();
+
+#ifdef UG_PARALLEL
+	if(m_rangeEnd < 0 || !grid.is_parallel())
+		return;
+
+	int range[2] = {m_rangeBegin, m_rangeEnd};
+	m_vProcRanges.resize(2 * pcl::NumProcs());
+	pcl::ProcessCommunicator().allgather(range, 2, PCL_DT_INT,
+										 &m_vProcRanges.front(), 2, PCL_DT_INT);
+
+//	interfaces are created in end_parallel_range_load
+	grid.distributed_grid_manager()->enable_interface_management(false);
+#endif
+}
+
+void GridReaderUGXB::
+shared_vertex_procs(std::vector<int>& procsOut, uint32 vrt, int baseObjId) const
+{
+	procsOut.clear();
+
+	SharedVertex key;
+	key.vrt = vrt;
+	key.proc = -1;
+	key.maxDim = 0;
+	for(vector<SharedVertex>::const_iterator iter = lower_bound(m_vSharedVrts.begin(),
+							m_vSharedVrts.end(), key);
+		iter != m_vSharedVrts.end() && iter->vrt == vrt; ++iter)
+	{
+	//	elements of dimension > 0 are only loaded through the corners of
+	//	elements of higher dimension
+		if(baseObjId == VERTEX || iter->maxDim > baseObjId)
+			procsOut.push_back(iter->proc);
+	}
+}
+
+template <class TElem>
+void GridReaderUGXB::
+create_range_interfaces(Grid& grid, const std::vector<TElem*>& elems, int baseObjId,
+						Grid::VertexAttachmentAccessor<AInt>& aaVrtInd,
+						const std::vector<std::vector<int> >& vSubsetProcs)
+{
+#ifdef UG_PARALLEL
+	GridLayoutMap& glm = grid.distributed_grid_manager()->grid_layout_map();
+	const int localProc = pcl::ProcRank();
+	const vector<uint32>& fileInds = m_vFileInds[baseObjId];
+	const UGXBSection* shInds = find_section(UGXB_SUBSET_INDICES,
+											 (uint32)m_rangeSH, baseObjId);
+
+	vector<int> procs, cornerProcs, vrtProcs, tmp;
+	for(size_t i = 0; i < elems.size(); ++i){
+		TElem* elem = elems[i];
+
+	//	processes which load the element since it is in their subset range
+		procs.clear();
+		if(baseObjId != VERTEX && shInds && fileInds[i] < shInds->count){
+			const int si = value<int32>(*shInds, fileInds[i]);
+			if(si >= 0 && si < (int)vSubsetProcs.size())
+				procs = vSubsetProcs[si];
+		}
+
+	//	processes which load the element through its corners
+		const size_t numCorners = NumVertices(elem);
+		for(size_t k = 0; k < numCorners; ++k){
+			shared_vertex_procs(vrtProcs, (uint32)aaVrtInd[GetVertex(elem, k)], baseObjId);
+			if(k == 0)
+				cornerProcs.swap(vrtProcs);
+			else{
+				tmp.clear();
+				set_intersection(cornerProcs.begin(), cornerProcs.end(),
+								 vrtProcs.begin(), vrtProcs.end(), back_inserter(tmp));
+				cornerProcs.swap(tmp);
+			}
+		}
+
+		tmp.clear();
+		set_union(procs.begin(), procs.end(), cornerProcs.begin(), cornerProcs.end(),
+				  back_inserter(tmp));
+		procs.swap(tmp);
+		if(procs.empty())
+			continue;
+
+	//	the process with the lowest rank holds the master copy
+		if(localProc < procs.front()){
+			for(size_t k = 0; k < procs.size(); ++k)
+				glm.get_layout<TElem>(INT_H_MASTER).interface(procs[k], 0).push_back(elem);
+		}
+		else
+			glm.get_layout<TElem>(INT_H_SLAVE).interface(procs.front(), 0).push_back(elem);
+	}
+#endif
+}
+
+/**	Elements are loaded by a process if they are in its subset range or if
+ *	all their corners belong to its loaded elements of higher dimension (see
+ *	collect_elements). Since the same rules are evaluated on all processes
+ *	and the elements are visited in the order of their file indices, the
+ *	interfaces match.*/
+void GridReaderUGXB::
+end_parallel_range_load(Grid& grid)
+{
+#ifdef UG_PARALLEL
+	if(m_vProcRanges.empty())
+		return;
+
+	const int localProc = pcl::ProcRank();
+	const int numProcs = (int)m_vProcRanges.size() / 2;
+
+//	the other processes which load the elements of a subset
+	vector<vector<int> > vSubsetProcs(num_subsets(m_rangeSH));
+	for(int p = 0; p < numProcs; ++p){
+		if(p == localProc)
+			continue;
+		const int siBegin = max(m_vProcRanges[2 * p], 0);
+		const int siEnd = min(m_vProcRanges[2 * p + 1], (int)vSubsetProcs.size());
+		for(int si = siBegin; si < siEnd; ++si)
+			vSubsetProcs[si].push_back(p);
+	}
+
+//	collect the local vertices which are loaded by other processes, too,
+//	together with the highest dimension of the elements through which
+//	they are loaded.
+	const vector<uint32>& vrtInds = m_vFileInds[VERTEX];
+	uint64 baseOffsets[4] = {0, 0, 0, 0};
+
+	for(size_t itype = 0; itype < UGXB_NUM_ELEM_TYPES; ++itype){
+		const int baseType = UGXB_ELEM_BASE_TYPES[itype];
+		const uint32 numCorners = UGXB_ELEM_NUM_CORNERS[itype];
+
+		const UGXBSection* elemSec = find_section(UGXB_ELEMENTS, 0, UGXB_ELEM_TYPES[itype]);
+		if(!elemSec)
+			continue;
+
+		const uint64 baseOffset = baseOffsets[baseType];
+		baseOffsets[baseType] += elemSec->count;
+
+		const UGXBSection* shInds = find_section(UGXB_SUBSET_INDICES,
+												 (uint32)m_rangeSH, baseType);
+		if(!shInds)
+			continue;
+
+		for(uint64 i = 0; i < elemSec->count && baseOffset + i < shInds->count; ++i){
+			const int si = value<int32>(*shInds, baseOffset + i);
+			if(si < 0 || si >= (int)vSubsetProcs.size() || vSubsetProcs[si].empty())
+				continue;
+
+			for(uint32 j = 0; j < numCorners; ++j){
+				const uint32 vrt = value<uint32>(*elemSec, i * numCorners + j);
+				vector<uint32>::const_iterator iter = lower_bound(vrtInds.begin(),
+																  vrtInds.end(), vrt);
+				if(iter == vrtInds.end() || *iter != vrt)
+					continue;
+
+				SharedVertex sv;
+				sv.vrt = (uint32)(iter - vrtInds.begin());
+				sv.maxDim = baseType;
+				for(size_t k = 0; k < vSubsetProcs[si].size(); ++k){
+					sv.proc = vSubsetProcs[si][k];
+					m_vSharedVrts.push_back(sv);
+				}
+			}
+		}
+	}
+
+	const UGXBSection* vrtShInds = find_section(UGXB_SUBSET_INDICES,
+												(uint32)m_rangeSH, VERTEX);
+	if(vrtShInds){
+		for(size_t i = 0; i < vrtInds.size(); ++i){
+			if(vrtInds[i] >= vrtShInds->count)
+				continue;
+			const int si = value<int32>(*vrtShInds, vrtInds[i]);
+			if(si < 0 || si >= (int)vSubsetProcs.size())
+				continue;
+
+			SharedVertex sv;
+			sv.vrt = (uint32)i;
+			sv.maxDim = VERTEX;
+			for(size_t k = 0; k < vSubsetProcs[si].size(); ++k){
+				sv.proc = vSubsetProcs[si][k];
+				m_vSharedVrts.push_back(sv);
+			}
+		}
+	}
+
+//	merge the entries of each pair of vertex and process
+	sort(m_vSharedVrts.begin(), m_vSharedVrts.end());
+	size_t numShared = 0;
+	for(size_t i = 0; i < m_vSharedVrts.size(); ++i){
+		const SharedVertex& sv = m_vSharedVrts[i];
+		if(numShared > 0 && m_vSharedVrts[numShared - 1].vrt == sv.vrt
+		   && m_vSharedVrts[numShared - 1].proc == sv.proc)
+		{
+			SharedVertex& prev = m_vSharedVrts[numShared - 1];
+			prev.maxDim = max(prev.maxDim, sv.maxDim);
+		}
+		else
+			m_vSharedVrts[numShared++] = sv;
+	}
+	m_vSharedVrts.resize(numShared);
+
+//	create the interfaces
+	AInt aVrtInd;
+	grid.attach_to_vertices(aVrtInd);
+	Grid::VertexAttachmentAccessor<AInt> aaVrtInd(grid, aVrtInd);
+	for(size_t i = 0; i < m_vVrts.size(); ++i)
+		aaVrtInd[m_vVrts[i]] = (int)i;
+
+	create_range_interfaces(grid, m_vVrts, VERTEX, aaVrtInd, vSubsetProcs);
+	create_range_interfaces(grid, m_vEdges, EDGE, aaVrtInd, vSubsetProcs);
+	create_range_interfaces(grid, m_vFaces, FACE, aaVrtInd, vSubsetProcs);
+	create_range_interfaces(grid, m_vVols, VOLUME, aaVrtInd, vSubsetProcs);
+
+	grid.detach_from_vertices(aVrtInd);
+	m_vSharedVrts.clear();
+
+	DistributedGridManager& distGridMgr = *grid.distributed_grid_manager();
+	distGridMgr.grid_layout_map().remove_empty_interfaces();
+	distGridMgr.enable_interface_management(true);
+	distGridMgr.grid_layouts_changed(false);
+#endif
+}
+
+template <class TElem>
+bool GridReaderUGXB::
+read_subset_indices(ISubsetHandler& shOut, size_t shIndex,
+					std::vector<TElem*>& elems,
+					const std::vector<uint32>& fileInds)
+{
+	const UGXBSection* s = find_section(UGXB_SUBSET_INDICES, (uint32)shIndex,
+										(uint32)TElem::BASE_OBJECT_ID);
+	if(!s)
+		return true;
+
+	for(size_t i = 0; i < elems.size(); ++i){
+		const uint64 fileInd = fileInds.empty() ? i : fileInds[i];
+		if(fileInd >= s->count){
+			UG_LOG("GridReaderUGXB: bad element index in subset handler " << shIndex << endl);
+			return false;
+		}
+
+		int si = value<int32>(*s, fileInd);
+		if(si >= 0)
+			shOut.assign_subset(elems[i], si);
+	}
+	return true;
+}
+
+bool GridReaderUGXB::
+subset_handler(ISubsetHandler& shOut, size_t shIndex)
+{
+	const UGXBSection* s = find_section(UGXB_SUBSET_HANDLER, (uint32)shIndex, 0);
+	if(!s){
+		UG_LOG("GridReaderUGXB::subset_handler: bad subsetHandlerIndex. Aborting.\n");
+		return false;
+	}
+
+//	subset infos
+	const char* p = m_data + s->offset;
+	read_string(p);
+	UGXBSection ps;
+	ps.offset = p - m_data;
+	const uint32 numSubsets = value<uint32>(ps, 0);
+	p += sizeof(uint32);
+
+	for(uint32 i = 0; i < numSubsets; ++i){
+	//	retrieve an initial subset-info from shOut, so that initialised values are kept.
+		SubsetInfo si = shOut.subset_info(i);
+		si.name = read_string(p);
+
+		ps.offset = p - m_data;
+		for(size_t j = 0; j < 4; ++j)
+			si.color[j] = (number)value<double>(ps, j);
+		p += 4 * sizeof(double);
+
+		ps.offset = p - m_data;
+		si.subsetState = (uint)value<uint32>(ps, 0);
+		p += sizeof(uint32);
+
+		shOut.set_subset_info(i, si);
+	}
+
+	bool success = true;
+	if(shOut.elements_are_supported(SHE_VERTEX))
+		success &= read_subset_indices(shOut, shIndex, m_vVrts, m_vFileInds[VERTEX]);
+	if(shOut.elements_are_supported(SHE_EDGE))
+		success &= read_subset_indices(shOut, shIndex, m_vEdges, m_vFileInds[EDGE]);
+	if(shOut.elements_are_supported(SHE_FACE))
+		success &= read_subset_indices(shOut, shIndex, m_vFaces, m_vFileInds[FACE]);
+	if(shOut.elements_are_supported(SHE_VOLUME))
+		success &= read_subset_indices(shOut, shIndex, m_vVols, m_vFileInds[VOLUME]);
+
+	return success;
+}
+
+template <class TElem>
+bool GridReaderUGXB::
+read_selection_states(ISelector& selOut, size_t selIndex,
+					  std::vector<TElem*>& elems,
+					  const std::vector<uint32>& fileInds)
+{
+	const UGXBSection* s = find_section(UGXB_SELECTION_STATES, (uint32)selIndex,
+										(uint32)TElem::BASE_OBJECT_ID);
+	if(!s)
+		return true;
+
+	for(size_t i = 0; i < elems.size(); ++i){
+		const uint64 fileInd = fileInds.empty() ? i : fileInds[i];
+		if(fileInd >= s->count){
+			UG_LOG("GridReaderUGXB: bad element index in selector " << selIndex << endl);
+			return false;
+		}
+
+		ISelector::status_t status = value<ISelector::status_t>(*s, fileInd);
+		if(status)
+			selOut.select(elems[i], status);
+	}
+	return true;
+}
+
+bool GridReaderUGXB::
+selector(ISelector& selOut, size_t selIndex)
+{
+	if(selIndex >= m_vSelNames.size()){
+		UG_LOG("GridReaderUGXB::selector: bad selectorIndex. Aborting.\n");
+		return false;
+	}
+
+	bool success = true;
+	if(selOut.elements_are_supported(SE_VERTEX))
+		success &= read_selection_states(selOut, selIndex, m_vVrts, m_vFileInds[VERTEX]);
+	if(selOut.elements_are_supported(SE_EDGE))
+		success &= read_selection_states(selOut, selIndex, m_vEdges, m_vFileInds[EDGE]);
+	if(selOut.elements_are_supported(SE_FACE))
+		success &= read_selection_states(selOut, selIndex, m_vFaces, m_vFileInds[FACE]);
+	if(selOut.elements_are_supported(SE_VOLUME))
+		success &= read_selection_states(selOut, selIndex, m_vVols, m_vFileInds[VOLUME]);
+
+	return success;
+}
+
+}//	end of namespace
@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__LIB_GRID__FILE_IO_UGXB__
+#define __H__LIB_GRID__FILE_IO_UGXB__
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "common/types.h"
+#include "lib_grid/grid/grid.h"
+#include "lib_grid/tools/subset_handler_interface.h"
+#include "lib_grid/tools/selector_interface.h"
+#include "lib_grid/common_attachments.h"
+#include "lib_grid/grid_objects/grid_objects.h"
+
+namespace ug
+{
+
+////////////////////////////////////////////////////////////////////////
+//	UGXB - binary ugx
+/**	A ugxb file contains the same information as a ugx file with a single
+ *	grid: vertex coordinates, elements, subset handlers, selectors and
+ *	global attachments. All data is stored in typed little-endian arrays,
+ *	each starting at an 8 byte aligned offset, so that a reader can map the
+ *	file into memory and access the arrays directly.
+ *
+ *	Layout:
+ *	- a header (magic "UGXB", version, world dimension, offset and size
+ *	  of the section table)
+ *	- a sequence of sections (see UGXBSectionType)
+ *	- the section table, one UGXBSection per section.
+ *
+ *	Elements are stored per reference object type in the order
+ *	edges, triangles, quadrilaterals, tetrahedra, hexahedra, prisms,
+ *	pyramids, octahedra. Per-element data of subset handlers, selectors and
+ *	attachments is stored per base object type (vertex, edge, face, volume)
+ *	in this order.
+ *
+ *	Hanging node grids (constrained and constraining elements) and
+ *	projection handlers are not supported by ugxb. Use ugx for those.
+ */
+enum UGXBSectionType
+{
+	UGXB_VERTICES = 1,			///< count * worldDim doubles
+	UGXB_ELEMENTS = 2,			///< count * numCorners uint32 vertex indices, objType = ReferenceObjectID
+	UGXB_SUBSET_HANDLER = 3,	///< name and subset infos of subset handler 'index'
+	UGXB_SUBSET_INDICES = 4,	///< count int32 subset indices, objType = base object id
+	UGXB_SELECTOR = 5,			///< name of selector 'index'
+	UGXB_SELECTION_STATES = 6,	///< count bytes of selection states, objType = base object id
+	UGXB_ATTACHMENT = 7			///< a serialized global attachment, objType = base object id
+};
+
+///	entry of the section table of a ugxb file
+struct UGXBSection
+{
+	uint32	type;
+	uint32	index;
+	uint32	objType;
+	uint32	reserved;
+	uint64	offset;
+	uint64	size;
+	uint64	count;
+};
+
+
+////////////////////////////////////////////////////////////////////////
+///	Writes a grid to a ugxb file. Internally uses GridWriterUGXB.
+/**	Since the type of the position attachment is a template parameter,
+ *	ug::aPosition, ug::aPosition2 and ug::aPosition1 are supported.*/
+template <class TAPosition>
+bool SaveGridToUGXB(Grid& grid, ISubsetHandler& sh,
+					const char* filename, TAPosition& aPos);
+
+///	Writes a grid to a ugxb file, using the standard position attachment of highest dimension.
+bool SaveGridToUGXB(Grid& grid, ISubsetHandler& sh, const char* filename);
+
+///	Reads a grid from a ugxb file. Internally uses GridReaderUGXB.
+/**	If siEnd >= 0, only the elements of the subsets [siBegin, siEnd) of the
+ *	first subset handler in the file are created, together with all lower
+ *	dimensional elements whose corners all belong to created elements
+ *	(see GridReaderUGXB::set_subset_range). If a subset range is loaded into
+ *	a parallel grid, the pieces loaded by the different processes are
+ *	connected through horizontal interfaces. This is a collective operation
+ *	then, i.e. all processes have to load a (possibly empty) subset range.*/
+template <class TAPosition>
+bool LoadGridFromUGXB(Grid& grid, ISubsetHandler& sh,
+					  const char* filename, TAPosition& aPos,
+					  int siBegin = 0, int siEnd = -1);
+
+///	Reads a grid from a ugxb file.
+/**	The standard position attachment of highest dimension attached to the
+ *	grid is used. If none is attached, aPosition is attached and used.*/
+bool LoadGridFromUGXB(Grid& grid, ISubsetHandler& sh, const char* filename,
+					  int siBegin = 0, int siEnd = -1);
+
+///	Converts the first grid of a ugx file to ugxb.
+/**	All subset handlers and selectors of that grid are converted, as well
+ *	as all global attachments.*/
+bool ConvertUGXToUGXB(const char* ugxFilename, const char* ugxbFilename);
+
+///	Converts a ugxb file to ugx.
+bool ConvertUGXBToUGX(const char* ugxbFilename, const char* ugxFilename);
+
+
+////////////////////////////////////////////////////////////////////////
+///	Grants write access to ugxb files.
+/**	Make sure that the grid, the position attachment and all subset
+ *	handlers and selectors added via one of the add_* methods exist until
+ *	write_to_file has been called.
+ *	All global attachments which are attached to the grid are written, too.
+ */
+class GridWriterUGXB
+{
+	public:
+		GridWriterUGXB();
+
+	/**	The value type of TPositionAttachment has to be compatible with
+	 *	MathVector. Make sure that aPos is attached to the vertices of the grid.*/
+		template <class TPositionAttachment>
+		bool add_grid(Grid& grid, TPositionAttachment& aPos);
+
+		void add_subset_handler(ISubsetHandler& sh, const char* name);
+
+		void add_selector(ISelector& sel, const char* name);
+
+		bool write_to_file(const char* filename);
+
+	protected:
+		typedef Grid::VertexAttachmentAccessor<AInt> AAVrtIndex;
+
+		template <class T>
+		static void write_array(std::ostream& out, const T* vals, size_t num);
+
+		template <class TPositionAttachment>
+		static void write_coords(std::ostream& out, Grid& grid, IAttachment& aPos,
+								 const std::vector<Vertex*>& vrts);
+
+		template <class TElem>
+		void write_elements(std::ostream& out, AAVrtIndex aaInd);
+
+		template <class TElem>
+		void write_subset_indices(std::ostream& out, ISubsetHandler& sh,
+								  uint32 shIndex, const std::vector<TElem*>& elems);
+
+		template <class TElem>
+		void write_selection_states(std::ostream& out, ISelector& sel,
+									uint32 selIndex, const std::vector<TElem*>& elems);
+
+		template <class TElem>
+		void write_global_attachments(std::ostream& out,
+									  const std::vector<TElem*>& elems);
+
+		void write_string(std::ostream& out, const std::string& str);
+
+		void align(std::ostream& out);
+		void begin_section(std::ostream& out, uint32 type, uint32 index,
+						   uint32 objType, uint64 count);
+		void end_section(std::ostream& out);
+
+	protected:
+		Grid*			m_pGrid;
+		IAttachment*	m_paPos;
+		uint32			m_worldDim;
+		void (*m_writeCoords)(std::ostream&, Grid&, IAttachment&,
+							  const std::vector<Vertex*>&);
+
+		std::vector<std::pair<std::string, ISubsetHandler*> >	m_vSH;
+		std::vector<std::pair<std::string, ISelector*> >		m_vSel;
+
+		std::vector<UGXBSection>	m_vSections;
+};
+
+
+////////////////////////////////////////////////////////////////////////
+///	Grants read access to ugxb files.
+/**	On POSIX systems the file is mapped into memory, on all other systems
+ *	it is read into a buffer. Elements are created directly from the
+ *	arrays in the file.
+ *
+ *	Through set_subset_range, loading may be restricted to a range of
+ *	subsets, e.g. to a set of pre-partitioned subdomains. In a parallel grid,
+ *	each process loads its own range and the loaded pieces are connected
+ *	through horizontal interfaces. The index of an element in the file serves
+ *	as its global id: each process determines from the file and the ranges of
+ *	all processes which other processes load its elements. The process with
+ *	the lowest rank holds the master copy of a shared element.
+ */
+class GridReaderUGXB
+{
+	public:
+		GridReaderUGXB();
+		~GridReaderUGXB();
+
+	///	opens and maps the given file. Returns false if it is not a valid ugxb file.
+		bool open(const char* filename);
+		void close();
+
+		uint32 world_dimension() const			{return m_worldDim;}
+
+		size_t num_subset_handlers() const		{return m_vSHNames.size();}
+		const char* get_subset_handler_name(size_t shIndex) const;
+		size_t num_subsets(size_t shIndex) const;
+
+		size_t num_selectors() const			{return m_vSelNames.size();}
+		const char* get_selector_name(size_t selIndex) const;
+
+	///	restricts the elements created in 'grid' to the given subsets
+	/**	Only elements which are assigned to one of the subsets [siBegin, siEnd)
+	 *	of the specified subset handler are created, together with all lower
+	 *	dimensional elements whose corners all belong to created elements of
+	 *	higher dimension. This way boundary subsets are created along with the
+	 *	volumes they bound. Has to be called before 'grid'.
+	 *	Pass siEnd < 0 to load all elements.
+	 *
+	 *	Note that global attachments can only be read if all elements are
+	 *	loaded. If a parallel grid is loaded, set_subset_range has to be
+	 *	called on all processes, since the ranges are exchanged in 'grid'.*/
+		void set_subset_range(size_t shIndex, int siBegin, int siEnd);
+
+	/**	The value type of TPositionAttachment has to be compatible with
+	 *	MathVector. aPos is attached to the grid if necessary.*/
+		template <class TPositionAttachment>
+		bool grid(Grid& gridOut, TPositionAttachment& aPos);
+
+		bool subset_handler(ISubsetHandler& shOut, size_t shIndex);
+
+		bool selector(ISelector& selOut, size_t selIndex);
+
+	protected:
+		const UGXBSection* find_section(uint32 type, uint32 index, uint32 objType) const;
+
+		template <class T>
+		T value(const UGXBSection& s, uint64 i) const;
+
+		std::string read_string(const char*& p) const;
+
+		bool collect_elements();
+		void collect_elements(int baseObjId, std::vector<uint32>& vrtsInOut);
+
+		Vertex* file_vertex(uint32 vrtInd) const;
+		bool create_elements(Grid& grid);
+		bool read_global_attachments(Grid& grid);
+
+	///	exchanges the subset ranges and disables the interface management
+	/**	Only has an effect if a subset range is loaded into a parallel grid.*/
+		void begin_parallel_range_load(Grid& grid);
+
+	///	creates the horizontal interfaces between the loaded pieces
+	/**	Only has an effect if a subset range is loaded into a parallel grid.*/
+		void end_parallel_range_load(Grid& grid);
+
+		template <class TElem>
+		void create_range_interfaces(Grid& grid, const std::vector<TElem*>& elems,
+									 int baseObjId,
+									 Grid::VertexAttachmentAccessor<AInt>& aaVrtInd,
+									 const std::vector<std::vector<int> >& vSubsetProcs);
+
+	///	processes which load the given vertex and thus elements of dimension baseObjId containing it
+		void shared_vertex_procs(std::vector<int>& procsOut, uint32 vrt, int baseObjId) const;
+
+		template <class TElem>
+		void read_global_attachments(Grid& grid, std::vector<TElem*>& elems);
+
+		template <class TElem>
+		bool read_subset_indices(ISubsetHandler& shOut, size_t shIndex,
+								 std::vector<TElem*>& elems,
+								 const std::vector<uint32>& fileInds);
+
+		template <class TElem>
+		bool read_selection_states(ISelector& selOut, size_t selIndex,
+								   std::vector<TElem*>& elems,
+								   const std::vector<uint32>& fileInds);
+
+	protected:
+		const char*		m_data;
+		uint64			m_size;
+		bool			m_mapped;
+		std::vector<char>	m_buffer;
+
+		uint32			m_worldDim;
+		std::vector<UGXBSection>	m_vSections;
+		std::vector<std::string>	m_vSHNames;
+		std::vector<std::string>	m_vSelNames;
+
+	//	subset range
+		size_t	m_rangeSH;
+		int		m_rangeBegin;
+		int		m_rangeEnd;
+
+	///	file indices of the elements which will be / have been created.
+	/**	Indexed by base object id. Empty if all elements are loaded.*/
+		std::vector<uint32>	m_vFileInds[4];
+
+	///	subset ranges of all processes (begin, end), if loaded in parallel
+		std::vector<int>	m_vProcRanges;
+
+	///	a vertex of the local piece which is loaded by another process, too
+		struct SharedVertex{
+			uint32	vrt;	///< index in m_vVrts
+			int		proc;
+			int		maxDim;	///< max dimension of an element in proc's range containing the vertex
+
+			bool operator<(const SharedVertex& sv) const
+			{
+				if(vrt != sv.vrt)
+					return vrt < sv.vrt;
+				return proc < sv.proc;
+			}
+		};
+		std::vector<SharedVertex>	m_vSharedVrts;
+
+	//	created elements in the order in which they appear in the file
+		std::vector<Vertex*>	m_vVrts;
+		std::vector<Edge*>		m_vEdges;
+		std::vector<Face*>		m_vFaces;
+		std::vector<Volume*>	m_vVols;
+};
+
+}//	end of namespace
+
+////////////////////////////////
+//	include implementation
+#include "file_io_ugxb_impl.hpp"
+
+#endif
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__LIB_GRID__FILE_IO_UGXB_IMPL__
+#define __H__LIB_GRID__FILE_IO_UGXB_IMPL__
+
+#include <algorithm>
+#include <cstring>
+#include <ostream>
+#include "common/util/endian_detection.h"
+
+namespace ug
+{
+
+////////////////////////////////////////////////////////////////////////
+template <class TAPosition>
+bool SaveGridToUGXB(Grid& grid, ISubsetHandler& sh, const char* filename,
+					TAPosition& aPos)
+{
+	GridWriterUGXB ugxbWriter;
+	if(!ugxbWriter.add_grid(grid, aPos))
+		return false;
+	ugxbWriter.add_subset_handler(sh, "defSH");
+
+	return ugxbWriter.write_to_file(filename);
+}
+
+////////////////////////////////////////////////////////////////////////
+template <class TAPosition>
+bool LoadGridFromUGXB(Grid& grid, ISubsetHandler& sh, const char* filename,
+					  TAPosition& aPos, int siBegin, int siEnd)
+{
+	GridReaderUGXB ugxbReader;
+	if(!ugxbReader.open(filename)){
+		UG_LOG("ERROR in LoadGridFromUGXB: Can't open file: " << filename << std::endl);
+		return false;
+	}
+
+	if(siEnd >= 0){
+		if(ugxbReader.num_subset_handlers() < 1){
+			UG_LOG("ERROR in LoadGridFromUGXB: A subset range was specified but "
+				   "the file contains no subset handler.\n");
+			return false;
+		}
+		ugxbReader.set_subset_range(0, siBegin, siEnd);
+	}
+
+	if(!ugxbReader.grid(grid, aPos))
+		return false;
+
+	if(ugxbReader.num_subset_handlers() > 0)
+		return ugxbReader.subset_handler(sh, 0);
+
+	return true;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+template <class TPositionAttachment>
+bool GridWriterUGXB::
+add_grid(Grid& grid, TPositionAttachment& aPos)
+{
+	if(!grid.has_vertex_attachment(aPos)){
+		UG_LOG("GridWriterUGXB::add_grid: position attachment missing.\n");
+		return false;
+	}
+
+	m_pGrid = &grid;
+	m_paPos = &aPos;
+	m_worldDim = (uint32)TPositionAttachment::ValueType::Size;
+	m_writeCoords = &write_coords<TPositionAttachment>;
+	return true;
+}
+
+template <class T>
+void GridWriterUGXB::
+write_array(std::ostream& out, const T* vals, size_t num)
+{
+	if(IsLittleEndian()){
+		out.write(reinterpret_cast<const char*>(vals), num * sizeof(T));
+		return;
+	}
+
+	for(size_t i = 0; i < num; ++i){
+		T val = vals[i];
+		char* c = reinterpret_cast<char*>(&val);
+		std::reverse(c, c + sizeof(T));
+		out.write(c, sizeof(T));
+	}
+}
+
+template <class TPositionAttachment>
+void GridWriterUGXB::
+write_coords(std::ostream& out, Grid& grid, IAttachment& aPos,
+			 const std::vector<Vertex*>& vrts)
+{
+	typedef typename TPositionAttachment::ValueType vector_t;
+	const size_t dim = vector_t::Size;
+	const size_t chunkSize = 4096;
+
+	Grid::VertexAttachmentAccessor<TPositionAttachment>
+		aaPos(grid, static_cast<TPositionAttachment&>(aPos));
+
+//	coordinates are always stored as doubles. Convert them chunk-wise.
+	std::vector<double> buf;
+	buf.reserve(chunkSize * dim);
+	for(size_t i = 0; i < vrts.size(); ++i){
+		const vector_t& p = aaPos[vrts[i]];
+		for(size_t d = 0; d < dim; ++d)
+			buf.push_back((double)p[d]);
+
+		if(buf.size() >= chunkSize * dim){
+			write_array(out, &buf.front(), buf.size());
+			buf.clear();
+		}
+	}
+
+	if(!buf.empty())
+		write_array(out, &buf.front(), buf.size());
+}
+
+
+////////////////////////////////////////////////////////////////////////
+template <class T>
+T GridReaderUGXB::
+value(const UGXBSection& s, uint64 i) const
+{
+	T val;
+	memcpy(&val, m_data + s.offset + i * sizeof(T), sizeof(T));
+	if(!IsLittleEndian()){
+		char* c = reinterpret_cast<char*>(&val);
+		std::reverse(c, c + sizeof(T));
+	}
+	return val;
+}
+
+template <class TPositionAttachment>
+bool GridReaderUGXB::
+grid(Grid& grid, TPositionAttachment& aPos)
+{
+	typedef typename TPositionAttachment::ValueType vector_t;
+	const size_t dim = vector_t::Size;
+
+	if(!m_data){
+		UG_LOG("GridReaderUGXB::grid: no file opened.\n");
+		return false;
+	}
+
+	const UGXBSection* vrtSec = find_section(UGXB_VERTICES, 0, 0);
+	if(!vrtSec){
+		UG_LOG("GridReaderUGXB::grid: file contains no vertices.\n");
+		return false;
+	}
+
+	begin_parallel_range_load(grid);
+
+	if(!collect_elements())
+		return false;
+
+//	Since we have to create all elements in the order in which they are
+//	stored in the file, we'll disable all grid-options and reenable them
+//	later on.
+	uint gridopts = grid.get_options();
+	grid.set_options(GRIDOPT_NONE);
+
+	if(!grid.has_vertex_attachment(aPos))
+		grid.attach_to_vertices(aPos);
+
+	Grid::VertexAttachmentAccessor<TPositionAttachment> aaPos(grid, aPos);
+
+	const bool loadAll = (m_rangeEnd < 0);
+	const std::vector<uint32>& vrtInds = m_vFileInds[VERTEX];
+	const size_t numVrts = loadAll ? (size_t)vrtSec->count : vrtInds.size();
+
+	m_vVrts.clear();
+	m_vVrts.reserve(numVrts);
+	grid.reserve<Vertex>(grid.num_vertices() + numVrts);
+
+	for(size_t i = 0; i < numVrts; ++i){
+		const uint64 fileInd = loadAll ? i : vrtInds[i];
+		Vertex* vrt = *grid.create<RegularVertex>();
+		m_vVrts.push_back(vrt);
+
+		vector_t& p = aaPos[vrt];
+		for(size_t d = 0; d < dim; ++d){
+			if(d < m_worldDim)
+				p[d] = (number)value<double>(*vrtSec, fileInd * m_worldDim + d);
+			else
+				p[d] = 0;
+		}
+	}
+
+	bool success = create_elements(grid);
+	if(success && loadAll)
+		success = read_global_attachments(grid);
+
+	grid.set_options(gridopts);
+
+	if(success)
+		end_parallel_range_load(grid);
+	return success;
+}
+
+}//	end of namespace
+
+#endif
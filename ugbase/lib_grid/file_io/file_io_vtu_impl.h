@@ -37,6 +37,7 @@
 #include <cstring>
 #include "lib_grid/algorithms/debug_util.h"
 #include "lib_grid/callbacks/subset_callbacks.h"
+#include "common/util/fast_number_parser.h"
 
 namespace ug{
 
@@ -285,67 +286,38 @@ create_vertices(std::vector<Vertex*>& vrtsOut, Grid& grid,
 	if(numSrcCoords < 1 || numDestCoords < 1)
 		return false;
 
-//	create a buffer with which we can access the data
-	string str(dataNode->value(), dataNode->value_size());
-	stringstream ss(str, ios_base::in);
+//	parse all coordinates at once. Large blocks are parsed in parallel.
+	typedef typename TAAPos::ValueType::value_type coord_t;
+	vector<coord_t> coords;
+	if(!ParseNumberBlock(coords, dataNode->value(), dataNode->value_size())
+	   || coords.size() % numSrcCoords != 0)
+	{
+		UG_LOG("GridReaderVTU::create_vertices: Failed to read vertex.\n");
+		return false;
+	}
 
-//	if numDestCoords == numSrcCoords parsing will be faster
-	if(numSrcCoords == numDestCoords){
-		while(!ss.eof()){
-		//	read the data
-			typename TAAPos::ValueType v;
+//	if numDestCoords < numSrcCoords we'll ignore some coords,
+//	in the other case we'll add some 0's.
+	int minNumCoords = min(numSrcCoords, numDestCoords);
+	size_t numVrts = coords.size() / numSrcCoords;
 
-			for(int i = 0; i < numSrcCoords; ++i)
-				ss >> v[i];
+	vrtsOut.reserve(vrtsOut.size() + numVrts);
+	for(size_t iVrt = 0; iVrt < numVrts; ++iVrt){
+		const coord_t* c = &coords[iVrt * numSrcCoords];
+		typename TAAPos::ValueType v;
 
-		//	make sure that everything went right
-			if(ss.fail())
-				break;
+		int i;
+		for(i = 0; i < minNumCoords; ++i)
+			v[i] = c[i];
+		for(; i < numDestCoords; ++i)
+			v[i] = 0;
 
-		//	create a new vertex
-			RegularVertex* vrt = *grid.create<RegularVertex>();
-			vrtsOut.push_back(vrt);
+	//	create a new vertex
+		RegularVertex* vrt = *grid.create<RegularVertex>();
+		vrtsOut.push_back(vrt);
 
-		//	set the coordinates
-			aaPos[vrt] = v;
-		}
-	}
-	else{
-	//	we have to be careful with reading.
-	//	if numDestCoords < numSrcCoords we'll ignore some coords,
-	//	in the other case we'll add some 0's.
-		int minNumCoords = min(numSrcCoords, numDestCoords);
-		typename TAAPos::ValueType::value_type dummy = 0;
-
-		while(!ss.eof()){
-		//	read the data
-			typename TAAPos::ValueType v;
-
-			int iMin;
-			for(iMin = 0; iMin < minNumCoords; ++iMin)
-				ss >> v[iMin];
-
-		//	ignore unused entries in the input buffer
-			for(int i = iMin; i < numSrcCoords; ++i)
-				ss >> dummy;
-
-		//	add 0's to the vector
-			for(int i = iMin; i < numDestCoords; ++i)
-				v[i] = 0;
-
-		//	make sure that everything went right
-			if(ss.fail()){
-				UG_LOG("GridReaderVTU::create_vertices: Failed to read vertex.\n");
-				return false;
-			}
-
-		//	create a new vertex
-			RegularVertex* vrt = *grid.create<RegularVertex>();
-			vrtsOut.push_back(vrt);
-
-		//	set the coordinates
-			aaPos[vrt] = v;
-		}
+	//	set the coordinates
+		aaPos[vrt] = v;
 	}
 
 	return true;
@@ -363,21 +335,18 @@ read_scalar_data(std::vector<T>& dataOut,
 	if(clearData)
 		dataOut.clear();
 
-//	create a buffer with which we can access the data
-	string str(dataNode->value(), dataNode->value_size());
-	stringstream ss(str, ios_base::in);
-
-	while(!ss.eof()){
-	//	read the data
-		T d;
-		ss >> d;
-
-	//	make sure that everything went right
-		if(ss.fail())
-			break;
-
-		dataOut.push_back(d);
+	vector<T> vals;
+	if(!ParseNumberBlock(vals, dataNode->value(), dataNode->value_size())){
+		rapidxml::xml_attribute<>* attrib = dataNode->first_attribute("Name");
+		UG_THROW("VTU parsing error in file " << m_filename
+				 << ": invalid entry in data array '"
+				 << (attrib ? attrib->value() : dataNode->name()) << "'.");
 	}
+
+	if(dataOut.empty())
+		dataOut.swap(vals);
+	else
+		dataOut.insert(dataOut.end(), vals.begin(), vals.end());
 }
 
 template <class T>
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#ifndef __H__LIB_GRID__CSR_ADJACENCY__
+#define __H__LIB_GRID__CSR_ADJACENCY__
+
+#include <vector>
+#include <algorithm>
+#include "common/types.h"
+
+namespace ug
+{
+
+///	Stores the adjacency lists of a set of indexed entries in compressed row format
+/**	The lists of all entries are stored consecutively in one array. The list
+ * of entry i is given by the range [offset(i), offset(i+1)). Compared to one
+ * std::vector per entry this saves the per-list heap allocations and keeps
+ * the lists of consecutive entries close in memory.
+ *
+ * The arrays are filled in two passes: After a call to reset, the number of
+ * elements of each entry has to be specified through set_num. After
+ * compute_offsets was called, the lists are assigned through assign.
+ *
+ * Iterators are of type std::vector<TElem*>::iterator and thus compatible
+ * with the iterators of std::vector<TElem*> based lists.
+ */
+template <class TElem>
+class CSRAdjacency
+{
+	public:
+		typedef typename std::vector<TElem*>::iterator	iterator;
+
+		CSRAdjacency() : m_bPacked(false)	{}
+
+	///	returns true if the arrays hold packed lists
+		bool packed() const					{return m_bPacked;}
+
+	///	prepares the arrays for numEntries entries
+		void reset(size_t numEntries)
+		{
+			m_vOffsets.assign(numEntries + 1, 0);
+			m_vElems.clear();
+			m_bPacked = false;
+		}
+
+	///	sets the number of elements in the list of the i-th entry
+		void set_num(uint i, size_t num)	{m_vOffsets[i + 1] = num;}
+
+	///	computes the offsets from the numbers specified through set_num
+		void compute_offsets()
+		{
+			for(size_t i = 1; i < m_vOffsets.size(); ++i)
+				m_vOffsets[i] += m_vOffsets[i - 1];
+			m_vElems.resize(m_vOffsets.back());
+			m_bPacked = true;
+		}
+
+	///	copies the given list to the position of the i-th entry
+		template <class TIter>
+		void assign(uint i, TIter listBegin, TIter listEnd)
+		{
+			std::copy(listBegin, listEnd, m_vElems.begin() + m_vOffsets[i]);
+		}
+
+	///	releases all memory
+		void clear()
+		{
+			std::vector<uint>().swap(m_vOffsets);
+			std::vector<TElem*>().swap(m_vElems);
+			m_bPacked = false;
+		}
+
+		iterator begin(uint i)	{return m_vElems.begin() + m_vOffsets[i];}
+		iterator end(uint i)	{return m_vElems.begin() + m_vOffsets[i + 1];}
+
+	///	number of elements in the list of the i-th entry
+		size_t num(uint i) const	{return m_vOffsets[i + 1] - m_vOffsets[i];}
+
+	///	returns the list of the i-th entry as array. Only valid if num(i) > 0.
+		TElem** array(uint i)		{return &m_vElems[m_vOffsets[i]];}
+
+	///	memory occupied by the arrays in bytes
+		size_t memory() const
+		{
+			return m_vOffsets.capacity() * sizeof(uint)
+					+ m_vElems.capacity() * sizeof(TElem*);
+		}
+
+	private:
+		std::vector<uint>	m_vOffsets;
+		std::vector<TElem*>	m_vElems;
+		bool				m_bPacked;
+};
+
+}//	end of namespace
+
+#endif
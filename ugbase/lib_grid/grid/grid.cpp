@@ -37,6 +37,7 @@
 #include "common/common.h"
 #include "lib_grid/attachments/attached_list.h"
 #include "lib_grid/tools/periodic_boundary_manager.h"
+#include "lib_grid/lib_grid_messages.h"
 
 #ifdef UG_PARALLEL
 #include "lib_grid/parallelization/distributed_grid.h"
@@ -58,6 +59,7 @@ Grid::Grid() :
 	m_aEdgeContainer("Grid_EdgeContainer", false),
 	m_aFaceContainer("Grid_FaceContainer", false),
 	m_aVolumeContainer("Grid_VolumeContainer", false),
+	m_bTopologyFrozen(false),
 	m_bMarking(false),
 	m_aMark("Grid_Mark", false),
 	m_distGridMgr(NULL),
@@ -76,6 +78,7 @@ Grid::Grid(uint options) :
 	m_aEdgeContainer("Grid_EdgeContainer", false),
 	m_aFaceContainer("Grid_FaceContainer", false),
 	m_aVolumeContainer("Grid_VolumeContainer", false),
+	m_bTopologyFrozen(false),
 	m_bMarking(false),
 	m_aMark("Grid_Mark", false),
 	m_distGridMgr(NULL),
@@ -94,6 +97,7 @@ Grid::Grid(const Grid& grid) :
 	m_aEdgeContainer("Grid_EdgeContainer", false),
 	m_aFaceContainer("Grid_FaceContainer", false),
 	m_aVolumeContainer("Grid_VolumeContainer", false),
+	m_bTopologyFrozen(false),
 	m_bMarking(false),
 	m_aMark("Grid_Mark", false),
 	m_distGridMgr(NULL),
@@ -109,10 +113,25 @@ Grid::Grid(const Grid& grid) :
 
 Grid::~Grid()
 {
+//	no automatic freezing during destruction
+	m_spAdaptionFreezeCallbackId = SPNULL;
+	m_spCreationFreezeCallbackId = SPNULL;
+
 	notify_and_clear_observers_on_grid_destruction();
 
-//	erase all elements
-	clear_geometry();
+//	erase all elements. Since no observers are left, the elements don't have
+//	to be unregistered one by one. Their memory is released slab-wise.
+	destroy_elements<Volume>();
+	destroy_elements<Face>();
+	destroy_elements<Edge>();
+	destroy_elements<Vertex>();
+
+	for(int i = 0; i < NUM_GEOMETRIC_BASE_OBJECTS; ++i){
+		for(size_t j = 0; j < m_vObjAllocators[i].size(); ++j)
+			delete m_vObjAllocators[i][j];
+		m_vObjAllocators[i].clear();
+		m_vObjAllocatorDestruct[i].clear();
+	}
 
 //	remove marks - would be done anyway...
 	remove_marks();
@@ -228,16 +247,98 @@ void Grid::clear_geometry()
 //	disable all options to speed it up
 	uint opts = get_options();
 	set_options(GRIDOPT_NONE);
-	
-	clear<Volume>();
-	clear<Face>();
-	clear<Edge>();
-	clear<Vertex>();
+
+	if(m_vertexObservers.empty() && m_edgeObservers.empty()
+		&& m_faceObservers.empty() && m_volumeObservers.empty())
+	{
+	//	nobody has to be notified about the erased elements. We thus discard
+	//	them without unregistering them one by one.
+		thaw_topology();
+		destroy_elements<Volume>();
+		destroy_elements<Face>();
+		destroy_elements<Edge>();
+		destroy_elements<Vertex>();
+	}
+	else{
+		clear<Volume>();
+		clear<Face>();
+		clear<Edge>();
+		clear<Vertex>();
+
+	//	return the memory of the erased elements
+		release_object_allocators();
+	}
 	
 //	reset options
 	set_options(opts);
 }
 
+void Grid::freeze_topology()
+{
+	if(m_bTopologyFrozen)
+		return;
+
+	GRID_PROFILE_FUNC();
+
+	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
+		pack_vertex_lists(m_csrEdgesVERTEX, m_aaEdgeContainerVERTEX);
+	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
+		pack_vertex_lists(m_csrFacesVERTEX, m_aaFaceContainerVERTEX);
+	if(option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
+		pack_vertex_lists(m_csrVolumesVERTEX, m_aaVolumeContainerVERTEX);
+
+	m_bTopologyFrozen = true;
+}
+
+void Grid::set_auto_freeze_topology(bool enable)
+{
+	if(enable == auto_freeze_topology())
+		return;
+
+	if(enable){
+		m_spAdaptionFreezeCallbackId = m_messageHub->register_class_callback(
+							this, &Grid::freeze_topology_on_adaption);
+		m_spCreationFreezeCallbackId = m_messageHub->register_class_callback(
+							this, &Grid::freeze_topology_on_creation);
+		freeze_topology();
+	}
+	else{
+		m_spAdaptionFreezeCallbackId = SPNULL;
+		m_spCreationFreezeCallbackId = SPNULL;
+	}
+}
+
+void Grid::freeze_topology_on_adaption(const GridMessage_Adaption& msg)
+{
+//	refine() and coarsen() may be called without enclosing adaption_begins
+//	and adaption_ends. We thus also freeze after each adaption step.
+	if(msg.adaption_ends() || msg.step_ends())
+		freeze_topology();
+}
+
+void Grid::freeze_topology_on_creation(const GridMessage_Creation& msg)
+{
+	if(msg.msg() == GMCT_CREATION_STOPS)
+		freeze_topology();
+}
+
+void Grid::thaw_topology()
+{
+	if(!m_bTopologyFrozen)
+		return;
+
+	GRID_PROFILE_FUNC();
+
+	if(m_csrEdgesVERTEX.packed())
+		unpack_vertex_lists(m_csrEdgesVERTEX, m_aaEdgeContainerVERTEX);
+	if(m_csrFacesVERTEX.packed())
+		unpack_vertex_lists(m_csrFacesVERTEX, m_aaFaceContainerVERTEX);
+	if(m_csrVolumesVERTEX.packed())
+		unpack_vertex_lists(m_csrVolumesVERTEX, m_aaVolumeContainerVERTEX);
+
+	m_bTopologyFrozen = false;
+}
+
 template <class TElem>
 void Grid::clear_attachments()
 {
@@ -412,6 +513,9 @@ void Grid::assign_grid(const Grid& grid)
 	//todo:	copy interfaces from grid.
 	}
 
+	if(auto_freeze_topology())
+		freeze_topology();
+
 //TODO: notify a grid observer that copying has ended
 }
 
@@ -487,7 +591,7 @@ void Grid::erase(Vertex* vrt)
 
 	unregister_vertex(vrt);
 
-	delete vrt;
+	free_object(vrt);
 }
 
 void Grid::erase(Edge* edge)
@@ -498,7 +602,7 @@ void Grid::erase(Edge* edge)
 
 	unregister_edge(edge);
 
-	delete edge;
+	free_object(edge);
 }
 
 void Grid::erase(Face* face)
@@ -509,7 +613,7 @@ void Grid::erase(Face* face)
 
 	unregister_face(face);
 
-	delete face;
+	free_object(face);
 }
 
 void Grid::erase(Volume* vol)
@@ -520,7 +624,70 @@ void Grid::erase(Volume* vol)
 
 	unregister_volume(vol);
 
-	delete vol;
+	free_object(vol);
+}
+
+////////////////////////////////////////////////////////////////////////
+//	object memory
+SlabAllocator* Grid::object_allocator(int baseObjID, int containerSection) const
+{
+	if(baseObjID < 0 || baseObjID >= NUM_GEOMETRIC_BASE_OBJECTS
+		|| containerSection < 0
+		|| containerSection >= (int)m_vObjAllocators[baseObjID].size())
+		return NULL;
+	return m_vObjAllocators[baseObjID][containerSection];
+}
+
+void Grid::free_object(GridObject* obj)
+{
+//	the address of the most derived object is the address of its memory
+	void* mem = dynamic_cast<void*>(obj);
+	SlabAllocator* alloc = object_allocator(obj->base_object_id(),
+											obj->container_section());
+	if(alloc && alloc->owns(mem)){
+		obj->~GridObject();
+		alloc->deallocate(mem);
+	}
+	else
+		delete obj;
+}
+
+void Grid::release_object_allocators()
+{
+	for(int i = 0; i < NUM_GEOMETRIC_BASE_OBJECTS; ++i){
+		for(size_t j = 0; j < m_vObjAllocators[i].size(); ++j){
+			SlabAllocator* alloc = m_vObjAllocators[i][j];
+			if(alloc && alloc->num_allocated() == 0)
+				alloc->release();
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////
+//	GridObjectAllocationScope
+///	grid of the innermost allocation scope of the executing thread
+static Grid* g_pObjectAllocationGrid = NULL;
+#ifdef UG_OPENMP
+	#pragma omp threadprivate(g_pObjectAllocationGrid)
+#endif
+
+GridObjectAllocationScope::
+GridObjectAllocationScope(Grid& grid) :
+	m_pPrevGrid(g_pObjectAllocationGrid)
+{
+	g_pObjectAllocationGrid = &grid;
+}
+
+GridObjectAllocationScope::
+~GridObjectAllocationScope()
+{
+	g_pObjectAllocationGrid = m_pPrevGrid;
+}
+
+Grid* GridObjectAllocationScope::
+current_grid()
+{
+	return g_pObjectAllocationGrid;
 }
 
 //	the geometric-object-collection:
@@ -886,6 +1053,8 @@ Grid::AssociatedEdgeIterator Grid::associated_edges_begin(Vertex* vrt)
 		LOG("WARNING in associated_edges_begin(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_EDGES." << endl);
 		vertex_store_associated_edges(true);
 	}
+	if(m_csrEdgesVERTEX.packed())
+		return m_csrEdgesVERTEX.begin(vrt->grid_data_index());
 	return m_aaEdgeContainerVERTEX[vrt].begin();
 }
 
@@ -896,6 +1065,8 @@ Grid::AssociatedEdgeIterator Grid::associated_edges_end(Vertex* vrt)
 		LOG("WARNING in associated_edges_end(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_EDGES." << endl);
 		vertex_store_associated_edges(true);
 	}
+	if(m_csrEdgesVERTEX.packed())
+		return m_csrEdgesVERTEX.end(vrt->grid_data_index());
 	return m_aaEdgeContainerVERTEX[vrt].end();
 }
 
@@ -948,6 +1119,8 @@ Grid::AssociatedFaceIterator Grid::associated_faces_begin(Vertex* vrt)
 		LOG("WARNING in associated_faces_begin(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_FACES." << endl);
 		vertex_store_associated_faces(true);
 	}
+	if(m_csrFacesVERTEX.packed())
+		return m_csrFacesVERTEX.begin(vrt->grid_data_index());
 	return m_aaFaceContainerVERTEX[vrt].begin();
 }
 
@@ -958,6 +1131,8 @@ Grid::AssociatedFaceIterator Grid::associated_faces_end(Vertex* vrt)
 		LOG("WARNING in associated_faces_end(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_FACES." << endl);
 		vertex_store_associated_faces(true);
 	}
+	if(m_csrFacesVERTEX.packed())
+		return m_csrFacesVERTEX.end(vrt->grid_data_index());
 	return m_aaFaceContainerVERTEX[vrt].end();
 }
 
@@ -1010,6 +1185,8 @@ Grid::AssociatedVolumeIterator Grid::associated_volumes_begin(Vertex* vrt)
 		LOG("WARNING in associated_volumes_begin(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_VOLUMES." << endl);
 		vertex_store_associated_volumes(true);
 	}
+	if(m_csrVolumesVERTEX.packed())
+		return m_csrVolumesVERTEX.begin(vrt->grid_data_index());
 	return m_aaVolumeContainerVERTEX[vrt].begin();
 }
 
@@ -1020,6 +1197,8 @@ Grid::AssociatedVolumeIterator Grid::associated_volumes_end(Vertex* vrt)
 		LOG("WARNING in associated_volumes_end(vrt): auto-enabling VRTOPT_STORE_ASSOCIATED_VOLUMES." << endl);
 		vertex_store_associated_volumes(true);
 	}
+	if(m_csrVolumesVERTEX.packed())
+		return m_csrVolumesVERTEX.end(vrt->grid_data_index());
 	return m_aaVolumeContainerVERTEX[vrt].end();
 }
 
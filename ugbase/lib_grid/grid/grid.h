@@ -38,6 +38,7 @@
 #include <memory>
 #include <boost/function.hpp>
 #include "common/util/message_hub.h"
+#include "common/allocators/slab_allocator.h"
 #include "common/ug_config.h"
 #include "grid_constants.h"
 #include "grid_base_objects.h"
@@ -45,6 +46,7 @@
 #include "grid_object_collection.h"
 #include "element_storage.h"
 #include "grid_base_object_traits.h"
+#include "csr_adjacency.h"
 
 //	Define PROFILE_GRID to profile some often used gird-methods
 //#define PROFILE_GRID
@@ -72,6 +74,11 @@ class DistributedGridManager;
 //	"lib_grid/tools/periodic_boundary_identifier.h"
 class PeriodicBoundaryManager;
 
+//	predeclaration of the grid messages, used for automatic freezing of the
+//	topology. Defined in "lib_grid/lib_grid_messages.h"
+class GridMessage_Adaption;
+class GridMessage_Creation;
+
 /**
  * \brief Grid, MultiGrid and GridObjectCollection are contained in this group
  * \defgroup lib_grid_grid grid
@@ -355,6 +362,41 @@ class UG_API Grid
 	///	clears the grids attachments. The geometry remains.
 		void clear_attachments();
 
+	////////////////////////////////////////////////
+	//	frozen topology
+	///	packs the lists of elements associated with vertices into compact arrays
+	/**	The lists of edges, faces and volumes associated with each vertex
+	 * (if stored due to the VRTOPT_STORE_ASSOCIATED_... options) are copied
+	 * into CSRAdjacency arrays and the per-vertex lists are released.
+	 * This reduces memory consumption and improves locality of adjacency
+	 * queries for grids which are not modified for a while, e.g. after
+	 * grid construction or refinement.
+	 *
+	 * As soon as the grid is modified (elements are created, erased or
+	 * replaced or vertex options are changed), the topology is thawed
+	 * automatically. Note that iterators obtained from associated_..._begin
+	 * are invalidated in this case.*/
+		void freeze_topology();
+
+	///	restores the per-vertex lists of associated elements from the packed arrays
+	/**	Called automatically whenever the grid is modified.*/
+		void thaw_topology();
+
+	///	returns true if the vertex-centric adjacency lists are packed
+		bool topology_frozen() const	{return m_bTopologyFrozen;}
+
+	///	enables or disables automatic freezing of the topology
+	/**	If enabled, freeze_topology is called whenever the grid posts a
+	 * GridMessage_Adaption which ends an adaption or an adaption step (i.e.
+	 * after refinement or coarsening), a GridMessage_Creation with
+	 * GMCT_CREATION_STOPS (e.g. after a grid has been loaded or distributed)
+	 * and after assign_grid. If the grid is enabled for the first time, it
+	 * is frozen immediately. Disabled by default.*/
+		void set_auto_freeze_topology(bool enable);
+
+	///	returns true if the topology is frozen automatically
+		bool auto_freeze_topology() const	{return m_spAdaptionFreezeCallbackId.valid();}
+
 	////////////////////////////////////////////////
 	//	element creation
 	///	create a custom element.
@@ -1002,6 +1044,46 @@ class UG_API Grid
 		void register_volume(Volume* v, GridObject* pParent = NULL);///< pDF specifies the element from which v derives its values
 		void unregister_volume(Volume* v);
 
+	///	returns memory for a new object of type TGeomObj from the grid's slabs
+	/**	The memory stems from a per-type SlabAllocator of the grid. Objects
+	 * are thus stored consecutively in creation order. Construct the object
+	 * through placement new and release it through free_object.*/
+		template <class TGeomObj>
+		void* allocate_object();
+
+	///	destroys the object and releases its memory
+	/**	Objects whose memory was obtained by allocate_object are returned to
+	 * the associated slab allocator, all others are deleted.*/
+		void free_object(GridObject* obj);
+
+	///	returns the allocator for the given base object and container section or NULL
+		SlabAllocator* object_allocator(int baseObjID, int containerSection) const;
+
+	///	releases the slabs of all object allocators which currently hold no objects
+		void release_object_allocators();
+
+	///	grants access to allocate_object for objects created outside of the grid
+		template <class TGeomObj>
+		friend void* AllocateGridObject();
+
+	///	packs the given per-vertex lists into csr and releases the lists
+		template <class TElem>
+		void pack_vertex_lists(CSRAdjacency<TElem>& csr,
+				AttachmentAccessor<Vertex, Attachment<std::vector<TElem*> > >& aaList);
+
+	///	restores the given per-vertex lists from csr and clears csr
+		template <class TElem>
+		void unpack_vertex_lists(CSRAdjacency<TElem>& csr,
+				AttachmentAccessor<Vertex, Attachment<std::vector<TElem*> > >& aaList);
+
+	///	destroys all elements of the given type without unregistering them
+	/**	Only to be used if no observers are registered for the given type,
+	 * e.g. during destruction of the grid. Sections whose elements all stem
+	 * from the associated allocator and require no destruction are not
+	 * visited at all. Their memory is released slab-wise.*/
+		template <class TElem>
+		void destroy_elements();
+
 		void change_options(uint optsNew);
 
 		void change_vertex_options(uint optsNew);
@@ -1144,6 +1226,12 @@ class UG_API Grid
 		template <class TElem>
 		void clear_attachments();
 
+	///	callbacks which freeze the topology if auto freezing is enabled
+	/**	\{ */
+		void freeze_topology_on_adaption(const GridMessage_Adaption& msg);
+		void freeze_topology_on_creation(const GridMessage_Creation& msg);
+	/**	\} */
+
 	protected:
 		VertexElementStorage	m_vertexElementStorage;
 		EdgeElementStorage		m_edgeElementStorage;
@@ -1181,6 +1269,12 @@ class UG_API Grid
 		AttachmentAccessor<Volume, AEdgeContainer>		m_aaEdgeContainerVOLUME;
 		AttachmentAccessor<Volume, AFaceContainer>		m_aaFaceContainerVOLUME;
 		AttachmentAccessor<Volume, AVolumeContainer>	m_aaVolumeContainerVOLUME;
+
+	//	packed vertex-centric interconnections (see freeze_topology)
+		bool						m_bTopologyFrozen;
+		CSRAdjacency<Edge>			m_csrEdgesVERTEX;
+		CSRAdjacency<Face>			m_csrFacesVERTEX;
+		CSRAdjacency<Volume>		m_csrVolumesVERTEX;
 		
 	//	marks
 		int m_currentMark;	// 0: marks inactive. -1: reset-marks (sets currentMark to 1)
@@ -1191,11 +1285,69 @@ class UG_API Grid
 		FaceAttachmentAccessor<AMark>	m_aaMarkFACE;
 		VolumeAttachmentAccessor<AMark>	m_aaMarkVOL;
 
+	//	object allocators, indexed by base object id and container section
+		std::vector<SlabAllocator*>	m_vObjAllocators[NUM_GEOMETRIC_BASE_OBJECTS];
+	//	whether the objects of the associated allocator require destruction
+		std::vector<bool>	m_vObjAllocatorDestruct[NUM_GEOMETRIC_BASE_OBJECTS];
+
 		SPMessageHub 							m_messageHub;
+
+	//	callbacks for automatic freezing of the topology (see set_auto_freeze_topology)
+		MessageHub::SPCallbackId	m_spAdaptionFreezeCallbackId;
+		MessageHub::SPCallbackId	m_spCreationFreezeCallbackId;
 		DistributedGridManager*		m_distGridMgr;
 		PeriodicBoundaryManager*	m_periodicBndMgr;
 };
 
+
+////////////////////////////////////////////////////////////////////////
+///	Specifies whether objects of the given type have to be destroyed explicitly
+/**	Objects of types whose destructor has no effect can be discarded
+ * together with the slabs they are stored in, when a grid is destroyed or
+ * cleared. Specialize this template for such types.*/
+template <class TGeomObj>
+struct grid_object_requires_destruction
+{
+	static const bool value = true;
+};
+
+
+////////////////////////////////////////////////////////////////////////
+///	Redirects the allocation of new grid objects on the calling thread to a grid
+/**	Grid objects create new objects without knowing the grid at which
+ * those will be registered, e.g. the children in Face::refine or the sides in
+ * Volume::create_face. While an instance of this class exists, such objects
+ * are allocated through AllocateGridObject from the slabs of the given grid,
+ * just as objects created through Grid::create. Otherwise they are
+ * allocated on the heap.
+ *
+ * Only use the scope if all objects created meanwhile are registered at the
+ * given grid, since they may not be deleted through operator delete.
+ * Scopes may be nested. If ug is compiled with OpenMP, the scope only
+ * applies to the thread by which it was created.*/
+class UG_API GridObjectAllocationScope
+{
+	public:
+		GridObjectAllocationScope(Grid& grid);
+		~GridObjectAllocationScope();
+
+	///	returns the grid of the innermost scope of the calling thread or NULL
+		static Grid* current_grid();
+
+	private:
+		GridObjectAllocationScope(const GridObjectAllocationScope&);
+		GridObjectAllocationScope& operator=(const GridObjectAllocationScope&);
+
+		Grid*	m_pPrevGrid;
+};
+
+///	returns memory for a new object of type TGeomObj
+/**	The memory stems from the grid of the current GridObjectAllocationScope.
+ * If no scope is active, it is allocated through operator new. Construct the
+ * object through placement new.*/
+template <class TGeomObj>
+void* AllocateGridObject();
+
 /** \} */
 }//end of namespace
 
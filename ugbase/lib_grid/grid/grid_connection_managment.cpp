@@ -97,6 +97,7 @@ namespace ug
 void Grid::register_vertex(Vertex* v, GridObject* pParent)
 {
 	GCM_PROFILE_FUNC();
+	thaw_topology();
 
 //	store the element and register it at the pipe.
 	m_vertexElementStorage.m_attachmentPipe.register_element(v);
@@ -113,6 +114,8 @@ void Grid::register_vertex(Vertex* v, GridObject* pParent)
 
 void Grid::register_and_replace_element(Vertex* v, Vertex* pReplaceMe)
 {
+	thaw_topology();
+
 	m_vertexElementStorage.m_attachmentPipe.register_element(v);
 	m_vertexElementStorage.m_sectionContainer.insert(v, v->container_section());
 
@@ -213,11 +216,13 @@ void Grid::register_and_replace_element(Vertex* v, Vertex* pReplaceMe)
 //	remove pReplaceMe
 	m_vertexElementStorage.m_attachmentPipe.unregister_element(pReplaceMe);
 	m_vertexElementStorage.m_sectionContainer.erase(get_iterator(pReplaceMe), pReplaceMe->container_section());
-	delete pReplaceMe;
+	free_object(pReplaceMe);
 }
 
 void Grid::unregister_vertex(Vertex* v)
 {
+	thaw_topology();
+
 //	notify observers that the vertex is being erased
 	NOTIFY_OBSERVERS_REVERSE(m_vertexObservers, vertex_to_be_erased(this, v));
 
@@ -333,6 +338,8 @@ void Grid::unregister_vertex(Vertex* v)
 
 void Grid::change_vertex_options(uint optsNew)
 {
+	thaw_topology();
+
 //	check if associated edge information has to be created or removed.
 	if(OPTIONS_CONTAIN_OPTION(optsNew, VRTOPT_STORE_ASSOCIATED_EDGES))
 	{
@@ -374,6 +381,8 @@ void Grid::change_vertex_options(uint optsNew)
 
 void Grid::vertex_store_associated_edges(bool bStoreIt)
 {
+	thaw_topology();
+
 	if(bStoreIt)
 	{
 		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))
@@ -405,6 +414,8 @@ void Grid::vertex_store_associated_edges(bool bStoreIt)
 
 void Grid::vertex_store_associated_faces(bool bStoreIt)
 {
+	thaw_topology();
+
 	if(bStoreIt)
 	{
 		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_FACES))
@@ -439,6 +450,8 @@ void Grid::vertex_store_associated_faces(bool bStoreIt)
 
 void Grid::vertex_store_associated_volumes(bool bStoreIt)
 {
+	thaw_topology();
+
 	if(bStoreIt)
 	{
 		if(!option_is_enabled(VRTOPT_STORE_ASSOCIATED_VOLUMES))
@@ -479,6 +492,7 @@ void Grid::register_edge(Edge* e, GridObject* pParent,
 						 Face* createdByFace, Volume* createdByVol)
 {
 	GCM_PROFILE_FUNC();
+	thaw_topology();
 
 //	store the element and register it at the pipe.
 	m_edgeElementStorage.m_attachmentPipe.register_element(e);
@@ -607,6 +621,8 @@ void Grid::register_edge(Edge* e, GridObject* pParent,
 
 void Grid::register_and_replace_element(Edge* e, Edge* pReplaceMe)
 {
+	thaw_topology();
+
 //	store the element and register it at the pipe.
 	m_edgeElementStorage.m_attachmentPipe.register_element(e);
 	m_edgeElementStorage.m_sectionContainer.insert(e, e->container_section());
@@ -672,11 +688,13 @@ void Grid::register_and_replace_element(Edge* e, Edge* pReplaceMe)
 //	remove the element from the storage and delete it.
 	m_edgeElementStorage.m_sectionContainer.erase(get_iterator(pReplaceMe), pReplaceMe->container_section());
 	m_edgeElementStorage.m_attachmentPipe.unregister_element(pReplaceMe);
-	delete pReplaceMe;
+	free_object(pReplaceMe);
 }
 
 void Grid::unregister_edge(Edge* e)
 {
+	thaw_topology();
+
 //	notify observers that the edge is being erased
 	NOTIFY_OBSERVERS_REVERSE(m_edgeObservers, edge_to_be_erased(this, e));
 
@@ -922,6 +940,7 @@ void Grid::edge_store_associated_volumes(bool bStoreIt)
 void Grid::register_face(Face* f, GridObject* pParent, Volume* createdByVol)
 {
 	GCM_PROFILE_FUNC();
+	thaw_topology();
 
 //	store the element and register it at the pipe.
 	m_faceElementStorage.m_attachmentPipe.register_element(f);
@@ -964,7 +983,11 @@ void Grid::register_face(Face* f, GridObject* pParent, Volume* createdByVol)
 				if(createEdges)
 				{
 				//	create the edge - regard the parent of f as the parent of the new edge, too.
-					e = f->create_edge(i);
+					{
+					//	store the new side in the slabs of this grid
+						GridObjectAllocationScope allocScope(*this);
+						e = f->create_edge(i);
+					}
 
 					if(facesStoreEdges)
 						m_aaEdgeContainerFACE[f].push_back(e);
@@ -1043,6 +1066,8 @@ void Grid::register_face(Face* f, GridObject* pParent, Volume* createdByVol)
 
 void Grid::register_and_replace_element(Face* f, Face* pReplaceMe)
 {
+	thaw_topology();
+
 //	check that f and pReplaceMe have the same amount of vertices.
 	if(f->num_vertices() != pReplaceMe->num_vertices())
 	{
@@ -1122,11 +1147,13 @@ void Grid::register_and_replace_element(Face* f, Face* pReplaceMe)
 //	remove the element from the storage and delete it.
 	m_faceElementStorage.m_sectionContainer.erase(get_iterator(pReplaceMe), pReplaceMe->container_section());
 	m_faceElementStorage.m_attachmentPipe.unregister_element(pReplaceMe);
-	delete pReplaceMe;
+	free_object(pReplaceMe);
 }
 
 void Grid::unregister_face(Face* f)
 {
+	thaw_topology();
+
 //	notify observers that the face is being erased
 	NOTIFY_OBSERVERS_REVERSE(m_faceObservers, face_to_be_erased(this, f));
 
@@ -1400,7 +1427,11 @@ void Grid::face_autogenerate_edges(bool bAutogen)
 					if(e == NULL)
 					{
 					//	create the edge
-						e = f->create_edge(i);
+						{
+						//	store the new side in the slabs of this grid
+							GridObjectAllocationScope allocScope(*this);
+							e = f->create_edge(i);
+						}
 						if(storeEdges)
 							m_aaEdgeContainerFACE[f].push_back(e);
 						register_edge(e, f, f, NULL);
@@ -1440,6 +1471,7 @@ void Grid::face_autogenerate_edges(bool bAutogen)
 void Grid::register_volume(Volume* v, GridObject* pParent)
 {
 	GCM_PROFILE_FUNC();
+	thaw_topology();
 
 //	store the element and register it at the pipe.
 	m_volumeElementStorage.m_attachmentPipe.register_element(v);
@@ -1499,7 +1531,11 @@ void Grid::register_volume(Volume* v, GridObject* pParent)
 			{
 				if(createFaces)
 				{
-					f = v->create_face(i);
+					{
+					//	store the new side in the slabs of this grid
+						GridObjectAllocationScope allocScope(*this);
+						f = v->create_face(i);
+					}
 
 					if(volsStoreFaces)
 						m_aaFaceContainerVOLUME[v].push_back(f);
@@ -1539,7 +1575,11 @@ void Grid::register_volume(Volume* v, GridObject* pParent)
 				if(createEdges)
 				{
 				//	create the edge
-					e = v->create_edge(i);
+					{
+					//	store the new side in the slabs of this grid
+						GridObjectAllocationScope allocScope(*this);
+						e = v->create_edge(i);
+					}
 
 				//	store a reference to the edge, if required
 					if(volsStoreEdges)
@@ -1575,6 +1615,8 @@ void Grid::register_volume(Volume* v, GridObject* pParent)
 
 void Grid::register_and_replace_element(Volume* v, Volume* pReplaceMe)
 {
+	thaw_topology();
+
 //	check that v and pReplaceMe have the same number of vertices.
 	if(v->num_vertices() != pReplaceMe->num_vertices())
 	{
@@ -1651,11 +1693,13 @@ void Grid::register_and_replace_element(Volume* v, Volume* pReplaceMe)
 //	remove the element from the storage and delete it.
 	m_volumeElementStorage.m_sectionContainer.erase(get_iterator(pReplaceMe), pReplaceMe->container_section());
 	m_volumeElementStorage.m_attachmentPipe.unregister_element(pReplaceMe);
-	delete pReplaceMe;
+	free_object(pReplaceMe);
 }
 
 void Grid::unregister_volume(Volume* v)
 {
+	thaw_topology();
+
 //	notify observers that the face is being erased
 	NOTIFY_OBSERVERS_REVERSE(m_volumeObservers, volume_to_be_erased(this, v));
 
@@ -1958,7 +2002,11 @@ void Grid::volume_autogenerate_edges(bool bAutogen)
 					if(e == NULL)
 					{
 					//	create the edge
-						e = v->create_edge(i);
+						{
+						//	store the new side in the slabs of this grid
+							GridObjectAllocationScope allocScope(*this);
+							e = v->create_edge(i);
+						}
 						if(volsStoreEdges) // has to be performed before register_edge
 							m_aaEdgeContainerVOLUME[v].push_back(e);
 						register_edge(e, v, NULL, v);
@@ -2010,7 +2058,11 @@ void Grid::volume_autogenerate_faces(bool bAutogen)
 					if(f == NULL)
 					{
 					//	create the face
-						f = v->create_face(i);
+						{
+						//	store the new side in the slabs of this grid
+							GridObjectAllocationScope allocScope(*this);
+							f = v->create_face(i);
+						}
 						if(volsStoreFaces) // has to be performed before register_face
 							m_aaFaceContainerVOLUME[v].push_back(f);
 						register_face(f, v, v);
@@ -2085,6 +2137,8 @@ void Grid::volume_sort_associated_edge_container()
 //	replace_vertex
 bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 {
+	thaw_topology();
+
 //	this bool should be a parameter. However one first would have
 //	to add connectivity updates for double-elements in this method,
 //	to handle the case when eraseDoubleElements is set to false.
@@ -2187,7 +2241,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 				//	we can now remove e from the storage.
 					m_edgeElementStorage.m_sectionContainer.erase(get_iterator(e), e->container_section());
 					m_edgeElementStorage.m_attachmentPipe.unregister_element(e);
-					delete e;
+					free_object(e);
 				}
 			}
 
@@ -2303,7 +2357,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 				//	we can now remove f from the storage.
 					m_faceElementStorage.m_sectionContainer.erase(get_iterator(f), f->container_section());
 					m_faceElementStorage.m_attachmentPipe.unregister_element(f);
-					delete f;
+					free_object(f);
 				}
 			}
 
@@ -2444,7 +2498,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 				//	we can now remove v from the storage.
 					m_volumeElementStorage.m_sectionContainer.erase(get_iterator(v), v->container_section());
 					m_volumeElementStorage.m_attachmentPipe.unregister_element(v);
-					delete v;
+					free_object(v);
 				}
 			}
 
@@ -2528,7 +2582,7 @@ bool Grid::replace_vertex(Vertex* vrtOld, Vertex* vrtNew)
 //	finally erase vrtOld.
 	m_vertexElementStorage.m_sectionContainer.erase(get_iterator(vrtOld), vrtOld->container_section());
 	m_vertexElementStorage.m_attachmentPipe.unregister_element(vrtOld);
-	delete vrtOld;
+	free_object(vrtOld);
 
 	return true;
 }
@@ -2639,11 +2693,12 @@ void Grid::get_associated(SecureEdgeContainer& edges, Vertex* v)
 		vertex_store_associated_edges(true);
 	}
 
-	EdgeContainer& assEdges = m_aaEdgeContainerVERTEX[v];
-	if(assEdges.empty())
+	AssociatedEdgeIterator iterBegin = associated_edges_begin(v);
+	AssociatedEdgeIterator iterEnd = associated_edges_end(v);
+	if(iterBegin == iterEnd)
 		edges.clear();
 	else
-		edges.set_external_array(&assEdges.front(), assEdges.size());
+		edges.set_external_array(&(*iterBegin), iterEnd - iterBegin);
 }
 
 void Grid::get_associated(SecureEdgeContainer& edges, Face* f)
@@ -2725,11 +2780,12 @@ void Grid::get_associated(SecureFaceContainer& faces, Vertex* v)
 		vertex_store_associated_faces(true);
 	}
 
-	FaceContainer& assFaces = m_aaFaceContainerVERTEX[v];
-	if(assFaces.empty())
+	AssociatedFaceIterator iterBegin = associated_faces_begin(v);
+	AssociatedFaceIterator iterEnd = associated_faces_end(v);
+	if(iterBegin == iterEnd)
 		faces.clear();
 	else
-		faces.set_external_array(&assFaces.front(), assFaces.size());
+		faces.set_external_array(&(*iterBegin), iterEnd - iterBegin);
 }
 
 void Grid::get_associated(SecureFaceContainer& faces, Edge* e)
@@ -2769,10 +2825,12 @@ void Grid::get_associated(SecureFaceContainer& faces, Edge* e)
 		}
 */
 
-		FaceContainer& assFaces = m_aaFaceContainerVERTEX[vrt];
-		for(size_t i = 0; i < assFaces.size(); ++i){
-			if(FaceContains(assFaces[i], e))
-				faces.push_back(assFaces[i]);
+		AssociatedFaceIterator iterEnd = associated_faces_end(vrt);
+		for(AssociatedFaceIterator iter = associated_faces_begin(vrt);
+			iter != iterEnd; ++iter)
+		{
+			if(FaceContains(*iter, e))
+				faces.push_back(*iter);
 		}
 	}
 }
@@ -2826,11 +2884,12 @@ void Grid::get_associated(SecureVolumeContainer& vols, Vertex* v)
 		vertex_store_associated_volumes(true);
 	}
 
-	VolumeContainer& assVols = m_aaVolumeContainerVERTEX[v];
-	if(assVols.empty())
+	AssociatedVolumeIterator iterBegin = associated_volumes_begin(v);
+	AssociatedVolumeIterator iterEnd = associated_volumes_end(v);
+	if(iterBegin == iterEnd)
 		vols.clear();
 	else
-		vols.set_external_array(&assVols.front(), assVols.size());
+		vols.set_external_array(&(*iterBegin), iterEnd - iterBegin);
 }
 
 void Grid::get_associated(SecureVolumeContainer& vols, Edge* e)
@@ -2870,10 +2929,12 @@ void Grid::get_associated(SecureVolumeContainer& vols, Edge* e)
 		}
 */
 
-		VolumeContainer& assVols = m_aaVolumeContainerVERTEX[vrt];
-		for(size_t i = 0; i < assVols.size(); ++i){
-			if(VolumeContains(assVols[i], e))
-				vols.push_back(assVols[i]);
+		AssociatedVolumeIterator iterEnd = associated_volumes_end(vrt);
+		for(AssociatedVolumeIterator iter = associated_volumes_begin(vrt);
+			iter != iterEnd; ++iter)
+		{
+			if(VolumeContains(*iter, e))
+				vols.push_back(*iter);
 		}
 	}
 }
@@ -2914,9 +2975,11 @@ void Grid::get_associated_vols_raw(SecureVolumeContainer& vols, Face* f)
 //	check as few faces as possible
 	Vertex* vrt = f->vertex(0);
 
-	VolumeContainer& assVols = m_aaVolumeContainerVERTEX[vrt];
-	for(size_t i = 0; i < assVols.size(); ++i){
-		Volume* v = assVols[i];
+	AssociatedVolumeIterator iterEnd = associated_volumes_end(vrt);
+	for(AssociatedVolumeIterator iter = associated_volumes_begin(vrt);
+		iter != iterEnd; ++iter)
+	{
+		Volume* v = *iter;
 		if(VolumeContains(v, f->vertex(1))){
 			if(VolumeContains(v, f->vertex(2))){
 				if(VolumeContains(v, f))
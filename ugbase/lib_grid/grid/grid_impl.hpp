@@ -72,7 +72,7 @@ Grid::create(GridObject* pParent)
 		&&	geometry_traits<TGeomObj>::BASE_OBJECT_ID != -1,
 		invalid_geometry_type);
 
-	TGeomObj* geomObj = new TGeomObj;
+	TGeomObj* geomObj = new(allocate_object<TGeomObj>()) TGeomObj;
 //	int baseObjectType = geometry_traits<GeomObjType>::base_object_type();
 //	geomObj->m_elemHandle = m_elementStorage[baseObjectType].m_sectionContainer.insert_element(geomObj, geometry_traits<GeomObjType>::container_section());
 //	m_elementStorage[baseObjectType].m_attachmentPipe.register_element(geomObj);
@@ -91,7 +91,7 @@ Grid::create(const typename geometry_traits<TGeomObj>::Descriptor& descriptor,
 			&&	geometry_traits<TGeomObj>::BASE_OBJECT_ID != -1,
 			invalid_geometry_type);
 
-	TGeomObj* geomObj = new TGeomObj(descriptor);
+	TGeomObj* geomObj = new(allocate_object<TGeomObj>()) TGeomObj(descriptor);
 
 //	int baseObjectType = geometry_traits<TGeomObj>::base_object_type();
 //	geomObj->m_elemHandle = m_elementStorage[baseObjectType].m_sectionContainer.insert_element(geomObj, geometry_traits<GeomObjType>::container_section());
@@ -110,7 +110,7 @@ Grid::create_and_replace(typename geometry_traits<TGeomObj>::grid_base_object* p
 		&&	geometry_traits<TGeomObj>::BASE_OBJECT_ID != -1,
 		invalid_geometry_type);
 
-	TGeomObj* geomObj = new TGeomObj;
+	TGeomObj* geomObj = new(allocate_object<TGeomObj>()) TGeomObj;
 
 	if(geomObj->reference_object_id() == pReplaceMe->reference_object_id())
 	{
@@ -121,11 +121,135 @@ Grid::create_and_replace(typename geometry_traits<TGeomObj>::grid_base_object* p
 	{
 		LOG("ERROR in Grid::create_and_replace(...): reference objects do not match!");
 		assert(!"ERROR in Grid::create_and_replace(...): reference objects do not match!");
-		delete geomObj;
+		free_object(geomObj);
 		return end<TGeomObj>();
 	}
 }
 
+////////////////////////////////////////////////////////////////////////
+//	object memory
+template <class TGeomObj>
+void* Grid::allocate_object()
+{
+	const int baseObjID = geometry_traits<TGeomObj>::BASE_OBJECT_ID;
+	const int section = geometry_traits<TGeomObj>::CONTAINER_SECTION;
+
+	SlabAllocator* alloc;
+
+//	children may be created concurrently during threaded refinement
+	#ifdef UG_OPENMP
+		#pragma omp critical(ug_grid_allocate_object)
+	#endif
+	{
+		std::vector<SlabAllocator*>& vAllocators = m_vObjAllocators[baseObjID];
+		if((int)vAllocators.size() <= section){
+			vAllocators.resize(section + 1, NULL);
+			m_vObjAllocatorDestruct[baseObjID].resize(section + 1, true);
+		}
+
+		if(!vAllocators[section]){
+			vAllocators[section] = new SlabAllocator(sizeof(TGeomObj));
+			m_vObjAllocatorDestruct[baseObjID][section] =
+					grid_object_requires_destruction<TGeomObj>::value;
+		}
+	//	if any type of the section requires destruction, all of them are destroyed
+		else if(grid_object_requires_destruction<TGeomObj>::value)
+			m_vObjAllocatorDestruct[baseObjID][section] = true;
+		alloc = vAllocators[section];
+	}
+
+	UG_COND_THROW(alloc->object_size() < sizeof(TGeomObj),
+			"Grid::allocate_object: Types with equal container section have to"
+			" have the same size, but an object of size " << sizeof(TGeomObj)
+			<< " is requested from a slab of objects of size "
+			<< alloc->object_size() << " (base object id " << baseObjID
+			<< ", container section " << section << ").");
+
+	return alloc->allocate();
+}
+
+template <class TElem>
+void Grid::destroy_elements()
+{
+	typedef typename traits<TElem>::ElementStorage	ElemStorage;
+	typedef typename ElemStorage::SectionContainer	SectionContainer;
+	typedef typename SectionContainer::iterator		SectionIterator;
+
+	const int baseObjID = geometry_traits<TElem>::BASE_OBJECT_ID;
+	ElemStorage& es = element_storage<TElem>();
+	SectionContainer& sc = es.m_sectionContainer;
+
+	for(int s = 0; s < sc.num_sections(); ++s){
+	//	if all elements of the section stem from its allocator and don't
+	//	require destruction, they are discarded together with the slabs below.
+		SlabAllocator* alloc = object_allocator(baseObjID, s);
+		if(alloc && !m_vObjAllocatorDestruct[baseObjID][s]
+			&& alloc->num_allocated() == sc.num_elements(s))
+			continue;
+
+	//	the iterator has to be advanced before the element is destroyed, since
+	//	the links of the list are accessed through the element.
+		SectionIterator iter = sc.section_begin(s);
+		SectionIterator iterEnd = sc.section_end(s);
+		while(iter != iterEnd){
+			TElem* elem = *iter;
+			++iter;
+			free_object(elem);
+		}
+	}
+
+//	reset the list without accessing the destroyed elements
+	sc.get_container().set_pipe(&es.m_attachmentPipe);
+	sc.clear();
+	es.m_attachmentPipe.clear_elements();
+
+//	release the memory of all elements at once
+	for(size_t i = 0; i < m_vObjAllocators[baseObjID].size(); ++i){
+		if(m_vObjAllocators[baseObjID][i])
+			m_vObjAllocators[baseObjID][i]->release();
+	}
+}
+
+template <class TGeomObj>
+void* AllocateGridObject()
+{
+	Grid* grid = GridObjectAllocationScope::current_grid();
+	if(grid)
+		return grid->allocate_object<TGeomObj>();
+	return ::operator new(sizeof(TGeomObj));
+}
+
+////////////////////////////////////////////////////////////////////////
+//	frozen topology
+template <class TElem>
+void Grid::pack_vertex_lists(CSRAdjacency<TElem>& csr,
+			AttachmentAccessor<Vertex, Attachment<std::vector<TElem*> > >& aaList)
+{
+	csr.reset(m_vertexElementStorage.m_attachmentPipe.num_data_entries());
+
+	for(VertexIterator iter = begin<Vertex>(); iter != end<Vertex>(); ++iter)
+		csr.set_num((*iter)->grid_data_index(), aaList[*iter].size());
+
+	csr.compute_offsets();
+
+	for(VertexIterator iter = begin<Vertex>(); iter != end<Vertex>(); ++iter){
+		std::vector<TElem*>& list = aaList[*iter];
+		csr.assign((*iter)->grid_data_index(), list.begin(), list.end());
+		std::vector<TElem*>().swap(list);
+	}
+}
+
+template <class TElem>
+void Grid::unpack_vertex_lists(CSRAdjacency<TElem>& csr,
+			AttachmentAccessor<Vertex, Attachment<std::vector<TElem*> > >& aaList)
+{
+	for(VertexIterator iter = begin<Vertex>(); iter != end<Vertex>(); ++iter){
+		const uint ind = (*iter)->grid_data_index();
+		aaList[*iter].assign(csr.begin(ind), csr.end(ind));
+	}
+	csr.clear();
+}
+
 ////////////////////////////////////////////////////////////////////////
 template <class TGeomObj>
 void Grid::reserve(size_t num)
@@ -49,6 +49,11 @@ enum VertexContainerSections
 	CSVRT_CONSTRAINED_VERTEX = 1
 };
 
+//	the destructors of the following types have no effect. Their objects can
+//	thus be discarded together with the slabs of a grid.
+class RegularVertex;
+template <> struct grid_object_requires_destruction<RegularVertex>	{static const bool value = false;};
+
 
 ////////////////////////////////////////////////////////////////////////
 //	RegularVertex
@@ -66,7 +71,7 @@ class UG_API RegularVertex : public Vertex
 
 		virtual ~RegularVertex()	{}
 
-		virtual GridObject* create_empty_instance() const	{return new RegularVertex;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<RegularVertex>()) RegularVertex;}
 
 		virtual int container_section() const	{return CSVRT_REGULAR_VERTEX;}
 		virtual ReferenceObjectID reference_object_id() const {return ROID_VERTEX;}
@@ -119,7 +124,7 @@ class UG_API ConstrainedVertex : public Vertex
 				m_constrainingObj->remove_constraint_link(this);
 		}
 
-		virtual GridObject* create_empty_instance() const	{return new ConstrainedVertex;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<ConstrainedVertex>()) ConstrainedVertex;}
 
 		virtual int container_section() const	{return CSVRT_CONSTRAINED_VERTEX;}
 		virtual ReferenceObjectID reference_object_id() const {return ROID_VERTEX;}
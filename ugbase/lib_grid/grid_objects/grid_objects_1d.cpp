@@ -42,13 +42,13 @@ bool RegularEdge::refine(std::vector<Edge*>& vNewEdgesOut, Vertex* newVertex,
 	vNewEdgesOut.clear();
 	if(pSubstituteVrts)
 	{
-		vNewEdgesOut.push_back(new RegularEdge(pSubstituteVrts[0], newVertex));
-		vNewEdgesOut.push_back(new RegularEdge(newVertex, pSubstituteVrts[1]));
+		vNewEdgesOut.push_back(new(AllocateGridObject<RegularEdge>()) RegularEdge(pSubstituteVrts[0], newVertex));
+		vNewEdgesOut.push_back(new(AllocateGridObject<RegularEdge>()) RegularEdge(newVertex, pSubstituteVrts[1]));
 	}
 	else
 	{
-		vNewEdgesOut.push_back(new RegularEdge(vertex(0), newVertex));
-		vNewEdgesOut.push_back(new RegularEdge(newVertex, vertex(1)));
+		vNewEdgesOut.push_back(new(AllocateGridObject<RegularEdge>()) RegularEdge(vertex(0), newVertex));
+		vNewEdgesOut.push_back(new(AllocateGridObject<RegularEdge>()) RegularEdge(newVertex, vertex(1)));
 	}
 	return true;
 }
@@ -68,13 +68,13 @@ bool ConstrainedEdge::refine(std::vector<Edge*>& vNewEdgesOut, Vertex* newVertex
 	vNewEdgesOut.clear();
 	if(pSubstituteVrts)
 	{
-		vNewEdgesOut.push_back(new ConstrainedEdge(pSubstituteVrts[0], newVertex));
-		vNewEdgesOut.push_back(new ConstrainedEdge(newVertex, pSubstituteVrts[1]));
+		vNewEdgesOut.push_back(new(AllocateGridObject<ConstrainedEdge>()) ConstrainedEdge(pSubstituteVrts[0], newVertex));
+		vNewEdgesOut.push_back(new(AllocateGridObject<ConstrainedEdge>()) ConstrainedEdge(newVertex, pSubstituteVrts[1]));
 	}
 	else
 	{
-		vNewEdgesOut.push_back(new ConstrainedEdge(vertex(0), newVertex));
-		vNewEdgesOut.push_back(new ConstrainedEdge(newVertex, vertex(1)));
+		vNewEdgesOut.push_back(new(AllocateGridObject<ConstrainedEdge>()) ConstrainedEdge(vertex(0), newVertex));
+		vNewEdgesOut.push_back(new(AllocateGridObject<ConstrainedEdge>()) ConstrainedEdge(newVertex, vertex(1)));
 	}
 	return true;
 }
@@ -94,13 +94,13 @@ bool ConstrainingEdge::refine(std::vector<Edge*>& vNewEdgesOut, Vertex* newVerte
 	vNewEdgesOut.clear();
 	if(pSubstituteVrts)
 	{
-		vNewEdgesOut.push_back(new ConstrainingEdge(pSubstituteVrts[0], newVertex));
-		vNewEdgesOut.push_back(new ConstrainingEdge(newVertex, pSubstituteVrts[1]));
+		vNewEdgesOut.push_back(new(AllocateGridObject<ConstrainingEdge>()) ConstrainingEdge(pSubstituteVrts[0], newVertex));
+		vNewEdgesOut.push_back(new(AllocateGridObject<ConstrainingEdge>()) ConstrainingEdge(newVertex, pSubstituteVrts[1]));
 	}
 	else
 	{
-		vNewEdgesOut.push_back(new ConstrainingEdge(vertex(0), newVertex));
-		vNewEdgesOut.push_back(new ConstrainingEdge(newVertex, vertex(1)));
+		vNewEdgesOut.push_back(new(AllocateGridObject<ConstrainingEdge>()) ConstrainingEdge(vertex(0), newVertex));
+		vNewEdgesOut.push_back(new(AllocateGridObject<ConstrainingEdge>()) ConstrainingEdge(newVertex, vertex(1)));
 	}
 	return true;
 }
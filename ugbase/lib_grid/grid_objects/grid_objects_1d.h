@@ -52,6 +52,11 @@ enum EdgeContainerSections
 	CSEDGE_CONSTRAINING_EDGE = 2
 };
 
+//	the destructors of the following types have no effect. Their objects can
+//	thus be discarded together with the slabs of a grid.
+class RegularEdge;
+template <> struct grid_object_requires_destruction<RegularEdge>	{static const bool value = false;};
+
 
 
 ////////////////////////////////////////////////////////////////////////
@@ -83,7 +88,7 @@ class UG_API RegularEdge : public Edge
 
 		virtual ~RegularEdge()	{}
 
-		virtual GridObject* create_empty_instance() const	{return new RegularEdge;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<RegularEdge>()) RegularEdge;}
 
 		virtual int container_section() const	{return CSEDGE_REGULAR_EDGE;}
 		virtual ReferenceObjectID reference_object_id() const {return ROID_EDGE;}
@@ -171,7 +176,7 @@ class UG_API ConstrainedEdge : public Edge
 				m_pConstrainingObject->remove_constraint_link(this);
 		}
 
-		virtual GridObject* create_empty_instance() const	{return new ConstrainedEdge;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<ConstrainedEdge>()) ConstrainedEdge;}
 
 		virtual int container_section() const	{return CSEDGE_CONSTRAINED_EDGE;}
 		virtual ReferenceObjectID reference_object_id() const {return ROID_EDGE;}
@@ -309,7 +314,7 @@ class UG_API ConstrainingEdge : public Edge
 			}
 		}
 
-		virtual GridObject* create_empty_instance() const	{return new ConstrainingEdge;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<ConstrainingEdge>()) ConstrainingEdge;}
 
 		virtual int container_section() const	{return CSEDGE_CONSTRAINING_EDGE;}
 		virtual ReferenceObjectID reference_object_id() const {return ROID_EDGE;}
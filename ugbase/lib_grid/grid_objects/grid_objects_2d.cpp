@@ -155,9 +155,9 @@ refine(std::vector<Face*>& vNewFacesOut,
 		}
 
 	//	create three new triangles
-		vNewFacesOut.push_back(new RefTriType(vrts[0], vrts[1], newFaceVertex));
-		vNewFacesOut.push_back(new RefTriType(vrts[1], vrts[2], newFaceVertex));
-		vNewFacesOut.push_back(new RefTriType(vrts[2], vrts[0], newFaceVertex));
+		vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[0], vrts[1], newFaceVertex));
+		vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[1], vrts[2], newFaceVertex));
+		vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[2], vrts[0], newFaceVertex));
 		return true;
 	}
 	else
@@ -183,9 +183,9 @@ refine(std::vector<Face*>& vNewFacesOut,
 				iCorner[2] = (iCorner[1] + 1) % 3;
 					
 			//	create the new triangles.
-				vNewFacesOut.push_back(new RefTriType(vrts[iCorner[0]], vrts[iCorner[1]],
+				vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[iCorner[0]], vrts[iCorner[1]],
 																newEdgeVertices[iNew]));
-				vNewFacesOut.push_back(new RefTriType(vrts[iCorner[0]], newEdgeVertices[iNew],
+				vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[iCorner[0]], newEdgeVertices[iNew],
 																vrts[iCorner[2]]));
 																
 				return true;
@@ -214,10 +214,10 @@ refine(std::vector<Face*>& vNewFacesOut,
 				iCorner[2] = (iFree + 2) % 3;
 				
 			//	create the faces
-				vNewFacesOut.push_back(new RefTriType(newEdgeVertices[iNew[0]],
+				vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(newEdgeVertices[iNew[0]],
 																vrts[iCorner[2]],
 																newEdgeVertices[iNew[1]]));
-				vNewFacesOut.push_back(new RefQuadType(vrts[iCorner[0]], vrts[iCorner[1]],
+				vNewFacesOut.push_back(new(AllocateGridObject<RefQuadType>()) RefQuadType(vrts[iCorner[0]], vrts[iCorner[1]],
 														newEdgeVertices[iNew[0]], newEdgeVertices[iNew[1]]));
 				return true;
 			}
@@ -225,10 +225,10 @@ refine(std::vector<Face*>& vNewFacesOut,
 			case 3:
 			{
 			//	perform regular refine.
-				vNewFacesOut.push_back(new RefTriType(vrts[0], newEdgeVertices[0], newEdgeVertices[2]));
-				vNewFacesOut.push_back(new RefTriType(vrts[1], newEdgeVertices[1], newEdgeVertices[0]));
-				vNewFacesOut.push_back(new RefTriType(vrts[2], newEdgeVertices[2], newEdgeVertices[1]));
-				vNewFacesOut.push_back(new RefTriType(newEdgeVertices[0], newEdgeVertices[1], newEdgeVertices[2]));
+				vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[0], newEdgeVertices[0], newEdgeVertices[2]));
+				vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[1], newEdgeVertices[1], newEdgeVertices[0]));
+				vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[2], newEdgeVertices[2], newEdgeVertices[1]));
+				vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(newEdgeVertices[0], newEdgeVertices[1], newEdgeVertices[2]));
 				return true;
 			}
 
@@ -325,8 +325,8 @@ create_faces_by_edge_split(int splitEdgeIndex,
 	int ind1 = (ind0 + 1) % 3;
 	int ind2 = (ind1 + 1) % 3;
 
-	vNewFacesOut.push_back(new Triangle(vrts[ind0], newVertex, vrts[ind2]));
-	vNewFacesOut.push_back(new Triangle(newVertex, vrts[ind1], vrts[ind2]));
+	vNewFacesOut.push_back(new(AllocateGridObject<Triangle>()) Triangle(vrts[ind0], newVertex, vrts[ind2]));
+	vNewFacesOut.push_back(new(AllocateGridObject<Triangle>()) Triangle(newVertex, vrts[ind1], vrts[ind2]));
 }
 
 
@@ -435,9 +435,9 @@ create_faces_by_edge_split(int splitEdgeIndex,
 	TriangleDescriptor td;
 
 //	edge-split generates 3 triangles
-	vNewFacesOut.push_back(new RefTriType(vrts[ind0], newVertex, vrts[ind3]));
-	vNewFacesOut.push_back(new RefTriType(newVertex, vrts[ind1], vrts[ind2]));
-	vNewFacesOut.push_back(new RefTriType(vrts[ind3], newVertex, vrts[ind2]));
+	vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[ind0], newVertex, vrts[ind3]));
+	vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(newVertex, vrts[ind1], vrts[ind2]));
+	vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[ind3], newVertex, vrts[ind2]));
 
 //	we're done.
 }
@@ -478,10 +478,10 @@ refine(std::vector<Face*>& vNewFacesOut,
 	{
 		case 0:
 		//	create four new triangles
-			vNewFacesOut.push_back(new RefTriType(vrts[0], vrts[1], newFaceVertex));
-			vNewFacesOut.push_back(new RefTriType(vrts[1], vrts[2], newFaceVertex));
-			vNewFacesOut.push_back(new RefTriType(vrts[2], vrts[3], newFaceVertex));
-			vNewFacesOut.push_back(new RefTriType(vrts[3], vrts[0], newFaceVertex));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[0], vrts[1], newFaceVertex));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[1], vrts[2], newFaceVertex));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[2], vrts[3], newFaceVertex));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(vrts[3], vrts[0], newFaceVertex));
 			return true;
 			
 		case 1:
@@ -511,19 +511,19 @@ refine(std::vector<Face*>& vNewFacesOut,
 
 		//	create the new elements
 			if(snapPointIndex == -1){
-				vNewFacesOut.push_back(new RefTriType(corner[0], corner[1], edgeVrts[iNew]));
-				vNewFacesOut.push_back(new RefTriType(corner[0], edgeVrts[iNew], corner[3]));
-				vNewFacesOut.push_back(new RefTriType(corner[3], edgeVrts[iNew], corner[2]));
+				vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[0], corner[1], edgeVrts[iNew]));
+				vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[0], edgeVrts[iNew], corner[3]));
+				vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[3], edgeVrts[iNew], corner[2]));
 			}
 			else{
 				snapPointIndex = (snapPointIndex + 4 - rot) % 4;
 				if(snapPointIndex == 0){
-					vNewFacesOut.push_back(new RefTriType(corner[0], corner[1], edgeVrts[iNew]));
-					vNewFacesOut.push_back(new RefQuadType(corner[0], edgeVrts[iNew], corner[2], corner[3]));
+					vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[0], corner[1], edgeVrts[iNew]));
+					vNewFacesOut.push_back(new(AllocateGridObject<RefQuadType>()) RefQuadType(corner[0], edgeVrts[iNew], corner[2], corner[3]));
 				}
 				else if(snapPointIndex == 3){
-					vNewFacesOut.push_back(new RefQuadType(corner[0], corner[1], edgeVrts[iNew], corner[3]));
-					vNewFacesOut.push_back(new RefTriType(corner[3], edgeVrts[iNew], corner[2]));
+					vNewFacesOut.push_back(new(AllocateGridObject<RefQuadType>()) RefQuadType(corner[0], corner[1], edgeVrts[iNew], corner[3]));
+					vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[3], edgeVrts[iNew], corner[2]));
 				}
 				else{
 					UG_THROW("Unexpected snap-point index: " << snapPointIndex << ". This is an implementation error!");
@@ -560,10 +560,10 @@ refine(std::vector<Face*>& vNewFacesOut,
 				ReorderCornersCCW(corner, vrts, 4, (iNew[0] + 3) % 4);
 				
 			//	create new faces
-				vNewFacesOut.push_back(new RefQuadType(corner[0], corner[1],
+				vNewFacesOut.push_back(new(AllocateGridObject<RefQuadType>()) RefQuadType(corner[0], corner[1],
 													edgeVrts[iNew[0]], edgeVrts[iNew[1]]));
 
-				vNewFacesOut.push_back(new RefQuadType(edgeVrts[iNew[1]], edgeVrts[iNew[0]],
+				vNewFacesOut.push_back(new(AllocateGridObject<RefQuadType>()) RefQuadType(edgeVrts[iNew[1]], edgeVrts[iNew[0]],
 														corner[2], corner[3]));
 			}
 			else{
@@ -584,15 +584,15 @@ refine(std::vector<Face*>& vNewFacesOut,
 
 			//	create new faces
 				if(snapPointIndex == -1){
-					vNewFacesOut.push_back(new RefTriType(corner[0], corner[1], edgeVrts[iNew[0]]));
-					vNewFacesOut.push_back(new RefTriType(edgeVrts[iNew[0]], corner[2], edgeVrts[iNew[1]]));
-					vNewFacesOut.push_back(new RefTriType(corner[3], corner[0], edgeVrts[iNew[1]]));
-					vNewFacesOut.push_back(new RefTriType(corner[0], edgeVrts[iNew[0]], edgeVrts[iNew[1]]));
+					vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[0], corner[1], edgeVrts[iNew[0]]));
+					vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(edgeVrts[iNew[0]], corner[2], edgeVrts[iNew[1]]));
+					vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[3], corner[0], edgeVrts[iNew[1]]));
+					vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[0], edgeVrts[iNew[0]], edgeVrts[iNew[1]]));
 				}
 				else{
-					vNewFacesOut.push_back(new RefTriType(corner[0], corner[1], edgeVrts[iNew[0]]));
-					vNewFacesOut.push_back(new RefTriType(corner[3], corner[0], edgeVrts[iNew[1]]));
-					vNewFacesOut.push_back(new RefQuadType(corner[0], edgeVrts[iNew[0]], corner[2], edgeVrts[iNew[1]]));
+					vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[0], corner[1], edgeVrts[iNew[0]]));
+					vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[3], corner[0], edgeVrts[iNew[1]]));
+					vNewFacesOut.push_back(new(AllocateGridObject<RefQuadType>()) RefQuadType(corner[0], edgeVrts[iNew[0]], corner[2], edgeVrts[iNew[1]]));
 				}
 			}
 
@@ -625,10 +625,10 @@ refine(std::vector<Face*>& vNewFacesOut,
 			ReorderCornersCCW(corner, vrts, 4, (iFree + 1) % 4);
 
 		//	create the faces
-			vNewFacesOut.push_back(new RefQuadType(corner[0], nvrts[0], nvrts[2], corner[3]));
-			vNewFacesOut.push_back(new RefTriType(corner[1], nvrts[1], nvrts[0]));
-			vNewFacesOut.push_back(new RefTriType(corner[2], nvrts[2], nvrts[1]));
-			vNewFacesOut.push_back(new RefTriType(nvrts[0], nvrts[1], nvrts[2]));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefQuadType>()) RefQuadType(corner[0], nvrts[0], nvrts[2], corner[3]));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[1], nvrts[1], nvrts[0]));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(corner[2], nvrts[2], nvrts[1]));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(nvrts[0], nvrts[1], nvrts[2]));
 
 			return true;
 		}
@@ -637,14 +637,14 @@ refine(std::vector<Face*>& vNewFacesOut,
 		{
 		//	we'll create 4 new quads. create a new center if required.
 			if(!newFaceVertex)
-				newFaceVertex = new RegularVertex;
+				newFaceVertex = new(AllocateGridObject<RegularVertex>()) RegularVertex;
 
 			*newFaceVertexOut = newFaceVertex;
 		
-			vNewFacesOut.push_back(new RefQuadType(vrts[0], edgeVrts[0], newFaceVertex, edgeVrts[3]));
-			vNewFacesOut.push_back(new RefQuadType(vrts[1], edgeVrts[1], newFaceVertex, edgeVrts[0]));
-			vNewFacesOut.push_back(new RefQuadType(vrts[2], edgeVrts[2], newFaceVertex, edgeVrts[1]));
-			vNewFacesOut.push_back(new RefQuadType(vrts[3], edgeVrts[3], newFaceVertex, edgeVrts[2]));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefQuadType>()) RefQuadType(vrts[0], edgeVrts[0], newFaceVertex, edgeVrts[3]));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefQuadType>()) RefQuadType(vrts[1], edgeVrts[1], newFaceVertex, edgeVrts[0]));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefQuadType>()) RefQuadType(vrts[2], edgeVrts[2], newFaceVertex, edgeVrts[1]));
+			vNewFacesOut.push_back(new(AllocateGridObject<RefQuadType>()) RefQuadType(vrts[3], edgeVrts[3], newFaceVertex, edgeVrts[2]));
 			return true;
 		}
 	}
@@ -691,7 +691,7 @@ collapse_edge(std::vector<Face*>& vNewFacesOut,
 	int ind3 = (ind2 + 1) % 4;
 
 //	ind0 and ind1 will be replaced by newVertex.
-	vNewFacesOut.push_back(new RefTriType(newVertex, vrts[ind2], vrts[ind3]));
+	vNewFacesOut.push_back(new(AllocateGridObject<RefTriType>()) RefTriType(newVertex, vrts[ind2], vrts[ind3]));
 	return true;
 }
 
@@ -67,6 +67,11 @@ class ConstrainedQuadrilateral;
 class ConstrainingTriangle;
 class ConstrainingQuadrilateral;
 
+//	the destructors of the following types have no effect. Their objects can
+//	thus be discarded together with the slabs of a grid.
+template <> struct grid_object_requires_destruction<Triangle>	{static const bool value = false;};
+template <> struct grid_object_requires_destruction<Quadrilateral>	{static const bool value = false;};
+
 ////////////////////////////////////////////////////////////////////////////////
 //	NORMAL FACES
 ////////////////////////////////////////////////////////////////////////////////
@@ -114,7 +119,7 @@ class UG_API CustomTriangle : public BaseClass
 		CustomTriangle(const TriangleDescriptor& td);
 		CustomTriangle(Vertex* v1, Vertex* v2, Vertex* v3);
 
-		virtual GridObject* create_empty_instance() const	{return new ConcreteTriangleType;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<ConcreteTriangleType>()) ConcreteTriangleType;}
 		virtual ReferenceObjectID reference_object_id() const {return ROID_TRIANGLE;}
 
 		virtual Vertex* vertex(size_t index) const	{return m_vertices[index];}
@@ -185,7 +190,7 @@ class UG_API Triangle :
 	protected:
 		virtual Edge* create_edge(int index)
 			{
-				return new RegularEdge(m_vertices[index], m_vertices[(index+1) % 3]);
+				return new(AllocateGridObject<RegularEdge>()) RegularEdge(m_vertices[index], m_vertices[(index+1) % 3]);
 			}
 };
 
@@ -259,7 +264,7 @@ class UG_API CustomQuadrilateral : public BaseClass
 		CustomQuadrilateral(Vertex* v1, Vertex* v2,
 							Vertex* v3, Vertex* v4);
 
-		virtual GridObject* create_empty_instance() const	{return new ConcreteQuadrilateralType;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<ConcreteQuadrilateralType>()) ConcreteQuadrilateralType;}
 		virtual ReferenceObjectID reference_object_id() const {return ROID_QUADRILATERAL;}
 
 		virtual Vertex* vertex(size_t index) const	{return m_vertices[index];}
@@ -338,7 +343,7 @@ class UG_API Quadrilateral :
 	protected:
 		virtual Edge* create_edge(int index)
 		{
-			return new RegularEdge(m_vertices[index], m_vertices[(index+1) % 4]);
+			return new(AllocateGridObject<RegularEdge>()) RegularEdge(m_vertices[index], m_vertices[(index+1) % 4]);
 		}
 };
 
@@ -459,7 +464,7 @@ class UG_API ConstrainedTriangle :
 	protected:
 		virtual Edge* create_edge(int index)
 			{
-				return new ConstrainedEdge(m_vertices[index], m_vertices[(index+1) % 3]);
+				return new(AllocateGridObject<ConstrainedEdge>()) ConstrainedEdge(m_vertices[index], m_vertices[(index+1) % 3]);
 			}
 };
 
@@ -516,7 +521,7 @@ class UG_API ConstrainedQuadrilateral :
 	protected:
 		virtual Edge* create_edge(int index)
 			{
-				return new ConstrainedEdge(m_vertices[index], m_vertices[(index+1) % 4]);
+				return new(AllocateGridObject<ConstrainedEdge>()) ConstrainedEdge(m_vertices[index], m_vertices[(index+1) % 4]);
 			}
 };
 
@@ -751,7 +756,7 @@ class UG_API ConstrainingTriangle :
 
 		virtual Edge* create_edge(int index)
 			{
-				return new RegularEdge(m_vertices[index], m_vertices[(index+1) % 3]);
+				return new(AllocateGridObject<RegularEdge>()) RegularEdge(m_vertices[index], m_vertices[(index+1) % 3]);
 			}
 };
 
@@ -820,7 +825,7 @@ class UG_API ConstrainingQuadrilateral :
 
 		virtual Edge* create_edge(int index)
 			{
-				return new RegularEdge(m_vertices[index], m_vertices[(index+1) % 4]);
+				return new(AllocateGridObject<RegularEdge>()) RegularEdge(m_vertices[index], m_vertices[(index+1) % 4]);
 			}
 };
 
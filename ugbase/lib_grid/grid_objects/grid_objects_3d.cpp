@@ -145,11 +145,11 @@ void CreateVolumesFromElementIndexList (
 		}
 
 		switch(gridObjectID){
-			case GOID_TETRAHEDRON:	volsOut.push_back(new Tetrahedron(vd));	break;
-			case GOID_PYRAMID:		volsOut.push_back(new Pyramid(vd));		break;
-			case GOID_PRISM:		volsOut.push_back(new Prism(vd)); 		break;
-			case GOID_HEXAHEDRON:	volsOut.push_back(new Hexahedron(vd));	break;
-			case GOID_OCTAHEDRON:	volsOut.push_back(new Octahedron(vd));	break;
+			case GOID_TETRAHEDRON:	volsOut.push_back(new(AllocateGridObject<Tetrahedron>()) Tetrahedron(vd));	break;
+			case GOID_PYRAMID:		volsOut.push_back(new(AllocateGridObject<Pyramid>()) Pyramid(vd));		break;
+			case GOID_PRISM:		volsOut.push_back(new(AllocateGridObject<Prism>()) Prism(vd)); 		break;
+			case GOID_HEXAHEDRON:	volsOut.push_back(new(AllocateGridObject<Hexahedron>()) Hexahedron(vd));	break;
+			case GOID_OCTAHEDRON:	volsOut.push_back(new(AllocateGridObject<Octahedron>()) Octahedron(vd));	break;
 		}
 	}
 }
@@ -372,7 +372,7 @@ Edge* Tetrahedron::create_edge(int index)
 	using namespace tet_rules;
 	assert(index >= 0 && index < NUM_EDGES);
 	const int* e = EDGE_VRT_INDS[index];
-	return new RegularEdge(m_vertices[e[0]], m_vertices[e[1]]);
+	return new(AllocateGridObject<RegularEdge>()) RegularEdge(m_vertices[e[0]], m_vertices[e[1]]);
 }
 
 Face* Tetrahedron::create_face(int index)
@@ -381,7 +381,7 @@ Face* Tetrahedron::create_face(int index)
 	assert(index >= 0 && index < NUM_FACES);
 
 	const int* f = FACE_VRT_INDS[index];
-	return new Triangle(m_vertices[f[0]], m_vertices[f[2]], m_vertices[f[1]]);
+	return new(AllocateGridObject<Triangle>()) Triangle(m_vertices[f[0]], m_vertices[f[2]], m_vertices[f[1]]);
 }
 
 void Tetrahedron::
@@ -604,7 +604,7 @@ Edge* Hexahedron::create_edge(int index)
 	using namespace hex_rules;
 	assert(index >= 0 && index < NUM_EDGES);
 	const int* e = EDGE_VRT_INDS[index];
-	return new RegularEdge(m_vertices[e[0]], m_vertices[e[1]]);
+	return new(AllocateGridObject<RegularEdge>()) RegularEdge(m_vertices[e[0]], m_vertices[e[1]]);
 }
 
 Face* Hexahedron::create_face(int index)
@@ -613,7 +613,7 @@ Face* Hexahedron::create_face(int index)
 	assert(index >= 0 && index < NUM_FACES);
 
 	const int* f = FACE_VRT_INDS[index];
-	return new Quadrilateral(m_vertices[f[0]], m_vertices[f[3]],
+	return new(AllocateGridObject<Quadrilateral>()) Quadrilateral(m_vertices[f[0]], m_vertices[f[3]],
 							 m_vertices[f[2]], m_vertices[f[1]]);
 }
 
@@ -852,7 +852,7 @@ Edge* Prism::create_edge(int index)
 	using namespace prism_rules;
 	assert(index >= 0 && index < NUM_EDGES);
 	const int* e = EDGE_VRT_INDS[index];
-	return new RegularEdge(m_vertices[e[0]], m_vertices[e[1]]);
+	return new(AllocateGridObject<RegularEdge>()) RegularEdge(m_vertices[e[0]], m_vertices[e[1]]);
 }
 
 Face* Prism::create_face(int index)
@@ -862,11 +862,11 @@ Face* Prism::create_face(int index)
 
 	const int* f = FACE_VRT_INDS[index];
 	if(f[3] == -1){
-		return new Triangle(m_vertices[f[0]], m_vertices[f[2]],
+		return new(AllocateGridObject<Triangle>()) Triangle(m_vertices[f[0]], m_vertices[f[2]],
 							m_vertices[f[1]]);
 	}
 	else{
-		return new Quadrilateral(m_vertices[f[0]], m_vertices[f[3]],
+		return new(AllocateGridObject<Quadrilateral>()) Quadrilateral(m_vertices[f[0]], m_vertices[f[3]],
 								 m_vertices[f[2]], m_vertices[f[1]]);
 	}
 }
@@ -1134,7 +1134,7 @@ Edge* Pyramid::create_edge(int index)
 	using namespace pyra_rules;
 	assert(index >= 0 && index < NUM_EDGES);
 	const int* e = EDGE_VRT_INDS[index];
-	return new RegularEdge(m_vertices[e[0]], m_vertices[e[1]]);
+	return new(AllocateGridObject<RegularEdge>()) RegularEdge(m_vertices[e[0]], m_vertices[e[1]]);
 }
 
 Face* Pyramid::create_face(int index)
@@ -1144,11 +1144,11 @@ Face* Pyramid::create_face(int index)
 
 	const int* f = FACE_VRT_INDS[index];
 	if(f[3] == -1){
-		return new Triangle(m_vertices[f[0]], m_vertices[f[2]],
+		return new(AllocateGridObject<Triangle>()) Triangle(m_vertices[f[0]], m_vertices[f[2]],
 							m_vertices[f[1]]);
 	}
 	else{
-		return new Quadrilateral(m_vertices[f[0]], m_vertices[f[3]],
+		return new(AllocateGridObject<Quadrilateral>()) Quadrilateral(m_vertices[f[0]], m_vertices[f[3]],
 								 m_vertices[f[2]], m_vertices[f[1]]);
 	}
 }
@@ -1391,7 +1391,7 @@ Edge* Octahedron::create_edge(int index)
 	using namespace oct_rules;
 	assert(index >= 0 && index < NUM_EDGES);
 	const int* e = EDGE_VRT_INDS[index];
-	return new RegularEdge(m_vertices[e[0]], m_vertices[e[1]]);
+	return new(AllocateGridObject<RegularEdge>()) RegularEdge(m_vertices[e[0]], m_vertices[e[1]]);
 }
 
 Face* Octahedron::create_face(int index)
@@ -1400,7 +1400,7 @@ Face* Octahedron::create_face(int index)
 	assert(index >= 0 && index < NUM_FACES);
 
 	const int* f = FACE_VRT_INDS[index];
-    return new Triangle(m_vertices[f[0]], m_vertices[f[2]], m_vertices[f[1]]);
+    return new(AllocateGridObject<Triangle>()) Triangle(m_vertices[f[0]], m_vertices[f[2]], m_vertices[f[1]]);
 }
 
 void Octahedron::
@@ -56,6 +56,19 @@ enum VolumeContainerSections
 	CSVOL_OCTAHEDRON = 4
 };
 
+//	the destructors of the following types have no effect. Their objects can
+//	thus be discarded together with the slabs of a grid.
+class Tetrahedron;
+class Hexahedron;
+class Prism;
+class Pyramid;
+class Octahedron;
+template <> struct grid_object_requires_destruction<Tetrahedron>	{static const bool value = false;};
+template <> struct grid_object_requires_destruction<Hexahedron>	{static const bool value = false;};
+template <> struct grid_object_requires_destruction<Prism>	{static const bool value = false;};
+template <> struct grid_object_requires_destruction<Pyramid>	{static const bool value = false;};
+template <> struct grid_object_requires_destruction<Octahedron>	{static const bool value = false;};
+
 ////////////////////////////////////////////////////////////////////////
 //	TetrahedronDescriptor
 ///	only used to initialize a tetrahedron. for all other tasks you should use VolumeDescripor.
@@ -101,7 +114,7 @@ class UG_API Tetrahedron : public Volume
 		Tetrahedron(const TetrahedronDescriptor& td);
 		Tetrahedron(Vertex* v1, Vertex* v2, Vertex* v3, Vertex* v4);
 
-		virtual GridObject* create_empty_instance() const	{return new Tetrahedron;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<Tetrahedron>()) Tetrahedron;}
 
 		virtual Vertex* vertex(size_t index) const	{return m_vertices[index];}
 		virtual ConstVertexArray vertices() const		{return m_vertices;}
@@ -238,7 +251,7 @@ class UG_API Hexahedron : public Volume
 		Hexahedron(Vertex* v1, Vertex* v2, Vertex* v3, Vertex* v4,
 					Vertex* v5, Vertex* v6, Vertex* v7, Vertex* v8);
 
-		virtual GridObject* create_empty_instance() const	{return new Hexahedron;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<Hexahedron>()) Hexahedron;}
 
 		virtual Vertex* vertex(size_t index) const	{return m_vertices[index];}
 		virtual ConstVertexArray vertices() const		{return m_vertices;}
@@ -371,7 +384,7 @@ class UG_API Prism : public Volume
 		Prism(Vertex* v1, Vertex* v2, Vertex* v3,
 				Vertex* v4, Vertex* v5, Vertex* v6);
 
-		virtual GridObject* create_empty_instance() const	{return new Prism;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<Prism>()) Prism;}
 
 		virtual Vertex* vertex(size_t index) const	{return m_vertices[index];}
 		virtual ConstVertexArray vertices() const		{return m_vertices;}
@@ -504,7 +517,7 @@ class UG_API Pyramid : public Volume
 		Pyramid(Vertex* v1, Vertex* v2, Vertex* v3,
 				Vertex* v4, Vertex* v5);
 
-		virtual GridObject* create_empty_instance() const	{return new Pyramid;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<Pyramid>()) Pyramid;}
 
 		virtual Vertex* vertex(size_t index) const	{return m_vertices[index];}
 		virtual ConstVertexArray vertices() const		{return m_vertices;}
@@ -636,7 +649,7 @@ class UG_API Octahedron : public Volume
 		Octahedron(const OctahedronDescriptor& td);
 		Octahedron(Vertex* v1, Vertex* v2, Vertex* v3, Vertex* v4, Vertex* v5, Vertex* v6);
 
-		virtual GridObject* create_empty_instance() const	{return new Octahedron;}
+		virtual GridObject* create_empty_instance() const	{return new(AllocateGridObject<Octahedron>()) Octahedron;}
 
 		virtual Vertex* vertex(size_t index) const	{return m_vertices[index];}
 		virtual ConstVertexArray vertices() const		{return m_vertices;}
@@ -205,6 +205,18 @@ class GridMessage_Creation : public MessageHub::IMessage
 		int m_procId;
 };
 
+
+///	Instances of this class inform that the positions of vertices have been changed
+/**	Objects which store data derived from the vertex positions, e.g. the
+ * Jacobians of affine elements, should invalidate these data on this message.
+ * Code which moves vertices of an existing grid (e.g. scaling, smoothing,
+ * projection) should post it on the message hub of the grid afterwards.*/
+class GridMessage_PositionsChanged : public MessageHub::IMessage
+{
+	public:
+		GridMessage_PositionsChanged()	{}
+};
+
 }//	end of namespace
 
 #endif
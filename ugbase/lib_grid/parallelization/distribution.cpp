@@ -1802,7 +1802,8 @@ bool DistributeGrid(MultiGrid& mg,
 					GridDataSerializationHandler& serializer,
 					bool createVerticalInterfaces,
 					const std::vector<int>* processMap,
-					const pcl::ProcessCommunicator& procComm)
+					const pcl::ProcessCommunicator& procComm,
+					uint64* pNumBytesSentOut)
 {
 	GDIST_PROFILE_FUNC();
 	PCL_DEBUG_BARRIER(procComm);
@@ -2000,6 +2001,12 @@ bool DistributeGrid(MultiGrid& mg,
 			out.write((char*)&magicNumber2, sizeof(int));
 		}
 	}
+	if(pNumBytesSentOut){
+		*pNumBytesSentOut = 0;
+		for(size_t i = 0; i < outBufs.size(); ++i)
+			*pNumBytesSentOut += outBufs[i].write_pos();
+	}
+
 	PCL_DEBUG_BARRIER(procComm);
 	GDIST_PROFILE_END();
 
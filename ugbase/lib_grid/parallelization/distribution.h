@@ -77,6 +77,9 @@ enum InterfaceStates{
  * 			shPartition.num_subsets(). All values in the array have to be
  * 			in the range [0, pcl:NumProcs()[.
  * 			The procMap associates a process rank with each subset index.
+ *
+ * \param	pNumBytesSentOut (optional) is filled with the number of bytes which
+ * 			were sent from the local process to other processes.
  */
 bool DistributeGrid(MultiGrid& mg,
 					SubsetHandler& shPartition,
@@ -84,7 +87,8 @@ bool DistributeGrid(MultiGrid& mg,
 					bool createVerticalInterfaces,
 					const std::vector<int>* processMap = NULL,
 					const pcl::ProcessCommunicator& procComm =
-												pcl::ProcessCommunicator());
+												pcl::ProcessCommunicator(),
+					uint64* pNumBytesSentOut = NULL);
 
 }// end of namespace
 
@@ -254,7 +254,9 @@ LoadBalancer() :
 	m_mg(NULL),
 	m_balanceThreshold(0.9),
 	m_elementThreshold(1),
-	m_createVerticalInterfaces(true)
+	m_createVerticalInterfaces(true),
+	m_numMigratedElems(0),
+	m_migrationVolume(0)
 {
 	m_processHierarchy = ProcessHierarchy::create();
 	m_balanceWeights = make_sp(new StdBalanceWeights());
@@ -329,19 +331,23 @@ problems_occurred()
 	return false;
 }
 
+int LoadBalancer::
+highest_element_type()
+{
+	int highestElem = VERTEX;
+	if(m_mg->num<Volume>() > 0)		highestElem = VOLUME;
+	else if(m_mg->num<Face>() > 0)	highestElem = FACE;
+	else if(m_mg->num<Edge>() > 0)	highestElem = EDGE;
+
+	pcl::ProcessCommunicator procCom;
+	return procCom.allreduce(highestElem, PCL_RO_MAX);
+}
+
 number LoadBalancer::
 estimate_distribution_quality(std::vector<number>* pLvlQualitiesOut)
 {
 	if(m_mg){
-		int highestElem = VERTEX;
-		if(m_mg->num<Volume>() > 0)		highestElem = VOLUME;
-		else if(m_mg->num<Face>() > 0)	highestElem = FACE;
-		else if(m_mg->num<Edge>() > 0)	highestElem = EDGE;
-
-		pcl::ProcessCommunicator procCom;
-		highestElem = procCom.allreduce(highestElem, PCL_RO_MAX);
-
-		switch(highestElem){
+		switch(highest_element_type()){
 		case VERTEX:
 			return estimate_distribution_quality_impl<Vertex>(pLvlQualitiesOut);
 		case EDGE:
@@ -430,6 +436,32 @@ estimate_distribution_quality_impl(std::vector<number>* pLvlQualitiesOut)
 	return comGlobal.allreduce(minQuality, PCL_RO_MIN);
 }
 
+template <class TElem>
+void LoadBalancer::
+count_migrating_elements(uint64& numMigratingOut, uint64& numTotalOut,
+						 SubsetHandler& partitions, const std::vector<int>* procMap)
+{
+	typedef typename Grid::traits<TElem>::iterator ElemIter;
+
+	MultiGrid& mg = *m_mg;
+	DistributedGridManager& distGridMgr = *mg.distributed_grid_manager();
+	const int localProc = pcl::ProcRank();
+
+	numMigratingOut = numTotalOut = 0;
+	for(ElemIter iter = mg.begin<TElem>(); iter != mg.end<TElem>(); ++iter){
+		TElem* e = *iter;
+		if(distGridMgr.is_ghost(e))
+			continue;
+
+		++numTotalOut;
+		int targetProc = partitions.get_subset_index(e);
+		if((targetProc >= 0) && procMap)
+			targetProc = procMap->at(targetProc);
+		if((targetProc >= 0) && (targetProc != localProc))
+			++numMigratingOut;
+	}
+}
+
 number LoadBalancer::
 estimate_distribution_quality()
 {
@@ -460,21 +492,21 @@ rebalance()
 	m_balanceWeights->refresh_weights(0);
 	//m_connectionWeights->refresh_weights(0);
 
-//	distribution quality is only interesting if repartitioning is supported.
-//	If it is not we'll set it to -1, thus calling partition anyways
-	number distQuality = -1;
-	if(m_partitioner->supports_repartitioning()){
-		distQuality = estimate_distribution_quality();
-		if(!m_partitioner->verbose()){
-			UG_LOG("Current estimated distribution quality: " << distQuality << "\n");
-		}
+	m_numMigratedElems = 0;
+	m_migrationVolume = 0;
+
+//	Only redistribute if the current distribution is worse than the threshold.
+//	Note that a newly reached distribution level leads to a bad quality, since
+//	the grid on that level is not yet distributed between the involved processes.
+	number distQuality = estimate_distribution_quality();
+	if(!m_partitioner->verbose()){
+		UG_LOG("Current estimated distribution quality: " << distQuality << "\n");
 	}
 
 	if(m_balanceThreshold > distQuality)
 	{
 		UG_DLOG(LIB_GRID, 1, "LoadBalancer-rebalance: partitioning...\n");
 		if(m_partitioner->partition(0, m_elementThreshold)){
-			UG_LOG("Redistributing...\n");
 			SubsetHandler& sh = m_partitioner->get_partitions();
 //			if(sh.num<elem_t>() != m_mg->num<elem_t>()){
 //				UG_THROW("All elements have to be assigned to subsets during partitioning! "
@@ -483,13 +515,33 @@ rebalance()
 
 			const std::vector<int>* procMap = m_partitioner->get_process_map();
 
+			uint64 numMigrating = 0, numTotal = 0;
+			switch(highest_element_type()){
+				case VERTEX:	count_migrating_elements<Vertex>(numMigrating, numTotal, sh, procMap); break;
+				case EDGE:		count_migrating_elements<Edge>(numMigrating, numTotal, sh, procMap); break;
+				case FACE:		count_migrating_elements<Face>(numMigrating, numTotal, sh, procMap); break;
+				case VOLUME:	count_migrating_elements<Volume>(numMigrating, numTotal, sh, procMap); break;
+			}
+
+			pcl::ProcessCommunicator procCom;
+			m_numMigratedElems = procCom.allreduce((unsigned long)numMigrating, PCL_RO_SUM);
+			numTotal = procCom.allreduce((unsigned long)numTotal, PCL_RO_SUM);
+
+			UG_LOG("Redistributing " << m_numMigratedElems << " of " << numTotal
+				   << " elements (" << 100. * (number)m_numMigratedElems / (number)max<uint64>(numTotal, 1)
+				   << "%)...\n");
+
 			UG_DLOG(LIB_GRID, 1, "LoadBalancer-rebalance: distributing...\n");
-			if(!DistributeGrid(*m_mg, sh, m_serializer, m_createVerticalInterfaces, procMap))
+			uint64 numBytesSent = 0;
+			if(!DistributeGrid(*m_mg, sh, m_serializer, m_createVerticalInterfaces, procMap,
+							   pcl::ProcessCommunicator(), &numBytesSent))
 			{
 				UG_THROW("DistributeGrid failed!");
 			}
 
-			UG_LOG("Redistribution done\n");
+			m_migrationVolume = procCom.allreduce((unsigned long)numBytesSent, PCL_RO_SUM);
+			UG_LOG("Redistribution done. Sent " << (number)m_migrationVolume / (1024. * 1024.)
+				   << " MB between processes.\n");
 			UG_DLOG(LIB_GRID, 1, "LoadBalancer-stop rebalance\n");
 			return true;
 		}
@@ -317,9 +317,23 @@ class LoadBalancer{
 	 * given level. Furthermore it tries to minimize the connection-weights of
 	 * edges which connect elements on different processes.
 	 *
-	 * The method returns false if e.g. problems during partitioning occurred.*/
+	 * The method returns false if e.g. problems during partitioning occurred.
+	 *
+	 * \note	The balance threshold is considered for all partitioners. Use a
+	 *			partitioner which supports repartitioning (e.g. Partitioner_DualGraph)
+	 *			to only move elements at the partition boundaries if an imbalance
+	 *			was detected.*/
 		virtual bool rebalance();
 
+	///	number of elements which left their process during the last call to rebalance
+	/**	Only elements of highest dimension are counted. The value is the same
+	 * on all processes.*/
+		size_t num_migrated_elements() const	{return m_numMigratedElems;}
+
+	///	number of bytes which were sent between processes during the last call to rebalance
+	/**	The value is the same on all processes.*/
+		size_t migration_volume() const			{return m_migrationVolume;}
+
 
 	/** The returned distribution quality represents the global quality of the elements
 	 * of highest dimension and is the same on all processes.
@@ -356,9 +370,18 @@ class LoadBalancer{
 		void print_quality_records() const;
 
 	private:
+	///	returns the highest dimensional element type (VERTEX, ..., VOLUME) in the global grid
+		int highest_element_type();
+
 		template <class TElem>
 		number estimate_distribution_quality_impl(std::vector<number>* pLvlQualitiesOut);
 
+	///	counts the local elements which will be sent to other processes due to the given partition
+		template <class TElem>
+		void count_migrating_elements(uint64& numMigratingOut, uint64& numTotalOut,
+									  SubsetHandler& partitions,
+									  const std::vector<int>* procMap);
+
 		MultiGrid*			m_mg;
 		number				m_balanceThreshold;
 		size_t				m_elementThreshold;
@@ -369,6 +392,8 @@ class LoadBalancer{
 		GridDataSerializationHandler	m_serializer;
 		StringStreamTable	m_qualityRecords;
 		bool m_createVerticalInterfaces;
+		size_t	m_numMigratedElems;
+		size_t	m_migrationVolume;
 };
 
 ///	\}
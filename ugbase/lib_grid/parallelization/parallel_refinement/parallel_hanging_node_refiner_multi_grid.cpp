@@ -55,7 +55,8 @@ ParallelHangingNodeRefiner_MultiGrid(
 	m_pDistGridMgr(NULL),
 	m_pMG(NULL)
 {
-	add_ref_mark_adjuster(ParallelHNodeAdjuster::create());
+	m_parallelAdjuster = ParallelHNodeAdjuster::create();
+	add_ref_mark_adjuster(m_parallelAdjuster);
 }
 
 ParallelHangingNodeRefiner_MultiGrid::
@@ -66,7 +67,8 @@ ParallelHangingNodeRefiner_MultiGrid(
 	m_pDistGridMgr(&distGridMgr),
 	m_pMG(distGridMgr.get_assigned_grid())
 {
-	add_ref_mark_adjuster(ParallelHNodeAdjuster::create());
+	m_parallelAdjuster = ParallelHNodeAdjuster::create();
+	add_ref_mark_adjuster(m_parallelAdjuster);
 }
 
 ParallelHangingNodeRefiner_MultiGrid::
@@ -83,10 +85,41 @@ set_distributed_grid_manager(DistributedGridManager& distGridMgr)
 	m_pMG = distGridMgr.get_assigned_grid();
 }
 
+template <class TStdVector>
+static bool ContainsInterfaceElem(const TStdVector& elems,
+								  DistributedGridManager& distGridMgr)
+{
+	for(size_t i = 0; i < elems.size(); ++i){
+		if(distGridMgr.is_interface_element(elems[i]))
+			return true;
+	}
+	return false;
+}
+
 bool ParallelHangingNodeRefiner_MultiGrid::
 continue_collect_objects_for_refine(bool continueRequired)
 {
-	return pcl::OneProcTrue(continueRequired);
+	int flags[2];
+	flags[0] = (int)continueRequired;
+	flags[1] = 0;
+	if(continueRequired && m_pDistGridMgr){
+		DistributedGridManager& dgm = *m_pDistGridMgr;
+		flags[1] = (int)(ContainsInterfaceElem(newly_marked_ref_vertices(), dgm)
+						 || ContainsInterfaceElem(newly_marked_ref_edges(), dgm)
+						 || ContainsInterfaceElem(newly_marked_ref_faces(), dgm)
+						 || ContainsInterfaceElem(newly_marked_ref_volumes(), dgm));
+	}
+
+	int globFlags[2];
+	pcl::ProcessCommunicator com;
+	com.allreduce(flags, globFlags, 2, PCL_RO_MAX);
+
+	if(globFlags[0] && m_pDistGridMgr)
+		m_parallelAdjuster->set_exchange_hint(globFlags[1] != 0);
+	else
+		m_parallelAdjuster->clear_exchange_hint();
+
+	return globFlags[0] != 0;
 }
 
 
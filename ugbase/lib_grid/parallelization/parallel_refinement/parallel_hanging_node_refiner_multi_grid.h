@@ -37,6 +37,7 @@
 #include "lib_grid/refinement/hanging_node_refiner_multi_grid.h"
 #include "../distributed_grid.h"
 #include "pcl/pcl_interface_communicator.h"
+#include "parallel_hnode_adjuster.h"
 
 namespace ug
 {
@@ -81,6 +82,11 @@ class ParallelHangingNodeRefiner_MultiGrid : public HangingNodeRefiner_MultiGrid
 	///	a callback that allows to deny refinement of special volumes
 		virtual bool refinement_is_allowed(Volume* elem);
 
+	///	decides globally whether mark adjustment has to be continued
+	/**	A single reduction determines whether any process marked new elements
+	 * and whether any of those are interface elements. The latter is passed
+	 * on to the ParallelHNodeAdjuster, so that it doesn't have to perform a
+	 * second global reduction in the next adjustment round.*/
 		virtual bool continue_collect_objects_for_refine(bool continueRequired);
 
 	///	distributes hnode marks
@@ -148,6 +154,7 @@ class ParallelHangingNodeRefiner_MultiGrid : public HangingNodeRefiner_MultiGrid
 		pcl::InterfaceCommunicator<EdgeLayout> m_intfComEDGE;
 		pcl::InterfaceCommunicator<FaceLayout> m_intfComFACE;
 		pcl::InterfaceCommunicator<VolumeLayout> m_intfComVOL;
+		SPParallelHNodeAdjuster	m_parallelAdjuster;
 };
 
 /// @}
@@ -129,6 +129,11 @@ ref_marks_changed(IRefiner& ref,
 {
 	UG_DLOG(LIB_GRID, 1, "refMarkAdjuster-start: ParallelHNodeAdjuster::ref_marks_changed\n");
 	UG_ASSERT(ref.grid(), "A refiner has to operate on a grid, before marks can be adjusted!");
+
+//	an exchange hint is only valid for a single call
+	const bool hintAvailable = m_exchangeHintAvailable;
+	m_exchangeHintAvailable = false;
+
 	if(!ref.grid()){
 		UG_DLOG(LIB_GRID, 1, "refMarkAdjuster-stop: ParallelHNodeAdjuster::ref_marks_changed\n");
 		return;
@@ -143,18 +148,19 @@ ref_marks_changed(IRefiner& ref,
 	DistributedGridManager& distGridMgr = *grid.distributed_grid_manager();
 	GridLayoutMap& layoutMap = distGridMgr.grid_layout_map();
 
-//	check whether new interface elements have been selected
-	bool newInterfaceVrtsMarked = ContainsInterfaceElem(vrts, distGridMgr);
-	bool newInterfaceEdgeMarked = ContainsInterfaceElem(edges, distGridMgr);
-	bool newInterfaceFacesMarked = ContainsInterfaceElem(faces, distGridMgr);
-	bool newInterfaceVolsMarked = ContainsInterfaceElem(vols, distGridMgr);
-
-	bool newlyMarkedElems = newInterfaceVrtsMarked ||
-							newInterfaceEdgeMarked ||
-							newInterfaceFacesMarked ||
-							newInterfaceVolsMarked;
-
-	bool exchangeFlag = pcl::OneProcTrue(newlyMarkedElems);
+//	check whether new interface elements have been selected. If the refiner
+//	already performed the global check, we don't have to repeat it here.
+	bool exchangeFlag;
+	if(hintAvailable)
+		exchangeFlag = m_exchangeHint;
+	else{
+		bool newlyMarkedElems = ContainsInterfaceElem(vrts, distGridMgr)
+							 || ContainsInterfaceElem(edges, distGridMgr)
+							 || ContainsInterfaceElem(faces, distGridMgr)
+							 || ContainsInterfaceElem(vols, distGridMgr);
+
+		exchangeFlag = pcl::OneProcTrue(newlyMarkedElems);
+	}
 
 	if(exchangeFlag){
 		const byte consideredMarks = RM_REFINE | RM_ANISOTROPIC;
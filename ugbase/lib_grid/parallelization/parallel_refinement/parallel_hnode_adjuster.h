@@ -49,8 +49,20 @@ class ParallelHNodeAdjuster : public IRefMarkAdjuster
 	public:
 		static SPParallelHNodeAdjuster create()		{return SPParallelHNodeAdjuster(new ParallelHNodeAdjuster);}
 
+		ParallelHNodeAdjuster() : m_exchangeHintAvailable(false), m_exchangeHint(false)	{}
 		virtual ~ParallelHNodeAdjuster()	{}
 
+	///	tells the adjuster whether marks have to be exchanged during the next call
+	/**	A refiner which already performs a global reduction after each adjustment
+	 * round can use this method to pass the result on to the adjuster. The
+	 * adjuster then skips its own global check during the next call to
+	 * ref_marks_changed. The hint is only used once.*/
+		void set_exchange_hint(bool exchangeRequired)
+		{m_exchangeHintAvailable = true; m_exchangeHint = exchangeRequired;}
+
+	///	discards a previously set exchange hint
+		void clear_exchange_hint()		{m_exchangeHintAvailable = false;}
+
 		virtual void ref_marks_changed(IRefiner& ref,
 										const std::vector<Vertex*>& vrts,
 										const std::vector<Edge*>& edges,
@@ -62,6 +74,8 @@ class ParallelHNodeAdjuster : public IRefMarkAdjuster
 		pcl::InterfaceCommunicator<VertexLayout> m_intfComVRT;
 		pcl::InterfaceCommunicator<EdgeLayout> m_intfComEDGE;
 		pcl::InterfaceCommunicator<FaceLayout> m_intfComFACE;
+		bool m_exchangeHintAvailable;
+		bool m_exchangeHint;
 };
 
 }// end of namespace
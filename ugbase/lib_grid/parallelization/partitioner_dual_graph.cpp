@@ -0,0 +1,558 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+#include <algorithm>
+#include "partitioner_dual_graph.h"
+#include "distributed_grid.h"
+#include "common/util/vector_util.h"
+#include "lib_grid/parallelization/util/compol_copy_attachment.h"
+#include "lib_grid/parallelization/util/compol_subset.h"
+#include "lib_grid/parallelization/util/parallel_dual_graph.h"
+
+using namespace std;
+
+namespace ug{
+
+template <class TElem, int dim>
+Partitioner_DualGraph<TElem, dim>::
+Partitioner_DualGraph() :
+	m_mg(NULL),
+	m_repartitioning(true)
+{
+	m_processHierarchy = SPProcessHierarchy(new ProcessHierarchy);
+	m_processHierarchy->add_hierarchy_level(0, 1);
+
+	m_balanceWeights = make_sp(new IBalanceWeights());
+}
+
+template <class TElem, int dim>
+Partitioner_DualGraph<TElem, dim>::
+~Partitioner_DualGraph()
+{
+}
+
+////////////////////////////////
+//	SETTERS AND GETTERS
+////////////////////////////////
+template <class TElem, int dim>
+void Partitioner_DualGraph<TElem, dim>::
+set_grid(MultiGrid* mg, Attachment<MathVector<dim> > aPos)
+{
+	m_mg = mg;
+	if(m_sh.valid())
+		m_sh->assign_grid(m_mg);
+	m_aPos = aPos;
+}
+
+template <class TElem, int dim>
+void Partitioner_DualGraph<TElem, dim>::
+set_subset_handler(SmartPtr<SubsetHandler> sh)
+{
+	m_sh = sh;
+	if(m_mg)
+		m_sh->assign_grid(m_mg);
+}
+
+template <class TElem, int dim>
+void Partitioner_DualGraph<TElem, dim>::
+set_next_process_hierarchy(SPProcessHierarchy procHierarchy)
+{
+	m_nextProcessHierarchy = procHierarchy;
+}
+
+template <class TElem, int dim>
+void Partitioner_DualGraph<TElem, dim>::
+set_balance_weights(SPBalanceWeights balanceWeights)
+{
+	m_balanceWeights = balanceWeights;
+}
+
+template <class TElem, int dim>
+void Partitioner_DualGraph<TElem, dim>::
+set_partition_post_processor(SPPartitionPostProcessor ppp)
+{
+	m_partitionPostProcessor = ppp;
+}
+
+template <class TElem, int dim>
+ConstSPProcessHierarchy Partitioner_DualGraph<TElem, dim>::
+current_process_hierarchy() const
+{
+	return m_processHierarchy;
+}
+
+template <class TElem, int dim>
+ConstSPProcessHierarchy Partitioner_DualGraph<TElem, dim>::
+next_process_hierarchy() const
+{
+	return m_nextProcessHierarchy;
+}
+
+template <class TElem, int dim>
+SubsetHandler& Partitioner_DualGraph<TElem, dim>::
+get_partitions()
+{
+	if(m_sh.invalid()){
+		if(m_mg)
+			m_sh = make_sp(new SubsetHandler(*m_mg));
+		else
+			m_sh = make_sp(new SubsetHandler());
+	}
+	return *m_sh;
+}
+
+template <class TElem, int dim>
+const std::vector<int>* Partitioner_DualGraph<TElem, dim>::
+get_process_map() const
+{
+	return NULL;
+}
+
+
+////////////////////////////////
+//	PARTITIONING
+////////////////////////////////
+template <class TElem, int dim>
+bool Partitioner_DualGraph<TElem, dim>::
+partition(size_t baseLvl, size_t elementThreshold)
+{
+	GDIST_PROFILE_FUNC();
+
+	UG_COND_THROW(m_mg == NULL,
+			"No grid was specified for Partitioner_DualGraph. "
+			"partitioning can't be executed without a specified grid.");
+
+	if(m_balanceWeights.invalid())
+		m_balanceWeights = make_sp(new IBalanceWeights());
+
+	MultiGrid& mg = *m_mg;
+	if(m_sh.invalid())
+		m_sh = make_sp(new SubsetHandler(mg));
+	SubsetHandler& sh = *m_sh;
+	sh.clear();
+
+	ANumber aWeight;
+	mg.attach_to<elem_t>(aWeight);
+	if(m_partitionPostProcessor.valid())
+		m_partitionPostProcessor->init_post_processing(m_mg, m_sh.get());
+
+//	assign all elements below baseLvl to the local process
+	for(int i = 0; i < (int)baseLvl; ++i)
+		sh.assign_subset(mg.begin<elem_t>(i), mg.end<elem_t>(i), 0);
+
+	const ProcessHierarchy* procH;
+	if(m_nextProcessHierarchy.valid())
+		procH = m_nextProcessHierarchy.get();
+	else
+		procH = m_processHierarchy.get();
+
+	m_problemsOccurred = false;
+
+//	iterate over all hierarchy levels and perform rebalancing for all
+//	hierarchy-sections which contain levels higher than baseLvl
+	for(size_t hlevel = 0; hlevel < procH->num_hierarchy_levels(); ++ hlevel)
+	{
+		int numProcs = procH->num_global_procs_involved(hlevel);
+
+		int minLvl = procH->grid_base_level(hlevel);
+		int maxLvl = (int)mg.top_level();
+
+		if(hlevel + 1 < procH->num_hierarchy_levels()){
+			maxLvl = min<int>(maxLvl,
+						(int)procH->grid_base_level(hlevel + 1) - 1);
+		}
+
+		if(minLvl < (int)baseLvl)
+			minLvl = (int)baseLvl;
+
+		if(maxLvl < minLvl)
+			continue;
+
+		if(numProcs <= 1){
+			for(int i = minLvl; i <= maxLvl; ++i)
+				sh.assign_subset(mg.begin<elem_t>(i), mg.end<elem_t>(i), 0);
+			continue;
+		}
+
+	//	if clustered siblings are enabled, we'll perform partitioning on the level
+	//	below minLvl (if such a level exists). However, only the partition-map
+	//	of minLvl and levels above will be adjusted.
+		int partitionLvl = minLvl;
+		pcl::ProcessCommunicator com;
+
+		if((minLvl > 0) && base_class::clustered_siblings_enabled()){
+			partitionLvl = minLvl - 1;
+			size_t partitionHLvl = m_processHierarchy->hierarchy_level_from_grid_level(partitionLvl);
+			com = m_processHierarchy->global_proc_com(partitionHLvl);
+		}
+		else
+			com = procH->global_proc_com(hlevel);
+
+		perform_partitioning(numProcs, minLvl, maxLvl, partitionLvl, aWeight, com,
+							 elementThreshold);
+
+		for(int i = minLvl; i < maxLvl; ++i){
+			copy_partitions_to_children(sh, i);
+		}
+	}
+
+	if(m_nextProcessHierarchy.valid()){
+		*m_processHierarchy = *m_nextProcessHierarchy;
+		m_nextProcessHierarchy = SPProcessHierarchy(NULL);
+	}
+
+	mg.detach_from<elem_t>(aWeight);
+	if(m_partitionPostProcessor.valid())
+		m_partitionPostProcessor->partitioning_done();
+
+	PCL_DEBUG_BARRIER_ALL();
+	return true;
+}
+
+
+template <class TElem, int dim>
+void Partitioner_DualGraph<TElem, dim>::
+perform_partitioning(int numTargetProcs, int minLvl, int maxLvl, int partitionLvl,
+					 ANumber aWeight, pcl::ProcessCommunicator com,
+					 size_t elementThreshold)
+{
+	GDIST_PROFILE_FUNC();
+
+	typedef typename MultiGrid::traits<elem_t>::iterator iter_t;
+
+	MultiGrid&		mg	= *m_mg;
+	SubsetHandler&	sh	= *m_sh;
+	DistributedGridManager* pdgm = mg.distributed_grid_manager();
+
+	vector<int> origSubsetIndices;
+	if(partitionLvl < minLvl){
+		origSubsetIndices.reserve(mg.num<elem_t>(partitionLvl));
+		for(iter_t eiter = mg.begin<elem_t>(partitionLvl);
+			eiter != mg.end<elem_t>(partitionLvl); ++eiter)
+		{
+			origSubsetIndices.push_back(sh.get_subset_index(*eiter));
+		}
+	}
+
+//	invalidate target partitions of all elements in partitionLvl
+	sh.assign_subset(mg.begin<elem_t>(partitionLvl),
+					   mg.end<elem_t>(partitionLvl), -1);
+
+	accumulate_weights(partitionLvl, minLvl, maxLvl, aWeight);
+	Grid::AttachmentAccessor<elem_t, ANumber> aaWeight(mg, aWeight);
+
+	ParallelDualGraph<elem_t, int> graph(&mg);
+	graph.generate_graph(partitionLvl, com);
+	pcl::ProcessCommunicator graphCom = graph.process_communicator();
+
+	if(!graphCom.empty()){
+		const int numLocalVrts = graph.num_graph_vertices();
+		const int* localAdjStart = graph.adjacency_map_structure();
+		const int* localAdjacency = NULL;
+		if(graph.num_graph_edges() > 0)
+			localAdjacency = graph.adjacency_map();
+		const int numVrts = graph.parallel_offset_map()[graphCom.size()];
+		const int localOffset = graph.parallel_offset_map()[graphCom.get_local_proc_id()];
+
+	//	the graph partitioner works with integral weights. We thus scale the
+	//	balance weights so that the total weight fits into an int.
+		number maxWeight = 0;
+		int numElems = 0;
+		for(int i = 0; i < numLocalVrts; ++i){
+			const number w = aaWeight[graph.get_element(i)];
+			maxWeight = max(maxWeight, w);
+		//	vertical masters are not counted, since they have no weight
+			if(w > 0)
+				++numElems;
+		}
+		maxWeight = graphCom.allreduce(maxWeight, PCL_RO_MAX);
+		numElems = graphCom.allreduce(numElems, PCL_RO_SUM);
+
+	//	don't create partitions which would in average contain less than
+	//	elementThreshold elements
+		if(elementThreshold > 1){
+			numTargetProcs = max(1, min<int>(numTargetProcs,
+											 numElems / (int)elementThreshold));
+		}
+
+		number scale = 1;
+		if(maxWeight > 0)
+			scale = max<number>(1, min<number>(1000, (1 << 30) / (number)numVrts)) / maxWeight;
+
+	//	the current process is used as initial partition during repartitioning.
+		int initialPart = -1;
+		if(m_repartitioning && (pcl::ProcRank() < numTargetProcs))
+			initialPart = pcl::ProcRank();
+
+		vector<int> degrees(numLocalVrts);
+		vector<int> vrtWeights(numLocalVrts);
+		vector<int> initialParts(numLocalVrts, initialPart);
+		vector<int> adjacency(localAdjacency, localAdjacency + graph.num_graph_edges());
+		vector<int> edgeWeights(graph.num_graph_edges());
+
+		for(int i = 0; i < numLocalVrts; ++i){
+			elem_t* e = graph.get_element(i);
+			degrees[i] = localAdjStart[i + 1] - localAdjStart[i];
+
+			if(aaWeight[e] > 0)
+				vrtWeights[i] = max(1, (int)(aaWeight[e] * scale + 0.5));
+			else{
+			//	vertical masters are represented by their vertical slaves
+				vrtWeights[i] = 0;
+				initialParts[i] = -1;
+			}
+
+			for(int j = localAdjStart[i]; j < localAdjStart[i + 1]; ++j)
+				edgeWeights[j] = num_side_descendants(graph.get_connection(j), maxLvl);
+		}
+
+	//	gather the graph on the first process of graphCom
+		vector<int> gDegrees, gVrtWeights, gInitialParts;
+		WeightedGraph g;
+		if(graphCom.size() > 1){
+			graphCom.gatherv(gDegrees, degrees, 0);
+			graphCom.gatherv(gVrtWeights, vrtWeights, 0);
+			graphCom.gatherv(gInitialParts, initialParts, 0);
+			graphCom.gatherv(g.adjacency, adjacency, 0);
+			graphCom.gatherv(g.edgeWeights, edgeWeights, 0);
+		}
+		else{
+			gDegrees.swap(degrees);
+			gVrtWeights.swap(vrtWeights);
+			gInitialParts.swap(initialParts);
+			g.adjacency.swap(adjacency);
+			g.edgeWeights.swap(edgeWeights);
+		}
+
+		vector<int> partition(numVrts, 0);
+		if(graphCom.get_local_proc_id() == 0){
+			g.adjStart.resize(numVrts + 1);
+			g.adjStart[0] = 0;
+			for(int i = 0; i < numVrts; ++i)
+				g.adjStart[i + 1] = g.adjStart[i] + gDegrees[i];
+			g.vrtWeights.swap(gVrtWeights);
+
+		//	connections over process boundaries were weighted by both processes,
+		//	possibly differently. Use the larger weight in both directions.
+			for(int i = 0; i < numVrts; ++i){
+				for(int k = g.adjStart[i]; k < g.adjStart[i + 1]; ++k){
+					const int j = g.adjacency[k];
+					if(j <= i)
+						continue;
+					for(int l = g.adjStart[j]; l < g.adjStart[j + 1]; ++l){
+						if(g.adjacency[l] == i){
+							const int w = max(g.edgeWeights[k], g.edgeWeights[l]);
+							g.edgeWeights[k] = g.edgeWeights[l] = w;
+							break;
+						}
+					}
+				}
+			}
+
+			bool gotInitialPartition = false;
+			for(int i = 0; i < numVrts; ++i){
+				if(gInitialParts[i] >= 0){
+					gotInitialPartition = true;
+					break;
+				}
+			}
+
+			int cut;
+			if(gotInitialPartition)
+				cut = m_graphPartitioner.repartition(partition, g, numTargetProcs, gInitialParts);
+			else
+				cut = m_graphPartitioner.partition(partition, g, numTargetProcs);
+
+			if(verbose()){
+				UG_LOG("Partitioner_DualGraph: partitioned " << numVrts << " elements on level "
+					   << partitionLvl << " into " << numTargetProcs << " parts. Edge-cut: " << cut);
+				if(gotInitialPartition){
+					int totalWeight = 0;
+					for(int i = 0; i < numVrts; ++i)
+						totalWeight += g.vertex_weight(i);
+					UG_LOG(", migrated weight: "
+						   << MultilevelGraphPartitioner::migrated_weight(g, partition, gInitialParts)
+						   << " of " << totalWeight);
+				}
+				UG_LOG("\n");
+			}
+		}
+
+		if(graphCom.size() > 1)
+			graphCom.broadcast(GetDataPtr(partition), numVrts, 0);
+
+		for(int i = 0; i < numLocalVrts; ++i)
+			sh.assign_subset(graph.get_element(i), partition[localOffset + i]);
+	}
+
+	if(m_partitionPostProcessor.valid())
+		m_partitionPostProcessor->post_process(partitionLvl);
+
+	if(partitionLvl < minLvl){
+		UG_ASSERT(partitionLvl == minLvl - 1,
+				  "partitionLvl and minLvl should be neighbors");
+
+	//	copy subset indices from partition-level to minLvl
+		for(int i = partitionLvl; i < minLvl; ++i){
+			copy_partitions_to_children(sh, i);
+		}
+
+	//	reset partitions in the specified partition-level
+		size_t counter = 0;
+		for(iter_t eiter = mg.begin<elem_t>(partitionLvl);
+			eiter != mg.end<elem_t>(partitionLvl); ++eiter, ++counter)
+		{
+			sh.assign_subset(*eiter, origSubsetIndices[counter]);
+		}
+	}
+	else if(pdgm){
+	//	copy subset indices from vertical slaves to vertical masters,
+	//	since vertical masters were only represented by their vertical slaves
+		GridLayoutMap& glm = pdgm->grid_layout_map();
+		ComPol_Subset<layout_t>	compolSHCopy(sh, true);
+
+		if(glm.has_layout<elem_t>(INT_V_SLAVE))
+			m_intfcCom.send_data(glm.get_layout<elem_t>(INT_V_SLAVE).layout_on_level(partitionLvl),
+								 compolSHCopy);
+		if(glm.has_layout<elem_t>(INT_V_MASTER))
+			m_intfcCom.receive_data(glm.get_layout<elem_t>(INT_V_MASTER).layout_on_level(partitionLvl),
+									compolSHCopy);
+		m_intfcCom.communicate();
+	}
+}
+
+
+template <class TElem, int dim>
+void Partitioner_DualGraph<TElem, dim>::
+accumulate_weights(int baseLvl, int minLvl, int maxLvl, ANumber aWeight)
+{
+	GDIST_PROFILE_FUNC();
+	typedef typename Grid::traits<elem_t>::iterator ElemIter;
+
+	IBalanceWeights& bw = *m_balanceWeights;
+	MultiGrid& mg = *m_mg;
+	DistributedGridManager& dgm = *mg.distributed_grid_manager();
+	GridLayoutMap& glm = dgm.grid_layout_map();
+	Grid::AttachmentAccessor<elem_t, ANumber> aaWeight(mg, aWeight);
+	ComPol_CopyAttachment<layout_t, ANumber> compolCopy(mg, aWeight);
+
+	for(int lvl = maxLvl; lvl >= baseLvl; --lvl){
+		if(lvl < maxLvl){
+		//	copy from v-slaves to vmasters, since only v-slaves have children
+			if(glm.has_layout<elem_t>(INT_V_SLAVE))
+				m_intfcCom.send_data(glm.get_layout<elem_t>(INT_V_SLAVE).layout_on_level(lvl + 1),
+									 compolCopy);
+			if(glm.has_layout<elem_t>(INT_V_MASTER))
+				m_intfcCom.receive_data(glm.get_layout<elem_t>(INT_V_MASTER).layout_on_level(lvl + 1),
+										compolCopy);
+			m_intfcCom.communicate();
+		}
+
+		for(ElemIter iter = mg.begin<elem_t>(lvl); iter != mg.end<elem_t>(lvl); ++iter)
+		{
+			elem_t* e = *iter;
+		//	v-masters on the base level are represented by their v-slaves
+			if((lvl == baseLvl) && dgm.contains_status(e, ES_V_MASTER)){
+				aaWeight[e] = 0;
+				continue;
+			}
+
+			number w = 0;
+			if(lvl >= minLvl)
+				w = bw.get_weight(e);
+			size_t numChildren = mg.num_children<elem_t>(e);
+			for(size_t i = 0; i < numChildren; ++i)
+				w += aaWeight[mg.get_child<elem_t>(e, i)];
+			aaWeight[e] = w;
+		}
+	}
+}
+
+
+template <class TElem, int dim>
+int Partitioner_DualGraph<TElem, dim>::
+num_side_descendants(side_t* s, int maxLvl)
+{
+	MultiGrid& mg = *m_mg;
+	if((mg.get_level(s) >= maxLvl) || (mg.num_children<side_t>(s) == 0))
+		return 1;
+
+	int num = 0;
+	for(size_t i = 0; i < mg.num_children<side_t>(s); ++i)
+		num += num_side_descendants(mg.get_child<side_t>(s, i), maxLvl);
+	return num;
+}
+
+
+template <class TElem, int dim>
+void Partitioner_DualGraph<TElem, dim>::
+copy_partitions_to_children(ISubsetHandler& partitionSH, int lvl)
+{
+	GDIST_PROFILE_FUNC();
+	typedef typename Grid::traits<elem_t>::iterator ElemIter;
+	MultiGrid& mg = *m_mg;
+
+//	assign partitions to all children in this hierarchy level
+	for(ElemIter iter = mg.begin<elem_t>(lvl); iter != mg.end<elem_t>(lvl); ++iter)
+	{
+		size_t numChildren = mg.num_children<elem_t>(*iter);
+		int si = partitionSH.get_subset_index(*iter);
+		for(size_t i = 0; i < numChildren; ++i)
+			partitionSH.assign_subset(mg.get_child<elem_t>(*iter, i), si);
+	}
+
+	if(mg.is_parallel()){
+		GridLayoutMap& glm = mg.distributed_grid_manager()->grid_layout_map();
+	//	communicate partitions from v-masters to v-slaves, since v-slaves
+	//	havn't got no parents on their procs.
+		ComPol_Subset<layout_t>	compolSHCopy(partitionSH, true);
+		if(glm.has_layout<elem_t>(INT_V_MASTER)){
+			m_intfcCom.send_data(glm.get_layout<elem_t>(INT_V_MASTER).layout_on_level(lvl+1),
+								 compolSHCopy);
+		}
+		if(glm.has_layout<elem_t>(INT_V_SLAVE)){
+			m_intfcCom.receive_data(glm.get_layout<elem_t>(INT_V_SLAVE).layout_on_level(lvl+1),
+									compolSHCopy);
+		}
+		m_intfcCom.communicate();
+	}
+}
+
+
+template class Partitioner_DualGraph<Edge, 1>;
+template class Partitioner_DualGraph<Edge, 2>;
+template class Partitioner_DualGraph<Face, 2>;
+template class Partitioner_DualGraph<Edge, 3>;
+template class Partitioner_DualGraph<Face, 3>;
+template class Partitioner_DualGraph<Volume, 3>;
+
+}// end of namespace
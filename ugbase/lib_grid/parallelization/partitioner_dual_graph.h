@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG__partitioner_dual_graph__
+#define __H__UG__partitioner_dual_graph__
+
+#include <vector>
+#include "parallel_grid_layout.h"
+#include "load_balancer.h"
+#include "pcl/pcl_interface_communicator.h"
+#include "lib_grid/algorithms/graph/multilevel_graph_partitioner.h"
+
+namespace ug{
+
+/// \addtogroup lib_grid_parallelization_distribution
+///	\{
+
+///	Parallel partitioner which minimizes the edge-cut of the dual graph
+/**	The dual graph of the elements in the partition-level of each hierarchy
+ * level is created through ParallelDualGraph. Each graph vertex is weighted
+ * with the balance weights of all its descendants in the levels of that
+ * hierarchy level. Each graph edge is weighted with the number of descendants
+ * of the connecting side in the highest partitioned level, which resembles
+ * the communication volume over that side.
+ *
+ * The graph is gathered on the first involved process and partitioned with a
+ * MultilevelGraphPartitioner. If the partition level contains less than
+ * elementThreshold elements per target process (see
+ * LoadBalancer::set_element_threshold), fewer target processes are used.
+ *
+ * \note	Since the whole dual graph of a partition level is gathered and
+ *			partitioned on a single process, the memory and run time required
+ *			on that process grow with the global number of elements in the
+ *			partition level. The partitioner is thus suited for moderately
+ *			sized partition levels, e.g. for the coarse levels of a
+ *			process hierarchy, but not for levels with very many elements.
+ *
+ * If repartitioning is enabled (default), the current distribution of the
+ * elements is used as initial partition. Elements then only leave their
+ * current process if this is required to balance the load or if it
+ * considerably reduces the edge-cut (see set_migration_cost). This is
+ * especially useful to rebalance adaptively refined grids.
+ *
+ * The partitioner can be used inside a LoadBalancer or separately. It can
+ * operate on serial and parallel multigrids.
+ */
+template <class TElem, int dim>
+class Partitioner_DualGraph : public IPartitioner{
+	public:
+		typedef IPartitioner	 						base_class;
+		typedef TElem									elem_t;
+		typedef typename TElem::side					side_t;
+		typedef Attachment<MathVector<dim> >			apos_t;
+		typedef typename GridLayoutMap::Types<elem_t>::Layout::LevelLayout	layout_t;
+
+		Partitioner_DualGraph();
+		virtual ~Partitioner_DualGraph();
+
+		void set_grid(MultiGrid* mg, Attachment<MathVector<dim> > aPos);
+
+	///	allows to optionally specify a subset-handler on which the balancer shall operate
+		void set_subset_handler(SmartPtr<SubsetHandler> sh);
+
+	///	enables repartitioning, i.e. the current distribution is used as initial partition.
+	/**	enabled by default.*/
+		void enable_repartitioning(bool enable)		{m_repartitioning = enable;}
+		bool repartitioning_enabled() const			{return m_repartitioning;}
+
+	///	cost of migrating an element relative to the cost of a cut connection. 1 by default.
+		void set_migration_cost(number cost)		{m_graphPartitioner.set_migration_cost(cost);}
+
+	///	maximal relative overweight of a partition. 0.05 by default.
+		void set_imbalance_tolerance(number tol)	{m_graphPartitioner.set_imbalance_tolerance(tol);}
+
+	///	maximal number of refinement passes on each level of the coarsened graphs. 8 by default.
+		void set_num_refinement_passes(int num)		{m_graphPartitioner.set_num_refinement_passes(num);}
+
+		virtual void set_next_process_hierarchy(SPProcessHierarchy procHierarchy);
+		virtual void set_balance_weights(SPBalanceWeights balanceWeights);
+		virtual void set_partition_post_processor(SPPartitionPostProcessor ppp);
+
+		virtual ConstSPProcessHierarchy current_process_hierarchy() const;
+		virtual ConstSPProcessHierarchy next_process_hierarchy() const;
+
+		virtual bool supports_balance_weights() const	{return true;}
+		virtual bool supports_repartitioning() const	{return true;}
+
+		virtual bool partition(size_t baseLvl, size_t elementThreshold);
+
+		virtual SubsetHandler& get_partitions();
+		virtual const std::vector<int>* get_process_map() const;
+
+	private:
+		void perform_partitioning(int numTargetProcs, int minLvl, int maxLvl,
+								  int partitionLvl, ANumber aWeight,
+								  pcl::ProcessCommunicator com,
+								  size_t elementThreshold);
+
+	///	accumulates the weights of all descendants in minLvl, ..., maxLvl in the elements of baseLvl
+		void accumulate_weights(int baseLvl, int minLvl, int maxLvl, ANumber aWeight);
+
+	///	returns the number of descendants of the given side in maxLvl (or of its leaf-descendants)
+		int num_side_descendants(side_t* s, int maxLvl);
+
+		void copy_partitions_to_children(ISubsetHandler& partitionSH, int lvl);
+
+		MultiGrid*								m_mg;
+		apos_t									m_aPos;
+		SmartPtr<SubsetHandler>					m_sh;
+		SPProcessHierarchy						m_processHierarchy;
+		SPProcessHierarchy						m_nextProcessHierarchy;
+		pcl::InterfaceCommunicator<layout_t>	m_intfcCom;
+
+		SPBalanceWeights						m_balanceWeights;
+		SPPartitionPostProcessor				m_partitionPostProcessor;
+
+		MultilevelGraphPartitioner				m_graphPartitioner;
+		bool									m_repartitioning;
+};
+
+///	\}
+
+}// end of namespace
+
+#endif
@@ -124,6 +124,9 @@ create_closure_elements_2d()
 
 	MultiGrid& mg = *multi_grid();
 
+//	closure elements are stored in the slabs of the multi-grid
+	GridObjectAllocationScope allocScope(mg);
+
 //	iterate over all constraining edges and collect associated surface faces
 //	Those then have to be refined to generate a closure.
 
@@ -220,6 +223,9 @@ create_closure_elements_3d()
 
 	MultiGrid& mg = *multi_grid();
 
+//	closure elements are stored in the slabs of the multi-grid
+	GridObjectAllocationScope allocScope(mg);
+
 //	iterate over all constraining edges and collect associated surface faces / volumes.
 //	Those then have to be refined to generate a closure.
 
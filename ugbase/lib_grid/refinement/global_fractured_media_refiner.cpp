@@ -200,6 +200,9 @@ perform_refinement()
 
 	MultiGrid& mg = *m_pMG;
 
+//	new elements are stored in the slabs of the multi-grid
+	GridObjectAllocationScope allocScope(mg);
+
 //	adjust marks for refinement
 	adjust_marks();
 
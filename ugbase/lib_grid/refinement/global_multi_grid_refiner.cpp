@@ -36,6 +36,8 @@
 #include "lib_grid/algorithms/algorithms.h"
 #include "lib_grid/file_io/file_io.h"
 
+#include "common/util/omp_util.h"
+
 //define PROFILE_GLOBAL_MULTI_GRID_REFINER if you want to profile
 //the refinement code.
 #define PROFILE_GLOBAL_MULTI_GRID_REFINER
@@ -57,13 +59,15 @@ namespace ug
 GlobalMultiGridRefiner::
 GlobalMultiGridRefiner(SPRefinementProjector projector) :
 	IRefiner(projector),
-	m_pMG(NULL)
+	m_pMG(NULL),
+	m_threadedRefinement(false)
 {
 }
 
 GlobalMultiGridRefiner::
 GlobalMultiGridRefiner(MultiGrid& mg, SPRefinementProjector projector) :
-	IRefiner(projector)
+	IRefiner(projector),
+	m_threadedRefinement(false)
 {
 	m_pMG = NULL;
 	assign_grid(mg);
@@ -131,6 +135,161 @@ num_marked_elems(std::vector<int>& numMarkedElemsOut)
 		numMarkedElemsOut.back() = m_pMG->num<TElem>(m_pMG->top_level());
 }
 
+////////////////////////////////////////////////////////////////////////
+///	buffers used while computing the children of a single element
+struct ChildVertexBuffers{
+	vector<Vertex*>	vrts;
+	vector<Vertex*>	edgeVrts;
+	vector<Vertex*>	faceVrts;
+	vector<vector3>	corners;
+
+	ChildVertexBuffers() : corners(6, vector3(0, 0, 0))	{}
+};
+
+///	computes the children of a face. The grid is not changed.
+/**	The projector is only required for volumes. It is part of the signature
+ * so that both overloads can be called from refine_elements.*/
+static bool CreateChildren(MultiGrid& mg, SPRefinementProjector&,
+						   Face* f, vector<Face*>& vFacesOut, Vertex*& newVrtOut,
+						   ChildVertexBuffers& buf)
+{
+//	collect child-vertices
+	buf.vrts.clear();
+	for(uint j = 0; j < f->num_vertices(); ++j)
+		buf.vrts.push_back(mg.get_child_vertex(f->vertex(j)));
+
+//	collect the associated edges
+	buf.edgeVrts.clear();
+	for(uint j = 0; j < f->num_edges(); ++j)
+		buf.edgeVrts.push_back(mg.get_child_vertex(mg.get_edge(f, j)));
+
+	newVrtOut = NULL;
+	return f->refine(vFacesOut, &newVrtOut, &buf.edgeVrts.front(), NULL,
+					 &buf.vrts.front());
+}
+
+///	computes the children of a volume. The grid is not changed.
+static bool CreateChildren(MultiGrid& mg, SPRefinementProjector& projector,
+						   Volume* v, vector<Volume*>& vVolsOut, Vertex*& newVrtOut,
+						   ChildVertexBuffers& buf)
+{
+//	collect child-vertices
+	buf.vrts.clear();
+	for(uint j = 0; j < v->num_vertices(); ++j)
+		buf.vrts.push_back(mg.get_child_vertex(v->vertex(j)));
+
+//	collect the associated edges
+	buf.edgeVrts.clear();
+	for(uint j = 0; j < v->num_edges(); ++j)
+		buf.edgeVrts.push_back(mg.get_child_vertex(mg.get_edge(v, j)));
+
+//	collect associated face-vertices
+	buf.faceVrts.clear();
+	for(uint j = 0; j < v->num_faces(); ++j)
+		buf.faceVrts.push_back(mg.get_child_vertex(mg.get_face(v, j)));
+
+//	if we're performing tetrahedral or octahedral refinement, we have to collect
+//	the corner coordinates, so that the refinement algorithm may choose
+//	the best interior diagonal.
+	vector3* pCorners = NULL;
+	if((v->num_vertices() == 4) && projector.valid()){
+		for(size_t i = 0; i < 4; ++i){
+			buf.corners[i] = projector->geometry()->pos(v->vertex(i));
+		}
+		pCorners = &buf.corners.front();
+	}
+	if((v->reference_object_id() == ROID_OCTAHEDRON) && projector.valid()){
+		for(size_t i = 0; i < 6; ++i){
+			buf.corners[i] = projector->geometry()->pos(v->vertex(i));
+		}
+		pCorners = &buf.corners.front();
+	}
+
+	newVrtOut = NULL;
+	return v->refine(vVolsOut, &newVrtOut, &buf.edgeVrts.front(),
+					 &buf.faceVrts.front(), NULL, RegularVertex(),
+					 &buf.vrts.front(), pCorners);
+}
+
+/**	The children of all parents are computed in a first pass, in which the grid
+ * is not changed. Since this pass only reads the grid, it is distributed onto
+ * several threads if threaded refinement is enabled. Each thread handles a
+ * contiguous range of parents and stores the number of children of each
+ * parent, so that all children can be registered in the original order
+ * in a second, serial pass.*/
+template <class TElem>
+void GlobalMultiGridRefiner::
+refine_elements(const std::vector<TElem*>& parents)
+{
+	MultiGrid& mg = *m_pMG;
+	const int numParents = (int)parents.size();
+
+	int numChunks = 1;
+	#ifdef UG_OPENMP
+		if(m_threadedRefinement)
+			numChunks = NumOMPChunks(numParents, 4096);
+	#endif
+
+//	numChildren[i] == -1 indicates that parents[i] couldn't be refined
+	vector<int>			numChildren(numParents, 0);
+	vector<Vertex*>		newVrts(numParents, NULL);
+	vector<vector<TElem*> >	children(numChunks);
+
+	GMGR_PROFILE(GMGR_CreateChildren);
+	#ifdef UG_OPENMP
+		#pragma omp parallel for schedule(static, 1) if(numChunks > 1)
+	#endif
+	for(int iChunk = 0; iChunk < numChunks; ++iChunk){
+		const int begin = (int)(((long long)iChunk * numParents) / numChunks);
+		const int end = (int)(((long long)(iChunk + 1) * numParents) / numChunks);
+
+	//	the allocation scope of the calling thread doesn't apply to other threads
+		GridObjectAllocationScope allocScope(mg);
+		ChildVertexBuffers buf;
+		vector<TElem*> vNewElems;
+		vector<TElem*>& chunkChildren = children[iChunk];
+
+		for(int i = begin; i < end; ++i){
+			if(CreateChildren(mg, m_projector, parents[i], vNewElems, newVrts[i], buf)){
+				numChildren[i] = (int)vNewElems.size();
+				chunkChildren.insert(chunkChildren.end(), vNewElems.begin(), vNewElems.end());
+			}
+			else
+				numChildren[i] = -1;
+		}
+	}
+	GMGR_PROFILE_END();
+
+//	register new elements in the order of their parents
+	GMGR_PROFILE(GMGR_RegisterChildren);
+	for(int iChunk = 0; iChunk < numChunks; ++iChunk){
+		const int begin = (int)(((long long)iChunk * numParents) / numChunks);
+		const int end = (int)(((long long)(iChunk + 1) * numParents) / numChunks);
+		vector<TElem*>& chunkChildren = children[iChunk];
+		size_t curChild = 0;
+
+		for(int i = begin; i < end; ++i){
+			TElem* p = parents[i];
+			if(numChildren[i] < 0){
+				LOG("  WARNING in Refine: could not refine element.\n");
+				continue;
+			}
+
+		//	if a new vertex was generated, we have to register it
+			if(newVrts[i]){
+				mg.register_element(newVrts[i], p);
+			//	allow refCallback to calculate a new position
+				if(m_projector.valid())
+					m_projector->new_vertex(newVrts[i], p);
+			}
+
+			for(int j = 0; j < numChildren[i]; ++j)
+				mg.register_element(chunkChildren[curChild++], p);
+		}
+	}
+	GMGR_PROFILE_END();
+}
+
 ////////////////////////////////////////////////////////////////////////
 void GlobalMultiGridRefiner::perform_refinement()
 {
@@ -145,6 +304,9 @@ void GlobalMultiGridRefiner::perform_refinement()
 //	the multi-grid
 	MultiGrid& mg = *m_pMG;
 
+//	new elements are stored in the slabs of the multi-grid
+	GridObjectAllocationScope allocScope(mg);
+
 //	make sure that the required options are enabled.
 	if(mg.num_volumes() > 0){
 		if(!mg.option_is_enabled(VOLOPT_AUTOGENERATE_FACES))
@@ -230,17 +392,9 @@ void GlobalMultiGridRefiner::perform_refinement()
 
 
 //	some buffers
-	vector<Vertex*> vVrts;
-	vector<Vertex*> vEdgeVrts;
-	vector<Vertex*> vFaceVrts;
 	vector<Edge*>	vEdges;
 	vector<Face*>		vFaces;
 	vector<Volume*>		vVols;
-	
-//	some repeatedly used objects
-	EdgeDescriptor ed;
-	FaceDescriptor fd;
-	VolumeDescriptor vd;
 
 	UG_DLOG(LIB_GRID, 1, "  creating new vertices\n");
 
@@ -328,122 +482,27 @@ void GlobalMultiGridRefiner::perform_refinement()
 	UG_DLOG(LIB_GRID, 1, "  creating new faces\n");
 
 //	create new vertices and faces from marked faces
+	vFaces.clear();
 	for(FaceIterator iter = mg.begin<Face>(oldTopLevel);
 		iter != mg.end<Face>(oldTopLevel); ++iter)
 	{
-		if(!refinement_is_allowed(*iter))
-			continue;
-			
-		Face* f = *iter;
-	//	collect child-vertices
-		vVrts.clear();
-		for(uint j = 0; j < f->num_vertices(); ++j)
-			vVrts.push_back(mg.get_child_vertex(f->vertex(j)));
-
-	//	collect the associated edges
-		vEdgeVrts.clear();
-		//bool bIrregular = false;
-		for(uint j = 0; j < f->num_edges(); ++j)
-			vEdgeVrts.push_back(mg.get_child_vertex(mg.get_edge(f, j)));
-
-		//GMGR_PROFILE(GMGR_Refine_CreatingFaces);
-		Vertex* newVrt;
-		if(f->refine(vFaces, &newVrt, &vEdgeVrts.front(), NULL, &vVrts.front())){
-		//	if a new vertex was generated, we have to register it
-			if(newVrt){
-				//GMGR_PROFILE(GMGR_Refine_CreatingVertices);
-				mg.register_element(newVrt, f);
-			//	allow refCallback to calculate a new position
-				if(m_projector.valid())
-					m_projector->new_vertex(newVrt, f);
-				//GMGR_PROFILE_END();
-			}
-
-		//	register the new faces and assign status
-			for(size_t j = 0; j < vFaces.size(); ++j)
-				mg.register_element(vFaces[j], f);
-		}
-		else{
-			LOG("  WARNING in Refine: could not refine face.\n");
-		}
-		//GMGR_PROFILE_END();
+		if(refinement_is_allowed(*iter))
+			vFaces.push_back(*iter);
 	}
+	refine_elements(vFaces);
 
 
 	UG_DLOG(LIB_GRID, 1, "  creating new volumes\n");
 
-//	only used for tetrahedron or octahedron refinement
-	vector<vector3> corners(6, vector3(0, 0, 0));
-
 //	create new vertices and volumes from marked volumes
+	vVols.clear();
 	for(VolumeIterator iter = mg.begin<Volume>(oldTopLevel);
 		iter != mg.end<Volume>(oldTopLevel); ++iter)
 	{
-		if(!refinement_is_allowed(*iter))
-			continue;
-
-		Volume* v = *iter;
-		//GMGR_PROFILE(GMGR_Refining_Volume);
-
-	//	collect child-vertices
-		//GMGR_PROFILE(GMGR_CollectingVolumeVertices);
-		vVrts.clear();
-		for(uint j = 0; j < v->num_vertices(); ++j)
-			vVrts.push_back(mg.get_child_vertex(v->vertex(j)));
-		//GMGR_PROFILE_END();
-
-	//	collect the associated edges
-		vEdgeVrts.clear();
-		//GMGR_PROFILE(GMGR_CollectingVolumeEdgeVertices);
-		//bool bIrregular = false;
-		for(uint j = 0; j < v->num_edges(); ++j)
-			vEdgeVrts.push_back(mg.get_child_vertex(mg.get_edge(v, j)));
-		//GMGR_PROFILE_END();
-
-	//	collect associated face-vertices
-		vFaceVrts.clear();
-		//GMGR_PROFILE(GMGR_CollectingVolumeFaceVertices);
-		for(uint j = 0; j < v->num_faces(); ++j)
-			vFaceVrts.push_back(mg.get_child_vertex(mg.get_face(v, j)));
-		//GMGR_PROFILE_END();
-
-	//	if we're performing tetrahedral or octahedral refinement, we have to collect
-	//	the corner coordinates, so that the refinement algorithm may choose
-	//	the best interior diagonal.
-		vector3* pCorners = NULL;
-		if((v->num_vertices() == 4) && m_projector.valid()){
-			for(size_t i = 0; i < 4; ++i){
-				corners[i] = m_projector->geometry()->pos(v->vertex(i));
-			}
-			pCorners = &corners.front();
-		}
-		if((v->reference_object_id() == ROID_OCTAHEDRON) && m_projector.valid()){
-			for(size_t i = 0; i < 6; ++i){
-				corners[i] = m_projector->geometry()->pos(v->vertex(i));
-			}
-			pCorners = &corners.front();
-		}
-
-		Vertex* newVrt;
-		if(v->refine(vVols, &newVrt, &vEdgeVrts.front(), &vFaceVrts.front(),
-					NULL, RegularVertex(), &vVrts.front(), pCorners)){
-		//	if a new vertex was generated, we have to register it
-			if(newVrt){
-				mg.register_element(newVrt, v);
-			//	allow refCallback to calculate a new position
-				if(m_projector.valid())
-					m_projector->new_vertex(newVrt, v);
-			}
-
-		//	register the new faces and assign status
-			for(size_t j = 0; j < vVols.size(); ++j)
-				mg.register_element(vVols[j], v);
-		}
-		else{
-			LOG("  WARNING in Refine: could not refine volume.\n");
-		}
-		//GMGR_PROFILE_END();
+		if(refinement_is_allowed(*iter))
+			vVols.push_back(*iter);
 	}
+	refine_elements(vVols);
 
 //	done - clean up
 	if(!bHierarchicalInsertionWasEnabled)
@@ -67,6 +67,16 @@ class GlobalMultiGridRefiner : public IRefiner, public GridObserver
 
 		virtual bool save_marks_to_file(const char* filename);
 
+	///	enables thread parallel computation of the children of faces and volumes.
+	/**	The children of the faces and volumes of the top level are computed by
+	 * several threads. They are registered at the grid afterwards, in the same
+	 * order as in serial refinement, so that observers receive the same
+	 * callbacks and the resulting grid is identical.
+	 * Only has an effect if ug was compiled with OpenMP. Disabled by default.
+	 * \note	the geometry of the refinement projector is accessed concurrently.*/
+		void enable_threaded_refinement(bool enable)	{m_threadedRefinement = enable;}
+		bool threaded_refinement_enabled() const		{return m_threadedRefinement;}
+
 	protected:
 	///	returns the number of (globally) marked edges on this level of the hierarchy
 		virtual void num_marked_edges_local(std::vector<int>& numMarkedEdgesOut);
@@ -78,6 +88,12 @@ class GlobalMultiGridRefiner : public IRefiner, public GridObserver
 		template <class TElem>
 		void num_marked_elems(std::vector<int>& numMarkedElemsOut);
 
+	///	creates and registers the children of the given faces or volumes.
+	/**	The children are computed first (possibly by several threads) and then
+	 * registered at the grid in the order of the given parents.*/
+		template <class TElem>
+		void refine_elements(const std::vector<TElem*>& parents);
+
 	////////////////////////////////
 	///	performs refinement on the marked elements.
 		virtual void perform_refinement();
@@ -107,6 +123,7 @@ class GlobalMultiGridRefiner : public IRefiner, public GridObserver
 		
 	protected:
 		MultiGrid*	m_pMG;
+		bool		m_threadedRefinement;
 };
 
 /// @}
@@ -30,8 +30,10 @@
  * GNU Lesser General Public License for more details.
  */
 
+#include <algorithm>
 #include <vector>
 #include "hanging_node_refiner_base.h"
+#include "common/stopwatch.h"
 #include "lib_grid/algorithms/geom_obj_util/geom_obj_util.h"
 #include "lib_grid/algorithms/debug_util.h"
 #include "lib_grid/algorithms/subset_util.h"
@@ -61,6 +63,38 @@
 using namespace std;
 
 namespace ug{
+///	removes duplicate entries from the given vector while preserving the order of first occurrence
+template <class TElem>
+static void RemoveDuplicates(std::vector<TElem*>& elems)
+{
+	if(elems.size() < 2)
+		return;
+
+	std::vector<std::pair<TElem*, size_t> > sorted(elems.size());
+	for(size_t i = 0; i < elems.size(); ++i)
+		sorted[i] = std::make_pair(elems[i], i);
+	std::sort(sorted.begin(), sorted.end());
+
+	std::vector<bool> keep(elems.size(), true);
+	bool foundDuplicate = false;
+	for(size_t i = 1; i < sorted.size(); ++i){
+		if(sorted[i].first == sorted[i-1].first){
+			keep[sorted[i].second] = false;
+			foundDuplicate = true;
+		}
+	}
+
+	if(!foundDuplicate)
+		return;
+
+	size_t numKept = 0;
+	for(size_t i = 0; i < elems.size(); ++i){
+		if(keep[i])
+			elems[numKept++] = elems[i];
+	}
+	elems.resize(numKept);
+}
+
 template <class TSelector>
 HangingNodeRefinerBase<TSelector>::
 HangingNodeRefinerBase(SPRefinementProjector projector) :
@@ -660,6 +694,9 @@ void HangingNodeRefinerBase<TSelector>::perform_refinement()
 		grid.enable_options(GRIDOPT_AUTOGENERATE_SIDES);
 	}
 
+//	new elements are stored in the slabs of the grid
+	GridObjectAllocationScope allocScope(grid);
+
 //	containers used for temporary results
 	vector<Edge*> 	vEdges;
 	vector<Face*>	 	vFaces;
@@ -1044,8 +1081,16 @@ void HangingNodeRefinerBase<TSelector>::collect_objects_for_refine()
 	newlyMarkedVols.assign(m_selMarkedElements.template begin<Volume>(),
 						   m_selMarkedElements.template end<Volume>());
 
+//	The adjusters only ever see the elements whose marks changed during the
+//	previous round (the work queue). Since an element may be re-marked several
+//	times during one round, the queues are made unique before they are processed,
+//	so that each element is visited at most once per round.
 	bool continueAdjustment = true;
 	bool firstAdjustment = true;
+	size_t numRounds = 0;
+	size_t numQueued = 0;
+	double tAdjust = 0;
+	double tSync = 0;
 
 	while(continueAdjustment){
 		if(!firstAdjustment){
@@ -1057,9 +1102,17 @@ void HangingNodeRefinerBase<TSelector>::collect_objects_for_refine()
 			newlyMarkedEdges.swap(m_newlyMarkedRefEdges);
 			newlyMarkedFaces.swap(m_newlyMarkedRefFaces);
 			newlyMarkedVols.swap(m_newlyMarkedRefVols);
+
+			RemoveDuplicates(newlyMarkedVrts);
+			RemoveDuplicates(newlyMarkedEdges);
+			RemoveDuplicates(newlyMarkedFaces);
+			RemoveDuplicates(newlyMarkedVols);
 		}
 
 		firstAdjustment = false;
+		++numRounds;
+		numQueued += newlyMarkedVrts.size() + newlyMarkedEdges.size()
+					 + newlyMarkedFaces.size() + newlyMarkedVols.size();
 
 		m_newlyMarkedRefVrts.clear();
 		m_newlyMarkedRefEdges.clear();
@@ -1067,6 +1120,8 @@ void HangingNodeRefinerBase<TSelector>::collect_objects_for_refine()
 		m_newlyMarkedRefVols.clear();
 
 	//	call the adjusters
+		HNODE_PROFILE_BEGIN(href_AdjustMarks_CallAdjusters);
+		double tStart = get_clock_s();
 		for(size_t i = 0; i < m_refMarkAdjusters.size(); ++i){
 			if(m_refMarkAdjusters[i]->enabled()){
 				m_refMarkAdjusters[i]->ref_marks_changed(*this, newlyMarkedVrts,
@@ -1075,15 +1130,25 @@ void HangingNodeRefinerBase<TSelector>::collect_objects_for_refine()
 															newlyMarkedVols);
 			}
 		}
+		tAdjust += get_clock_s() - tStart;
+		HNODE_PROFILE_END();
 
 		bool continueRequired =	(!m_newlyMarkedRefVrts.empty())
 							 || (!m_newlyMarkedRefEdges.empty())
 							 || (!m_newlyMarkedRefFaces.empty())
 							 || (!m_newlyMarkedRefVols.empty());
 
+		HNODE_PROFILE_BEGIN(href_AdjustMarks_Continue);
+		tStart = get_clock_s();
 		continueAdjustment = continue_collect_objects_for_refine(continueRequired);
+		tSync += get_clock_s() - tStart;
+		HNODE_PROFILE_END();
 	}
 
+	UG_DLOG(LIB_GRID, 1, "  mark adjustment: " << numRounds << " rounds, "
+			<< numQueued << " queued elements, adjusters: " << tAdjust
+			<< " s, continue-checks: " << tSync << " s\n");
+
 	m_adjustingRefMarks = false;
 	UG_DLOG(LIB_GRID, 1, "hnode_ref-stop: collect_objects_for_refine\n");
 }
@@ -360,6 +360,16 @@ class HangingNodeRefinerBase : public IRefiner, public GridObserver
 
 		inline bool adjusting_ref_marks() const	{return m_adjustingRefMarks;}
 
+	///	elements whose refinement marks changed during the current adjustment round.
+	/**	Those elements form the work queue of the next round of
+	 *	collect_objects_for_refine. The lists may contain duplicates.
+	 *	\{ */
+		const std::vector<Vertex*>& newly_marked_ref_vertices() const	{return m_newlyMarkedRefVrts;}
+		const std::vector<Edge*>& newly_marked_ref_edges() const		{return m_newlyMarkedRefEdges;}
+		const std::vector<Face*>& newly_marked_ref_faces() const		{return m_newlyMarkedRefFaces;}
+		const std::vector<Volume*>& newly_marked_ref_volumes() const	{return m_newlyMarkedRefVols;}
+	/**	\} */
+
 	private:
 	///	private copy constructor to avoid copy construction
 		HangingNodeRefinerBase(const HangingNodeRefinerBase&);
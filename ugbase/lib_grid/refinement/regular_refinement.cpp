@@ -115,7 +115,10 @@ bool Refine(Grid& grid, Selector& sel, AInt& aInt,
 		defaultProjector.set_geometry(make_sp(new Geometry<3, 3>(grid, aPosition)));
 		projector = &defaultProjector;
 	}
-		
+
+//	new elements are stored in the slabs of the grid
+	GridObjectAllocationScope allocScope(grid);
+
 //	make sure that GRIDOPT_VERTEXCENTRIC_INTERCONNECTION is enabled
 	if(grid.num_edges() && (!grid.option_is_enabled(VRTOPT_STORE_ASSOCIATED_EDGES))){
 		LOG("  INFO in Refine: autoenabling VRTOPT_STORE_ASSOCIATED_EDGES\n");
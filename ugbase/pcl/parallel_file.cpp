@@ -33,8 +33,11 @@
 #include "pcl_process_communicator.h"
 #include "common/util/binary_buffer.h"
 #include "common/log.h"
+#include "common/types.h"
+#include <algorithm>
 #include <map>
 #include <string>
+#include <vector>
 #include <mpi.h>
 
 namespace pcl{
@@ -135,4 +138,116 @@ void ReadCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename,
 	//	UG_LOG("File read.\n");
 }
 
+
+
+///	max number of bytes passed to a single MPI-IO call (counts are int)
+static const uint64 PARALLEL_FILE_CHUNK_SIZE = (uint64)1 << 30;
+
+void WritePartitionedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename, pcl::ProcessCommunicator pc)
+{
+	MPI_Status status;
+	MPI_Comm mpiComm = pc.get_mpi_communicator();
+	MPI_File fh;
+	const int numProcs = pc.size();
+	const int localProc = pc.get_local_proc_id();
+
+	char filename[1024];
+	strcpy(filename, strFilename.c_str());
+	if(MPI_File_open(mpiComm, filename, MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fh))
+		UG_THROW("could not open "<<filename);
+	MPI_File_set_size(fh, 0);
+
+//	the header holds numParts and all offsets. Since every process needs its
+//	offset anyways, all sizes are gathered on all processes.
+	unsigned long long mySize = buffer.write_pos();
+	std::vector<unsigned long long> sizes(numProcs);
+	MPI_Allgather(&mySize, 1, MPI_UNSIGNED_LONG_LONG, &sizes[0], 1,
+				  MPI_UNSIGNED_LONG_LONG, mpiComm);
+
+	std::vector<uint64> header(numProcs + 2);
+	header[0] = numProcs;
+	header[1] = header.size() * sizeof(uint64);
+	for(int i = 0; i < numProcs; ++i)
+		header[i + 2] = header[i + 1] + sizes[i];
+
+	if(localProc == 0)
+		MPI_File_write_at(fh, 0, &header[0], (int)(header.size() * sizeof(uint64)),
+						  MPI_BYTE, &status);
+
+//	the data is written in chunks, since counts are restricted to int.
+//	All processes have to take part in each collective call.
+	int myNumChunks = (int)((mySize + PARALLEL_FILE_CHUNK_SIZE - 1) / PARALLEL_FILE_CHUNK_SIZE);
+	int numChunks = 0;
+	MPI_Allreduce(&myNumChunks, &numChunks, 1, MPI_INT, MPI_MAX, mpiComm);
+
+	const char* data = buffer.buffer();
+	for(int i = 0; i < numChunks; ++i){
+		uint64 start = std::min<uint64>(i * PARALLEL_FILE_CHUNK_SIZE, mySize);
+		uint64 end = std::min<uint64>(start + PARALLEL_FILE_CHUNK_SIZE, mySize);
+		MPI_File_write_at_all(fh, (MPI_Offset)(header[localProc + 1] + start),
+							  (void*)(data + start), (int)(end - start), MPI_BYTE, &status);
+	}
+
+	MPI_File_close(&fh);
+}
+
+int ReadPartitionedParallelFile(std::vector<ug::BinaryBuffer> &buffersOut, int &firstPartOut,
+								std::string strFilename, pcl::ProcessCommunicator pc)
+{
+	MPI_Status status;
+	MPI_Comm mpiComm = pc.get_mpi_communicator();
+	MPI_File fh;
+	const int numProcs = pc.size();
+	const int localProc = pc.get_local_proc_id();
+
+	char filename[1024];
+	strcpy(filename, strFilename.c_str());
+	if(MPI_File_open(mpiComm, filename, MPI_MODE_RDONLY, MPI_INFO_NULL, &fh))
+		UG_THROW("could not open "<<filename);
+
+//	the first process reads the header and broadcasts it
+	unsigned long long numParts = 0;
+	if(localProc == 0)
+		MPI_File_read_at(fh, 0, &numParts, sizeof(numParts), MPI_BYTE, &status);
+	MPI_Bcast(&numParts, 1, MPI_UNSIGNED_LONG_LONG, 0, mpiComm);
+	UG_COND_THROW(numParts == 0 || numParts > (1ULL << 31),
+				  "invalid number of parts in " << strFilename << ": " << numParts);
+
+	std::vector<unsigned long long> offsets(numParts + 1);
+	if(localProc == 0)
+		MPI_File_read_at(fh, sizeof(uint64), &offsets[0],
+						 (int)(offsets.size() * sizeof(uint64)), MPI_BYTE, &status);
+	MPI_Bcast(&offsets[0], (int)offsets.size(), MPI_UNSIGNED_LONG_LONG, 0, mpiComm);
+
+//	the parts p with PartitionedParallelFileTargetProc(p) == localProc
+//	form the range [ceil(localProc * numParts / numReaders), ceil((localProc+1) * numParts / numReaders)).
+//	Processes with localProc >= numReaders read nothing.
+	const unsigned long long numReaders = std::min<unsigned long long>(numParts, numProcs);
+	int firstPart = (int)numParts;
+	int endPart = (int)numParts;
+	if((unsigned long long)localProc < numReaders){
+		firstPart = (int)(((unsigned long long)localProc * numParts + numReaders - 1) / numReaders);
+		endPart = (int)(((unsigned long long)(localProc + 1) * numParts + numReaders - 1) / numReaders);
+	}
+
+	buffersOut.clear();
+	buffersOut.resize(endPart - firstPart);
+	for(int p = firstPart; p < endPart; ++p){
+		ug::BinaryBuffer& buf = buffersOut[p - firstPart];
+		const uint64 size = offsets[p + 1] - offsets[p];
+		buf.reserve(size);
+		for(uint64 start = 0; start < size; start += PARALLEL_FILE_CHUNK_SIZE){
+			uint64 end = std::min<uint64>(start + PARALLEL_FILE_CHUNK_SIZE, size);
+			MPI_File_read_at(fh, (MPI_Offset)(offsets[p] + start), buf.buffer() + start,
+							 (int)(end - start), MPI_BYTE, &status);
+		}
+		buf.set_write_pos(size);
+	}
+
+	MPI_File_close(&fh);
+
+	firstPartOut = firstPart;
+	return (int)numParts;
+}
+
 }
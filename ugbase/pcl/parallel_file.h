@@ -34,6 +34,8 @@
 #define PARALLEL_FILE_H_
 
 #include "pcl_process_communicator.h"
+#include <algorithm>
+#include <vector>
 #include "common/util/binary_buffer.h"
 
 namespace pcl{
@@ -89,5 +91,58 @@ void WriteCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename
  */
 void ReadCombinedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename, pcl::ProcessCommunicator pc = pcl::ProcessCommunicator(pcl::PCD_WORLD));
 
+
+/**
+ * Writes the binary buffers of all participating processes into one file,
+ * using collective MPI I/O.
+ *
+ * Contrary to WriteCombinedParallelFile, all offsets are stored as 64 bit
+ * integers, so that the file may exceed 2GB, and the file can be read on a
+ * different number of processes through ReadPartitionedParallelFile.
+ *
+ * The file format is as follows:
+ *
+ * uint64	numParts
+ * uint64	offset[numParts + 1]
+ * byte		data0[offset[1] - offset[0]]
+ * byte		data1[offset[2] - offset[1]]
+ * ...
+ *
+ * where part i holds the buffer of the process with local id i in pc.
+ *
+ * @param buffer		a Binary buffer with data
+ * @param strFilename	the filename
+ * @param pc			a processes communicator (default pcl::World)
+ */
+void WritePartitionedParallelFile(ug::BinaryBuffer &buffer, std::string strFilename, pcl::ProcessCommunicator pc = pcl::ProcessCommunicator(pcl::PCD_WORLD));
+
+
+/**
+ * Reads the parts of a file which was written by WritePartitionedParallelFile.
+ *
+ * The parts are distributed in contiguous blocks onto the first
+ * numReaders = min(numParts, pc.size()) processes of pc: Part p is read by the
+ * process with local id p * numReaders / numParts. If the file was written by
+ * the same number of processes, each process thus reads the part which it
+ * wrote itself. If it was written by fewer processes, the processes with local
+ * id numParts and above read nothing. Use PartitionedParallelFileTargetProc
+ * to query the process which reads a given part.
+ *
+ * @param buffersOut	the parts read by this process
+ * @param firstPartOut	the index of the part in buffersOut[0]
+ * @param strFilename	the filename
+ * @param pc			a processes communicator (default pcl::World)
+ * @return				the total number of parts in the file
+ */
+int ReadPartitionedParallelFile(std::vector<ug::BinaryBuffer> &buffersOut, int &firstPartOut,
+								std::string strFilename, pcl::ProcessCommunicator pc = pcl::ProcessCommunicator(pcl::PCD_WORLD));
+
+///	returns the local id of the process which reads the given part in ReadPartitionedParallelFile
+inline int PartitionedParallelFileTargetProc(int part, int numParts, int numProcs)
+{
+	const int numReaders = std::min(numParts, numProcs);
+	return (int)(((long long)part * numReaders) / numParts);
+}
+
 }
 #endif /* PARALLEL_ARCHIVE_H_ */
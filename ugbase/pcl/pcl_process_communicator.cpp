@@ -408,7 +408,7 @@ allgatherv(const void* sendBuf, int sendCount, DataType sendType,
 void
 ProcessCommunicator::
 alltoall(const void* sendBuf, int sendCount, DataType sendType,
-    void* recBuf, int recCount, DataType recType)
+    void* recBuf, int recCount, DataType recType) const
 {
 	PCL_PROFILE(pcl_ProcCom_alltoall);
 	if(is_local()) {memcpy(recBuf, sendBuf, recCount*GetSize(recType)); return;}
@@ -418,6 +418,26 @@ alltoall(const void* sendBuf, int sendCount, DataType sendType,
 	MPI_Alltoall(const_cast<void*>(sendBuf), sendCount, sendType, recBuf, recCount, recType, m_comm->m_mpiComm);
 }
 
+void
+ProcessCommunicator::
+alltoallv(const void* sendBuf, int* sendCounts, int* sendDispls,
+		  DataType sendType, void* recBuf, int* recCounts,
+		  int* recDispls, DataType recType) const
+{
+	PCL_PROFILE(pcl_ProcCom_alltoallv);
+	if(is_local()){
+		memcpy((char*)recBuf + recDispls[0]*GetSize(recType),
+			   (const char*)sendBuf + sendDispls[0]*GetSize(sendType),
+			   recCounts[0]*GetSize(recType));
+		return;
+	}
+
+	UG_COND_THROW(empty(), "ERROR in ProcessCommunicator::alltoallv: empty communicator.");
+
+	MPI_Alltoallv(const_cast<void*>(sendBuf), sendCounts, sendDispls, sendType,
+				  recBuf, recCounts, recDispls, recType, m_comm->m_mpiComm);
+}
+
 void
 ProcessCommunicator::
 send_data(void* pBuffer, int bufferSize, int destProc, int tag) const
@@ -217,7 +217,38 @@ class ProcessCommunicator
 	 * \param recCount   number of elements to receive from each process (integer)
 	 * \param recType    data type of receive buffer elements (handle) */
 		void alltoall(const void* sendBuf, int sendCount, DataType sendType,
-		    		  void* recBuf, int recCount, DataType recType);
+		    		  void* recBuf, int recCount, DataType recType) const;
+
+	///	performs MPI_Alltoallv on the processes of the communicator.
+	/** All processes send individual amounts of data to all processes.
+	 *  The receive buffer needs to have the appropriate size.
+	 * \param sendBuf    starting address of send buffer (choice)
+	 * \param sendCounts integer array (of length group size) containing the number of elements to send to each process
+	 * \param sendDispls integer array (of length group size). Entry i specifies the displacement (relative to sendBuf) of the data for process i
+	 * \param sendType   data type of send buffer elements (handle)
+	 * \param recBuf     starting address of receive buffer (choice)
+	 * \param recCounts  integer array (of length group size) containing the number of elements that are received from each process
+	 * \param recDispls  integer array (of length group size). Entry i specifies the displacement (relative to recBuf) at which to place the incoming data from process i
+	 * \param recType    data type of receive buffer elements (handle) */
+		void alltoallv(const void* sendBuf, int* sendCounts, int* sendDispls,
+					   DataType sendType, void* recBuf, int* recCounts,
+					   int* recDispls, DataType recType) const;
+
+	///	exchanges variable arrays between all processes.
+	/**	sendBuf holds consecutive blocks of entries for the processes of this
+	 * ProcessCommunicator, where the i-th block has size sendSizes[i].
+	 * On return, recBufOut holds the blocks received from all processes,
+	 * again in the order of the processes. The sizes of the received blocks
+	 * are written to pRecSizesOut, if specified.
+	 *
+	 * Note that recBufOut and pRecSizesOut will be resized as required.
+	 *
+	 * Please note that this method communicates twice.*/
+		template<class TValue>
+		void alltoallv(std::vector<TValue>& recBufOut,
+					   const std::vector<TValue>& sendBuf,
+					   const std::vector<int>& sendSizes,
+					   std::vector<int>* pRecSizesOut = NULL) const;
 
 	///	gathers variable arrays on all processes.
 	/**	The arrays specified in sendBuf will be copied to all processes
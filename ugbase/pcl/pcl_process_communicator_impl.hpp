@@ -147,6 +147,58 @@ allgatherv(std::vector<TValue>& recBufOut,
 }
 
 
+template<class TValue>
+void ProcessCommunicator::
+alltoallv(std::vector<TValue>& recBufOut,
+		  const std::vector<TValue>& sendBuf,
+		  const std::vector<int>& sendSizes,
+		  std::vector<int>* pRecSizesOut) const
+{
+	using namespace ug;
+
+	const int numProcs = (int)this->size();
+	UG_COND_THROW((int)sendSizes.size() != numProcs,
+				  "ERROR in ProcessCommunicator::alltoallv: sendSizes has to "
+				  "contain one entry for each process.");
+
+//	the data is sent in bytes
+	std::vector<int> sendBytes(numProcs), sendOffsets(numProcs);
+	int totalSend = 0;
+	for(int i = 0; i < numProcs; ++i){
+		sendOffsets[i] = totalSend;
+		sendBytes[i] = sendSizes[i] * (int)sizeof(TValue);
+		totalSend += sendBytes[i];
+	}
+	UG_COND_THROW(totalSend != (int)(sendBuf.size() * sizeof(TValue)),
+				  "ERROR in ProcessCommunicator::alltoallv: sendSizes do not "
+				  "match the size of sendBuf.");
+
+//	exchange the sizes
+	std::vector<int> recBytes(numProcs), recOffsets(numProcs);
+	alltoall(GetDataPtr(sendBytes), 1, PCL_DT_INT,
+			 GetDataPtr(recBytes), 1, PCL_DT_INT);
+
+	int totalRec = 0;
+	for(int i = 0; i < numProcs; ++i){
+		recOffsets[i] = totalRec;
+		totalRec += recBytes[i];
+	}
+
+	recBufOut.resize(totalRec / sizeof(TValue));
+	alltoallv(GetDataPtr(sendBuf), GetDataPtr(sendBytes),
+			  GetDataPtr(sendOffsets), PCL_DT_BYTE,
+			  GetDataPtr(recBufOut), GetDataPtr(recBytes),
+			  GetDataPtr(recOffsets), PCL_DT_BYTE);
+
+	if(pRecSizesOut){
+		std::vector<int>& recSizesOut = *pRecSizesOut;
+		recSizesOut.resize(numProcs);
+		for(int i = 0; i < numProcs; ++i)
+			recSizesOut[i] = recBytes[i] / sizeof(TValue);
+	}
+}
+
+
 template<typename T>
 T ProcessCommunicator::
 reduce(const T &t, pcl::ReduceOperation op, int rootProc) const
@@ -0,0 +1,443 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include "benchmark.h"
+#include "common/error.h"
+#include "common/stopwatch.h"
+#include "lib_algebra/cpu_algebra_types.h"
+#include "lib_algebra/operator/interface/matrix_operator.h"
+#include "lib_algebra/operator/preconditioner/gauss_seidel.h"
+#include "lib_algebra/operator/preconditioner/ilu.h"
+#include "lib_disc/common/local_algebra.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+	#include "lib_algebra/parallelization/algebra_layouts.h"
+	#include "lib_algebra/parallelization/communication_policies.h"
+#endif
+
+using namespace std;
+
+namespace ug{
+namespace bench{
+
+////////////////////////////////////////////////////////////////////////////////
+//	helpers
+////////////////////////////////////////////////////////////////////////////////
+
+//	The algebra benchmarks operate on process-local data only. In parallel
+//	builds the objects nevertheless need layouts and a storage type, since the
+//	preconditioners check them.
+#ifdef UG_PARALLEL
+static ConstSmartPtr<AlgebraLayouts> LocalLayouts()
+{
+	static ConstSmartPtr<AlgebraLayouts> spLayouts(new AlgebraLayouts);
+	return spLayouts;
+}
+#endif
+
+#ifdef UG_PARALLEL
+///	marks a matrix or vector as process-local and additive in parallel builds
+template <typename T>
+static void SetLocalAdditive(T& obj)
+{
+	obj.set_layouts(LocalLayouts());
+	obj.set_storage_type(PST_ADDITIVE);
+}
+
+///	marks a vector as process-local and consistent in parallel builds
+template <typename T>
+static void SetLocalConsistent(T& obj)
+{
+	obj.set_layouts(LocalLayouts());
+	obj.set_storage_type(PST_CONSISTENT);
+}
+#else
+template <typename T>
+static void SetLocalAdditive(T&)	{}
+
+template <typename T>
+static void SetLocalConsistent(T&)	{}
+#endif
+
+///	adds the Q1 element matrices of -laplace(u) + u on a structured grid
+/**	The grid consists of numCells x numCells unit-square cells scaled to
+ * [0,1]^2, nodes are numbered lexicographically. Each of the numFct
+ * functions is stored as one component of the (block-)matrix, i.e. the
+ * coupling between the components is stored but zero.
+ * The matrix must already have size (numCells+1)^2.*/
+template <typename TMatrix>
+static void AddStructuredQ1Laplace(TMatrix& A, int numCells, size_t numFct)
+{
+	const size_t n = numCells + 1;
+	const number h = 1.0 / numCells;
+
+//	Q1 stiffness matrix of the unit square (independent of h in 2d) plus
+//	lumped mass
+	static const number K[4][4] = {{ 4, -1, -2, -1},
+								   {-1,  4, -1, -2},
+								   {-2, -1,  4, -1},
+								   {-1, -2, -1,  4}};
+	const number massDiag = 0.25 * h * h;
+
+	LocalIndices ind;
+	ind.resize_fct(numFct);
+	for(size_t fct = 0; fct < numFct; ++fct)
+		for(size_t dof = 0; dof < 4; ++dof)
+			ind.push_back_multi_index(fct, 0, fct);
+
+	LocalMatrix locA;
+	locA.resize(ind);
+	locA = 0.0;
+	for(size_t fct = 0; fct < numFct; ++fct)
+		for(size_t i = 0; i < 4; ++i){
+			for(size_t j = 0; j < 4; ++j)
+				locA(fct, i, fct, j) = K[i][j] / 6.0;
+			locA(fct, i, fct, i) += massDiag;
+		}
+
+	for(size_t cj = 0; cj < n - 1; ++cj){
+		for(size_t ci = 0; ci < n - 1; ++ci){
+			const size_t corner[4] = {cj * n + ci, cj * n + ci + 1,
+									  (cj + 1) * n + ci + 1, (cj + 1) * n + ci};
+			for(size_t fct = 0; fct < numFct; ++fct)
+				for(size_t dof = 0; dof < 4; ++dof)
+					ind.index(fct, dof) = corner[dof];
+
+			AddLocalMatrixToGlobal(A, locA);
+		}
+	}
+}
+
+///	creates the sparsity pattern and assembles the structured Q1 laplacian
+template <typename TMatrix>
+static void AssembleStructuredQ1Laplace(TMatrix& A, int numCells, size_t numFct)
+{
+	const size_t n = numCells + 1;
+	A.resize_and_clear(n * n, n * n);
+	AddStructuredQ1Laplace(A, numCells, numFct);
+	A.defragment();
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	matrix assembly
+////////////////////////////////////////////////////////////////////////////////
+
+///	assembly of a sparse matrix via AddLocalMatrixToGlobal
+/**	If bReuse is false, each run starts from an empty matrix, i.e. the sparsity
+ * pattern is created during the run. Otherwise the pattern is created in setup
+ * and each run only adds the element contributions, as in a newton iteration.*/
+class MatrixAssemblyBench : public IBenchmark
+{
+	public:
+		typedef CPUAlgebra::matrix_type matrix_type;
+
+		MatrixAssemblyBench(bool bReuse) : m_bReuse(bReuse), m_numCells(0) {}
+
+		virtual const char* name() const
+			{return m_bReuse ? "matrix_assembly_reuse" : "matrix_assembly";}
+		virtual const char* group() const	{return "algebra";}
+
+		virtual void setup(int size)
+		{
+			m_numCells = size;
+			if(m_bReuse)
+				AssembleStructuredQ1Laplace(m_A, m_numCells, 1);
+		}
+
+		virtual void prepare_run()
+		{
+			if(m_bReuse) m_A.scale(0.0);
+			else m_A.resize_and_clear(0, 0);
+		}
+
+		virtual void run()
+		{
+			if(m_bReuse) AddStructuredQ1Laplace(m_A, m_numCells, 1);
+			else AssembleStructuredQ1Laplace(m_A, m_numCells, 1);
+		}
+
+		virtual void report(BenchmarkResult& res)
+		{
+			res.add_param("cells", (number)m_numCells * m_numCells);
+			res.add_metric("rows", (number)m_A.num_rows());
+			res.add_metric("nnz", (number)m_A.total_num_connections());
+		}
+
+		virtual void teardown()	{m_A.resize_and_clear(0, 0);}
+
+	protected:
+		bool		m_bReuse;
+		int			m_numCells;
+		matrix_type	m_A;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	SpMV
+////////////////////////////////////////////////////////////////////////////////
+
+///	sparse matrix-vector product y = A*x for scalar and block algebras
+template <typename TAlgebra>
+class SpMVBench : public IBenchmark
+{
+	public:
+		typedef typename TAlgebra::matrix_type matrix_type;
+		typedef typename TAlgebra::vector_type vector_type;
+		static const size_t blockSize = TAlgebra::blockSize;
+
+		SpMVBench(const char* name) : m_name(name), m_numCells(0) {}
+
+		virtual const char* name() const	{return m_name.c_str();}
+		virtual const char* group() const	{return "algebra";}
+
+		virtual void setup(int size)
+		{
+			m_numCells = size;
+			AssembleStructuredQ1Laplace(m_A, m_numCells, blockSize);
+			m_x.resize(m_A.num_cols());
+			m_y.resize(m_A.num_rows());
+			m_x.set(1.0);
+			m_y.set(0.0);
+			SetLocalAdditive(m_A);
+			SetLocalConsistent(m_x);
+			SetLocalAdditive(m_y);
+		}
+
+		virtual void run()
+		{
+			m_A.apply(m_y, m_x);
+		}
+
+		virtual void report(BenchmarkResult& res)
+		{
+			const number nnz = (number)m_A.total_num_connections();
+			const number rows = (number)m_A.num_rows();
+			const number b = (number)blockSize;
+			res.add_param("cells", (number)m_numCells * m_numCells);
+			res.add_param("blockSize", b);
+			res.add_metric("rows", rows);
+			res.add_metric("nnz", nnz);
+		//	flops and (minimal) memory traffic per product: matrix values,
+		//	column indices, x and y
+			res.add_metric("flopPerRun", 2 * nnz * b * b);
+			res.add_metric("bytesPerRun", nnz * (b * b * sizeof(double) + sizeof(size_t))
+										  + 2 * rows * b * sizeof(double));
+		}
+
+		virtual void teardown()
+		{
+			m_A.resize_and_clear(0, 0);
+			m_x.resize(0); m_y.resize(0);
+		}
+
+	protected:
+		std::string	m_name;
+		int			m_numCells;
+		matrix_type	m_A;
+		vector_type	m_x, m_y;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	smoother sweeps
+////////////////////////////////////////////////////////////////////////////////
+
+///	one application c = B*d of a matrix based preconditioner
+/**	The preconditioner is initialized in setup, the time needed for the
+ * initialization (e.g. the ILU factorization) is reported as metric.*/
+template <typename TPrecond>
+class PreconditionerSweepBench : public IBenchmark
+{
+	public:
+		typedef CPUAlgebra::matrix_type matrix_type;
+		typedef CPUAlgebra::vector_type vector_type;
+		typedef MatrixOperator<matrix_type, vector_type> matrix_operator_type;
+
+		PreconditionerSweepBench(const char* name)
+			: m_name(name), m_numCells(0), m_tInit(0) {}
+
+		virtual const char* name() const	{return m_name.c_str();}
+		virtual const char* group() const	{return "algebra";}
+
+		virtual void setup(int size)
+		{
+			m_numCells = size;
+			m_spOp = make_sp(new matrix_operator_type());
+			AssembleStructuredQ1Laplace(m_spOp->get_matrix(), m_numCells, 1);
+			SetLocalAdditive(m_spOp->get_matrix());
+
+			m_c.resize(m_spOp->num_rows());
+			m_d.resize(m_spOp->num_rows());
+			m_d.set_random(-1.0, 1.0);
+			m_c.set(0.0);
+			SetLocalConsistent(m_c);
+			SetLocalAdditive(m_d);
+
+			m_spPrecond = make_sp(new TPrecond());
+			const double tStart = get_clock_s();
+			UG_COND_THROW(!m_spPrecond->init(m_spOp),
+						  name() << ": Cannot initialize preconditioner.");
+			m_tInit = get_clock_s() - tStart;
+		}
+
+		virtual void prepare_run()
+		{
+			SetLocalAdditive(m_d);
+		}
+
+		virtual void run()
+		{
+			UG_COND_THROW(!m_spPrecond->apply(m_c, m_d),
+						  name() << ": Applying preconditioner failed.");
+		}
+
+		virtual void report(BenchmarkResult& res)
+		{
+			res.add_param("cells", (number)m_numCells * m_numCells);
+			res.add_metric("rows", (number)m_spOp->num_rows());
+			res.add_metric("nnz", (number)m_spOp->get_matrix().total_num_connections());
+			res.add_metric("initTime", m_tInit);
+		}
+
+		virtual void teardown()
+		{
+			m_spPrecond = SPNULL;
+			m_spOp = SPNULL;
+			m_c.resize(0); m_d.resize(0);
+		}
+
+	protected:
+		std::string	m_name;
+		int			m_numCells;
+		number		m_tInit;
+		SmartPtr<matrix_operator_type>	m_spOp;
+		SmartPtr<TPrecond>				m_spPrecond;
+		vector_type	m_c, m_d;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	halo exchange
+////////////////////////////////////////////////////////////////////////////////
+
+#ifdef UG_PARALLEL
+///	additive-to-consistent exchange of interface values with the neighbors
+/**	The processes are arranged in a chain, each one holding a structured
+ * (size+1) x (size+1) patch of unknowns. The first row of a patch is slave of
+ * the last row of the patch on the previous process. One run adds the slave
+ * values to the masters and copies the result back, which is exactly what a
+ * change from additive to consistent storage does.*/
+class HaloExchangeBench : public IBenchmark
+{
+	public:
+		typedef CPUAlgebra::vector_type vector_type;
+
+		HaloExchangeBench() : m_numItf(0) {}
+
+		virtual const char* name() const	{return "halo_exchange";}
+		virtual const char* group() const	{return "pcl";}
+		virtual bool available() const		{return pcl::NumProcs() > 1;}
+
+		virtual void setup(int size)
+		{
+			const size_t n = size + 1;
+			const int rank = pcl::ProcRank();
+			m_numItf = n;
+
+			m_vec.resize(n * n);
+			m_vec.set(1.0);
+			m_master.clear();
+			m_slave.clear();
+
+			if(rank > 0){
+				IndexLayout::Interface& itf = m_slave.interface(rank - 1);
+				for(size_t i = 0; i < n; ++i) itf.push_back(i);
+			}
+			if(rank < pcl::NumProcs() - 1){
+				IndexLayout::Interface& itf = m_master.interface(rank + 1);
+				for(size_t i = 0; i < n; ++i) itf.push_back((n - 1) * n + i);
+			}
+		}
+
+		virtual void run()
+		{
+			ComPol_VecAdd<vector_type> cpAdd(&m_vec);
+			m_com.send_data(m_slave, cpAdd);
+			m_com.receive_data(m_master, cpAdd);
+			m_com.communicate();
+
+			ComPol_VecCopy<vector_type> cpCopy(&m_vec);
+			m_com.send_data(m_master, cpCopy);
+			m_com.receive_data(m_slave, cpCopy);
+			m_com.communicate();
+		}
+
+		virtual void report(BenchmarkResult& res)
+		{
+			res.add_param("interfaceSize", (number)m_numItf);
+			res.add_metric("bytesPerInterface", 2 * m_numItf * sizeof(double));
+		}
+
+		virtual void teardown()
+		{
+			m_master.clear();
+			m_slave.clear();
+			m_vec.resize(0);
+		}
+
+	protected:
+		size_t		m_numItf;
+		vector_type	m_vec;
+		IndexLayout	m_master, m_slave;
+		pcl::InterfaceCommunicator<IndexLayout>	m_com;
+};
+#endif
+
+
+void RegisterAlgebraBenchmarks(BenchmarkSuite& suite)
+{
+	suite.add(make_sp(new MatrixAssemblyBench(false)));
+	suite.add(make_sp(new MatrixAssemblyBench(true)));
+	suite.add(make_sp(new SpMVBench<CPUAlgebra>("spmv_cpu1")));
+	suite.add(make_sp(new SpMVBench<CPUBlockAlgebra<3> >("spmv_cpu3")));
+	suite.add(make_sp(new PreconditionerSweepBench<GaussSeidel<CPUAlgebra> >("gs_sweep")));
+	suite.add(make_sp(new PreconditionerSweepBench<ILU<CPUAlgebra> >("ilu_sweep")));
+#ifdef UG_PARALLEL
+	suite.add(make_sp(new HaloExchangeBench()));
+#endif
+}
+
+}//	end of namespace
+}//	end of namespace
@@ -0,0 +1,475 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <algorithm>
+#include "benchmark.h"
+#include "bench_util.h"
+#include "common/error.h"
+#include "common/stopwatch.h"
+#include "common/util/file_util.h"
+
+#ifdef UG_DIM_2
+#include "lib_algebra/cpu_algebra_types.h"
+#include "lib_disc/domain.h"
+#include "lib_disc/function_spaces/approximation_space.h"
+#include "lib_disc/function_spaces/grid_function.h"
+#include "lib_disc/spatial_disc/domain_disc.h"
+#include "lib_disc/spatial_disc/elem_disc/elem_disc_interface.h"
+#include "lib_disc/spatial_disc/disc_util/fv1_geom.h"
+#include "lib_disc/spatial_disc/disc_util/geom_provider.h"
+#include "lib_disc/spatial_disc/constraints/dirichlet_boundary/lagrange_dirichlet_boundary.h"
+#include "lib_disc/operator/linear_operator/assembled_linear_operator.h"
+#include "lib_disc/operator/linear_operator/multi_grid_solver/mg_solver.h"
+#include "lib_disc/io/vtkoutput.h"
+#include "lib_grid/refinement/global_multi_grid_refiner.h"
+#include "lib_algebra/operator/preconditioner/gauss_seidel.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+	#include "lib_grid/parallelization/parallel_refinement/parallel_refinement.h"
+#endif
+#endif
+
+using namespace std;
+
+namespace ug{
+namespace bench{
+
+#ifdef UG_DIM_2
+
+////////////////////////////////////////////////////////////////////////////////
+//	FV1 discretization of the poisson problem
+////////////////////////////////////////////////////////////////////////////////
+
+///	vertex centered finite volume discretization of -laplace(u) = f
+/**	The convection diffusion discretizations are plugins and thus not
+ * available in ugcore. This minimal element discretization follows the same
+ * structure (registered assemble functions per element type, FV1Geometry
+ * from the GeomProvider), so that the assembling cost is representative.*/
+template <typename TDomain>
+class BenchPoissonFV1 : public IElemDisc<TDomain>
+{
+	private:
+		typedef IElemDisc<TDomain> base_type;
+		typedef BenchPoissonFV1<TDomain> this_type;
+
+	public:
+		static const int dim = base_type::dim;
+
+		BenchPoissonFV1(const char* functions, const char* subsets,
+						number source = 1.0)
+			: base_type(functions, subsets), m_source(source)
+		{
+			register_func<Triangle, FV1Geometry<Triangle, dim> >();
+			register_func<Quadrilateral, FV1Geometry<Quadrilateral, dim> >();
+		}
+
+		virtual void prepare_setting(const std::vector<LFEID>& vLfeID,
+									 bool bNonRegularGrid)
+		{
+			UG_COND_THROW(bNonRegularGrid,
+						  "BenchPoissonFV1: Hanging nodes not supported.");
+			UG_COND_THROW(vLfeID.size() != 1,
+						  "BenchPoissonFV1: Need exactly 1 function.");
+			UG_COND_THROW(vLfeID[0].order() != 1 || vLfeID[0].type() != LFEID::LAGRANGE,
+						  "BenchPoissonFV1: Only 1st order Lagrange supported.");
+		}
+
+	protected:
+		template <typename TElem, typename TFVGeom>
+		void prep_elem_loop(const ReferenceObjectID roid, const int si)	{}
+
+		template <typename TElem, typename TFVGeom>
+		void fsh_elem_loop()	{}
+
+		template <typename TElem, typename TFVGeom>
+		void prep_elem(const LocalVector& u, GridObject* elem,
+					   const ReferenceObjectID roid,
+					   const MathVector<dim> vCornerCoords[])
+		{
+			static TFVGeom& geo = GeomProvider<TFVGeom>::get();
+			try{
+				geo.update(elem, vCornerCoords, &(this->subset_handler()));
+			}
+			UG_CATCH_THROW("BenchPoissonFV1::prep_elem: "
+							"Cannot update Finite Volume Geometry.");
+		}
+
+		template <typename TElem, typename TFVGeom>
+		void add_jac_A_elem(LocalMatrix& J, const LocalVector& u,
+							GridObject* elem, const MathVector<dim> vCornerCoords[])
+		{
+			const static TFVGeom& geo = GeomProvider<TFVGeom>::get();
+			for(size_t ip = 0; ip < geo.num_scvf(); ++ip){
+				const typename TFVGeom::SCVF& scvf = geo.scvf(ip);
+				for(size_t sh = 0; sh < scvf.num_sh(); ++sh){
+					const number flux = VecDot(scvf.global_grad(sh), scvf.normal());
+					J(0, scvf.from(), 0, sh) -= flux;
+					J(0, scvf.to()  , 0, sh) += flux;
+				}
+			}
+		}
+
+		template <typename TElem, typename TFVGeom>
+		void add_def_A_elem(LocalVector& d, const LocalVector& u,
+							GridObject* elem, const MathVector<dim> vCornerCoords[])
+		{
+			const static TFVGeom& geo = GeomProvider<TFVGeom>::get();
+			MathVector<dim> grad;
+			for(size_t ip = 0; ip < geo.num_scvf(); ++ip){
+				const typename TFVGeom::SCVF& scvf = geo.scvf(ip);
+				VecSet(grad, 0.0);
+				for(size_t sh = 0; sh < scvf.num_sh(); ++sh)
+					VecScaleAppend(grad, u(0, sh), scvf.global_grad(sh));
+
+				const number flux = VecDot(grad, scvf.normal());
+				d(0, scvf.from()) -= flux;
+				d(0, scvf.to()  ) += flux;
+			}
+		}
+
+		template <typename TElem, typename TFVGeom>
+		void add_rhs_elem(LocalVector& d, GridObject* elem,
+						  const MathVector<dim> vCornerCoords[])
+		{
+			const static TFVGeom& geo = GeomProvider<TFVGeom>::get();
+			for(size_t ip = 0; ip < geo.num_scv(); ++ip){
+				const typename TFVGeom::SCV& scv = geo.scv(ip);
+				d(0, scv.node_id()) += m_source * scv.volume();
+			}
+		}
+
+		template <typename TElem, typename TFVGeom>
+		void register_func()
+		{
+			ReferenceObjectID id = geometry_traits<TElem>::REFERENCE_OBJECT_ID;
+			typedef this_type T;
+
+			this->clear_add_fct(id);
+			this->set_prep_elem_loop_fct(id, &T::template prep_elem_loop<TElem, TFVGeom>);
+			this->set_prep_elem_fct(	 id, &T::template prep_elem<TElem, TFVGeom>);
+			this->set_fsh_elem_loop_fct( id, &T::template fsh_elem_loop<TElem, TFVGeom>);
+			this->set_add_jac_A_elem_fct(id, &T::template add_jac_A_elem<TElem, TFVGeom>);
+			this->set_add_def_A_elem_fct(id, &T::template add_def_A_elem<TElem, TFVGeom>);
+			this->set_add_rhs_elem_fct(	 id, &T::template add_rhs_elem<TElem, TFVGeom>);
+		}
+
+	protected:
+		number m_source;
+};
+
+
+///	domain, approximation space and discretization of the poisson problem
+/**	The generated unit square with numCoarseCells cells per direction is
+ * refined numRefs times. Homogeneous dirichlet values are used on the
+ * boundary. In parallel runs, each process holds its own copy of the mesh.*/
+class PoissonProblem
+{
+	public:
+		typedef CPUAlgebra algebra_type;
+		typedef CPUAlgebra::matrix_type matrix_type;
+		typedef CPUAlgebra::vector_type vector_type;
+		typedef ApproximationSpace<Domain2d> approx_space_type;
+		typedef DomainDiscretization<Domain2d, CPUAlgebra> domain_disc_type;
+		typedef GridFunction<Domain2d, CPUAlgebra> grid_function_type;
+
+		void create(int numCoarseCells, int numRefs)
+		{
+			clear();
+			spDom = make_sp(new Domain2d());
+			CreateUnitSquare(*spDom, numCoarseCells);
+
+			if(numRefs > 0){
+				SmartPtr<IRefiner> spRefiner;
+			#ifdef UG_PARALLEL
+				if(pcl::NumProcs() > 1)
+					spRefiner = make_sp(new ParallelGlobalRefiner_MultiGrid(
+											*spDom->distributed_grid_manager(),
+											spDom->refinement_projector()));
+				else
+			#endif
+					spRefiner = make_sp(new GlobalMultiGridRefiner(
+											*spDom->grid(),
+											spDom->refinement_projector()));
+				for(int i = 0; i < numRefs; ++i)
+					spRefiner->refine();
+			}
+
+			spApprox = make_sp(new approx_space_type(spDom,
+									AlgebraType(AlgebraType::CPU, 1)));
+			spApprox->add("u", "Lagrange", 1);
+			spApprox->init_levels();
+			spApprox->init_top_surface();
+
+			spDomDisc = make_sp(new domain_disc_type(spApprox));
+			SmartPtr<IElemDisc<Domain2d> > spElemDisc
+					= make_sp(new BenchPoissonFV1<Domain2d>("u", "Inner"));
+			spDomDisc->add(spElemDisc);
+
+			SmartPtr<DirichletBoundary<Domain2d, CPUAlgebra> > spDirichlet
+					= make_sp(new DirichletBoundary<Domain2d, CPUAlgebra>());
+			spDirichlet->add(0.0, "u", "Boundary");
+			spDomDisc->add(SmartPtr<IDomainConstraint<Domain2d, CPUAlgebra> >(spDirichlet));
+		}
+
+		void clear()
+		{
+			spDomDisc = SPNULL;
+			spApprox = SPNULL;
+			spDom = SPNULL;
+		}
+
+		SmartPtr<Domain2d>			spDom;
+		SmartPtr<approx_space_type>	spApprox;
+		SmartPtr<domain_disc_type>	spDomDisc;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	FV1 assembly
+////////////////////////////////////////////////////////////////////////////////
+
+///	assembly of matrix and right hand side of the FV1 poisson problem
+class FV1AssemblyBench : public IBenchmark
+{
+	public:
+		typedef PoissonProblem::matrix_type matrix_type;
+		typedef PoissonProblem::grid_function_type grid_function_type;
+
+		FV1AssemblyBench() : m_numCells(0) {}
+
+		virtual const char* name() const	{return "fv1_assembly";}
+		virtual const char* group() const	{return "disc";}
+
+		virtual void setup(int size)
+		{
+			m_numCells = size;
+			m_problem.create(m_numCells, 0);
+			m_spRhs = make_sp(new grid_function_type(m_problem.spApprox));
+			m_spMat = make_sp(new matrix_type());
+		}
+
+		virtual void run()
+		{
+			m_problem.spDomDisc->assemble_linear(*m_spMat, *m_spRhs);
+		}
+
+		virtual void report(BenchmarkResult& res)
+		{
+			res.add_param("cells", (number)m_numCells * m_numCells);
+			res.add_metric("dofs", (number)m_spRhs->size());
+			res.add_metric("nnz", (number)m_spMat->total_num_connections());
+		}
+
+		virtual void teardown()
+		{
+			m_spMat = SPNULL;
+			m_spRhs = SPNULL;
+			m_problem.clear();
+		}
+
+	protected:
+		int								m_numCells;
+		PoissonProblem					m_problem;
+		SmartPtr<grid_function_type>	m_spRhs;
+		SmartPtr<matrix_type>			m_spMat;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	geometric multigrid
+////////////////////////////////////////////////////////////////////////////////
+
+///	one geometric multigrid V-cycle for the FV1 poisson problem
+/**	The hierarchy consists of 5 levels, the finest one has (about) size x size
+ * cells. Gauss-Seidel with two pre- and postsmoothing steps and LU on the base
+ * level are used. The level matrices are assembled in setup.*/
+class GMGCycleBench : public IBenchmark
+{
+	public:
+		typedef PoissonProblem::algebra_type algebra_type;
+		typedef PoissonProblem::grid_function_type grid_function_type;
+		typedef AssembledLinearOperator<algebra_type> operator_type;
+		typedef AssembledMultiGridCycle<Domain2d, algebra_type> gmg_type;
+
+		GMGCycleBench() : m_numCoarseCells(0), m_numRefs(4), m_tInit(0) {}
+
+		virtual const char* name() const	{return "gmg_vcycle";}
+		virtual const char* group() const	{return "disc";}
+
+		virtual void setup(int size)
+		{
+			m_numCoarseCells = std::max(2, size >> m_numRefs);
+			m_problem.create(m_numCoarseCells, m_numRefs);
+
+			m_spU = make_sp(new grid_function_type(m_problem.spApprox));
+			m_spB = make_sp(new grid_function_type(m_problem.spApprox));
+			m_spC = make_sp(new grid_function_type(m_problem.spApprox));
+			m_spD = make_sp(new grid_function_type(m_problem.spApprox));
+			m_spU->set(0.0);
+
+			m_spOp = make_sp(new operator_type(m_problem.spDomDisc,
+											   m_spU->dof_distribution()->grid_level()));
+			m_spOp->init_op_and_rhs(*m_spB);
+
+			m_spGMG = make_sp(new gmg_type(m_problem.spApprox));
+			m_spGMG->set_discretization(m_problem.spDomDisc);
+			m_spGMG->set_base_level(0);
+			m_spGMG->set_smoother(make_sp(new GaussSeidel<algebra_type>()));
+			m_spGMG->set_num_presmooth(2);
+			m_spGMG->set_num_postsmooth(2);
+			m_spGMG->set_cycle_type(1);
+
+			const double tStart = get_clock_s();
+			UG_COND_THROW(!m_spGMG->init(m_spOp, *m_spU),
+						  "GMGCycleBench: Cannot initialize multigrid.");
+			m_tInit = get_clock_s() - tStart;
+		}
+
+		virtual void prepare_run()
+		{
+			m_spD->assign(*m_spB);
+			m_spC->set(0.0);
+		}
+
+		virtual void run()
+		{
+			UG_COND_THROW(!m_spGMG->apply(*m_spC, *m_spD),
+						  "GMGCycleBench: Multigrid cycle failed.");
+		}
+
+		virtual void report(BenchmarkResult& res)
+		{
+			res.add_param("coarseCells", (number)m_numCoarseCells * m_numCoarseCells);
+			res.add_param("numRefs", m_numRefs);
+			res.add_metric("dofs", (number)m_spU->size());
+			res.add_metric("initTime", m_tInit);
+
+		//	defect reduction of a single cycle applied to the rhs
+			prepare_run();
+			run();
+			m_spD->assign(*m_spB);
+			m_spOp->apply_sub(*m_spD, *m_spC);
+			const number n0 = m_spB->norm();
+			if(n0 > 0)
+				res.add_metric("defectReduction", m_spD->norm() / n0);
+		}
+
+		virtual void teardown()
+		{
+			m_spGMG = SPNULL;
+			m_spOp = SPNULL;
+			m_spU = m_spB = m_spC = m_spD = SPNULL;
+			m_problem.clear();
+		}
+
+	protected:
+		int								m_numCoarseCells;
+		int								m_numRefs;
+		number							m_tInit;
+		PoissonProblem					m_problem;
+		SmartPtr<grid_function_type>	m_spU, m_spB, m_spC, m_spD;
+		SmartPtr<operator_type>			m_spOp;
+		SmartPtr<gmg_type>				m_spGMG;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	VTK output
+////////////////////////////////////////////////////////////////////////////////
+
+///	writes a grid function on a generated size x size mesh to vtu
+class VTKOutputBench : public IBenchmark
+{
+	public:
+		typedef PoissonProblem::grid_function_type grid_function_type;
+
+		VTKOutputBench() : m_numCells(0) {}
+
+		virtual const char* name() const	{return "vtk_output";}
+		virtual const char* group() const	{return "disc";}
+
+		virtual void setup(int size)
+		{
+			m_numCells = size;
+			m_problem.create(m_numCells, 0);
+			m_spU = make_sp(new grid_function_type(m_problem.spApprox));
+			m_spU->set_random(0.0, 1.0);
+			m_spVTK = make_sp(new VTKOutput<2>());
+			m_filename = ScratchFile(name(), "");
+		}
+
+		virtual void run()
+		{
+			m_spVTK->print(m_filename.c_str(), *m_spU, false);
+		}
+
+		virtual void report(BenchmarkResult& res)
+		{
+			res.add_param("cells", (number)m_numCells * m_numCells);
+			res.add_metric("dofs", (number)m_spU->size());
+			const string vtu = m_filename + ".vtu";
+			if(FileExists(vtu.c_str()))
+				res.add_metric("fileSize", (number)FileSize(vtu.c_str()));
+		}
+
+		virtual void teardown()
+		{
+			m_spVTK = SPNULL;
+			m_spU = SPNULL;
+			m_problem.clear();
+			RemoveScratchFiles(name());
+		}
+
+	protected:
+		int								m_numCells;
+		std::string						m_filename;
+		PoissonProblem					m_problem;
+		SmartPtr<grid_function_type>	m_spU;
+		SmartPtr<VTKOutput<2> >			m_spVTK;
+};
+
+#endif
+
+
+void RegisterDiscBenchmarks(BenchmarkSuite& suite)
+{
+#ifdef UG_DIM_2
+	suite.add(make_sp(new FV1AssemblyBench()));
+	suite.add(make_sp(new GMGCycleBench()));
+	suite.add(make_sp(new VTKOutputBench()));
+#endif
+}
+
+}//	end of namespace
+}//	end of namespace
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <algorithm>
+#include "benchmark.h"
+#include "bench_util.h"
+#include "common/error.h"
+#include "common/util/file_util.h"
+#include "lib_disc/domain.h"
+#include "lib_disc/domain_util.h"
+#include "lib_grid/refinement/global_multi_grid_refiner.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+	#include "lib_grid/parallelization/parallel_refinement/parallel_refinement.h"
+#endif
+
+using namespace std;
+
+namespace ug{
+namespace bench{
+
+///	creates a global refiner for the domain (parallel if required)
+static SmartPtr<IRefiner> CreateGlobalRefiner(Domain2d& dom)
+{
+	#ifdef UG_PARALLEL
+		if(pcl::NumProcs() > 1){
+			return SmartPtr<IRefiner>(
+					new ParallelGlobalRefiner_MultiGrid(
+							*dom.distributed_grid_manager(),
+							dom.refinement_projector()));
+		}
+	#endif
+
+	return SmartPtr<IRefiner>(
+				new GlobalMultiGridRefiner(*dom.grid(),
+										   dom.refinement_projector()));
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	UGX load
+////////////////////////////////////////////////////////////////////////////////
+
+///	loads a generated size x size quadrilateral mesh from a ugx file
+/**	In parallel runs, each process loads its own copy of the file.*/
+class UGXLoadBench : public IBenchmark
+{
+	public:
+		UGXLoadBench() : m_numCells(0) {}
+
+		virtual const char* name() const	{return "ugx_load";}
+		virtual const char* group() const	{return "grid";}
+
+		virtual void setup(int size)
+		{
+			m_numCells = size;
+			m_filename = ScratchFile(name(), "ugx");
+
+			Domain2d dom;
+			CreateUnitSquare(dom, m_numCells);
+			SaveDomain(dom, m_filename.c_str());
+		}
+
+		virtual void prepare_run()
+		{
+			m_spDom = make_sp(new Domain2d());
+		}
+
+		virtual void run()
+		{
+			LoadDomain(*m_spDom, m_filename.c_str());
+		}
+
+		virtual void report(BenchmarkResult& res)
+		{
+			res.add_param("cells", (number)m_numCells * m_numCells);
+			res.add_metric("fileSize", (number)FileSize(m_filename.c_str()));
+			if(m_spDom.valid()){
+				res.add_metric("vertices", (number)m_spDom->grid()->num_vertices());
+				res.add_metric("faces", (number)m_spDom->grid()->num_faces());
+			}
+		}
+
+		virtual void teardown()
+		{
+			m_spDom = SPNULL;
+			RemoveScratchFiles(name());
+		}
+
+	protected:
+		int					m_numCells;
+		std::string			m_filename;
+		SmartPtr<Domain2d>	m_spDom;
+};
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	global refinement
+////////////////////////////////////////////////////////////////////////////////
+
+///	global refinement of a generated quadrilateral mesh
+/**	The coarse mesh has size/8 cells per direction and is refined three times,
+ * so that the finest level has (about) size x size cells.*/
+class GlobalRefinementBench : public IBenchmark
+{
+	public:
+		GlobalRefinementBench() : m_numCoarseCells(0), m_numRefs(3) {}
+
+		virtual const char* name() const	{return "global_refinement";}
+		virtual const char* group() const	{return "grid";}
+
+		virtual void setup(int size)
+		{
+			m_numCoarseCells = std::max(1, size >> m_numRefs);
+		}
+
+		virtual void prepare_run()
+		{
+			m_spRefiner = SPNULL;
+			m_spDom = make_sp(new Domain2d());
+			CreateUnitSquare(*m_spDom, m_numCoarseCells);
+			m_spRefiner = CreateGlobalRefiner(*m_spDom);
+		}
+
+		virtual void run()
+		{
+			for(int i = 0; i < m_numRefs; ++i)
+				m_spRefiner->refine();
+		}
+
+		virtual void report(BenchmarkResult& res)
+		{
+			res.add_param("coarseCells", (number)m_numCoarseCells * m_numCoarseCells);
+			res.add_param("numRefs", m_numRefs);
+			if(m_spDom.valid()){
+				MultiGrid& mg = *m_spDom->grid();
+				res.add_metric("levels", (number)mg.num_levels());
+				res.add_metric("facesTopLevel",
+							   (number)mg.num<Face>(mg.top_level()));
+				res.add_metric("elementsTotal", (number)mg.num_faces());
+			}
+		}
+
+		virtual void teardown()
+		{
+			m_spRefiner = SPNULL;
+			m_spDom = SPNULL;
+		}
+
+	protected:
+		int					m_numCoarseCells;
+		int					m_numRefs;
+		SmartPtr<Domain2d>	m_spDom;
+		SmartPtr<IRefiner>	m_spRefiner;
+};
+
+
+void RegisterGridBenchmarks(BenchmarkSuite& suite)
+{
+	suite.add(make_sp(new UGXLoadBench()));
+	suite.add(make_sp(new GlobalRefinementBench()));
+}
+
+}//	end of namespace
+}//	end of namespace
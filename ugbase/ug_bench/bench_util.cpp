@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <cstdio>
+#include <sstream>
+#include <vector>
+#include "bench_util.h"
+#include "common/error.h"
+#include "common/util/file_util.h"
+#include "lib_grid/algorithms/geom_obj_util/edge_util.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl_base.h"
+#endif
+
+using namespace std;
+
+namespace ug{
+namespace bench{
+
+static string& ScratchDirectoryRef()
+{
+	static string dir(GetTmpPath());
+	return dir;
+}
+
+void SetScratchDirectory(const string& dir)
+{
+	UG_COND_THROW(!DirectoryExists(dir.c_str()),
+				  "SetScratchDirectory: Directory '" << dir << "' does not exist.");
+	ScratchDirectoryRef() = dir;
+}
+
+const string& ScratchDirectory()
+{
+	return ScratchDirectoryRef();
+}
+
+static string ScratchPrefix(const char* name)
+{
+	return string("ugbench_") + name;
+}
+
+string ScratchFile(const char* name, const char* ext)
+{
+	stringstream ss;
+	ss << ScratchDirectory() << "/" << ScratchPrefix(name);
+#ifdef UG_PARALLEL
+	if(pcl::NumProcs() > 1)
+		ss << "_p" << pcl::ProcRank();
+#endif
+	if(ext && *ext)
+		ss << "." << ext;
+	return ss.str();
+}
+
+void RemoveScratchFiles(const char* name)
+{
+	const string prefix = ScratchPrefix(name);
+	vector<string> vFile;
+	if(!GetFilesInDirectory(vFile, ScratchDirectory().c_str()))
+		return;
+
+	for(size_t i = 0; i < vFile.size(); ++i){
+		if(vFile[i].compare(0, prefix.size(), prefix) == 0)
+			remove((ScratchDirectory() + "/" + vFile[i]).c_str());
+	}
+}
+
+void CreateUnitSquare(Domain2d& dom, int numCells)
+{
+	UG_COND_THROW(numCells < 1, "CreateUnitSquare: numCells has to be positive.");
+
+	MultiGrid& mg = *dom.grid();
+	MGSubsetHandler& sh = *dom.subset_handler();
+	Domain2d::position_accessor_type& aaPos = dom.position_accessor();
+
+	mg.message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STARTS));
+
+	const int n = numCells + 1;
+	const number h = 1.0 / (number)numCells;
+	vector<Vertex*> vVrt(n * n);
+	for(int j = 0; j < n; ++j){
+		for(int i = 0; i < n; ++i){
+			Vertex* vrt = *mg.create<RegularVertex>();
+			aaPos[vrt] = vector2(h * i, h * j);
+			if(i == 0 || j == 0 || i == n - 1 || j == n - 1)
+				sh.assign_subset(vrt, 1);
+			vVrt[j * n + i] = vrt;
+		}
+	}
+
+	for(int j = 0; j < numCells; ++j){
+		for(int i = 0; i < numCells; ++i){
+			Face* f = *mg.create<Quadrilateral>(
+						QuadrilateralDescriptor(vVrt[j * n + i],
+												vVrt[j * n + i + 1],
+												vVrt[(j + 1) * n + i + 1],
+												vVrt[(j + 1) * n + i]));
+			sh.assign_subset(f, 0);
+		}
+	}
+
+	for(EdgeIterator iter = mg.begin<Edge>(); iter != mg.end<Edge>(); ++iter){
+		if(IsBoundaryEdge2D(mg, *iter))
+			sh.assign_subset(*iter, 1);
+		else
+			sh.assign_subset(*iter, 0);
+	}
+
+	sh.set_subset_name("Inner", 0);
+	sh.set_subset_name("Boundary", 1);
+
+	mg.message_hub()->post_message(GridMessage_Creation(GMCT_CREATION_STOPS));
+}
+
+}//	end of namespace
+}//	end of namespace
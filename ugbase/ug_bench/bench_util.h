@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG_BENCH__BENCH_UTIL__
+#define __H__UG_BENCH__BENCH_UTIL__
+
+#include <string>
+#include "lib_disc/domain.h"
+
+namespace ug{
+namespace bench{
+
+/// \addtogroup ugbase_ugbench
+/// \{
+
+///	sets the directory in which benchmarks write temporary files
+void SetScratchDirectory(const std::string& dir);
+
+///	returns the directory in which benchmarks write temporary files
+const std::string& ScratchDirectory();
+
+///	returns a file name in the scratch directory, unique for this process
+/**	The returned name has the form "<scratch>/ugbench_<name>[_p<rank>].<ext>".
+ * Pass an empty extension to obtain a base name without extension.*/
+std::string ScratchFile(const char* name, const char* ext);
+
+///	removes all files from the scratch directory created for 'name'
+void RemoveScratchFiles(const char* name);
+
+///	creates a structured mesh of numCells x numCells quadrilaterals on [0,1]^2
+/**	Faces are assigned to subset 0 ("Inner"), boundary vertices and edges to
+ * subset 1 ("Boundary"). The domain is expected to be empty. The grid
+ * creation messages are posted, so that the domain updates its subset
+ * information just as if the mesh had been loaded from a file.*/
+void CreateUnitSquare(Domain2d& dom, int numCells);
+
+/// \}
+
+}//	end of namespace
+}//	end of namespace
+
+#endif
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include "benchmark.h"
+#include "common/log.h"
+#include "common/error.h"
+#include "common/stopwatch.h"
+#include "common/util/string_util.h"
+#include "compile_info/compile_info.h"
+
+#ifdef UG_PARALLEL
+	#include "pcl/pcl.h"
+#endif
+
+using namespace std;
+
+namespace ug{
+namespace bench{
+
+////////////////////////////////////////////////////////////////////////////////
+//	helpers
+////////////////////////////////////////////////////////////////////////////////
+
+static int NumProcesses()
+{
+#ifdef UG_PARALLEL
+	return pcl::NumProcs();
+#else
+	return 1;
+#endif
+}
+
+static bool IsOutputProcess()
+{
+#ifdef UG_PARALLEL
+	return pcl::ProcRank() == 0;
+#else
+	return true;
+#endif
+}
+
+static void Synchronize()
+{
+#ifdef UG_PARALLEL
+	pcl::ProcessCommunicator().barrier();
+#endif
+}
+
+///	returns the maximum of the passed time over all processes
+static number MaxOverProcesses(number t)
+{
+#ifdef UG_PARALLEL
+	return pcl::ProcessCommunicator().allreduce(t, PCL_RO_MAX);
+#else
+	return t;
+#endif
+}
+
+///	returns true on all processes, iff b is true on all processes
+static bool AllProcessesTrue(bool b)
+{
+#ifdef UG_PARALLEL
+	return pcl::AllProcsTrue(b);
+#else
+	return b;
+#endif
+}
+
+static string JSONEscape(const string& str)
+{
+	stringstream ss;
+	for(size_t i = 0; i < str.size(); ++i){
+		const char c = str[i];
+		switch(c){
+			case '"':	ss << "\\\""; break;
+			case '\\':	ss << "\\\\"; break;
+			case '\n':	ss << "\\n"; break;
+			case '\t':	ss << "\\t"; break;
+			default:
+				if((unsigned char)c < 0x20)
+					ss << "\\u" << hex << setw(4) << setfill('0') << (int)c
+					   << dec << setfill(' ');
+				else
+					ss << c;
+		}
+	}
+	return ss.str();
+}
+
+///	writes a number such that the output is valid JSON (no nan/inf)
+static void WriteJSONNumber(ostream& out, number val)
+{
+	if(val != val || fabs(val) > numeric_limits<number>::max())
+		out << "null";
+	else
+		out << val;
+}
+
+static void WriteJSONPairs(ostream& out,
+						   const vector<pair<string, number> >& vPair)
+{
+	out << "{";
+	for(size_t i = 0; i < vPair.size(); ++i){
+		if(i > 0) out << ", ";
+		out << "\"" << JSONEscape(vPair[i].first) << "\": ";
+		WriteJSONNumber(out, vPair[i].second);
+	}
+	out << "}";
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+//	BenchmarkSuite
+////////////////////////////////////////////////////////////////////////////////
+
+BenchmarkSuite::BenchmarkSuite() :
+	m_numReps(10), m_numWarmup(1), m_size(256)
+{
+}
+
+void BenchmarkSuite::add(SmartPtr<IBenchmark> bench)
+{
+	UG_COND_THROW(bench.invalid(), "BenchmarkSuite::add: invalid benchmark.");
+	m_vBench.push_back(bench);
+}
+
+void BenchmarkSuite::list() const
+{
+	UG_LOG("Registered benchmarks:\n");
+	for(size_t i = 0; i < m_vBench.size(); ++i){
+		const IBenchmark& b = *m_vBench[i];
+		UG_LOG("  " << left << setw(28) << b.name() << setw(10) << b.group()
+			   << (b.available() ? "" : "(not available)") << "\n");
+	}
+}
+
+bool BenchmarkSuite::matches(const IBenchmark& bench,
+							 const vector<string>& vFilter) const
+{
+	if(vFilter.empty()) return true;
+	for(size_t i = 0; i < vFilter.size(); ++i){
+		if(vFilter[i] == bench.group()
+		   || string(bench.name()).find(vFilter[i]) != string::npos)
+			return true;
+	}
+	return false;
+}
+
+bool BenchmarkSuite::run_benchmark(IBenchmark& bench, BenchmarkResult& res)
+{
+	res = BenchmarkResult();
+	res.name = bench.name();
+	res.group = bench.group();
+
+	bench.setup(m_size);
+
+	vector<number> vTime;
+	vTime.reserve(m_numReps);
+	for(size_t i = 0; i < m_numWarmup + m_numReps; ++i){
+		bench.prepare_run();
+		Synchronize();
+		const double tStart = get_clock_s();
+		bench.run();
+		const number t = MaxOverProcesses(get_clock_s() - tStart);
+		if(i >= m_numWarmup)
+			vTime.push_back(t);
+	}
+
+	bench.report(res);
+	bench.teardown();
+
+	if(vTime.empty()) return true;
+
+	res.numReps = vTime.size();
+	number sum = 0;
+	for(size_t i = 0; i < vTime.size(); ++i) sum += vTime[i];
+	res.tMean = sum / vTime.size();
+
+	number sqSum = 0;
+	for(size_t i = 0; i < vTime.size(); ++i)
+		sqSum += (vTime[i] - res.tMean) * (vTime[i] - res.tMean);
+	res.tStdDev = sqrt(sqSum / vTime.size());
+
+	sort(vTime.begin(), vTime.end());
+	res.tMin = vTime.front();
+	res.tMax = vTime.back();
+	const size_t mid = vTime.size() / 2;
+	res.tMedian = (vTime.size() % 2) ? vTime[mid]
+									 : 0.5 * (vTime[mid - 1] + vTime[mid]);
+	return true;
+}
+
+bool BenchmarkSuite::run(const string& filter)
+{
+	vector<string> vFilter;
+	if(!filter.empty())
+		TokenizeTrimString(filter, vFilter, ',');
+
+	m_vResult.clear();
+	bool bSuccess = true;
+	for(size_t i = 0; i < m_vBench.size(); ++i){
+		IBenchmark& bench = *m_vBench[i];
+		if(!matches(bench, vFilter)) continue;
+		if(!bench.available()){
+			UG_LOG("Skipping '" << bench.name() << "': not available.\n");
+			continue;
+		}
+
+		UG_LOG("Running '" << bench.name() << "' ... ");
+		BenchmarkResult res;
+		bool bOk = true;
+		try{
+			bOk = run_benchmark(bench, res);
+		}
+		catch(UGError& err){
+			UG_LOG("\n" << err.get_stacktrace() << "\n");
+			bOk = false;
+		}
+		catch(std::exception& ex){
+			UG_LOG("\n" << ex.what() << "\n");
+			bOk = false;
+		}
+
+	//	the result is only usable if all processes succeeded
+		if(!AllProcessesTrue(bOk)){
+			UG_LOG("FAILED.\n");
+			try{bench.teardown();}
+			catch(...){}
+			bSuccess = false;
+			continue;
+		}
+
+		UG_LOG("median " << res.tMedian << " s\n");
+		m_vResult.push_back(res);
+	}
+	return bSuccess;
+}
+
+void BenchmarkSuite::print_summary() const
+{
+	UG_LOG("\n" << left << setw(28) << "benchmark" << right
+		   << setw(14) << "min [s]" << setw(14) << "median [s]"
+		   << setw(14) << "max [s]" << "  metrics\n");
+	for(size_t i = 0; i < m_vResult.size(); ++i){
+		const BenchmarkResult& r = m_vResult[i];
+		stringstream ss;
+		for(size_t j = 0; j < r.metrics.size(); ++j)
+			ss << "  " << r.metrics[j].first << "=" << r.metrics[j].second;
+		UG_LOG(left << setw(28) << r.name << right << scientific
+			   << setprecision(4) << setw(14) << r.tMin
+			   << setw(14) << r.tMedian << setw(14) << r.tMax
+			   << ss.str() << "\n");
+	}
+	UG_LOG(resetiosflags(ios::floatfield) << setprecision(6));
+}
+
+bool BenchmarkSuite::write_json(const char* filename) const
+{
+	if(!IsOutputProcess()) return true;
+
+	ofstream out(filename);
+	if(!out){
+		UG_LOG("ERROR in BenchmarkSuite::write_json: Cannot open '"
+			   << filename << "'.\n");
+		return false;
+	}
+
+	out << setprecision(10);
+	out << "{\n";
+	out << "  \"revision\": \"" << JSONEscape(UGSvnRevision()) << "\",\n";
+	out << "  \"buildHost\": \"" << JSONEscape(UGBuildHost()) << "\",\n";
+	out << "  \"compileDate\": \"" << JSONEscape(UGCompileDate()) << "\",\n";
+	out << "  \"numProcs\": " << NumProcesses() << ",\n";
+	out << "  \"size\": " << m_size << ",\n";
+	out << "  \"repetitions\": " << m_numReps << ",\n";
+	out << "  \"warmup\": " << m_numWarmup << ",\n";
+	out << "  \"benchmarks\": [";
+	for(size_t i = 0; i < m_vResult.size(); ++i){
+		const BenchmarkResult& r = m_vResult[i];
+		out << (i > 0 ? ",\n" : "\n");
+		out << "    {\"name\": \"" << JSONEscape(r.name) << "\", "
+			<< "\"group\": \"" << JSONEscape(r.group) << "\", "
+			<< "\"reps\": " << r.numReps << ",\n";
+		out << "     \"time\": {\"min\": "; WriteJSONNumber(out, r.tMin);
+		out << ", \"median\": "; WriteJSONNumber(out, r.tMedian);
+		out << ", \"mean\": "; WriteJSONNumber(out, r.tMean);
+		out << ", \"max\": "; WriteJSONNumber(out, r.tMax);
+		out << ", \"stddev\": "; WriteJSONNumber(out, r.tStdDev);
+		out << "},\n     \"params\": "; WriteJSONPairs(out, r.params);
+		out << ",\n     \"metrics\": "; WriteJSONPairs(out, r.metrics);
+		out << "}";
+	}
+	out << "\n  ]\n}\n";
+
+	if(!out){
+		UG_LOG("ERROR in BenchmarkSuite::write_json: Writing '"
+			   << filename << "' failed.\n");
+		return false;
+	}
+	return true;
+}
+
+}//	end of namespace
+}//	end of namespace
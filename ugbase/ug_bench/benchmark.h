@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#ifndef __H__UG_BENCH__BENCHMARK__
+#define __H__UG_BENCH__BENCHMARK__
+
+#include <string>
+#include <vector>
+#include <utility>
+#include "common/types.h"
+#include "common/util/smart_pointer.h"
+
+namespace ug{
+namespace bench{
+
+/// \addtogroup ugbase_ugbench
+/// \{
+
+///	timings and derived quantities of one benchmark run
+/**	All times are in seconds. In parallel runs, each repetition is timed on
+ * every process and the maximum over all processes is stored, since the
+ * slowest process determines the runtime of the kernel.*/
+struct BenchmarkResult
+{
+	BenchmarkResult() : numReps(0), tMin(0), tMax(0), tMean(0), tMedian(0),
+						tStdDev(0)	{}
+
+	std::string	name;
+	std::string	group;
+	size_t		numReps;
+	number		tMin;
+	number		tMax;
+	number		tMean;
+	number		tMedian;
+	number		tStdDev;
+
+///	input parameters of the benchmark (e.g. problem size)
+	std::vector<std::pair<std::string, number> >	params;
+
+///	derived quantities (e.g. nnz, flops or bytes moved per run)
+	std::vector<std::pair<std::string, number> >	metrics;
+
+	void add_param(const std::string& key, number val)
+		{params.push_back(std::make_pair(key, val));}
+	void add_metric(const std::string& key, number val)
+		{metrics.push_back(std::make_pair(key, val));}
+};
+
+
+///	interface for a single benchmark
+/**	A benchmark is set up once (untimed), then prepare_run and run are called
+ * for a number of warmup and timed repetitions. Only run is timed. The
+ * problem size is controlled by a single integer whose meaning is defined by
+ * the benchmark (e.g. number of cells per direction of a generated mesh).*/
+class IBenchmark
+{
+	public:
+		virtual ~IBenchmark()	{}
+
+	///	unique name of the benchmark
+		virtual const char* name() const = 0;
+
+	///	group of the benchmark (e.g. "algebra", "disc", "grid", "pcl")
+		virtual const char* group() const = 0;
+
+	///	returns false, if the benchmark can not run in the current setting
+		virtual bool available() const	{return true;}
+
+	///	creates all data needed for the timed runs (not timed)
+		virtual void setup(int size) = 0;
+
+	///	called before each repetition (not timed)
+		virtual void prepare_run()	{}
+
+	///	one timed repetition
+		virtual void run() = 0;
+
+	///	adds parameters and metrics to the result (called after the runs)
+		virtual void report(BenchmarkResult&)	{}
+
+	///	releases all data created in setup
+		virtual void teardown()	{}
+};
+
+
+///	collection of benchmarks with timing, filtering and JSON output
+class BenchmarkSuite
+{
+	public:
+		BenchmarkSuite();
+
+	///	adds a benchmark to the suite
+		void add(SmartPtr<IBenchmark> bench);
+
+	///	number of timed repetitions per benchmark
+		void set_repetitions(size_t num)	{m_numReps = num;}
+
+	///	number of untimed warmup repetitions per benchmark
+		void set_warmup(size_t num)			{m_numWarmup = num;}
+
+	///	size scale passed to IBenchmark::setup
+		void set_size(int size)				{m_size = size;}
+
+	///	prints name and group of all registered benchmarks
+		void list() const;
+
+	///	runs all benchmarks whose name or group matches one of the
+	///	comma-separated entries in filter (empty filter: all)
+	/**	Errors thrown by a benchmark are reported and the benchmark is skipped.
+	 * \returns	false if at least one benchmark failed.*/
+		bool run(const std::string& filter);
+
+	///	prints a table of all results
+		void print_summary() const;
+
+	///	writes all results to a JSON file (only on the output process)
+		bool write_json(const char* filename) const;
+
+	///	access to the results of the last run
+		const std::vector<BenchmarkResult>& results() const	{return m_vResult;}
+
+	protected:
+		bool matches(const IBenchmark& bench,
+					 const std::vector<std::string>& vFilter) const;
+		bool run_benchmark(IBenchmark& bench, BenchmarkResult& resOut);
+
+	protected:
+		std::vector<SmartPtr<IBenchmark> >	m_vBench;
+		std::vector<BenchmarkResult>		m_vResult;
+		size_t	m_numReps;
+		size_t	m_numWarmup;
+		int		m_size;
+};
+
+
+///	registers the sparse matrix, SpMV, smoother and halo exchange benchmarks
+void RegisterAlgebraBenchmarks(BenchmarkSuite& suite);
+
+///	registers the UGX load and global refinement benchmarks
+void RegisterGridBenchmarks(BenchmarkSuite& suite);
+
+///	registers the FV1 assembly, multigrid and VTK output benchmarks
+void RegisterDiscBenchmarks(BenchmarkSuite& suite);
+
+/// \}
+
+}//	end of namespace
+}//	end of namespace
+
+#endif
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2026:  G-CSC, Goethe University Frankfurt
+ * Author: agent
+ * 
+ * This file is part of UG4.
+ * 
+ * UG4 is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License version 3 (as published by the
+ * Free Software Foundation) with the following additional attribution
+ * requirements (according to LGPL/GPL v3 §7):
+ * 
+ * (1) The following notice must be displayed in the Appropriate Legal Notices
+ * of covered and combined works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (2) The following notice must be displayed at a prominent place in the
+ * terminal output of covered works: "Based on UG4 (www.ug4.org/license)".
+ * 
+ * (3) The following bibliography is recommended for citation and must be
+ * preserved in all covered files:
+ * "Reiter, S., Vogel, A., Heppner, I., Rupp, M., and Wittum, G. A massively
+ *   parallel geometric multigrid solver on hierarchically distributed grids.
+ *   Computing and visualization in science 16, 4 (2013), 151-164"
+ * "Vogel, A., Reiter, S., Rupp, M., Nägel, A., and Wittum, G. UG4 -- a novel
+ *   flexible software system for simulating pde based models on high performance
+ *   computers. Computing and visualization in science 16, 4 (2013), 165-179"
+ * 
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU Lesser General Public License for more details.
+ */
+
+
+#include <string>
+#include "ug.h"
+#include "benchmark.h"
+#include "bench_util.h"
+#include "common/log.h"
+#include "common/error.h"
+#include "common/util/parameter_parsing.h"
+#include "compile_info/compile_info.h"
+
+#ifdef UG_PARALLEL
+#include "pcl/pcl.h"
+#endif
+
+using namespace std;
+using namespace ug;
+using namespace ug::bench;
+
+/**
+ * \defgroup ugbase_ugbench UGBench
+ * \ingroup ugbase
+ * \brief benchmark suite for the core numerical kernels of ug4
+ *
+ * ugbench runs a set of micro- and meso-benchmarks on generated meshes and
+ * matrices and optionally writes the results to a JSON file, so that the
+ * performance of a build can be compared across revisions.
+ * \{
+ */
+
+static void PrintUsage()
+{
+	UG_LOG("usage: ugbench [options]\n");
+	UG_LOG("  -list:             Lists all benchmarks.\n");
+	UG_LOG("  -bench names:      Comma-separated list of benchmark names or groups\n");
+	UG_LOG("                     (algebra, disc, grid, pcl). Default: all.\n");
+	UG_LOG("  -size n:           Problem size (cells per direction). Default: 256.\n");
+	UG_LOG("  -reps n:           Number of timed repetitions. Default: 10.\n");
+	UG_LOG("  -warmup n:         Number of untimed warmup runs. Default: 1.\n");
+	UG_LOG("  -json filename:    Writes the results to the given JSON file.\n");
+	UG_LOG("  -scratch dir:      Directory for temporary files. Default: " << ScratchDirectory() << "\n");
+	UG_LOG("  -outproc id:       Sets the output-proc to id. Default is 0.\n");
+}
+
+int main(int argc, char* argv[])
+{
+	#ifdef UG_PARALLEL
+		pcl::Init(&argc, &argv);
+	#endif
+
+	int outputProc = 0;
+	ParamToInt(outputProc, "-outproc", argc, argv);
+	GetLogAssistant().set_output_process(outputProc);
+
+	UG_LOG("ugbench - ug" << UGGetVersionString() << ", head revision '"
+		   << UGSvnRevision() << "', compiled '" << UGCompileDate() << "'\n");
+	UG_LOG("Based on UG4 (www.ug4.org/license)\n\n");
+
+	if(FindParam("-help", argc, argv)){
+		PrintUsage();
+		UGFinalize();
+		return 0;
+	}
+
+	int ret = 0;
+	try{
+		InitPaths(argv[0]);
+
+		BenchmarkSuite suite;
+		RegisterAlgebraBenchmarks(suite);
+		RegisterGridBenchmarks(suite);
+		RegisterDiscBenchmarks(suite);
+
+		if(FindParam("-list", argc, argv)){
+			suite.list();
+			UGFinalize();
+			return 0;
+		}
+
+		const char* scratchDir = NULL;
+		if(ParamToString(&scratchDir, "-scratch", argc, argv))
+			SetScratchDirectory(scratchDir);
+
+		suite.set_size(ParamToInt("-size", argc, argv, 256));
+		suite.set_repetitions(ParamToInt("-reps", argc, argv, 10));
+		suite.set_warmup(ParamToInt("-warmup", argc, argv, 1));
+
+		const char* filter = "";
+		ParamToString(&filter, "-bench", argc, argv);
+
+		if(!suite.run(filter))
+			ret = 1;
+
+		suite.print_summary();
+
+		const char* jsonFile = NULL;
+		if(ParamToString(&jsonFile, "-json", argc, argv)){
+			if(suite.write_json(jsonFile))
+				{UG_LOG("\nResults written to '" << jsonFile << "'.\n");}
+			else
+				ret = 1;
+		}
+	}
+	catch(UGError& err){
+		UG_LOG("ERROR in ugbench:\n" << err.get_stacktrace());
+		ret = 1;
+	}
+
+	UGFinalize();
+	return ret;
+}
+
+/// \}